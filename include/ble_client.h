@@ -10,12 +10,50 @@
 struct ble_gap_event;
 
 typedef void (*ble_focus_cb_t)(void *ctx);
+// Camera link connected, disconnected or changed its bond state.
+typedef void (*ble_state_cb_t)(void *ctx);
+
+// GATT handles of the last fully discovered camera. Kept across deep sleep so
+// a reconnect to the same camera can skip service discovery.
+typedef struct {
+  bool valid;
+  uint8_t peer_addr_type;
+  uint8_t peer_addr[6];
+  uint16_t loc_svc_start;
+  uint16_t loc_svc_end;
+  uint16_t rem_svc_start;
+  uint16_t rem_svc_end;
+  uint16_t chr_dd11;
+  uint16_t chr_dd21;
+  uint16_t chr_dd30;
+  uint16_t chr_dd31;
+  uint16_t chr_ff02;
+  uint16_t end_ff02;
+  uint16_t cccd_ff02;
+} ble_handle_cache_t;
+
+// Time from an FF02 focus notification to the camera acknowledging the
+// location write it triggered.
+typedef struct {
+  uint32_t count;
+  uint64_t total_us;
+  uint64_t max_us;
+  uint64_t last_us;
+} ble_focus_stats_t;
 
 void ble_client_init(const app_config_t *cfg);
 void ble_client_set_focus_callback(ble_focus_cb_t cb, void *ctx);
+void ble_client_set_state_callback(ble_state_cb_t cb, void *ctx);
 bool ble_client_is_connected(void);
+// True while the camera link is in bring-up or serving a focus event; flash
+// writes wait for it to clear.
+bool ble_client_is_busy(void);
 bool ble_client_is_bonded(void);
+bool ble_client_is_location_enabled(void);
 bool ble_client_send_location(const gps_fix_t *fix);
+bool ble_client_get_handle_cache(ble_handle_cache_t *out);
+void ble_client_set_handle_cache(const ble_handle_cache_t *cache);
+void ble_client_get_focus_stats(ble_focus_stats_t *out);
 int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg);
 
 #endif
@@ -1,11 +1,15 @@
 #ifndef ALPHALOC_BLE_CONFIG_SERVER_H
 #define ALPHALOC_BLE_CONFIG_SERVER_H
 
+#include <stdint.h>
+
 #include "config.h"
 
 void ble_config_server_register(app_config_t *cfg);
 void ble_config_server_on_sync(void);
 void ble_config_server_start(void);
 void ble_config_server_stop(void);
+void ble_config_server_set_window_callback(void (*cb)(void *ctx), void *ctx);
+int64_t ble_config_server_last_activity_us(void);
 
 #endif
@@ -0,0 +1,24 @@
+#ifndef ALPHALOC_BOOT_PROFILE_H
+#define ALPHALOC_BOOT_PROFILE_H
+
+#include <stdint.h>
+
+typedef enum {
+  BOOT_MARK_APP_MAIN = 0,
+  BOOT_MARK_NVS_READY,
+  BOOT_MARK_CONFIG_LOADED,
+  BOOT_MARK_GPS_STARTED,
+  BOOT_MARK_BLE_STARTED,
+  BOOT_MARK_FIRST_SCAN,
+  BOOT_MARK_CAMERA_CONNECTED,
+  BOOT_MARK_FIRST_FIX,
+  BOOT_MARK_FIRST_LOCATION,
+  BOOT_MARK_WIFI_STARTED,
+  BOOT_MARK_UI_REACHABLE,
+  BOOT_MARK_COUNT,
+} boot_mark_t;
+
+void boot_profile_mark(boot_mark_t mark);
+int64_t boot_profile_get_us(boot_mark_t mark);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef ALPHALOC_COEX_POLICY_H
+#define ALPHALOC_COEX_POLICY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Returns true while the respective side needs the radio.
+typedef bool (*coex_busy_fn_t)(void);
+
+// Location write round trips (write issued until the camera acks), split by
+// whether WiFi was up at the time.
+typedef struct {
+  uint32_t count;
+  uint64_t total_us;
+  uint64_t max_us;
+} coex_latency_t;
+
+// WiFi has been started / is about to stop. While it runs, the radio is
+// handed to BLE whenever ble_busy() is true, and WiFi power save is raised
+// while web_active() is false.
+void coex_policy_start(coex_busy_fn_t ble_busy, coex_busy_fn_t web_active);
+void coex_policy_stop(void);
+// The camera link just entered bring-up or a focus burst. Switches to BLE
+// immediately instead of on the next poll.
+void coex_policy_ble_burst(void);
+void coex_policy_record_write(uint32_t latency_us);
+void coex_policy_get_latency(coex_latency_t *wifi_off, coex_latency_t *wifi_on);
+
+#endif
@@ -7,6 +7,7 @@
 #define CONFIG_STR_MAX_32 32
 #define CONFIG_STR_MAX_64 64
 #define CONFIG_STR_MAX_18 18
+#define CONFIG_STR_MAX_16 16
 
 typedef struct
 {
@@ -18,14 +19,39 @@ typedef struct
   uint32_t ble_passkey;
   uint16_t tz_offset_min;
   uint16_t dst_offset_min;
+  // 1 = take TZ/DST from the position (tz_lookup.h), the offsets above
+  // only where no zone is known.
+  uint16_t tz_auto;
   char wifi_ssid[CONFIG_STR_MAX_32];
   char wifi_pass[CONFIG_STR_MAX_64];
+  // Optional static STA address; empty = DHCP.
+  char wifi_ip[CONFIG_STR_MAX_16];
+  char wifi_gw[CONFIG_STR_MAX_16];
+  char wifi_mask[CONFIG_STR_MAX_16];
   char ap_ssid[CONFIG_STR_MAX_32];
   char ap_pass[CONFIG_STR_MAX_64];
 } app_config_t;
 
+// Bits in the change mask passed to config listeners.
+typedef enum
+{
+  CONFIG_CHANGED_GPS_INTERVAL = 1u << 0,
+  CONFIG_CHANGED_MAX_GPS_AGE = 1u << 1,
+  CONFIG_CHANGED_CONFIG_WINDOW = 1u << 2,
+  CONFIG_CHANGED_CAMERA_FILTER = 1u << 3,
+  CONFIG_CHANGED_BLE_PASSKEY = 1u << 4,
+  CONFIG_CHANGED_TZ_DST = 1u << 5,
+  CONFIG_CHANGED_WIFI = 1u << 6,
+} config_changed_t;
+
+typedef void (*config_listener_t)(const app_config_t *cfg, uint32_t changed,
+                                  void *ctx);
+
 void config_set_defaults(app_config_t *cfg);
 bool config_load(app_config_t *cfg);
 bool config_save(const app_config_t *cfg);
+bool config_add_listener(config_listener_t cb, void *ctx);
+uint32_t config_update(app_config_t *live, const app_config_t *next);
+void config_flush(void);
 
 #endif
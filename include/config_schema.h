@@ -0,0 +1,122 @@
+#ifndef ALPHALOC_CONFIG_SCHEMA_H
+#define ALPHALOC_CONFIG_SCHEMA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+
+#ifndef ALPHALOC_DEFAULT_CAMERA_NAME_PREFIX
+#define ALPHALOC_DEFAULT_CAMERA_NAME_PREFIX "SonyA7"
+#endif
+#ifndef ALPHALOC_DEFAULT_CAMERA_MAC_PREFIX
+#define ALPHALOC_DEFAULT_CAMERA_MAC_PREFIX ""
+#endif
+#ifndef ALPHALOC_DEFAULT_WIFI_SSID
+#define ALPHALOC_DEFAULT_WIFI_SSID "WiFi"
+#endif
+#ifndef ALPHALOC_DEFAULT_WIFI_PASS
+#define ALPHALOC_DEFAULT_WIFI_PASS "changeme"
+#endif
+#ifndef ALPHALOC_DEFAULT_AP_SSID
+#define ALPHALOC_DEFAULT_AP_SSID "AlphaLoc"
+#endif
+#ifndef ALPHALOC_DEFAULT_AP_PASS
+#define ALPHALOC_DEFAULT_AP_PASS "alphaloc1234"
+#endif
+
+// Where a setting shows up besides NVS.
+#define CONFIG_F_WEB (1u << 0) // field on the web form
+#define CONFIG_F_BLE (1u << 1) // R/W characteristic in the BLE config service
+
+// Every persisted setting, in web form order. Adding a tunable means adding
+// an app_config_t member and one line here.
+//
+//   X(type, member, key, id, min, max, default, flags, changed, label)
+//
+//   type    STR, U16 or U32
+//   key     NVS key of the legacy per-key layout and web form field name
+//   id      stable tag in the config blob and low byte of the BLE
+//           characteristic UUID (...<id>007EA1); never reuse an id, and
+//           skip 0x01 and 0x0C-0x11 (service, status and control UUIDs)
+//   min/max accepted range (numbers) or minimum length (strings, max is
+//           the member size)
+//   changed CONFIG_CHANGED_* bit reported to listeners
+#define CONFIG_SCHEMA(X)                                                      \
+  X(STR, camera_name_prefix, "cam_name", 0x02, 0, 0,                          \
+    ALPHALOC_DEFAULT_CAMERA_NAME_PREFIX, CONFIG_F_WEB | CONFIG_F_BLE,         \
+    CONFIG_CHANGED_CAMERA_FILTER, "Camera name prefix")                       \
+  X(STR, camera_mac_prefix, "cam_mac", 0x03, 0, 0,                            \
+    ALPHALOC_DEFAULT_CAMERA_MAC_PREFIX, CONFIG_F_WEB | CONFIG_F_BLE,          \
+    CONFIG_CHANGED_CAMERA_FILTER, "Camera MAC prefix")                        \
+  X(U16, tz_offset_min, "tz_off", 0x04, 0, 1440, 60,                          \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_TZ_DST, "TZ offset (minutes)") \
+  X(U16, dst_offset_min, "dst_off", 0x05, 0, 1440, 60,                        \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_TZ_DST,                       \
+    "DST offset (minutes)")                                                   \
+  X(U16, tz_auto, "tz_auto", 0x23, 0, 1, 0, CONFIG_F_WEB | CONFIG_F_BLE,      \
+    CONFIG_CHANGED_TZ_DST, "TZ/DST from position (0/1)")                      \
+  X(STR, wifi_ssid, "wifi_ssid", 0x07, 0, 0, ALPHALOC_DEFAULT_WIFI_SSID,      \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_WIFI, "WiFi SSID (STA)")      \
+  X(STR, wifi_pass, "wifi_pass", 0x08, 0, 0, ALPHALOC_DEFAULT_WIFI_PASS,      \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_WIFI, "WiFi pass (STA)")      \
+  X(STR, wifi_ip, "wifi_ip", 0x12, 0, 0, "", CONFIG_F_WEB | CONFIG_F_BLE,     \
+    CONFIG_CHANGED_WIFI, "Static IP (STA, empty = DHCP)")                     \
+  X(STR, wifi_gw, "wifi_gw", 0x13, 0, 0, "", CONFIG_F_WEB | CONFIG_F_BLE,     \
+    CONFIG_CHANGED_WIFI, "Gateway (static IP)")                               \
+  X(STR, wifi_mask, "wifi_mask", 0x14, 0, 0, "255.255.255.0",                 \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_WIFI, "Netmask (static IP)")  \
+  X(STR, ap_ssid, "ap_ssid", 0x09, 1, 0, ALPHALOC_DEFAULT_AP_SSID,            \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_WIFI, "AP SSID")              \
+  X(STR, ap_pass, "ap_pass", 0x0A, 8, 0, ALPHALOC_DEFAULT_AP_PASS,            \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_WIFI, "AP pass")              \
+  X(U32, max_gps_age_s, "max_age_s", 0x0B, 0, 1440, 300,                      \
+    CONFIG_F_WEB | CONFIG_F_BLE, CONFIG_CHANGED_MAX_GPS_AGE,                  \
+    "Max GPS age (seconds)")                                                  \
+  X(U32, gps_interval_ms, "gps_int_ms", 0x20, 100, 60000, 5000, 0,            \
+    CONFIG_CHANGED_GPS_INTERVAL, "GPS interval (ms)")                         \
+  X(U32, config_window_s, "cfg_win_s", 0x21, 0, 3600, 120, 0,                 \
+    CONFIG_CHANGED_CONFIG_WINDOW, "Config window idle (s)")                   \
+  X(U32, ble_passkey, "ble_pass", 0x22, 0, 999999, 123456, 0,                 \
+    CONFIG_CHANGED_BLE_PASSKEY, "BLE passkey")
+
+typedef enum
+{
+  CONFIG_TYPE_STR,
+  CONFIG_TYPE_U16,
+  CONFIG_TYPE_U32,
+} config_type_t;
+
+typedef struct
+{
+  config_type_t type;
+  uint8_t id;
+  uint8_t flags;
+  uint16_t offset;
+  uint16_t size;
+  uint32_t min;
+  uint32_t max;
+  uint32_t def_num;
+  const char *def_str;
+  uint32_t changed;
+  const char *key;
+  const char *label;
+} config_field_t;
+
+extern const config_field_t g_config_fields[];
+extern const size_t g_config_field_count;
+
+const config_field_t *config_field_by_key(const char *key);
+const config_field_t *config_field_by_id(uint8_t id);
+void config_field_set_default(const config_field_t *f, app_config_t *cfg);
+// Formats the value as text (numbers in decimal). Returns the string length.
+size_t config_field_format(const config_field_t *f, const app_config_t *cfg,
+                           char *out, size_t out_len);
+// Parses and range-checks text input; cfg is only modified on success.
+bool config_field_parse(const config_field_t *f, const char *text,
+                        app_config_t *cfg);
+bool config_field_equal(const config_field_t *f, const app_config_t *a,
+                        const app_config_t *b);
+
+#endif
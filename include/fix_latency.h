@@ -0,0 +1,57 @@
+#ifndef ALPHALOC_FIX_LATENCY_H
+#define ALPHALOC_FIX_LATENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// End-to-end latency of the positions sent to the camera. Each location
+// write that the camera acknowledges leaves one record in a fixed ring,
+// stamped at seven points: the first UART read of the fix's burst, the end
+// of its RMC sentence, the fix being stored for readers, the sender waking
+// up (publisher period or focus callback), the payload being encoded, the
+// ble_gattc_write_* call and the write response.
+
+// The gaps between consecutive points, and the whole path.
+typedef enum {
+  FIX_LAT_PARSE = 0,  // first UART read -> end of the RMC sentence
+  FIX_LAT_PUBLISH,    // -> fix stored for gps_get_latest()
+  FIX_LAT_WAIT,       // -> sender wakes up and reads it
+  FIX_LAT_ENCODE,     // -> location payload built
+  FIX_LAT_ISSUE,      // -> ble_gattc_write_* called
+  FIX_LAT_ACK,        // -> write response from the camera
+  FIX_LAT_TOTAL,      // first UART read -> write response
+  FIX_LAT_HOP_COUNT,
+} fix_lat_hop_t;
+
+typedef struct {
+  uint32_t p50_us;
+  uint32_t p99_us;
+  uint32_t max_us;
+} fix_lat_pct_t;
+
+typedef struct {
+  uint32_t records;    // in the ring, which the percentiles cover
+  uint32_t total;      // acknowledged writes since boot
+  uint32_t unmatched;  // sends of a fix too old to find its epoch stamps
+  fix_lat_pct_t hop[FIX_LAT_HOP_COUNT];
+} fix_lat_summary_t;
+
+// GPS task: a fix was stored. sentence_us is its last_fix_time_us.
+void fix_latency_epoch(int64_t rx_us, int64_t sentence_us, int64_t publish_us);
+// The sender woke up at wake_us and is about to send the fix with this
+// last_fix_time_us. Starts the record that the calls below fill in.
+void fix_latency_wake(int64_t fix_us, int64_t wake_us);
+void fix_latency_encoded(void);
+// The location write was queued; issue_us is when it was called.
+void fix_latency_issued(int64_t issue_us);
+// The write issued above could not be queued; drops its record.
+void fix_latency_abort(void);
+// Write response; only acknowledged writes are recorded.
+void fix_latency_done(bool ok);
+// Nearest-rank percentiles over the ring. False when it is empty or the
+// module is compiled out.
+bool fix_latency_get_summary(fix_lat_summary_t *out);
+// Short key for logs and JSON, e.g. "parse".
+const char *fix_latency_hop_name(fix_lat_hop_t hop);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef ALPHALOC_FLASH_SCHED_H
+#define ALPHALOC_FLASH_SCHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Kinds of deferred flash writes. One pending job per kind: submitting a kind
+// that is already queued replaces its callback and keeps the original
+// deadline, so bursts coalesce into one write.
+typedef enum {
+  FLASH_JOB_CONFIG = 0,
+  FLASH_JOB_BOND,
+  FLASH_JOB_WIFI,
+  FLASH_JOB_OTA,
+  FLASH_JOB_TRACK,
+  FLASH_JOB_GPS_AID,
+  FLASH_JOB_TRACE,
+  FLASH_JOB_COUNT,
+} flash_job_t;
+
+// Performs the write. Returns the time spent in flash operations in
+// microseconds (0 if nothing was written); that is the window during which
+// the flash cache was disabled.
+typedef uint32_t (*flash_job_fn_t)(void *ctx);
+// True while the BLE link must not be disturbed (bring-up, focus handling).
+typedef bool (*flash_sched_busy_fn_t)(void);
+
+typedef struct {
+  uint32_t runs;
+  uint32_t forced;  // ran at the deadline while the link was busy
+  uint32_t last_stall_us;
+  uint32_t max_stall_us;
+} flash_sched_stats_t;
+
+void flash_sched_start(flash_sched_busy_fn_t busy);
+// Queues job to run no earlier than settle_ms from now, as soon as the link
+// is quiet, and no later than ALPHALOC_FLASH_DEADLINE_MS after it was first
+// queued. Runs it inline if the scheduler has not been started.
+void flash_sched_submit(flash_job_t job, flash_job_fn_t fn, void *ctx,
+                        uint32_t settle_ms);
+// The link just became idle (e.g. a location write was acknowledged).
+void flash_sched_kick(void);
+// Runs every pending job now, e.g. before deep sleep.
+void flash_sched_flush(void);
+// Reports a flash write done outside a job (0 is ignored).
+void flash_sched_record_stall(uint32_t stall_us);
+void flash_sched_get_stats(flash_sched_stats_t *out);
+
+#endif
@@ -2,6 +2,7 @@
 #define ALPHALOC_GPS_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct {
@@ -32,16 +33,46 @@ typedef struct {
   gps_constellation_t constellations;
 } gps_status_t;
 
+// Chipset of the receiver on the UART, for its proprietary commands.
+typedef enum {
+  GPS_RECEIVER_UNKNOWN = 0,
+  GPS_RECEIVER_MTK,    // PMTK sentences (Adafruit Ultimate GPS, L80, ...)
+  GPS_RECEIVER_UBLOX,  // UBX binary (NEO-6M on the GY-GPS6MV2, ...)
+} gps_receiver_t;
+
+// Called from the GPS task after each GGA sentence (once per epoch).
+typedef void (*gps_epoch_cb_t)(void *ctx);
+// Called from the GPS task with every block read from the UART, before it is
+// parsed. Must not block.
+typedef void (*gps_raw_cb_t)(const uint8_t *data, size_t len, void *ctx);
+
+// Where NMEA comes from; see gps_source.h.
+typedef struct gps_source gps_source_t;
+
 typedef struct {
   int uart_num;
   int tx_pin;
   int rx_pin;
   int baud_rate;
   uint32_t update_interval_ms;
+  // NULL for the receiver on uart_num.
+  const gps_source_t *source;
 } gps_config_t;
 
 void gps_init(const gps_config_t *cfg);
 bool gps_get_latest(gps_fix_t *out_fix);
 bool gps_get_status(gps_status_t *out_status);
+void gps_set_standby(bool standby);
+void gps_restore_fix(const gps_fix_t *fix);
+void gps_set_update_interval(uint32_t interval_ms);
+void gps_set_epoch_callback(gps_epoch_cb_t cb, void *ctx);
+void gps_set_raw_callback(gps_raw_cb_t cb, void *ctx);
+// Sends "$<body>*<checksum>\r\n" to the receiver, e.g. "PMTK161,0".
+void gps_send_sentence(const char *body);
+// Sends a UBX frame (sync, class, id, length, payload, checksum).
+void gps_send_ubx(uint8_t cls, uint8_t id, const void *payload, size_t len);
+// Set by ALPHALOC_GPS_RECEIVER, or detected from the replies to a probe on
+// each start. Kept across deep sleep.
+gps_receiver_t gps_get_receiver(void);
 
 #endif
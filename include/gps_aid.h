@@ -0,0 +1,59 @@
+#ifndef ALPHALOC_GPS_AID_H
+#define ALPHALOC_GPS_AID_H
+
+// Assisted starts for the receiver on the UART. On every start (boot, wake
+// from standby) the last position and the time are injected as soon as the
+// receiver talks and its chipset is known: PMTK741/740 for MTK, UBX-AID-INI
+// for u-blox. An MTK receiver also gets EPO orbit data from the "epo"
+// partition when its own runs out, once the start has its first fix. Time
+// to first fix is logged per start with the aiding it had.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "gps_source.h"
+#include "nmea_parse.h"
+
+// What a start was aided with.
+typedef enum {
+  GPS_AID_TIME = 1 << 0,
+  GPS_AID_POS = 1 << 1,
+  GPS_AID_EPO = 1 << 2,  // the receiver held EPO data covering the start
+} gps_aid_kind_t;
+
+typedef struct {
+  uint32_t last_ttff_ms;  // 0 until the first fix of the current start
+  uint8_t last_aid;       // gps_aid_kind_t bits of the current start
+  // Kept across deep sleep, reset on power-on.
+  uint32_t aided_n;
+  uint32_t aided_avg_ms;
+  uint32_t unaided_n;
+  uint32_t unaided_avg_ms;
+  // Stored EPO file: bytes and UTC end of its coverage (0 = none).
+  uint32_t epo_bytes;
+  uint32_t epo_end;
+  uint32_t epo_transfers;
+} gps_aid_stats_t;
+
+// Loads the saved position and finds the stored EPO file. After NVS.
+void gps_aid_init(void);
+// Called by gps.c from the GPS task, for the UART receiver only.
+void gps_aid_start(const gps_source_t *src, int baud);
+void gps_aid_on_sentence(const char *line, const nmea_sentence_t *st);
+// Runs an EPO transfer when one is due and the start has a fix; NMEA output
+// pauses meanwhile.
+void gps_aid_poll(void);
+
+// Stores an EPO file (MTK format, e.g. MTK7d.EPO) in the "epo" partition,
+// streamed chunk by chunk like ota_update.h. finish() checks the file and
+// queues a transfer to the receiver.
+esp_err_t gps_aid_epo_begin(size_t len);
+esp_err_t gps_aid_epo_write(const void *data, size_t len);
+esp_err_t gps_aid_epo_finish(void);
+void gps_aid_epo_abort(void);
+
+void gps_aid_get_stats(gps_aid_stats_t *out);
+
+#endif
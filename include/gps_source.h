@@ -0,0 +1,26 @@
+#ifndef ALPHALOC_GPS_SOURCE_H
+#define ALPHALOC_GPS_SOURCE_H
+
+// A byte source for the GPS task. gps.c does the sentence assembly,
+// parsing, callbacks and fix state for every source, so a source only has
+// to deliver NMEA and take receiver commands.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gps.h"
+
+struct gps_source {
+  const char *name;
+  void (*start)(const gps_config_t *cfg);
+  // Waits up to timeout_ms for data. Returns the bytes read, 0 on timeout
+  // or a negative value on error.
+  int (*read)(uint8_t *buf, size_t cap, uint32_t timeout_ms);
+  // Sends to the receiver: a complete sentence (with CR/LF) or, for EPO
+  // uploads, a binary packet.
+  void (*write)(const char *data, size_t len);
+  void (*set_standby)(bool standby);
+};
+
+#endif
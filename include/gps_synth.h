@@ -0,0 +1,32 @@
+#ifndef ALPHALOC_GPS_SYNTH_H
+#define ALPHALOC_GPS_SYNTH_H
+
+// Synthetic receiver for bench tests (ALPHALOC_FAKE_GPS). It plays a small
+// script and emits RMC and GGA at the scripted rate with a running UTC
+// clock, so the parser, callbacks, track log and camera link see the same
+// traffic as from a real receiver.
+//
+// Script: one command per line or separated by ';', '#' starts a comment.
+//   time YYYY-MM-DD HH:MM:SS   set the UTC clock
+//   pos LAT LON [ALT]          jump to a position
+//   rate HZ                    epochs per second, 1..10
+//   sats N                     satellites reported while the fix is good
+//   go LAT LON SPEED           travel to a point at SPEED m/s
+//   hold S                     stay put for S seconds
+//   drop S                     no fix for S seconds
+//   loop                       start over from the first command
+// After the last command the position is held. The clock never runs
+// backwards: time only applies on the first pass through a loop.
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gps_source.h"
+
+// NULL when built with ALPHALOC_FAKE_GPS=0.
+const gps_source_t *gps_synth_source(void);
+// Replaces the running script. On a parse error the old script keeps
+// running and err describes the first bad line.
+bool gps_synth_load(const char *script, char *err, size_t err_len);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef ALPHALOC_HEAP_GUARD_H
+#define ALPHALOC_HEAP_GUARD_H
+
+#include <stdbool.h>
+
+// Returns true while a phase that legitimately allocates (e.g. the config
+// window bringing up WiFi/httpd) is active.
+typedef bool (*heap_guard_busy_fn_t)(void);
+
+void heap_guard_start(heap_guard_busy_fn_t busy);
+
+#endif
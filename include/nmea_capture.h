@@ -0,0 +1,38 @@
+#ifndef ALPHALOC_NMEA_CAPTURE_H
+#define ALPHALOC_NMEA_CAPTURE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Capture file layout (also the in-RAM ring's record format), little-endian:
+//   NMEA_CAPTURE_MAGIC (8 bytes), then per UART read:
+//   uint32_t t_ms  arrival time, milliseconds since boot
+//   uint16_t len
+//   uint8_t  data[len]
+#define NMEA_CAPTURE_MAGIC "ALNMEA01"
+#define NMEA_CAPTURE_MAGIC_LEN 8
+#define NMEA_CAPTURE_REC_HDR 6
+
+typedef struct {
+  uint32_t records;   // records in the ring
+  uint32_t bytes;     // ring bytes in use
+  uint32_t overwritten;  // oldest records dropped to make room
+} nmea_capture_stats_t;
+
+void nmea_capture_init(void);
+// False when built with ALPHALOC_NMEA_CAPTURE=0; the other calls are then
+// no-ops.
+bool nmea_capture_enabled(void);
+// Records one UART read with its arrival time. Called from the GPS task.
+void nmea_capture_feed(const uint8_t *data, size_t len);
+// Positions (bytes ever written) of the oldest record and the end.
+void nmea_capture_span(uint32_t *begin, uint32_t *end);
+// Copies whole records from *cursor up to end into buf and advances the
+// cursor; returns the bytes copied, 0 when done. A cursor the writer has
+// overtaken skips ahead to the oldest record still in the ring.
+size_t nmea_capture_read(uint32_t *cursor, uint32_t end, uint8_t *buf,
+                         size_t cap);
+void nmea_capture_get_stats(nmea_capture_stats_t *out);
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ALPHALOC_NMEA_PARSE_H
+#define ALPHALOC_NMEA_PARSE_H
+
+// NMEA sentence assembly and parsing used by the GPS task. Plain C with no
+// ESP-IDF dependencies, so the host replay tool runs the same code.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gps.h"
+
+#define NMEA_LINE_MAX 128
+
+typedef enum {
+  NMEA_OTHER = 0,  // a sentence this firmware does not use
+  NMEA_GGA,
+  NMEA_RMC,
+  NMEA_ZDA,
+} nmea_kind_t;
+
+typedef struct {
+  nmea_kind_t kind;
+  // GGA: fields present (fix quality and satellites).
+  bool status_ok;
+  gps_status_t status;
+  // RMC: the receiver reports a valid position (status 'A'); fix holds it,
+  // with the UTC time and date if present. last_fix_time_us is not set.
+  // ZDA: time and/or date in fix.
+  bool fix_ok;
+  bool time_ok;
+  bool date_ok;
+  gps_fix_t fix;
+  // RMC/ZDA: milliseconds of the UTC time (gps_fix_t has whole seconds).
+  uint16_t time_ms;
+} nmea_sentence_t;
+
+// Splits a byte stream into sentences. Lines that do not start with '$' or
+// are shorter than 7 characters are dropped, as are overlong ones.
+typedef struct {
+  char buf[NMEA_LINE_MAX];
+  size_t len;
+} nmea_line_t;
+
+typedef void (*nmea_line_fn_t)(const char *line, void *ctx);
+
+void nmea_line_feed(nmea_line_t *lb, const uint8_t *data, size_t len,
+                    nmea_line_fn_t fn, void *ctx);
+void nmea_line_reset(nmea_line_t *lb);
+// Classifies and parses one sentence (without CR/LF).
+void nmea_parse(const char *line, nmea_sentence_t *out);
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef ALPHALOC_NMEA_TCP_H
+#define ALPHALOC_NMEA_TCP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ALPHALOC_NMEA_TCP_MAX_CLIENTS
+#define ALPHALOC_NMEA_TCP_MAX_CLIENTS 4
+#endif
+// The listener plus one socket per client.
+#define NMEA_TCP_SOCKETS (ALPHALOC_NMEA_TCP_MAX_CLIENTS + 1)
+
+typedef struct {
+  uint32_t clients;
+  uint32_t dropped;       // clients closed for falling a ring behind
+  uint64_t bytes_in;      // bytes fed by the GPS task while someone listened
+  uint64_t bytes_out;     // bytes sent, summed over all clients
+  uint32_t feeds;
+  uint64_t feed_total_us; // time the GPS task spent in nmea_tcp_feed()
+  uint32_t feed_max_us;
+} nmea_tcp_stats_t;
+
+// Opens / closes the listener on ALPHALOC_NMEA_TCP_PORT; call while the
+// network is up.
+void nmea_tcp_start(void);
+void nmea_tcp_stop(void);
+// Appends raw receiver bytes to the shared ring. Never blocks; returns
+// immediately when nobody is connected.
+void nmea_tcp_feed(const uint8_t *data, size_t len);
+int nmea_tcp_client_count(void);
+// Last time NMEA went out to a client; 0 = never.
+int64_t nmea_tcp_last_activity_us(void);
+void nmea_tcp_get_stats(nmea_tcp_stats_t *out);
+
+#endif
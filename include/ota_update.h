@@ -0,0 +1,39 @@
+#ifndef ALPHALOC_OTA_UPDATE_H
+#define ALPHALOC_OTA_UPDATE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Figures for one streamed update, logged and returned to the uploader.
+typedef struct {
+  uint32_t bytes;
+  uint32_t elapsed_ms;
+  uint32_t kib_per_s;
+  // Largest drop in free heap below the level at ota_update_begin().
+  uint32_t peak_heap_bytes;
+} ota_update_stats_t;
+
+// True once the running image has passed its self-test (or was never
+// pending verification).
+typedef bool (*ota_self_test_fn_t)(void);
+
+// Opens the inactive app slot. sha256_hex (64 hex digits, may be NULL) is
+// the expected digest of the whole upload; the image's own checksum is
+// always verified by ota_update_finish().
+esp_err_t ota_update_begin(const char *sha256_hex);
+// Appends one received chunk; the slot is erased sector by sector as the
+// data arrives, so nothing is buffered.
+esp_err_t ota_update_write(const void *data, size_t len);
+// Verifies the digests and selects the new slot for the next boot.
+esp_err_t ota_update_finish(ota_update_stats_t *out);
+void ota_update_abort(void);
+bool ota_update_in_progress(void);
+
+// A freshly updated image stays pending until test() passes; if it has not
+// within ALPHALOC_OTA_SELF_TEST_S the device rolls back and reboots.
+void ota_update_start_self_test(ota_self_test_fn_t test);
+
+#endif
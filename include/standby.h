@@ -0,0 +1,25 @@
+#ifndef ALPHALOC_STANDBY_H
+#define ALPHALOC_STANDBY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ble_client.h"
+#include "gps.h"
+
+typedef enum {
+  STANDBY_BOOT_COLD = 0,
+  STANDBY_BOOT_WAKE,
+} standby_boot_t;
+
+void standby_init(void);
+standby_boot_t standby_boot_kind(void);
+bool standby_restore_fix(gps_fix_t *out_fix);
+// UTC from the system time the RTC kept through deep sleep; true only after a
+// timer wake when the clock had been set from GNSS before sleeping.
+bool standby_restore_time(int64_t *out_utc_us);
+bool standby_restore_handles(ble_handle_cache_t *out_cache);
+void standby_note_location_sent(void);
+void standby_enter(uint32_t wake_interval_s);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef ALPHALOC_TASK_PLAN_H
+#define ALPHALOC_TASK_PLAN_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Application tasks with a fixed place in the core/priority plan. The NimBLE
+// host and controller are placed through sdkconfig and share the "radio" core
+// with the focus path; GNSS ingestion and the web stack use the other core.
+// TASK_ROLE_BLE_HOST is only created here in a static build; otherwise
+// nimble_port_freertos_init() creates the host task.
+typedef enum {
+  TASK_ROLE_LOCATION = 0,
+  TASK_ROLE_GPS,
+  TASK_ROLE_HTTPD,
+  TASK_ROLE_CONFIG_WINDOW,
+  TASK_ROLE_BATTERY,
+  TASK_ROLE_STANDBY,
+  TASK_ROLE_BUTTON,
+  TASK_ROLE_LED,
+  TASK_ROLE_STATS,
+  TASK_ROLE_HEAP_GUARD,
+  TASK_ROLE_FLASH,
+  TASK_ROLE_NMEA_TCP,
+  TASK_ROLE_BLE_HOST,
+  TASK_ROLE_COUNT,
+} task_role_t;
+
+BaseType_t task_plan_create(task_role_t role, TaskFunction_t fn,
+                            const char *name, uint32_t stack_size, void *arg,
+                            TaskHandle_t *out_handle);
+BaseType_t task_plan_core(task_role_t role);
+UBaseType_t task_plan_priority(task_role_t role);
+void task_plan_log(void);
+void task_plan_start_stats(void);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef ALPHALOC_TIME_SYNC_H
+#define ALPHALOC_TIME_SYNC_H
+
+// UTC clock disciplined by GNSS time. Each RMC with a fix sets the phase of
+// a software clock running on esp_timer and, over longer spans, its drift,
+// so the time keeps advancing correctly between fixes and through
+// dropouts. The system time (gettimeofday) follows the same clock.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gps.h"
+
+typedef struct {
+  bool synced;
+  float drift_ppm;       // UTC rate against esp_timer
+  uint32_t samples;      // GNSS time fixes used
+  uint32_t steps;        // fixes too far off the clock that reset its phase
+  // The clock as of one fix, run blind for ALPHALOC_TIME_HOLDOVER_CHECK_S
+  // and compared with a later fix.
+  uint32_t holdover_checks;
+  int32_t holdover_err_us;
+  int32_t holdover_max_us;  // largest magnitude seen, with sign
+  // The last real gap of 10 s or more between fixes.
+  uint32_t gap_s;
+  int32_t gap_err_us;
+} time_sync_stats_t;
+
+void time_sync_init(void);
+// Feeds a GNSS time (fix->year..second plus ms) observed at rx_us
+// (esp_timer_get_time()). Called from the GPS task.
+void time_sync_gnss(const gps_fix_t *fix, uint16_t ms, int64_t rx_us);
+// Starts the clock from a UTC known without GNSS, e.g. the system time the
+// RTC kept through deep sleep. Ignored once a fix has set the clock; the
+// next fix replaces the seed.
+void time_sync_seed(int64_t utc_us);
+// Current UTC in microseconds since 1970. False until the first fix or seed.
+bool time_sync_now_us(int64_t *utc_us);
+// Overwrites the date and time of fix with the current UTC. False (fix
+// unchanged) until the first fix or seed.
+bool time_sync_stamp(gps_fix_t *fix);
+void time_sync_get_stats(time_sync_stats_t *out);
+
+#endif
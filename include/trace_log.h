@@ -0,0 +1,180 @@
+#ifndef ALPHALOC_TRACE_LOG_H
+#define ALPHALOC_TRACE_LOG_H
+
+// Deferred-format tracing for hot paths and release builds. TRACE_I(fmt,
+// ...) stores the address of the format string, the caller's TAG, a
+// timestamp and the raw arguments in a lock-free RAM ring; nothing is
+// formatted on the device. tools/trace_decode.c turns a download of the ring
+// (/api/trace) back into log lines using the firmware's ELF.
+//
+// Arguments are stored as C varargs would pass them on the ESP32: doubles
+// and 64-bit integers take two words, everything else one. A %s argument is
+// stored as its address, so only strings in flash (literals, const tables)
+// can be printed by the decoder. At most TRACE_MAX_ARGS arguments.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef ALPHALOC_TRACE
+#define ALPHALOC_TRACE 1
+#endif
+// Also print every trace record through ESP_LOG (formats on the device).
+#ifndef ALPHALOC_TRACE_ECHO
+#define ALPHALOC_TRACE_ECHO 0
+#endif
+#if ALPHALOC_TRACE_ECHO
+#include "esp_log.h"
+#endif
+
+// Record layout in 32-bit words, little-endian:
+//   header  TRACE_REC_MAGIC << 24 | lap << 16 | core << 11 | level << 8 |
+//           words (the whole record, header included)
+//   t_lo, t_hi  esp_timer_get_time() in microseconds
+//   fmt, tag    addresses of the format string and TAG
+//   args...
+// lap is the low byte of (position / ring words); it tells a record written
+// in this pass over the ring from a stale one.
+#define TRACE_REC_MAGIC 0xA7u
+#define TRACE_REC_HDR_WORDS 5
+#define TRACE_MAX_ARGS 8
+#define TRACE_MAX_ARG_WORDS (2 * TRACE_MAX_ARGS)
+// Levels, numbered like esp_log_level_t.
+#define TRACE_LEVEL_ERROR 1
+#define TRACE_LEVEL_WARN 2
+#define TRACE_LEVEL_INFO 3
+#define TRACE_LEVEL_DEBUG 4
+
+// Download layout (/api/trace and the flash copy): this header, then the
+// ring's words from position begin to end, oldest first. Words the writers
+// overtook during the download are zeroed.
+#define TRACE_DUMP_MAGIC "ALTRACE1"
+typedef struct {
+  char magic[8];
+  uint32_t ring_words;
+  uint32_t begin;
+  uint32_t end;
+  uint32_t uptime_s;  // at the time of the download or copy
+  char version[32];   // esp_app_desc version
+  char build[24];     // hex prefix of the ELF's SHA-256
+} trace_dump_hdr_t;
+
+typedef struct {
+  uint32_t ring_words;
+  uint32_t written_words;  // since the ring was last cleared
+  bool kept;               // the ring survived the last reset
+  uint32_t flash_copies;
+} trace_log_stats_t;
+
+// Clears the ring after a power-on; after a panic, watchdog or software
+// reset of the same build it keeps the previous records. Call first in
+// app_main.
+void trace_log_init(void);
+// False when built with ALPHALOC_TRACE=0; the other calls are then no-ops.
+bool trace_log_enabled(void);
+// Use the TRACE_x macros. Safe from any task or ISR.
+void trace_log_write(uint8_t level, const char *tag, const char *fmt,
+                     const uint32_t *args, size_t n);
+// Positions (words ever written) of the oldest word in the ring and the end.
+void trace_log_span(uint32_t *begin, uint32_t *end);
+// Copies words from *cursor up to end into buf and advances the cursor;
+// returns the words copied, 0 when done.
+size_t trace_log_read(uint32_t *cursor, uint32_t end, uint32_t *buf,
+                      size_t cap);
+void trace_log_dump_header(trace_dump_hdr_t *out, uint32_t begin,
+                           uint32_t end);
+// Queues a copy of the ring to the "trace" partition, e.g. before deep
+// sleep. Only with ALPHALOC_TRACE_FLASH_S > 0.
+void trace_log_mirror(void);
+// Reads the last flash copy: *total is its size in bytes (0 = none).
+bool trace_log_flash_read(size_t off, void *buf, size_t len, size_t *total);
+void trace_log_get_stats(trace_log_stats_t *out);
+
+// --- Argument packing ---------------------------------------------------
+
+static inline uint32_t *trace_put_u32(uint32_t *p, uint32_t v) {
+  *p = v;
+  return p + 1;
+}
+
+static inline uint32_t *trace_put_u64(uint32_t *p, uint64_t v) {
+  p[0] = (uint32_t)v;
+  p[1] = (uint32_t)(v >> 32);
+  return p + 2;
+}
+
+static inline uint32_t *trace_put_f64(uint32_t *p, double v) {
+  uint64_t u;
+  memcpy(&u, &v, sizeof(u));
+  return trace_put_u64(p, u);
+}
+
+static inline uint32_t *trace_put_ptr(uint32_t *p, const void *v) {
+  *p = (uint32_t)(uintptr_t)v;
+  return p + 1;
+}
+
+#define TRACE_PUT_(p, x)                                   \
+  (p) = _Generic((x),                                      \
+      double: trace_put_f64,                               \
+      float: trace_put_f64,                                \
+      long long: trace_put_u64,                            \
+      unsigned long long: trace_put_u64,                   \
+      char *: trace_put_ptr,                               \
+      const char *: trace_put_ptr,                         \
+      void *: trace_put_ptr,                               \
+      const void *: trace_put_ptr,                         \
+      default: trace_put_u32)((p), (x))
+
+#define TRACE_PUT_0(p) (void)(p)
+#define TRACE_PUT_1(p, a) TRACE_PUT_(p, a)
+#define TRACE_PUT_2(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_1(p, __VA_ARGS__)
+#define TRACE_PUT_3(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_2(p, __VA_ARGS__)
+#define TRACE_PUT_4(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_3(p, __VA_ARGS__)
+#define TRACE_PUT_5(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_4(p, __VA_ARGS__)
+#define TRACE_PUT_6(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_5(p, __VA_ARGS__)
+#define TRACE_PUT_7(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_6(p, __VA_ARGS__)
+#define TRACE_PUT_8(p, a, ...) TRACE_PUT_(p, a); TRACE_PUT_7(p, __VA_ARGS__)
+#define TRACE_NARGS_(...) TRACE_NARGS_N_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define TRACE_NARGS_N_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+#define TRACE_CAT_(a, b) TRACE_CAT2_(a, b)
+#define TRACE_CAT2_(a, b) a##b
+
+#if ALPHALOC_TRACE_ECHO
+#define TRACE_ECHO_(level, fmt, ...) \
+  ESP_LOG_LEVEL_LOCAL((esp_log_level_t)(level), TAG, fmt, ##__VA_ARGS__)
+#else
+// Never runs; keeps the compiler checking the format against the arguments,
+// which is what the decoder relies on.
+#define TRACE_ECHO_(level, fmt, ...) \
+  do {                               \
+    if (0) {                         \
+      printf(fmt, ##__VA_ARGS__);    \
+    }                                \
+  } while (0)
+#endif
+
+#if ALPHALOC_TRACE
+#define TRACE_(level, fmt, ...)                                             \
+  do {                                                                      \
+    static const char trace_fmt_[] = fmt;                                   \
+    uint32_t trace_args_[TRACE_MAX_ARG_WORDS];                              \
+    uint32_t *trace_p_ = trace_args_;                                       \
+    TRACE_CAT_(TRACE_PUT_, TRACE_NARGS_(__VA_ARGS__))(trace_p_,             \
+                                                      ##__VA_ARGS__);       \
+    trace_log_write((level), TAG, trace_fmt_, trace_args_,                  \
+                    (size_t)(trace_p_ - trace_args_));                      \
+    TRACE_ECHO_(level, fmt, ##__VA_ARGS__);                                 \
+  } while (0)
+#else
+#define TRACE_(level, fmt, ...) TRACE_ECHO_(level, fmt, ##__VA_ARGS__)
+#endif
+
+#define TRACE_E(fmt, ...) TRACE_(TRACE_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define TRACE_W(fmt, ...) TRACE_(TRACE_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define TRACE_I(fmt, ...) TRACE_(TRACE_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define TRACE_D(fmt, ...) TRACE_(TRACE_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef ALPHALOC_TRACK_CODEC_H
+#define ALPHALOC_TRACK_CODEC_H
+
+// Track log format, shared by the firmware logger and the host tools. Plain
+// C with no ESP-IDF dependencies.
+//
+// The log partition is a ring of 4 KB sectors. Each sector starts with a
+// track_sector_hdr_t. Blocks follow it, one per 256-byte flash page (the
+// first one shares page 0 with the sector header). A block is a
+// track_block_hdr_t plus at most one page of payload, written in a single
+// program operation. A block whose CRC does not match was torn by a power
+// loss and ends its sector.
+//
+// Latitude and longitude are stored in steps of TRACK_QUANT_UDEG (1e-5 deg,
+// about 1.1 m), altitude in whole metres; a decoded point is within half a
+// step of what was logged, well inside GNSS noise.
+//
+// Every block starts with an absolute point (keyframe), so any block decodes
+// on its own. The points after it are second-order deltas against a
+// constant-velocity prediction. They are zigzag varints, and epochs the
+// prediction already covers are folded into runs:
+//
+//   keyframe: varint t, zz lat, zz lon, zz alt
+//   record:   varint head
+//             head & 1 == 0: (head >> 1) more epochs exactly as predicted
+//             head & 1 == 1: zz(dt - previous dt) = head >> 1,
+//                            then zz dd_lat, zz dd_lon, zz dd_alt
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TRACK_SECTOR_SIZE 4096
+#define TRACK_PAGE_SIZE 256
+#define TRACK_SECTOR_MAGIC 0x324B5254u  // "TRK2", quantized positions
+#define TRACK_QUANT_UDEG 10
+#define TRACK_BLOCK_ERASED 0xFFFFu
+
+typedef struct {
+  uint32_t magic;
+  uint32_t seq;      // increments with every sector opened; highest = newest
+  uint32_t t_first;  // time of the first point in the sector (unix seconds)
+  uint32_t crc;      // over the fields above
+} track_sector_hdr_t;
+
+typedef struct {
+  uint16_t len;    // payload bytes, TRACK_BLOCK_ERASED = free
+  uint16_t count;  // points in the block
+  uint32_t crc;    // over len, count and the payload
+} track_block_hdr_t;
+
+// Payload room of a block that has its page to itself; the first block of a
+// sector has sizeof(track_sector_hdr_t) less.
+#define TRACK_BLOCK_PAYLOAD_MAX (TRACK_PAGE_SIZE - sizeof(track_block_hdr_t))
+
+typedef struct {
+  uint32_t t;        // unix seconds (UTC)
+  int32_t lat_udeg;  // micro-degrees
+  int32_t lon_udeg;
+  int32_t alt_m;
+} track_point_t;
+
+typedef struct {
+  uint8_t buf[TRACK_BLOCK_PAYLOAD_MAX];
+  size_t cap;        // usable payload bytes for the current block
+  size_t len;
+  uint16_t count;
+  uint32_t t_first;
+  uint32_t t_last;
+  // Reconstructed state, exactly what a decoder will see (lat/lon in
+  // TRACK_QUANT_UDEG steps).
+  track_point_t last;
+  uint32_t dt;
+  int32_t v_lat;
+  int32_t v_lon;
+  int32_t v_alt;
+  uint32_t run;
+  // Largest error a run may hide, in micro-degrees and metres, measured
+  // against the unquantized input.
+  int32_t tol_udeg;
+  int32_t tol_alt_m;
+} track_encoder_t;
+
+typedef struct {
+  const uint8_t *buf;
+  size_t len;
+  size_t pos;
+  uint16_t count;
+  uint16_t emitted;
+  track_point_t last;
+  uint32_t dt;
+  int32_t v_lat;
+  int32_t v_lon;
+  int32_t v_alt;
+  uint32_t run;
+} track_decoder_t;
+
+uint32_t track_crc32(uint32_t crc, const void *data, size_t len);
+bool track_sector_hdr_valid(const track_sector_hdr_t *hdr);
+void track_sector_hdr_seal(track_sector_hdr_t *hdr);
+// Offset of the first block in a sector.
+size_t track_first_block_offset(void);
+// True if a TRACK_SECTOR_SIZE sector image has a valid header and an intact
+// first block; copies the header to hdr. A power loss between opening a
+// sector and writing its first block leaves a header with no points.
+bool track_sector_has_data(const uint8_t *sector, track_sector_hdr_t *hdr);
+// Seconds since 1970-01-01 for a UTC calendar date and time.
+uint32_t track_unix_time(int year, int month, int day, int hour, int minute,
+                         int second);
+void track_unix_to_civil(uint32_t t, int *year, int *month, int *day,
+                         int *hour, int *minute, int *second);
+
+// Starts an empty block with cap payload bytes (<= TRACK_BLOCK_PAYLOAD_MAX).
+void track_enc_begin(track_encoder_t *enc, size_t cap, int32_t tol_udeg,
+                     int32_t tol_alt_m);
+// Appends a point with a later time than the previous one. Returns false if
+// the block is full; finish it, begin a new one and add the point again.
+bool track_enc_add(track_encoder_t *enc, const track_point_t *p);
+// Writes out a pending run; returns the payload length.
+size_t track_enc_finish(track_encoder_t *enc);
+// Fills in the block header for a finished payload.
+void track_block_hdr_seal(track_block_hdr_t *hdr, const uint8_t *payload,
+                          uint16_t len, uint16_t count);
+bool track_block_valid(const track_block_hdr_t *hdr, const uint8_t *payload);
+
+void track_dec_begin(track_decoder_t *dec, const uint8_t *payload, size_t len,
+                     uint16_t count);
+// Returns false at the end of the block or on malformed data.
+bool track_dec_next(track_decoder_t *dec, track_point_t *out);
+
+#endif
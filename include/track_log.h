@@ -0,0 +1,60 @@
+#ifndef ALPHALOC_TRACK_LOG_H
+#define ALPHALOC_TRACK_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_partition.h"
+#include "gps.h"
+#include "track_codec.h"
+
+typedef struct {
+  uint32_t points;
+  uint32_t blocks;
+  uint32_t payload_bytes;  // encoded bytes written, without headers
+  uint32_t dropped_blocks; // flash writes could not keep up
+  uint32_t sectors;        // partition size in sectors
+  uint32_t encode_max_us;
+  uint64_t encode_total_us;
+} track_log_stats_t;
+
+// Finds the "track" partition and resumes after the last intact block.
+// Returns false (and logging stays off) without the partition.
+bool track_log_init(void);
+// Records the fix if it is valid and newer than the last one; call once per
+// GPS epoch.
+void track_log_epoch(const gps_fix_t *fix);
+// Closes the current block and queues it for writing (e.g. before sleep).
+void track_log_flush(void);
+void track_log_get_stats(track_log_stats_t *out);
+
+// Reads the log back oldest first through a memory map of the partition, so
+// reading never stalls the flash cache. Constant memory; may run while the
+// logger writes.
+typedef struct {
+  const uint8_t *base;
+  esp_partition_mmap_handle_t map;
+  uint32_t sectors;
+  uint32_t sector;  // physical sector being read
+  uint32_t left;    // sectors still to read, this one included
+  uint32_t page;    // next page within the sector
+  uint32_t t_from;
+  uint32_t t_to;
+  bool in_block;
+  track_decoder_t dec;
+  uint32_t blocks;  // blocks decoded
+} track_reader_t;
+
+// Positions the reader at the sector holding t_from, found by binary search
+// over the sector headers. Blocks still in RAM are queued for writing first
+// and show up once flash_sched has run. Returns false without a log.
+bool track_reader_open(track_reader_t *r, uint32_t t_from, uint32_t t_to);
+// Next point with t_from <= t <= t_to; false once past t_to or the newest
+// block.
+bool track_reader_next(track_reader_t *r, track_point_t *out);
+// Alternative to track_reader_next: the next valid sector in the range as
+// raw TRACK_SECTOR_SIZE bytes (pointing into the map), or NULL at the end.
+const uint8_t *track_reader_next_sector(track_reader_t *r);
+void track_reader_close(track_reader_t *r);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef ALPHALOC_TZ_DATA_H
+#define ALPHALOC_TZ_DATA_H
+
+// Time zone tables for tz_lookup.c, generated by tools/tzgen.c into
+// src/tz_data.c. Plain C so host tools can link them.
+
+#include <stdint.h>
+
+#define TZ_ZONE_NONE 0xFFFF
+
+// A POSIX TZ rule ("CET-1CEST,M3.5.0,M10.5.0/3"): DST starts on the
+// start_week-th (5 = last) start_wday (0 = Sunday) of start_month at
+// start_min local standard time and ends likewise at end_min local
+// daylight time. Negative DST (Europe/Dublin) is stored the other way
+// round, so dst_min is never negative.
+typedef struct {
+  int16_t std_min;  // standard offset, minutes east of UTC
+  int16_t dst_min;  // added while DST is in effect; 0 = no DST
+  uint8_t start_month;
+  uint8_t start_week;
+  uint8_t start_wday;
+  uint8_t end_month;
+  uint8_t end_week;
+  uint8_t end_wday;
+  int16_t start_min;
+  int16_t end_min;
+} tz_rule_t;
+
+typedef struct {
+  const char *name;  // IANA name, e.g. "Europe/Berlin"
+  uint16_t rule;     // index into tz_rules
+} tz_zone_t;
+
+// One run of equal cells in a grid row: from col to the next run's col.
+typedef struct {
+  uint16_t col;
+  uint16_t zone;  // index into tz_zones or TZ_ZONE_NONE
+} tz_run_t;
+
+// Row 0 starts at 90N, column 0 at 180W; a cell is 1/cells_per_deg degree.
+typedef struct {
+  uint16_t cells_per_deg;
+  uint16_t rows;
+  uint16_t cols;
+  uint16_t zone_count;
+  const char *source;  // what the generator was run on
+} tz_grid_t;
+
+extern const tz_grid_t tz_grid;
+extern const tz_rule_t tz_rules[];
+extern const tz_zone_t tz_zones[];
+extern const uint32_t tz_row_start[];  // rows + 1 entries into tz_runs
+extern const tz_run_t tz_runs[];
+
+#endif
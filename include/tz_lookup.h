@@ -0,0 +1,25 @@
+#ifndef ALPHALOC_TZ_LOOKUP_H
+#define ALPHALOC_TZ_LOOKUP_H
+
+// Time zone and DST from a position and a UTC time, using the embedded
+// grid in tz_data.c. No ESP-IDF dependencies, so host tools share it.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  int zone;         // index into tz_zones
+  int16_t tz_min;   // standard offset, minutes east of UTC
+  int16_t dst_min;  // DST offset now in effect (0 outside DST)
+} tz_info_t;
+
+// Zone covering the position, or -1 (open sea, no data, bad input).
+int tz_lookup_zone(double lat_deg, double lon_deg);
+// Offsets of a zone at a UTC time (seconds since 1970).
+void tz_zone_offsets(int zone, uint32_t utc, int16_t *tz_min,
+                     int16_t *dst_min);
+// Both of the above. False if no zone covers the position.
+bool tz_lookup(double lat_deg, double lon_deg, uint32_t utc, tz_info_t *out);
+const char *tz_zone_name(int zone);
+
+#endif
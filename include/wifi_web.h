@@ -1,9 +1,25 @@
 #ifndef ALPHALOC_WIFI_WEB_H
 #define ALPHALOC_WIFI_WEB_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "config.h"
 
+// Concurrent /api/events viewers; each one keeps an httpd socket open.
+#ifndef ALPHALOC_WEB_MAX_VIEWERS
+#define ALPHALOC_WEB_MAX_VIEWERS 3
+#endif
+// Page load plus API calls need a few sockets next to the viewers. The
+// httpd also keeps three lwIP sockets of its own (listener and control).
+#define WIFI_WEB_OPEN_SOCKETS (ALPHALOC_WEB_MAX_VIEWERS + 4)
+#define WIFI_WEB_SOCKETS (WIFI_WEB_OPEN_SOCKETS + 3)
+
 void wifi_web_start(app_config_t *cfg);
 void wifi_web_stop(void);
+int64_t wifi_web_last_activity_us(void);
+// Something shown in the status bar may have changed; pushes the difference
+// to open /api/events viewers. Cheap when nobody is watching.
+void wifi_web_notify_status(void);
 
 #endif
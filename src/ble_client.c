@@ -4,8 +4,15 @@
 #include <string.h>
 
 #include "ble_config_server.h"
+#include "boot_profile.h"
+#include "coex_policy.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "fix_latency.h"
+#include "flash_sched.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 #include "host/ble_att.h"
 #include "host/ble_gap.h"
 #include "host/ble_hs.h"
@@ -15,9 +22,14 @@
 #include "host/ble_store.h"
 #include "nimble/nimble_port.h"
 #include "nimble/nimble_port_freertos.h"
+#include "sdkconfig.h"
 #include "services/gap/ble_svc_gap.h"
 #include "services/gatt/ble_svc_gatt.h"
 #include "store/config/ble_store_config.h"
+#include "task_plan.h"
+#include "trace_log.h"
+#include "track_codec.h"
+#include "tz_lookup.h"
 
 static const char *TAG = "ble_client";
 
@@ -32,6 +44,9 @@ static const char *TAG = "ble_client";
 #define VLOGI(...) ((void)0)
 #define VLOGW(...) ((void)0)
 #endif
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
 
 extern void ble_store_config_init(void);
 extern int ble_store_util_delete_peer(const ble_addr_t *addr);
@@ -70,9 +85,14 @@ static uint8_t s_own_addr_type;
 static const app_config_t *s_cfg;
 static ble_focus_cb_t s_focus_cb;
 static void *s_focus_ctx;
+static ble_state_cb_t s_state_cb;
+static void *s_state_ctx;
 static bool s_require_tz_dst;
 static uint16_t s_tz_off_min;
 static uint16_t s_dst_off_min;
+// Zone and DST last reported by tz_auto; -2 = none yet, -1 = no zone.
+static int s_auto_zone = -2;
+static int16_t s_auto_dst_min;
 static bool s_connecting_camera;
 static uint8_t s_dd21_retry;
 static bool s_location_enabled;
@@ -85,6 +105,16 @@ static bool s_dsc_pending_ff02;
 static bool s_dsc_in_progress;
 static int64_t s_last_loc_enable_attempt_us;
 static int64_t s_last_dd21_attempt_us;
+// Why the last location send was skipped, so each reason is traced once
+// instead of on every publisher tick.
+typedef enum {
+  LOC_SKIP_NONE = 0,
+  LOC_SKIP_NO_CONN,
+  LOC_SKIP_NOT_ENABLED,
+  LOC_SKIP_DD21,
+  LOC_SKIP_DD11,
+} loc_skip_t;
+static loc_skip_t s_loc_skip;
 typedef enum {
   DSC_NONE = 0,
   DSC_FF02,
@@ -100,6 +130,39 @@ static bool s_payload_logged;
 #endif
 static bool s_bonded_camera;
 static bool s_retried_disc_after_enc;
+static ble_handle_cache_t s_handle_cache;
+static bool s_handles_from_cache;
+// Set while the focus callback runs; the write it issues takes it over.
+static int64_t s_focus_rx_us;
+static int64_t s_focus_write_us;
+static ble_focus_stats_t s_focus_stats;
+// Flash writes are held off while a location write is outstanding and for a
+// while after a focus event.
+#define FOCUS_QUIET_US 1000000
+static bool s_loc_write_inflight;
+static int64_t s_loc_write_us;
+static int64_t s_last_focus_us;
+
+// Bond and CCCD writes from the host are parked here and persisted by the
+// flash scheduler once the link is quiet. Only the host task touches the
+// list; the scheduler job hands the flush to it through an event.
+#define BOND_PENDING_MAX 4
+typedef struct {
+  int obj_type;
+  union ble_store_value value;
+} bond_write_t;
+static bond_write_t s_bond_pending[BOND_PENDING_MAX];
+static uint8_t s_bond_pending_count;
+static ble_store_read_fn *s_store_read;
+static ble_store_write_fn *s_store_write;
+static ble_store_delete_fn *s_store_delete;
+static struct ble_npl_event s_bond_flush_ev;
+static SemaphoreHandle_t s_bond_flush_done;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_bond_flush_done_buf;
+#endif
+static uint32_t s_bond_flush_us;
+static TaskHandle_t s_host_task;
 
 static void ble_start_scan(void);
 static void schedule_dsc_retry(void);
@@ -211,8 +274,12 @@ static void log_mfg_data(const uint8_t *data, uint8_t len) {
   }
   char buf[64];
   size_t pos = 0;
-  for (uint8_t i = 0; i < len && pos + 3 < sizeof(buf); ++i) {
-    pos += snprintf(buf + pos, sizeof(buf) - pos, "%02X", data[i]);
+  for (uint8_t i = 0; i < len; ++i) {
+    const int n = snprintf(buf + pos, sizeof(buf) - pos, "%02X", data[i]);
+    if (n < 0 || (size_t)n >= sizeof(buf) - pos) {
+      break;
+    }
+    pos += (size_t)n;
   }
   buf[pos] = '\0';
   VLOGI("Sony ADV mfg_data len=%u data=%s", (unsigned)len, buf);
@@ -318,6 +385,103 @@ static void start_all_char_discovery(uint16_t conn_handle) {
   ble_gattc_disc_all_chrs(conn_handle, 1, 0xFFFF, gatt_disc_chrs_cb, NULL);
 }
 
+static void remember_handles(uint16_t conn_handle) {
+  struct ble_gap_conn_desc desc;
+  if (s_handles.chr_dd11 == 0 || ble_gap_conn_find(conn_handle, &desc) != 0) {
+    return;
+  }
+  s_handle_cache.peer_addr_type = desc.peer_ota_addr.type;
+  memcpy(s_handle_cache.peer_addr, desc.peer_ota_addr.val,
+         sizeof(s_handle_cache.peer_addr));
+  s_handle_cache.loc_svc_start = s_handles.loc_svc_start;
+  s_handle_cache.loc_svc_end = s_handles.loc_svc_end;
+  s_handle_cache.rem_svc_start = s_handles.rem_svc_start;
+  s_handle_cache.rem_svc_end = s_handles.rem_svc_end;
+  s_handle_cache.chr_dd11 = s_handles.chr_dd11;
+  s_handle_cache.chr_dd21 = s_handles.chr_dd21;
+  s_handle_cache.chr_dd30 = s_handles.chr_dd30;
+  s_handle_cache.chr_dd31 = s_handles.chr_dd31;
+  s_handle_cache.chr_ff02 = s_handles.chr_ff02;
+  s_handle_cache.end_ff02 = s_handles.end_ff02;
+  s_handle_cache.cccd_ff02 = s_handles.cccd_ff02;
+  s_handle_cache.valid = true;
+  VLOGI("GATT handles cached");
+}
+
+static bool restore_cached_handles(const struct ble_gap_conn_desc *desc) {
+  if (!s_handle_cache.valid || s_handle_cache.chr_dd11 == 0) {
+    return false;
+  }
+  if (desc->peer_ota_addr.type != s_handle_cache.peer_addr_type ||
+      memcmp(desc->peer_ota_addr.val, s_handle_cache.peer_addr,
+             sizeof(s_handle_cache.peer_addr)) != 0) {
+    return false;
+  }
+  s_handles.loc_svc_start = s_handle_cache.loc_svc_start;
+  s_handles.loc_svc_end = s_handle_cache.loc_svc_end;
+  s_handles.rem_svc_start = s_handle_cache.rem_svc_start;
+  s_handles.rem_svc_end = s_handle_cache.rem_svc_end;
+  s_handles.chr_dd11 = s_handle_cache.chr_dd11;
+  s_handles.chr_dd21 = s_handle_cache.chr_dd21;
+  s_handles.chr_dd30 = s_handle_cache.chr_dd30;
+  s_handles.chr_dd31 = s_handle_cache.chr_dd31;
+  s_handles.chr_ff02 = s_handle_cache.chr_ff02;
+  s_handles.end_ff02 = s_handle_cache.end_ff02;
+  s_handles.cccd_ff02 = s_handle_cache.cccd_ff02;
+  s_ff02_cccd_deferred = (s_handles.cccd_ff02 != 0);
+  s_remote_disc_started = true;
+  s_handles_from_cache = true;
+  return true;
+}
+
+// Cached handles did not match the camera (e.g. after a firmware update):
+// forget them and fall back to a full discovery on the live connection.
+static void drop_cached_handles(uint16_t conn_handle) {
+  ESP_LOGW(TAG, "Cached GATT handles rejected; rediscovering");
+  memset(&s_handle_cache, 0, sizeof(s_handle_cache));
+  s_handles_from_cache = false;
+  memset(&s_handles, 0, sizeof(s_handles));
+  s_handles.conn_handle = conn_handle;
+  s_location_enabled = false;
+  s_dd21_ready = false;
+  s_dd21_retry = 0;
+  s_remote_disc_started = false;
+  s_ff02_cccd_deferred = false;
+  start_location_service_discovery(conn_handle);
+}
+
+static int location_write_cb(uint16_t conn_handle,
+                             const struct ble_gatt_error *error,
+                             struct ble_gatt_attr *attr, void *arg) {
+  (void)conn_handle;
+  (void)attr;
+  (void)arg;
+  // The camera has the position; nothing is due on the link until the next
+  // publish, so this is a good moment for deferred flash writes.
+  s_loc_write_inflight = false;
+  fix_latency_done(error->status == 0);
+  flash_sched_kick();
+  if (error->status == 0) {
+    coex_policy_record_write(
+        (uint32_t)(esp_timer_get_time() - s_loc_write_us));
+  }
+  if (s_focus_write_us == 0 || error->status != 0) {
+    s_focus_write_us = 0;
+    return 0;
+  }
+  uint64_t latency_us = (uint64_t)(esp_timer_get_time() - s_focus_write_us);
+  s_focus_write_us = 0;
+  s_focus_stats.count++;
+  s_focus_stats.total_us += latency_us;
+  s_focus_stats.last_us = latency_us;
+  if (latency_us > s_focus_stats.max_us) {
+    s_focus_stats.max_us = latency_us;
+  }
+  TRACE_I("Focus location acked after %llu us",
+          (unsigned long long)latency_us);
+  return 0;
+}
+
 static int dd21_read_cb(uint16_t conn_handle,
                         const struct ble_gatt_error *error,
                         struct ble_gatt_attr *attr, void *arg) {
@@ -325,6 +489,10 @@ static int dd21_read_cb(uint16_t conn_handle,
   (void)arg;
   if (error->status != 0 || attr == NULL || attr->om == NULL) {
     ESP_LOGW(TAG, "DD21 read failed: %d", error->status);
+    if (s_handles_from_cache) {
+      drop_cached_handles(conn_handle);
+      return 0;
+    }
     if (s_dd21_retry < 2 && s_handles.chr_dd21 != 0) {
       s_dd21_retry++;
       ble_gattc_read(conn_handle, s_handles.chr_dd21, dd21_read_cb, NULL);
@@ -719,6 +887,7 @@ static int gatt_disc_dsc_cb(uint16_t conn_handle,
   }
 
   if (error->status == BLE_HS_EDONE) {
+    remember_handles(conn_handle);
     if (s_dsc_target == DSC_FF02) {
       if (s_handles.cccd_ff02 != 0) {
         s_ff02_cccd_deferred = true;
@@ -793,13 +962,56 @@ static bool build_location_payload(const gps_fix_t *fix, bool require_tz_dst,
   return true;
 }
 
+// The TZ/DST offsets to send with a fix: with tz_auto those of the zone at
+// the fix, otherwise (or where no zone is known) the configured ones.
+// Negative offsets go out as 16-bit two's complement.
+static void location_tz_dst(const gps_fix_t *fix, uint16_t *tz_off_min,
+                            uint16_t *dst_off_min) {
+  *tz_off_min = s_tz_off_min;
+  *dst_off_min = s_dst_off_min;
+  if (!s_cfg || !s_cfg->tz_auto || !fix->time_valid || fix->year == 0 ||
+      fix->month == 0 || fix->day == 0) {
+    return;
+  }
+  const uint32_t utc = track_unix_time(fix->year, fix->month, fix->day,
+                                       fix->hour, fix->minute, fix->second);
+  tz_info_t tz;
+  const bool found = tz_lookup(fix->lat_deg, fix->lon_deg, utc, &tz);
+  if (tz.zone != s_auto_zone || tz.dst_min != s_auto_dst_min) {
+    s_auto_zone = tz.zone;
+    s_auto_dst_min = tz.dst_min;
+    if (found) {
+      ESP_LOGI(TAG, "Auto TZ/DST: %s %+d/%+d", tz_zone_name(tz.zone),
+               tz.tz_min, tz.dst_min);
+    } else {
+      ESP_LOGI(TAG, "Auto TZ/DST: no zone here, using %u/%u", s_tz_off_min,
+               s_dst_off_min);
+    }
+  }
+  if (found) {
+    *tz_off_min = (uint16_t)tz.tz_min;
+    *dst_off_min = (uint16_t)tz.dst_min;
+  }
+}
+
+// True if the send is skipped for another reason than the last time.
+static bool loc_skip_changed(loc_skip_t why) {
+  const bool changed = why != s_loc_skip;
+  s_loc_skip = why;
+  return changed;
+}
+
 bool ble_client_send_location(const gps_fix_t *fix) {
   if (s_handles.conn_handle == BLE_HS_CONN_HANDLE_NONE) {
-    VLOGW("Skip location send: no connection");
+    if (loc_skip_changed(LOC_SKIP_NO_CONN)) {
+      TRACE_W("Skip location send: no connection");
+    }
     return false;
   }
   if (!s_location_enabled) {
-    VLOGW("Skip location send: location updates not enabled");
+    if (loc_skip_changed(LOC_SKIP_NOT_ENABLED)) {
+      TRACE_W("Skip location send: location updates not enabled");
+    }
     if (s_encrypted && s_dd21_ready) {
       int64_t now = esp_timer_get_time();
       if (now - s_last_loc_enable_attempt_us > 3000000) {
@@ -817,34 +1029,56 @@ bool ble_client_send_location(const gps_fix_t *fix) {
     return false;
   }
   if (s_handles.chr_dd21 != 0 && !s_dd21_ready) {
-    VLOGW("Skip location send: DD21 not ready");
+    if (loc_skip_changed(LOC_SKIP_DD21)) {
+      TRACE_W("Skip location send: DD21 not ready");
+    }
     return false;
   }
   if (s_handles.chr_dd11 == 0) {
-    VLOGW("Skip location send: DD11 not discovered");
+    if (loc_skip_changed(LOC_SKIP_DD11)) {
+      TRACE_W("Skip location send: DD11 not discovered");
+    }
     return false;
   }
+  s_loc_skip = LOC_SKIP_NONE;
+  uint16_t tz_off_min, dst_off_min;
+  location_tz_dst(fix, &tz_off_min, &dst_off_min);
   uint8_t payload[95];
   size_t payload_len = 0;
-  if (!build_location_payload(fix, s_require_tz_dst, s_tz_off_min,
-                              s_dst_off_min, payload, &payload_len)) {
+  if (!build_location_payload(fix, s_require_tz_dst, tz_off_min, dst_off_min,
+                              payload, &payload_len)) {
     ESP_LOGW(TAG, "Location payload unavailable");
     return false;
   }
+  fix_latency_encoded();
   uint16_t mtu = ble_att_mtu(s_handles.conn_handle);
   uint16_t max_payload = mtu > 3 ? (uint16_t)(mtu - 3) : 0;
   int rc = 0;
+  const int64_t issue_us = esp_timer_get_time();
+  // The ack can arrive on the host task before ble_gattc_write_* returns
+  // here (the S3 runs both cores), so the write is marked in flight first
+  // and the marks are rolled back if it was never queued.
+  s_focus_write_us = s_focus_rx_us;
+  s_loc_write_us = issue_us;
+  s_loc_write_inflight = true;
+  fix_latency_issued(issue_us);
   if (payload_len > max_payload) {
     struct os_mbuf *om = ble_hs_mbuf_from_flat(payload, (uint16_t)payload_len);
     if (om == NULL) {
       ESP_LOGW(TAG, "Location write failed: no mbuf");
-      return false;
+      rc = BLE_HS_ENOMEM;
+    } else {
+      rc = ble_gattc_write_long(s_handles.conn_handle, s_handles.chr_dd11, 0,
+                                om, location_write_cb, NULL);
     }
-    rc = ble_gattc_write_long(s_handles.conn_handle, s_handles.chr_dd11, 0, om,
-                              NULL, NULL);
   } else {
     rc = ble_gattc_write_flat(s_handles.conn_handle, s_handles.chr_dd11,
-                              payload, payload_len, NULL, NULL);
+                              payload, payload_len, location_write_cb, NULL);
+  }
+  if (rc != 0) {
+    s_loc_write_inflight = false;
+    s_focus_write_us = 0;
+    fix_latency_abort();
   }
 #if ALPHALOC_VERBOSE
   if (!s_payload_logged) {
@@ -853,8 +1087,11 @@ bool ble_client_send_location(const gps_fix_t *fix) {
     ESP_LOG_BUFFER_HEX(TAG, payload, payload_len);
   }
 #endif
-  VLOGI("Location write %s (%u bytes)", rc == 0 ? "ok" : "failed",
-        (unsigned)payload_len);
+  TRACE_I("Location write %s (%u bytes)", rc == 0 ? "ok" : "failed",
+          (unsigned)payload_len);
+  if (rc == 0) {
+    boot_profile_mark(BOOT_MARK_FIRST_LOCATION);
+  }
   if (rc == 0 && s_ff02_cccd_deferred && !s_ff02_cccd_sent && s_encrypted &&
       s_handles.cccd_ff02 != 0) {
     s_ff02_cccd_sent = true;
@@ -864,12 +1101,55 @@ bool ble_client_send_location(const gps_fix_t *fix) {
   return rc == 0;
 }
 
+bool ble_client_is_busy(void) {
+  if (s_connecting_camera) {
+    return true;
+  }
+  if (s_handles.conn_handle == BLE_HS_CONN_HANDLE_NONE) {
+    return false;
+  }
+  // Pairing, discovery and the DD30/DD31/DD21 handshake run until location
+  // updates are enabled.
+  if (!s_location_enabled || s_dsc_in_progress || s_notify_pending ||
+      s_loc_write_inflight) {
+    return true;
+  }
+  return s_last_focus_us != 0 &&
+         esp_timer_get_time() - s_last_focus_us < FOCUS_QUIET_US;
+}
+
 bool ble_client_is_connected(void) {
   return s_handles.conn_handle != BLE_HS_CONN_HANDLE_NONE;
 }
 
 bool ble_client_is_bonded(void) { return s_bonded_camera; }
 
+static void notify_state(void) {
+  if (s_state_cb) {
+    s_state_cb(s_state_ctx);
+  }
+}
+
+bool ble_client_is_location_enabled(void) {
+  return s_handles.conn_handle != BLE_HS_CONN_HANDLE_NONE &&
+         s_location_enabled;
+}
+
+bool ble_client_get_handle_cache(ble_handle_cache_t *out) {
+  if (!out || !s_handle_cache.valid) {
+    return false;
+  }
+  *out = s_handle_cache;
+  return true;
+}
+
+void ble_client_set_handle_cache(const ble_handle_cache_t *cache) {
+  if (!cache || !cache->valid) {
+    return;
+  }
+  s_handle_cache = *cache;
+}
+
 int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
   switch (event->type) {
   case BLE_GAP_EVENT_DISC: {
@@ -883,6 +1163,7 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
     }
     ble_gap_disc_cancel();
     s_connecting_camera = true;
+    coex_policy_ble_burst();
     ble_gap_connect(s_own_addr_type, &event->disc.addr, 30000, NULL,
                     ble_client_gap_event_cb, NULL);
     VLOGI("Connecting to Sony camera");
@@ -892,15 +1173,22 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
     if (event->connect.status == 0) {
       if (s_connecting_camera) {
         s_handles.conn_handle = event->connect.conn_handle;
+        boot_profile_mark(BOOT_MARK_CAMERA_CONNECTED);
         ESP_LOGI(TAG, "Connected to camera");
+        notify_state();
         struct ble_gap_conn_desc desc;
-        if (ble_gap_conn_find(s_handles.conn_handle, &desc) == 0 &&
-            peer_is_bonded(&desc.peer_ota_addr)) {
+        bool have_desc = ble_gap_conn_find(s_handles.conn_handle, &desc) == 0;
+        if (have_desc && peer_is_bonded(&desc.peer_ota_addr)) {
           ESP_LOGI(TAG, "Existing bond found; skipping pairing");
         }
         VLOGI("Start security");
         ble_gap_security_initiate(s_handles.conn_handle);
-        start_location_service_discovery(s_handles.conn_handle);
+        if (have_desc && restore_cached_handles(&desc)) {
+          ESP_LOGI(TAG, "Using cached GATT handles; skipping discovery");
+          enable_location_updates(s_handles.conn_handle);
+        } else {
+          start_location_service_discovery(s_handles.conn_handle);
+        }
         s_connecting_camera = false;
       } else {
         ESP_LOGI(TAG, "Config client connected");
@@ -919,6 +1207,7 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
       s_handles.conn_handle = BLE_HS_CONN_HANDLE_NONE;
       s_connecting_camera = false;
       s_location_enabled = false;
+      s_loc_write_inflight = false;
       s_dd21_ready = false;
       s_dd21_pending = false;
       s_encrypted = false;
@@ -933,6 +1222,8 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
       s_ff02_cccd_sent = false;
       s_bonded_camera = false;
       s_retried_disc_after_enc = false;
+      s_handles_from_cache = false;
+      notify_state();
       ble_start_scan();
     } else {
       ESP_LOGI(TAG, "Config client disconnected");
@@ -940,9 +1231,9 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
     return 0;
   }
   case BLE_GAP_EVENT_NOTIFY_RX: {
+    TRACE_I("Notify rx handle=%u len=%u", event->notify_rx.attr_handle,
+            (unsigned)event->notify_rx.om->om_len);
 #if ALPHALOC_VERBOSE
-    ESP_LOGI(TAG, "Notify rx handle=%u len=%u", event->notify_rx.attr_handle,
-             (unsigned)event->notify_rx.om->om_len);
     ESP_LOG_BUFFER_HEX(TAG, event->notify_rx.om->om_data,
                        event->notify_rx.om->om_len);
 #endif
@@ -951,10 +1242,14 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
       if (event->notify_rx.om->om_len == sizeof(focus_msg) &&
           memcmp(event->notify_rx.om->om_data, focus_msg, sizeof(focus_msg)) ==
               0) {
-        ESP_LOGI(TAG, "Focus acquired notification");
+        TRACE_I("Focus acquired notification");
+        s_focus_rx_us = esp_timer_get_time();
+        s_last_focus_us = s_focus_rx_us;
+        coex_policy_ble_burst();
         if (s_focus_cb) {
           s_focus_cb(s_focus_ctx);
         }
+        s_focus_rx_us = 0;
       }
     }
     return 0;
@@ -1009,6 +1304,7 @@ int ble_client_gap_event_cb(struct ble_gap_event *event, void *arg) {
       s_bonded_camera = false;
     }
     ESP_LOGI(TAG, "Encryption %s", s_encrypted ? "enabled" : "failed");
+    notify_state();
     if (s_encrypted && s_dd21_pending && s_handles.chr_dd21 != 0 &&
         !s_dd21_ready) {
       s_dd21_pending = false;
@@ -1035,6 +1331,7 @@ static void ble_start_scan(void) {
   params.filter_duplicates = 1;
   ble_gap_disc(s_own_addr_type, BLE_HS_FOREVER, &params,
                ble_client_gap_event_cb, NULL);
+  boot_profile_mark(BOOT_MARK_FIRST_SCAN);
   ESP_LOGI(TAG, "BLE scanning");
 }
 
@@ -1044,9 +1341,116 @@ static void ble_on_sync(void) {
   ble_config_server_on_sync();
 }
 
+static void config_changed_cb(const app_config_t *cfg, uint32_t changed,
+                              void *ctx) {
+  (void)ctx;
+  if (changed & CONFIG_CHANGED_TZ_DST) {
+    // Picked up by the next location payload; no reconnect needed.
+    s_tz_off_min = cfg->tz_offset_min;
+    s_dst_off_min = cfg->dst_offset_min;
+    s_auto_zone = -2;  // log the automatic offsets again
+    ESP_LOGI(TAG, "TZ/DST updated: %u/%u%s", s_tz_off_min, s_dst_off_min,
+             cfg->tz_auto ? " (auto)" : "");
+  }
+  // Name/MAC filters and the passkey are read from the live config when
+  // needed, so they apply to the next advertisement or pairing as-is.
+}
+
+// Writes the parked entries of obj_type (-1 = all) through the original
+// store. Host task only. Returns the time spent writing.
+static uint32_t bond_flush_now(int obj_type) {
+  if (s_bond_pending_count == 0) {
+    return 0;
+  }
+  const int64_t start_us = esp_timer_get_time();
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < s_bond_pending_count; ++i) {
+    bond_write_t *w = &s_bond_pending[i];
+    if (obj_type >= 0 && w->obj_type != obj_type) {
+      s_bond_pending[kept++] = *w;
+      continue;
+    }
+    int rc = s_store_write(w->obj_type, &w->value);
+    if (rc != 0) {
+      ESP_LOGW(TAG, "Bond store write failed: %d", rc);
+    }
+  }
+  s_bond_pending_count = kept;
+  return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void bond_flush_event(struct ble_npl_event *ev) {
+  (void)ev;
+  s_bond_flush_us = bond_flush_now(-1);
+  xSemaphoreGive(s_bond_flush_done);
+}
+
+static uint32_t bond_flush_job(void *ctx) {
+  (void)ctx;
+  if (xTaskGetCurrentTaskHandle() == s_host_task) {
+    return bond_flush_now(-1);
+  }
+  xSemaphoreTake(s_bond_flush_done, 0);
+  ble_npl_eventq_put(nimble_port_get_dflt_eventq(), &s_bond_flush_ev);
+  if (xSemaphoreTake(s_bond_flush_done, pdMS_TO_TICKS(1000)) != pdTRUE) {
+    ESP_LOGW(TAG, "Bond flush timed out");
+    return 0;
+  }
+  return s_bond_flush_us;
+}
+
+static int bond_store_write(int obj_type, const union ble_store_value *val) {
+  if (s_bond_pending_count == BOND_PENDING_MAX) {
+    flash_sched_record_stall(bond_flush_now(-1));
+  }
+  s_bond_pending[s_bond_pending_count].obj_type = obj_type;
+  s_bond_pending[s_bond_pending_count].value = *val;
+  s_bond_pending_count++;
+  flash_sched_submit(FLASH_JOB_BOND, bond_flush_job, NULL, 0);
+  return 0;
+}
+
+// Reads and deletes go to the original store, so parked writes of the same
+// type are persisted first. Other types (e.g. CCCD lookups during bring-up)
+// do not force a flush.
+static int bond_store_read(int obj_type, const union ble_store_key *key,
+                           union ble_store_value *val) {
+  flash_sched_record_stall(bond_flush_now(obj_type));
+  return s_store_read(obj_type, key, val);
+}
+
+static int bond_store_delete(int obj_type, const union ble_store_key *key) {
+  flash_sched_record_stall(bond_flush_now(obj_type));
+  return s_store_delete(obj_type, key);
+}
+
+static void bond_store_wrap(void) {
+  s_store_read = ble_hs_cfg.store_read_cb;
+  s_store_write = ble_hs_cfg.store_write_cb;
+  s_store_delete = ble_hs_cfg.store_delete_cb;
+#if ALPHALOC_STATIC_ALLOC
+  s_bond_flush_done = xSemaphoreCreateBinaryStatic(&s_bond_flush_done_buf);
+#else
+  s_bond_flush_done = xSemaphoreCreateBinary();
+#endif
+  if (!s_store_read || !s_store_write || !s_store_delete ||
+      !s_bond_flush_done) {
+    return;
+  }
+  ble_npl_event_init(&s_bond_flush_ev, bond_flush_event, NULL);
+  ble_hs_cfg.store_read_cb = bond_store_read;
+  ble_hs_cfg.store_write_cb = bond_store_write;
+  ble_hs_cfg.store_delete_cb = bond_store_delete;
+}
+
 static void ble_host_task(void *param) {
+  s_host_task = xTaskGetCurrentTaskHandle();
   nimble_port_run();
+#if ALPHALOC_STATIC_ALLOC
+  vTaskDelete(NULL);
+#else
   nimble_port_freertos_deinit();
+#endif
 }
 
 void ble_client_init(const app_config_t *cfg) {
@@ -1058,6 +1462,7 @@ void ble_client_init(const app_config_t *cfg) {
   s_require_tz_dst = false;
   s_tz_off_min = cfg ? cfg->tz_offset_min : 0;
   s_dst_off_min = cfg ? cfg->dst_offset_min : 0;
+  config_add_listener(config_changed_cb, NULL);
   s_connecting_camera = false;
   s_dd21_retry = 0;
   s_location_enabled = false;
@@ -1076,6 +1481,7 @@ void ble_client_init(const app_config_t *cfg) {
   s_ff02_cccd_deferred = false;
   s_ff02_cccd_sent = false;
   s_retried_disc_after_enc = false;
+  s_handles_from_cache = false;
 #if ALPHALOC_VERBOSE
   s_payload_logged = false;
 #endif
@@ -1084,6 +1490,7 @@ void ble_client_init(const app_config_t *cfg) {
   ble_svc_gap_init();
   ble_svc_gatt_init();
   ble_store_config_init();
+  bond_store_wrap();
   ble_config_server_register((app_config_t *)cfg);
 
   ble_svc_gap_device_name_set("AlphaLoc");
@@ -1108,7 +1515,23 @@ void ble_client_init(const app_config_t *cfg) {
   };
   esp_timer_create(&dsc_timer_args, &s_dsc_retry_timer);
 
+#if ALPHALOC_STATIC_ALLOC
+  // Same core and priority nimble_port_freertos_init() would use, but from
+  // the static stack pool.
+  if (task_plan_create(TASK_ROLE_BLE_HOST, ble_host_task, "nimble_host",
+                       CONFIG_BT_NIMBLE_HOST_TASK_STACK_SIZE, NULL,
+                       NULL) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create nimble_host task");
+  }
+#else
   nimble_port_freertos_init(ble_host_task);
+#endif
+}
+
+void ble_client_get_focus_stats(ble_focus_stats_t *out) {
+  if (out) {
+    *out = s_focus_stats;
+  }
 }
 
 void ble_client_set_focus_callback(ble_focus_cb_t cb, void *ctx) {
@@ -1116,6 +1539,11 @@ void ble_client_set_focus_callback(ble_focus_cb_t cb, void *ctx) {
   s_focus_ctx = ctx;
 }
 
+void ble_client_set_state_callback(ble_state_cb_t cb, void *ctx) {
+  s_state_ctx = ctx;
+  s_state_cb = cb;
+}
+
 void ble_client_deinit(void) {
   // Stop and delete the retry timer to prevent resource leak
   if (s_dsc_retry_timer) {
@@ -5,6 +5,7 @@
 #include <string.h>
 
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "host/ble_gap.h"
 #include "host/ble_hs.h"
 #include "host/ble_uuid.h"
@@ -13,139 +14,92 @@
 #include "services/gap/ble_svc_gap.h"
 
 #include "ble_client.h"
+#include "config_schema.h"
 #include "gps.h"
 
 static const char *TAG = "ble_cfg_srv";
 
+// Read-only status values and control points; settings come from
+// CONFIG_SCHEMA.
 typedef enum {
-  FIELD_CAM_NAME = 1,
-  FIELD_CAM_MAC,
-  FIELD_TZ_OFF,
-  FIELD_DST_OFF,
-  FIELD_WIFI_SSID,
-  FIELD_WIFI_PASS,
-  FIELD_AP_SSID,
-  FIELD_AP_PASS,
-  FIELD_MAX_GPS_AGE,
-  FIELD_STATUS_GPS_LOCK,
+  FIELD_STATUS_GPS_LOCK = 1,
   FIELD_STATUS_GPS_SATS,
   FIELD_STATUS_GPS_CONST,
   FIELD_STATUS_CAM_CONN,
   FIELD_STATUS_CAM_BOND,
+  FIELD_CTRL_CONFIG_WINDOW,
 } field_id_t;
 
+// Upper bound for CONFIG_F_BLE settings in the schema.
+#define MAX_SETTING_CHRS 16
+#define STATUS_CHR_COUNT 6
+
 static app_config_t *s_cfg;
 static bool s_synced;
 static bool s_adv_requested;
+static void (*s_window_cb)(void *ctx);
+static void *s_window_ctx;
+static volatile int64_t s_last_activity_us;
 
-static const ble_uuid128_t k_svc_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x01, 0x00, 0x7E, 0xA1);
+// Setting characteristics use the service base with the schema id in byte 12.
+#define CFG_UUID128(id)                                                  \
+  BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E, 0x5B, \
+                   0x4F, 0x4A, 0x1F, (id), 0x00, 0x7E, 0xA1)
 
-static const ble_uuid128_t k_chr_cam_name_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x02, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_cam_mac_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x03, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_tz_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x04, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_dst_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x05, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_wifi_ssid_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x07, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_wifi_pass_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x08, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_ap_ssid_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x09, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_ap_pass_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x0A, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_max_gps_age_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x0B, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_status_gps_lock_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x0C, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_status_gps_sats_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x0D, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_status_gps_const_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x0E, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_status_cam_conn_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x0F, 0x00, 0x7E, 0xA1);
-static const ble_uuid128_t k_chr_status_cam_bond_uuid =
-    BLE_UUID128_INIT(0xB1, 0xF0, 0xB4, 0xD5, 0x79, 0x7B, 0x5A, 0x9E,
-                     0x5B, 0x4F, 0x4A, 0x1F, 0x10, 0x00, 0x7E, 0xA1);
+static const ble_uuid128_t k_svc_uuid = CFG_UUID128(0x01);
+static const ble_uuid128_t k_chr_status_gps_lock_uuid = CFG_UUID128(0x0C);
+static const ble_uuid128_t k_chr_status_gps_sats_uuid = CFG_UUID128(0x0D);
+static const ble_uuid128_t k_chr_status_gps_const_uuid = CFG_UUID128(0x0E);
+static const ble_uuid128_t k_chr_status_cam_conn_uuid = CFG_UUID128(0x0F);
+static const ble_uuid128_t k_chr_status_cam_bond_uuid = CFG_UUID128(0x10);
+static const ble_uuid128_t k_chr_ctrl_config_window_uuid = CFG_UUID128(0x11);
 
-static void copy_str_field(char *dst, size_t dst_len, const char *src, size_t src_len) {
-  size_t copy_len = src_len < dst_len - 1 ? src_len : dst_len - 1;
-  memcpy(dst, src, copy_len);
-  dst[copy_len] = '\0';
-}
+static ble_uuid128_t s_setting_uuids[MAX_SETTING_CHRS];
+static struct ble_gatt_chr_def s_chrs[MAX_SETTING_CHRS + STATUS_CHR_COUNT + 1];
+static struct ble_gatt_svc_def s_gatt_svcs[2];
+
+static int setting_access_cb(uint16_t conn_handle, uint16_t attr_handle,
+                             struct ble_gatt_access_ctxt *ctxt, void *arg) {
+  (void)conn_handle;
+  (void)attr_handle;
+  const config_field_t *f = (const config_field_t *)arg;
+  char buf[CONFIG_STR_MAX_64] = {0};
+  s_last_activity_us = esp_timer_get_time();
 
-static bool parse_u16_field(const char *buf, uint16_t *out) {
-  if (buf == NULL || buf[0] == '\0') {
-    return false;
+  if (ctxt->op == BLE_GATT_ACCESS_OP_READ_CHR) {
+    size_t len = config_field_format(f, s_cfg, buf, sizeof(buf));
+    return os_mbuf_append(ctxt->om, buf, len) == 0 ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
   }
-  char *end = NULL;
-  unsigned long val = strtoul(buf, &end, 10);
-  if (end == buf || *end != '\0' || val > 1440) {
-    return false;
+
+  if (ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR) {
+    int rc = ble_hs_mbuf_to_flat(ctxt->om, buf, sizeof(buf) - 1, NULL);
+    if (rc != 0) {
+      return BLE_ATT_ERR_UNLIKELY;
+    }
+    app_config_t next = *s_cfg;
+    if (!config_field_parse(f, buf, &next)) {
+      return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    config_update(s_cfg, &next);
+    return 0;
   }
-  *out = (uint16_t)val;
-  return true;
+
+  return BLE_ATT_ERR_UNLIKELY;
 }
 
-static int gatt_access_cb(uint16_t conn_handle, uint16_t attr_handle,
-                          struct ble_gatt_access_ctxt *ctxt, void *arg) {
+static int status_access_cb(uint16_t conn_handle, uint16_t attr_handle,
+                            struct ble_gatt_access_ctxt *ctxt, void *arg) {
   (void)conn_handle;
   (void)attr_handle;
   field_id_t field = (field_id_t)(intptr_t)arg;
-  char buf[CONFIG_STR_MAX_64] = {0};
+  char buf[8] = {0};
   gps_status_t status;
+  s_last_activity_us = esp_timer_get_time();
 
   if (ctxt->op == BLE_GATT_ACCESS_OP_READ_CHR) {
     const char *value = "";
     char num_buf[8];
     switch (field) {
-      case FIELD_CAM_NAME:
-        value = s_cfg->camera_name_prefix;
-        break;
-      case FIELD_CAM_MAC:
-        value = s_cfg->camera_mac_prefix;
-        break;
-      case FIELD_TZ_OFF:
-        snprintf(num_buf, sizeof(num_buf), "%u", s_cfg->tz_offset_min);
-        value = num_buf;
-        break;
-      case FIELD_DST_OFF:
-        snprintf(num_buf, sizeof(num_buf), "%u", s_cfg->dst_offset_min);
-        value = num_buf;
-        break;
-      case FIELD_WIFI_SSID:
-        value = s_cfg->wifi_ssid;
-        break;
-      case FIELD_WIFI_PASS:
-        value = s_cfg->wifi_pass;
-        break;
-      case FIELD_AP_SSID:
-        value = s_cfg->ap_ssid;
-        break;
-      case FIELD_AP_PASS:
-        value = s_cfg->ap_pass;
-        break;
-      case FIELD_MAX_GPS_AGE:
-        snprintf(num_buf, sizeof(num_buf), "%u", (unsigned)s_cfg->max_gps_age_s);
-        value = num_buf;
-        break;
       case FIELD_STATUS_GPS_LOCK:
         if (gps_get_status(&status)) {
           snprintf(num_buf, sizeof(num_buf), "%u", status.has_lock ? 1 : 0);
@@ -172,6 +126,9 @@ static int gatt_access_cb(uint16_t conn_handle, uint16_t attr_handle,
         snprintf(num_buf, sizeof(num_buf), "%u", ble_client_is_bonded() ? 1 : 0);
         value = num_buf;
         break;
+      case FIELD_CTRL_CONFIG_WINDOW:
+        value = "0";
+        break;
       default:
         return BLE_ATT_ERR_UNLIKELY;
     }
@@ -179,142 +136,82 @@ static int gatt_access_cb(uint16_t conn_handle, uint16_t attr_handle,
   }
 
   if (ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR) {
+    if (field != FIELD_CTRL_CONFIG_WINDOW) {
+      return BLE_ATT_ERR_WRITE_NOT_PERMITTED;
+    }
     int rc = ble_hs_mbuf_to_flat(ctxt->om, buf, sizeof(buf) - 1, NULL);
     if (rc != 0) {
       return BLE_ATT_ERR_UNLIKELY;
     }
-
-    switch (field) {
-      case FIELD_CAM_NAME:
-        copy_str_field(s_cfg->camera_name_prefix, sizeof(s_cfg->camera_name_prefix), buf, strlen(buf));
-        break;
-      case FIELD_CAM_MAC:
-        copy_str_field(s_cfg->camera_mac_prefix, sizeof(s_cfg->camera_mac_prefix), buf, strlen(buf));
-        break;
-      case FIELD_TZ_OFF: {
-        uint16_t tz;
-        if (!parse_u16_field(buf, &tz)) {
-          return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
-        }
-        s_cfg->tz_offset_min = tz;
-        break;
-      }
-      case FIELD_DST_OFF: {
-        uint16_t dst;
-        if (!parse_u16_field(buf, &dst)) {
-          return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
-        }
-        s_cfg->dst_offset_min = dst;
-        break;
-      }
-      case FIELD_WIFI_SSID:
-        copy_str_field(s_cfg->wifi_ssid, sizeof(s_cfg->wifi_ssid), buf, strlen(buf));
-        break;
-      case FIELD_WIFI_PASS:
-        copy_str_field(s_cfg->wifi_pass, sizeof(s_cfg->wifi_pass), buf, strlen(buf));
-        break;
-      case FIELD_AP_SSID:
-        copy_str_field(s_cfg->ap_ssid, sizeof(s_cfg->ap_ssid), buf, strlen(buf));
-        break;
-      case FIELD_AP_PASS:
-        copy_str_field(s_cfg->ap_pass, sizeof(s_cfg->ap_pass), buf, strlen(buf));
-        break;
-      case FIELD_MAX_GPS_AGE: {
-        uint16_t max_age = 0;
-        if (!parse_u16_field(buf, &max_age)) {
-          return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
-        }
-        s_cfg->max_gps_age_s = max_age;
-        break;
-      }
-      case FIELD_STATUS_GPS_LOCK:
-      case FIELD_STATUS_GPS_SATS:
-      case FIELD_STATUS_GPS_CONST:
-      case FIELD_STATUS_CAM_CONN:
-      case FIELD_STATUS_CAM_BOND:
-        return BLE_ATT_ERR_WRITE_NOT_PERMITTED;
-      default:
-        return BLE_ATT_ERR_UNLIKELY;
+    // Control point, not a setting: nothing to persist.
+    if (strcmp(buf, "1") != 0) {
+      return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    if (s_window_cb) {
+      s_window_cb(s_window_ctx);
     }
-
-    config_save(s_cfg);
     return 0;
   }
 
   return BLE_ATT_ERR_UNLIKELY;
 }
 
-static const struct ble_gatt_svc_def gatt_svcs[] = {
-    {
-        .type = BLE_GATT_SVC_TYPE_PRIMARY,
-        .uuid = &k_svc_uuid.u,
-        .characteristics = (struct ble_gatt_chr_def[]){
-            {.uuid = &k_chr_cam_name_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_CAM_NAME},
-            {.uuid = &k_chr_cam_mac_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_CAM_MAC},
-            {.uuid = &k_chr_tz_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_TZ_OFF},
-            {.uuid = &k_chr_dst_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_DST_OFF},
-            {.uuid = &k_chr_wifi_ssid_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_WIFI_SSID},
-            {.uuid = &k_chr_wifi_pass_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_WIFI_PASS},
-            {.uuid = &k_chr_ap_ssid_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_AP_SSID},
-            {.uuid = &k_chr_ap_pass_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_AP_PASS},
-            {.uuid = &k_chr_max_gps_age_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
-             .arg = (void *)FIELD_MAX_GPS_AGE},
-            {.uuid = &k_chr_status_gps_lock_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ,
-             .arg = (void *)FIELD_STATUS_GPS_LOCK},
-            {.uuid = &k_chr_status_gps_sats_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ,
-             .arg = (void *)FIELD_STATUS_GPS_SATS},
-            {.uuid = &k_chr_status_gps_const_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ,
-             .arg = (void *)FIELD_STATUS_GPS_CONST},
-            {.uuid = &k_chr_status_cam_conn_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ,
-             .arg = (void *)FIELD_STATUS_CAM_CONN},
-            {.uuid = &k_chr_status_cam_bond_uuid.u,
-             .access_cb = gatt_access_cb,
-             .flags = BLE_GATT_CHR_F_READ,
-             .arg = (void *)FIELD_STATUS_CAM_BOND},
-            {0},
-        },
-    },
-    {0},
-};
+static void add_status_chr(size_t *n, const ble_uuid128_t *uuid,
+                           field_id_t field, uint16_t flags) {
+  s_chrs[*n] = (struct ble_gatt_chr_def){
+      .uuid = &uuid->u,
+      .access_cb = status_access_cb,
+      .flags = flags,
+      .arg = (void *)(intptr_t)field,
+  };
+  (*n)++;
+}
+
+// Builds the service definition from the schema; NimBLE keeps pointers to
+// these tables, so they are static.
+static void build_gatt_svcs(void) {
+  size_t n = 0;
+  for (size_t i = 0; i < g_config_field_count && n < MAX_SETTING_CHRS; ++i) {
+    const config_field_t *f = &g_config_fields[i];
+    if (!(f->flags & CONFIG_F_BLE)) {
+      continue;
+    }
+    s_setting_uuids[n] = (ble_uuid128_t)CFG_UUID128(f->id);
+    s_chrs[n] = (struct ble_gatt_chr_def){
+        .uuid = &s_setting_uuids[n].u,
+        .access_cb = setting_access_cb,
+        .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
+        .arg = (void *)f,
+    };
+    n++;
+  }
+  add_status_chr(&n, &k_chr_status_gps_lock_uuid, FIELD_STATUS_GPS_LOCK,
+                 BLE_GATT_CHR_F_READ);
+  add_status_chr(&n, &k_chr_status_gps_sats_uuid, FIELD_STATUS_GPS_SATS,
+                 BLE_GATT_CHR_F_READ);
+  add_status_chr(&n, &k_chr_status_gps_const_uuid, FIELD_STATUS_GPS_CONST,
+                 BLE_GATT_CHR_F_READ);
+  add_status_chr(&n, &k_chr_status_cam_conn_uuid, FIELD_STATUS_CAM_CONN,
+                 BLE_GATT_CHR_F_READ);
+  add_status_chr(&n, &k_chr_status_cam_bond_uuid, FIELD_STATUS_CAM_BOND,
+                 BLE_GATT_CHR_F_READ);
+  add_status_chr(&n, &k_chr_ctrl_config_window_uuid, FIELD_CTRL_CONFIG_WINDOW,
+                 BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE);
+  s_chrs[n] = (struct ble_gatt_chr_def){0};
+
+  s_gatt_svcs[0] = (struct ble_gatt_svc_def){
+      .type = BLE_GATT_SVC_TYPE_PRIMARY,
+      .uuid = &k_svc_uuid.u,
+      .characteristics = s_chrs,
+  };
+  s_gatt_svcs[1] = (struct ble_gatt_svc_def){0};
+}
 
 void ble_config_server_register(app_config_t *cfg) {
   s_cfg = cfg;
-  ble_gatts_count_cfg(gatt_svcs);
-  ble_gatts_add_svcs(gatt_svcs);
+  build_gatt_svcs();
+  ble_gatts_count_cfg(s_gatt_svcs);
+  ble_gatts_add_svcs(s_gatt_svcs);
 }
 
 void ble_config_server_on_sync(void) {
@@ -357,6 +254,13 @@ void ble_config_server_start(void) {
   }
 }
 
+void ble_config_server_set_window_callback(void (*cb)(void *ctx), void *ctx) {
+  s_window_cb = cb;
+  s_window_ctx = ctx;
+}
+
+int64_t ble_config_server_last_activity_us(void) { return s_last_activity_us; }
+
 void ble_config_server_stop(void) {
   s_adv_requested = false;
   if (s_synced) {
@@ -0,0 +1,61 @@
+#include "boot_profile.h"
+
+#include <stdio.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "boot";
+
+// Microseconds since esp_timer start (shortly after the bootloader hands
+// over), 0 = not reached yet. Only the first occurrence of a mark counts.
+static int64_t s_marks_us[BOOT_MARK_COUNT];
+
+static const char *const k_mark_names[BOOT_MARK_COUNT] = {
+    [BOOT_MARK_APP_MAIN] = "app_main",
+    [BOOT_MARK_NVS_READY] = "nvs",
+    [BOOT_MARK_CONFIG_LOADED] = "config",
+    [BOOT_MARK_GPS_STARTED] = "gps",
+    [BOOT_MARK_BLE_STARTED] = "ble",
+    [BOOT_MARK_FIRST_SCAN] = "scan",
+    [BOOT_MARK_CAMERA_CONNECTED] = "camera",
+    [BOOT_MARK_FIRST_FIX] = "fix",
+    [BOOT_MARK_FIRST_LOCATION] = "location",
+    [BOOT_MARK_WIFI_STARTED] = "wifi",
+    [BOOT_MARK_UI_REACHABLE] = "ui",
+};
+
+static void log_summary(void) {
+  char buf[256];
+  size_t pos = 0;
+  buf[0] = '\0';
+  for (int i = 0; i < BOOT_MARK_COUNT && pos < sizeof(buf); ++i) {
+    if (s_marks_us[i] == 0) {
+      continue;
+    }
+    const int n = snprintf(buf + pos, sizeof(buf) - pos, " %s=%lldms",
+                           k_mark_names[i], (long long)(s_marks_us[i] / 1000));
+    if (n < 0 || (size_t)n >= sizeof(buf) - pos) {
+      break;  // truncated; buf is still terminated
+    }
+    pos += (size_t)n;
+  }
+  ESP_LOGI(TAG, "Boot profile:%s", buf);
+}
+
+void boot_profile_mark(boot_mark_t mark) {
+  if (mark >= BOOT_MARK_COUNT || s_marks_us[mark] != 0) {
+    return;
+  }
+  s_marks_us[mark] = esp_timer_get_time();
+  if (mark == BOOT_MARK_FIRST_SCAN || mark == BOOT_MARK_FIRST_LOCATION) {
+    log_summary();
+  }
+}
+
+int64_t boot_profile_get_us(boot_mark_t mark) {
+  if (mark >= BOOT_MARK_COUNT) {
+    return 0;
+  }
+  return s_marks_us[mark];
+}
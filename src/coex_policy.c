@@ -0,0 +1,148 @@
+#include "coex_policy.h"
+
+#include "esp_coexist.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+
+// 0 = leave coexistence and power save at the IDF defaults (for comparing
+// write latency against the policy).
+#ifndef ALPHALOC_COEX_POLICY
+#define ALPHALOC_COEX_POLICY 1
+#endif
+// How often the policy re-evaluates; the switch to BLE is also pushed
+// directly from the camera link.
+#define COEX_POLL_US (250 * 1000)
+
+typedef enum {
+  COEX_STATE_NONE = 0,
+  COEX_STATE_BLE,   // camera bring-up or focus burst
+  COEX_STATE_IDLE,  // WiFi up, nobody using the UI
+  COEX_STATE_WEB,   // a page is loading or watching status
+} coex_state_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool s_wifi_on;
+static coex_busy_fn_t s_ble_busy;
+static coex_busy_fn_t s_web_active;
+static coex_latency_t s_latency[2];
+
+#if ALPHALOC_COEX_POLICY
+static const char *TAG = "coex";
+// evaluate() only ever runs in the esp_timer task: from the poll timer or
+// from the one-shot kick a burst arms. s_state and s_ps are never touched
+// from the NimBLE host, so they need no lock.
+static esp_timer_handle_t s_timer;
+static esp_timer_handle_t s_kick;
+static coex_state_t s_state;
+static wifi_ps_type_t s_ps;
+
+static void set_preference(esp_coex_prefer_t prefer) {
+  // Deprecated in IDF 5, where it no longer steers the coexistence scheduler
+  // on the S3 or C6; the power-save switch in evaluate() is what takes
+  // effect there. Kept for older IDF releases.
+  const esp_err_t err = esp_coex_preference_set(prefer);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Coex preference %d not applied: %s", (int)prefer,
+             esp_err_to_name(err));
+  }
+}
+
+static void evaluate(void *arg) {
+  (void)arg;
+  if (!s_wifi_on) {
+    return;
+  }
+  const bool web = s_web_active && s_web_active();
+  coex_state_t state = COEX_STATE_IDLE;
+  if (s_ble_busy && s_ble_busy()) {
+    state = COEX_STATE_BLE;
+  } else if (web) {
+    state = COEX_STATE_WEB;
+  }
+  if (state != s_state) {
+    s_state = state;
+    // Balanced only while someone uses the UI; otherwise BLE keeps the edge.
+    set_preference(state == COEX_STATE_WEB ? ESP_COEX_PREFER_BALANCE
+                                           : ESP_COEX_PREFER_BT);
+  }
+  // With BLE enabled WIFI_PS_NONE is not allowed; minimum modem sleep is
+  // the low-latency setting. It only affects the STA, the soft-AP keeps
+  // beaconing either way.
+  const wifi_ps_type_t ps = web ? WIFI_PS_MIN_MODEM : WIFI_PS_MAX_MODEM;
+  if (ps != s_ps && esp_wifi_set_ps(ps) == ESP_OK) {
+    s_ps = ps;
+    ESP_LOGI(TAG, "WiFi power save %s", ps == WIFI_PS_MAX_MODEM ? "max" : "min");
+  }
+}
+#endif
+
+void coex_policy_start(coex_busy_fn_t ble_busy, coex_busy_fn_t web_active) {
+  s_ble_busy = ble_busy;
+  s_web_active = web_active;
+#if ALPHALOC_COEX_POLICY
+  s_state = COEX_STATE_NONE;
+  s_ps = WIFI_PS_NONE;
+  if (!s_timer) {
+    const esp_timer_create_args_t args = {.callback = evaluate,
+                                          .name = "coex"};
+    const esp_timer_create_args_t kick_args = {.callback = evaluate,
+                                               .name = "coex_kick"};
+    if (esp_timer_create(&args, &s_timer) != ESP_OK ||
+        esp_timer_create(&kick_args, &s_kick) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to create coex timers");
+      return;
+    }
+  }
+#endif
+  s_wifi_on = true;
+#if ALPHALOC_COEX_POLICY
+  esp_timer_start_once(s_kick, 0);
+  esp_timer_start_periodic(s_timer, COEX_POLL_US);
+#endif
+}
+
+void coex_policy_stop(void) {
+  s_wifi_on = false;
+#if ALPHALOC_COEX_POLICY
+  if (s_timer) {
+    esp_timer_stop(s_timer);
+    esp_timer_stop(s_kick);
+  }
+  set_preference(ESP_COEX_PREFER_BALANCE);
+#endif
+}
+
+void coex_policy_ble_burst(void) {
+#if ALPHALOC_COEX_POLICY
+  // Runs on the NimBLE host; the switch itself is made in timer context.
+  // A kick that is already pending covers this one.
+  if (s_wifi_on && s_kick) {
+    esp_timer_start_once(s_kick, 0);
+  }
+#endif
+}
+
+void coex_policy_record_write(uint32_t latency_us) {
+  portENTER_CRITICAL(&s_lock);
+  coex_latency_t *l = &s_latency[s_wifi_on ? 1 : 0];
+  l->count++;
+  l->total_us += latency_us;
+  if (latency_us > l->max_us) {
+    l->max_us = latency_us;
+  }
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void coex_policy_get_latency(coex_latency_t *wifi_off,
+                             coex_latency_t *wifi_on) {
+  portENTER_CRITICAL(&s_lock);
+  if (wifi_off) {
+    *wifi_off = s_latency[0];
+  }
+  if (wifi_on) {
+    *wifi_on = s_latency[1];
+  }
+  portEXIT_CRITICAL(&s_lock);
+}
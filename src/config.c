@@ -1,8 +1,13 @@
 #include "config.h"
 
+#include <stddef.h>
 #include <string.h>
 
+#include "config_schema.h"
 #include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "flash_sched.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "nvs.h"
@@ -10,88 +15,272 @@
 
 #define NVS_NAMESPACE "alphaloc"
 
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+// Quiet time after the last config_update() before the blob is handed to the
+// flash scheduler, so a burst of BLE writes or form fields ends up as one NVS
+// commit.
+#ifndef ALPHALOC_CONFIG_SAVE_DEBOUNCE_MS
+#define ALPHALOC_CONFIG_SAVE_DEBOUNCE_MS 2000
+#endif
+#define CONFIG_MAX_LISTENERS 6
+
 static const char *TAG = "config";
 static SemaphoreHandle_t s_config_mutex = NULL;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_config_mutex_buf;
+#endif
+
+typedef struct
+{
+  config_listener_t cb;
+  void *ctx;
+} config_listener_slot_t;
+
+static config_listener_slot_t s_listeners[CONFIG_MAX_LISTENERS];
+static size_t s_listener_count = 0;
+static const app_config_t *s_pending_cfg = NULL;
+// Duration of the last NVS write + commit, 0 if the save was skipped.
+static uint32_t s_last_write_us = 0;
 
-static void config_set_str_default(char *dst, size_t dst_len, const char *src)
+void config_set_defaults(app_config_t *cfg)
 {
-  if (!dst || dst_len == 0)
+  memset(cfg, 0, sizeof(*cfg));
+  for (size_t i = 0; i < g_config_field_count; ++i)
   {
-    return;
+    config_field_set_default(&g_config_fields[i], cfg);
   }
-  if (!src)
+}
+
+// Settings are stored as one blob so a save is a single NVS write/commit.
+// Version 2 is a list of (id, length, value) records generated from
+// CONFIG_SCHEMA, so adding a field does not change the format: unknown ids
+// are skipped and missing ones keep their defaults. Version 1 was a fixed
+// struct and is only decoded to migrate.
+#define CONFIG_BLOB_KEY "cfg"
+#define CONFIG_BLOB_VERSION 2
+// Room for every record at its longest (id + length + value).
+#define CONFIG_BLOB_DATA_MAX 384
+
+typedef struct
+{
+  uint16_t version;
+  uint16_t length;
+  uint32_t crc;
+  uint8_t data[CONFIG_BLOB_DATA_MAX];
+} config_blob_t;
+
+typedef struct
+{
+  uint32_t gps_interval_ms;
+  uint32_t max_gps_age_s;
+  uint32_t config_window_s;
+  uint32_t ble_passkey;
+  uint16_t tz_offset_min;
+  uint16_t dst_offset_min;
+  char camera_name_prefix[CONFIG_STR_MAX_32];
+  char camera_mac_prefix[CONFIG_STR_MAX_18];
+  char wifi_ssid[CONFIG_STR_MAX_32];
+  char wifi_pass[CONFIG_STR_MAX_64];
+  char ap_ssid[CONFIG_STR_MAX_32];
+  char ap_pass[CONFIG_STR_MAX_64];
+} config_blob_v1_t;
+
+#define CONFIG_BLOB_HEADER_LEN offsetof(config_blob_t, data)
+
+// Last blob known to be in flash; lets config_save() skip no-op writes.
+static config_blob_t s_stored;
+static size_t s_stored_len = 0;
+
+static size_t config_blob_encode(const app_config_t *cfg, config_blob_t *blob)
+{
+  memset(blob, 0, sizeof(*blob));
+  size_t pos = 0;
+  for (size_t i = 0; i < g_config_field_count; ++i)
   {
-    dst[0] = '\0';
-    return;
+    const config_field_t *f = &g_config_fields[i];
+    const uint8_t *value = (const uint8_t *)cfg + f->offset;
+    size_t len = f->type == CONFIG_TYPE_STR ? strnlen((const char *)value,
+                                                      f->size)
+                                            : f->size;
+    if (pos + 2 + len > sizeof(blob->data))
+    {
+      ESP_LOGE(TAG, "Config blob full at %s", f->key);
+      break;
+    }
+    blob->data[pos++] = f->id;
+    blob->data[pos++] = (uint8_t)len;
+    memcpy(&blob->data[pos], value, len);
+    pos += len;
   }
-  strncpy(dst, src, dst_len - 1);
-  dst[dst_len - 1] = '\0';
+  blob->version = CONFIG_BLOB_VERSION;
+  blob->length = (uint16_t)pos;
+  blob->crc = esp_rom_crc32_le(0, blob->data, pos);
+  return CONFIG_BLOB_HEADER_LEN + pos;
 }
 
-void config_set_defaults(app_config_t *cfg)
+static void config_decode_v1(const config_blob_v1_t *p, app_config_t *cfg)
 {
-  memset(cfg, 0, sizeof(*cfg));
-  cfg->gps_interval_ms = 5000;
-  cfg->max_gps_age_s = 300;
-  cfg->config_window_s = 300;
-  cfg->ble_passkey = 123456;
-  cfg->tz_offset_min = 60;
-  cfg->dst_offset_min = 60;
-#ifdef ALPHALOC_DEFAULT_CAMERA_NAME_PREFIX
-  config_set_str_default(cfg->camera_name_prefix,
-                         sizeof(cfg->camera_name_prefix),
-                         ALPHALOC_DEFAULT_CAMERA_NAME_PREFIX);
-#else
-  config_set_str_default(cfg->camera_name_prefix,
-                         sizeof(cfg->camera_name_prefix), "SonyA7");
-#endif
-
-#ifdef ALPHALOC_DEFAULT_CAMERA_MAC_PREFIX
-  config_set_str_default(cfg->camera_mac_prefix,
-                         sizeof(cfg->camera_mac_prefix),
-                         ALPHALOC_DEFAULT_CAMERA_MAC_PREFIX);
-#else
-  cfg->camera_mac_prefix[0] = '\0';
-#endif
+  cfg->gps_interval_ms = p->gps_interval_ms;
+  cfg->max_gps_age_s = p->max_gps_age_s;
+  cfg->config_window_s = p->config_window_s;
+  cfg->ble_passkey = p->ble_passkey;
+  cfg->tz_offset_min = p->tz_offset_min;
+  cfg->dst_offset_min = p->dst_offset_min;
+  memcpy(cfg->camera_name_prefix, p->camera_name_prefix,
+         sizeof(cfg->camera_name_prefix));
+  memcpy(cfg->camera_mac_prefix, p->camera_mac_prefix,
+         sizeof(cfg->camera_mac_prefix));
+  memcpy(cfg->wifi_ssid, p->wifi_ssid, sizeof(cfg->wifi_ssid));
+  memcpy(cfg->wifi_pass, p->wifi_pass, sizeof(cfg->wifi_pass));
+  memcpy(cfg->ap_ssid, p->ap_ssid, sizeof(cfg->ap_ssid));
+  memcpy(cfg->ap_pass, p->ap_pass, sizeof(cfg->ap_pass));
+}
 
-#ifdef ALPHALOC_DEFAULT_AP_SSID
-  config_set_str_default(cfg->ap_ssid, sizeof(cfg->ap_ssid),
-                         ALPHALOC_DEFAULT_AP_SSID);
-#else
-  config_set_str_default(cfg->ap_ssid, sizeof(cfg->ap_ssid), "AlphaLoc");
-#endif
+static void config_decode_records(const uint8_t *data, size_t len,
+                                  app_config_t *cfg)
+{
+  size_t pos = 0;
+  while (pos + 2 <= len)
+  {
+    uint8_t id = data[pos];
+    uint8_t vlen = data[pos + 1];
+    pos += 2;
+    if (pos + vlen > len)
+    {
+      break;
+    }
+    const config_field_t *f = config_field_by_id(id);
+    if (f && f->type == CONFIG_TYPE_STR && vlen < f->size)
+    {
+      uint8_t *dst = (uint8_t *)cfg + f->offset;
+      memcpy(dst, &data[pos], vlen);
+      dst[vlen] = '\0';
+    }
+    else if (f && f->type != CONFIG_TYPE_STR && vlen == f->size)
+    {
+      // Stored values are range-checked again in case the bounds tightened.
+      uint32_t v = 0;
+      memcpy(&v, &data[pos], vlen);
+      if (v >= f->min && v <= f->max)
+      {
+        memcpy((uint8_t *)cfg + f->offset, &data[pos], vlen);
+      }
+    }
+    pos += vlen;
+  }
+}
 
-#ifdef ALPHALOC_DEFAULT_AP_PASS
-  config_set_str_default(cfg->ap_pass, sizeof(cfg->ap_pass),
-                         ALPHALOC_DEFAULT_AP_PASS);
-#else
-  config_set_str_default(cfg->ap_pass, sizeof(cfg->ap_pass), "alphaloc1234");
-#endif
+static bool config_blob_decode(const config_blob_t *blob, size_t len,
+                               app_config_t *cfg)
+{
+  if (len < CONFIG_BLOB_HEADER_LEN ||
+      len - CONFIG_BLOB_HEADER_LEN < blob->length)
+  {
+    ESP_LOGW(TAG, "Config blob truncated (%u bytes)", (unsigned)len);
+    return false;
+  }
+  if (esp_rom_crc32_le(0, blob->data, blob->length) != blob->crc)
+  {
+    ESP_LOGW(TAG, "Config blob CRC mismatch");
+    return false;
+  }
+  switch (blob->version)
+  {
+  case 1:
+    if (blob->length != sizeof(config_blob_v1_t))
+    {
+      return false;
+    }
+    config_decode_v1((const config_blob_v1_t *)blob->data, cfg);
+    return true;
+  case 2:
+    config_decode_records(blob->data, blob->length, cfg);
+    return true;
+  default:
+    ESP_LOGW(TAG, "Unknown config blob version %u", blob->version);
+    return false;
+  }
+}
 
-#ifdef ALPHALOC_DEFAULT_WIFI_SSID
-  config_set_str_default(cfg->wifi_ssid, sizeof(cfg->wifi_ssid),
-                         ALPHALOC_DEFAULT_WIFI_SSID);
-#else
-  config_set_str_default(cfg->wifi_ssid, sizeof(cfg->wifi_ssid), "WiFi");
-#endif
+static bool config_load_legacy(nvs_handle_t nvs, app_config_t *cfg)
+{
+  bool found = false;
+  for (size_t i = 0; i < g_config_field_count; ++i)
+  {
+    const config_field_t *f = &g_config_fields[i];
+    void *p = (uint8_t *)cfg + f->offset;
+    esp_err_t err = ESP_ERR_NVS_NOT_FOUND;
+    switch (f->type)
+    {
+    case CONFIG_TYPE_STR:
+    {
+      size_t len = f->size;
+      err = nvs_get_str(nvs, f->key, (char *)p, &len);
+      if (err != ESP_OK)
+      {
+        // Legacy behaviour: a missing string key meant empty.
+        ((char *)p)[0] = '\0';
+      }
+      break;
+    }
+    case CONFIG_TYPE_U16:
+      err = nvs_get_u16(nvs, f->key, (uint16_t *)p);
+      break;
+    case CONFIG_TYPE_U32:
+      err = nvs_get_u32(nvs, f->key, (uint32_t *)p);
+      break;
+    }
+    found = found || err == ESP_OK;
+  }
+  return found;
+}
 
-#ifdef ALPHALOC_DEFAULT_WIFI_PASS
-  config_set_str_default(cfg->wifi_pass, sizeof(cfg->wifi_pass),
-                         ALPHALOC_DEFAULT_WIFI_PASS);
-#else
-  config_set_str_default(cfg->wifi_pass, sizeof(cfg->wifi_pass), "changeme");
-#endif
+static esp_err_t config_write_blob(nvs_handle_t nvs, const config_blob_t *blob,
+                                   size_t len)
+{
+  esp_err_t err = nvs_set_blob(nvs, CONFIG_BLOB_KEY, blob, len);
+  if (err == ESP_OK)
+  {
+    err = nvs_commit(nvs);
+  }
+  if (err == ESP_OK)
+  {
+    s_stored = *blob;
+    s_stored_len = len;
+  }
+  return err;
 }
 
-static void config_read_str(nvs_handle_t nvs, const char *key, char *out,
-                            size_t out_len)
+// Moves legacy per-key settings into the blob. The blob is committed before
+// the old keys go, so an interrupted migration just repeats on next boot.
+static void config_migrate_legacy(const app_config_t *cfg)
 {
-  size_t len = out_len;
-  esp_err_t err = nvs_get_str(nvs, key, out, &len);
+  nvs_handle_t nvs;
+  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK)
+  {
+    return;
+  }
+  config_blob_t blob;
+  size_t len = config_blob_encode(cfg, &blob);
+  esp_err_t err = config_write_blob(nvs, &blob, len);
+  if (err == ESP_OK)
+  {
+    for (size_t i = 0; i < g_config_field_count; ++i)
+    {
+      nvs_erase_key(nvs, g_config_fields[i].key);
+    }
+    err = nvs_commit(nvs);
+  }
+  nvs_close(nvs);
   if (err != ESP_OK)
   {
-    out[0] = '\0';
+    ESP_LOGW(TAG, "Config migration failed: %s", esp_err_to_name(err));
+    return;
   }
+  ESP_LOGI(TAG, "Migrated legacy config keys to blob v%d",
+           CONFIG_BLOB_VERSION);
 }
 
 bool config_load(app_config_t *cfg)
@@ -101,9 +290,14 @@ bool config_load(app_config_t *cfg)
   // Initialize mutex on first load
   if (s_config_mutex == NULL)
   {
+#if ALPHALOC_STATIC_ALLOC
+    s_config_mutex = xSemaphoreCreateMutexStatic(&s_config_mutex_buf);
+#else
     s_config_mutex = xSemaphoreCreateMutex();
+#endif
   }
 
+  const int64_t start_us = esp_timer_get_time();
   nvs_handle_t nvs;
   esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs);
   if (err != ESP_OK)
@@ -112,31 +306,39 @@ bool config_load(app_config_t *cfg)
     return false;
   }
 
-  nvs_get_u32(nvs, "gps_int_ms", &cfg->gps_interval_ms);
-  nvs_get_u32(nvs, "max_age_s", &cfg->max_gps_age_s);
-  nvs_get_u32(nvs, "cfg_win_s", &cfg->config_window_s);
-  nvs_get_u32(nvs, "ble_pass", &cfg->ble_passkey);
-  uint16_t tz = cfg->tz_offset_min;
-  uint16_t dst = cfg->dst_offset_min;
-  if (nvs_get_u16(nvs, "tz_off", &tz) == ESP_OK)
+  config_blob_t blob;
+  size_t len = sizeof(blob);
+  err = nvs_get_blob(nvs, CONFIG_BLOB_KEY, &blob, &len);
+  if (err == ESP_OK && config_blob_decode(&blob, len, cfg))
   {
-    cfg->tz_offset_min = tz;
+    nvs_close(nvs);
+    // A blob from an older schema is not remembered, so the next save
+    // rewrites it in the current format.
+    if (blob.version == CONFIG_BLOB_VERSION)
+    {
+      s_stored_len = config_blob_encode(cfg, &s_stored);
+    }
+    ESP_LOGI(TAG, "Config loaded (blob v%u, %u bytes) in %lld us",
+             blob.version, (unsigned)len,
+             (long long)(esp_timer_get_time() - start_us));
+    return true;
   }
-  if (nvs_get_u16(nvs, "dst_off", &dst) == ESP_OK)
+  if (err == ESP_OK)
   {
-    cfg->dst_offset_min = dst;
+    config_set_defaults(cfg);
   }
 
-  config_read_str(nvs, "cam_name", cfg->camera_name_prefix,
-                  sizeof(cfg->camera_name_prefix));
-  config_read_str(nvs, "cam_mac", cfg->camera_mac_prefix,
-                  sizeof(cfg->camera_mac_prefix));
-  config_read_str(nvs, "wifi_ssid", cfg->wifi_ssid, sizeof(cfg->wifi_ssid));
-  config_read_str(nvs, "wifi_pass", cfg->wifi_pass, sizeof(cfg->wifi_pass));
-  config_read_str(nvs, "ap_ssid", cfg->ap_ssid, sizeof(cfg->ap_ssid));
-  config_read_str(nvs, "ap_pass", cfg->ap_pass, sizeof(cfg->ap_pass));
-
+  bool legacy = config_load_legacy(nvs, cfg);
   nvs_close(nvs);
+  if (!legacy)
+  {
+    config_set_defaults(cfg);
+    return false;
+  }
+  ESP_LOGI(TAG, "Config loaded (%u legacy keys) in %lld us",
+           (unsigned)g_config_field_count,
+           (long long)(esp_timer_get_time() - start_us));
+  config_migrate_legacy(cfg);
   return true;
 }
 
@@ -150,6 +352,20 @@ bool config_save(const app_config_t *cfg)
     return false;
   }
 
+  config_blob_t blob;
+  size_t len = config_blob_encode(cfg, &blob);
+  if (len == s_stored_len && memcmp(&blob, &s_stored, len) == 0)
+  {
+    if (s_config_mutex)
+    {
+      xSemaphoreGive(s_config_mutex);
+    }
+    s_last_write_us = 0;
+    ESP_LOGI(TAG, "Config unchanged, skipping flash write");
+    return true;
+  }
+
+  const int64_t start_us = esp_timer_get_time();
   nvs_handle_t nvs;
   esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
   if (err != ESP_OK)
@@ -162,22 +378,9 @@ bool config_save(const app_config_t *cfg)
     return false;
   }
 
-  nvs_set_u32(nvs, "gps_int_ms", cfg->gps_interval_ms);
-  nvs_set_u32(nvs, "max_age_s", cfg->max_gps_age_s);
-  nvs_set_u32(nvs, "cfg_win_s", cfg->config_window_s);
-  nvs_set_u32(nvs, "ble_pass", cfg->ble_passkey);
-  nvs_set_u16(nvs, "tz_off", cfg->tz_offset_min);
-  nvs_set_u16(nvs, "dst_off", cfg->dst_offset_min);
-
-  nvs_set_str(nvs, "cam_name", cfg->camera_name_prefix);
-  nvs_set_str(nvs, "cam_mac", cfg->camera_mac_prefix);
-  nvs_set_str(nvs, "wifi_ssid", cfg->wifi_ssid);
-  nvs_set_str(nvs, "wifi_pass", cfg->wifi_pass);
-  nvs_set_str(nvs, "ap_ssid", cfg->ap_ssid);
-  nvs_set_str(nvs, "ap_pass", cfg->ap_pass);
-
-  err = nvs_commit(nvs);
+  err = config_write_blob(nvs, &blob, len);
   nvs_close(nvs);
+  s_last_write_us = (uint32_t)(esp_timer_get_time() - start_us);
 
   if (s_config_mutex)
   {
@@ -189,5 +392,105 @@ bool config_save(const app_config_t *cfg)
     ESP_LOGE(TAG, "NVS commit failed: %s", esp_err_to_name(err));
     return false;
   }
+  ESP_LOGI(TAG, "Config saved (%u bytes) in %lu us", (unsigned)len,
+           (unsigned long)s_last_write_us);
   return true;
 }
+
+static uint32_t config_diff(const app_config_t *a, const app_config_t *b)
+{
+  uint32_t changed = 0;
+  for (size_t i = 0; i < g_config_field_count; ++i)
+  {
+    const config_field_t *f = &g_config_fields[i];
+    if (!config_field_equal(f, a, b))
+    {
+      changed |= f->changed;
+    }
+  }
+  return changed;
+}
+
+static void config_save_pending(void)
+{
+  const app_config_t *live = s_pending_cfg;
+  if (!live)
+  {
+    return;
+  }
+  s_pending_cfg = NULL;
+  app_config_t snapshot;
+  if (s_config_mutex)
+  {
+    xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  }
+  snapshot = *live;
+  if (s_config_mutex)
+  {
+    xSemaphoreGive(s_config_mutex);
+  }
+  config_save(&snapshot);
+}
+
+static uint32_t config_save_job(void *ctx)
+{
+  (void)ctx;
+  s_last_write_us = 0;
+  config_save_pending();
+  return s_last_write_us;
+}
+
+bool config_add_listener(config_listener_t cb, void *ctx)
+{
+  if (!cb || s_listener_count >= CONFIG_MAX_LISTENERS)
+  {
+    return false;
+  }
+  s_listeners[s_listener_count].cb = cb;
+  s_listeners[s_listener_count].ctx = ctx;
+  s_listener_count++;
+  return true;
+}
+
+// Applies next to the live config, tells listeners which fields changed and
+// schedules a debounced save. Returns the change mask (0 = nothing to do).
+uint32_t config_update(app_config_t *live, const app_config_t *next)
+{
+  if (!live || !next)
+  {
+    return 0;
+  }
+  if (s_config_mutex)
+  {
+    xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  }
+  uint32_t changed = config_diff(live, next);
+  if (changed)
+  {
+    *live = *next;
+  }
+  if (s_config_mutex)
+  {
+    xSemaphoreGive(s_config_mutex);
+  }
+  if (!changed)
+  {
+    return 0;
+  }
+
+  for (size_t i = 0; i < s_listener_count; ++i)
+  {
+    s_listeners[i].cb(live, changed, s_listeners[i].ctx);
+  }
+
+  s_pending_cfg = live;
+  flash_sched_submit(FLASH_JOB_CONFIG, config_save_job, NULL,
+                     ALPHALOC_CONFIG_SAVE_DEBOUNCE_MS);
+  return changed;
+}
+
+// Writes a pending debounced save now, e.g. before deep sleep or reboot.
+void config_flush(void)
+{
+  config_save_pending();
+}
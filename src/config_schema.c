@@ -0,0 +1,171 @@
+#include "config_schema.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MEMBER_SIZE(member) sizeof(((app_config_t *)0)->member)
+
+#define CONFIG_DESC_STR(member, key_, id_, min_, max_, def, flags_, chg,       \
+                        label_)                                                \
+  {.type = CONFIG_TYPE_STR, .id = (id_), .flags = (flags_),                    \
+   .offset = offsetof(app_config_t, member), .size = MEMBER_SIZE(member),      \
+   .min = (min_), .max = MEMBER_SIZE(member) - 1, .def_str = (def),            \
+   .changed = (chg), .key = (key_), .label = (label_)},
+#define CONFIG_DESC_NUM(type_, member, key_, id_, min_, max_, def, flags_,   \
+                        chg, label_)                                           \
+  {.type = (type_), .id = (id_), .flags = (flags_),                            \
+   .offset = offsetof(app_config_t, member), .size = MEMBER_SIZE(member),      \
+   .min = (min_), .max = (max_), .def_num = (def), .changed = (chg),           \
+   .key = (key_), .label = (label_)},
+#define CONFIG_DESC_U16(...) CONFIG_DESC_NUM(CONFIG_TYPE_U16, __VA_ARGS__)
+#define CONFIG_DESC_U32(...) CONFIG_DESC_NUM(CONFIG_TYPE_U32, __VA_ARGS__)
+
+#define CONFIG_DESC(type, member, key, id, min, max, def, flags, chg, label)  \
+  CONFIG_DESC_##type(member, key, id, min, max, def, flags, chg, label)
+
+const config_field_t g_config_fields[] = {CONFIG_SCHEMA(CONFIG_DESC)};
+const size_t g_config_field_count =
+    sizeof(g_config_fields) / sizeof(g_config_fields[0]);
+
+// Catch a table entry whose type does not match its app_config_t member.
+#define CONFIG_CHECK_STR(member)                                               \
+  _Static_assert(MEMBER_SIZE(member) > 1, #member);
+#define CONFIG_CHECK_U16(member)                                               \
+  _Static_assert(MEMBER_SIZE(member) == sizeof(uint16_t), #member);
+#define CONFIG_CHECK_U32(member)                                               \
+  _Static_assert(MEMBER_SIZE(member) == sizeof(uint32_t), #member);
+#define CONFIG_CHECK(type, member, key, id, min, max, def, flags, chg, label) \
+  CONFIG_CHECK_##type(member)
+CONFIG_SCHEMA(CONFIG_CHECK)
+
+const config_field_t *config_field_by_key(const char *key)
+{
+  for (size_t i = 0; i < g_config_field_count; ++i)
+  {
+    if (strcmp(g_config_fields[i].key, key) == 0)
+    {
+      return &g_config_fields[i];
+    }
+  }
+  return NULL;
+}
+
+const config_field_t *config_field_by_id(uint8_t id)
+{
+  for (size_t i = 0; i < g_config_field_count; ++i)
+  {
+    if (g_config_fields[i].id == id)
+    {
+      return &g_config_fields[i];
+    }
+  }
+  return NULL;
+}
+
+static void *field_ptr(const config_field_t *f, app_config_t *cfg)
+{
+  return (uint8_t *)cfg + f->offset;
+}
+
+static const void *field_cptr(const config_field_t *f, const app_config_t *cfg)
+{
+  return (const uint8_t *)cfg + f->offset;
+}
+
+void config_field_set_default(const config_field_t *f, app_config_t *cfg)
+{
+  void *p = field_ptr(f, cfg);
+  switch (f->type)
+  {
+  case CONFIG_TYPE_STR:
+  {
+    char *dst = (char *)p;
+    strncpy(dst, f->def_str ? f->def_str : "", f->size - 1);
+    dst[f->size - 1] = '\0';
+    break;
+  }
+  case CONFIG_TYPE_U16:
+    *(uint16_t *)p = (uint16_t)f->def_num;
+    break;
+  case CONFIG_TYPE_U32:
+    *(uint32_t *)p = f->def_num;
+    break;
+  }
+}
+
+size_t config_field_format(const config_field_t *f, const app_config_t *cfg,
+                           char *out, size_t out_len)
+{
+  const void *p = field_cptr(f, cfg);
+  int n = 0;
+  switch (f->type)
+  {
+  case CONFIG_TYPE_STR:
+    n = snprintf(out, out_len, "%s", (const char *)p);
+    break;
+  case CONFIG_TYPE_U16:
+    n = snprintf(out, out_len, "%u", (unsigned)*(const uint16_t *)p);
+    break;
+  case CONFIG_TYPE_U32:
+    n = snprintf(out, out_len, "%lu", (unsigned long)*(const uint32_t *)p);
+    break;
+  }
+  if (n < 0)
+  {
+    return 0;
+  }
+  return (size_t)n < out_len ? (size_t)n : out_len - 1;
+}
+
+bool config_field_parse(const config_field_t *f, const char *text,
+                        app_config_t *cfg)
+{
+  if (!text)
+  {
+    return false;
+  }
+  void *p = field_ptr(f, cfg);
+  if (f->type == CONFIG_TYPE_STR)
+  {
+    size_t len = strlen(text);
+    if (len < f->min || len > f->max)
+    {
+      return false;
+    }
+    memcpy(p, text, len + 1);
+    return true;
+  }
+
+  if (text[0] == '\0')
+  {
+    return false;
+  }
+  char *end = NULL;
+  unsigned long v = strtoul(text, &end, 10);
+  if (end == text || *end != '\0' || v < f->min || v > f->max)
+  {
+    return false;
+  }
+  if (f->type == CONFIG_TYPE_U16)
+  {
+    *(uint16_t *)p = (uint16_t)v;
+  }
+  else
+  {
+    *(uint32_t *)p = (uint32_t)v;
+  }
+  return true;
+}
+
+bool config_field_equal(const config_field_t *f, const app_config_t *a,
+                        const app_config_t *b)
+{
+  const void *pa = field_cptr(f, a);
+  const void *pb = field_cptr(f, b);
+  if (f->type == CONFIG_TYPE_STR)
+  {
+    return strncmp((const char *)pa, (const char *)pb, f->size) == 0;
+  }
+  return memcmp(pa, pb, f->size) == 0;
+}
@@ -0,0 +1,211 @@
+#include "fix_latency.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "trace_log.h"
+
+#ifndef ALPHALOC_FIX_LATENCY
+#define ALPHALOC_FIX_LATENCY 1
+#endif
+// Acknowledged writes kept for the percentiles. The summary sorts one hop at
+// a time in a stack buffer of this many words.
+#ifndef ALPHALOC_FIX_LATENCY_RECORDS
+#define ALPHALOC_FIX_LATENCY_RECORDS 128
+#endif
+_Static_assert(ALPHALOC_FIX_LATENCY_RECORDS >= 1 &&
+                   ALPHALOC_FIX_LATENCY_RECORDS <= 256,
+               "ALPHALOC_FIX_LATENCY_RECORDS must be 1..256");
+
+static const char *const k_hop_names[FIX_LAT_HOP_COUNT] = {
+    "parse", "pub", "wait", "enc", "issue", "ack", "total",
+};
+
+const char *fix_latency_hop_name(fix_lat_hop_t hop) {
+  return (unsigned)hop < FIX_LAT_HOP_COUNT ? k_hop_names[hop] : "?";
+}
+
+#if ALPHALOC_FIX_LATENCY
+
+static const char *TAG = "fix_lat";
+
+// Stamp points; a record holds each one after the first UART read as an
+// offset from it.
+enum {
+  PT_RX = 0,
+  PT_SENTENCE,
+  PT_PUBLISH,
+  PT_WAKE,
+  PT_ENCODE,
+  PT_ISSUE,
+  PT_DONE,
+  PT_COUNT,
+};
+// The sender reads the newest fix, which may be an epoch or two past the one
+// it was woken for.
+#define EPOCH_SLOTS 4
+
+typedef struct {
+  int64_t t[PT_COUNT];
+  bool active;
+} fix_lat_open_t;
+
+typedef struct {
+  uint32_t off_us[PT_COUNT - 1];  // PT_SENTENCE.. relative to PT_RX
+} fix_lat_rec_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t s_epochs[EPOCH_SLOTS][PT_WAKE];
+static uint32_t s_epoch_next;
+// Being built by the sender, and written to the camera awaiting its response.
+static fix_lat_open_t s_pending;
+static fix_lat_open_t s_inflight;
+static fix_lat_rec_t s_ring[ALPHALOC_FIX_LATENCY_RECORDS];
+static uint32_t s_total;
+static uint32_t s_unmatched;
+
+void fix_latency_epoch(int64_t rx_us, int64_t sentence_us,
+                       int64_t publish_us) {
+  portENTER_CRITICAL(&s_lock);
+  int64_t *e = s_epochs[s_epoch_next++ % EPOCH_SLOTS];
+  e[PT_RX] = rx_us;
+  e[PT_SENTENCE] = sentence_us;
+  e[PT_PUBLISH] = publish_us;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void fix_latency_wake(int64_t fix_us, int64_t wake_us) {
+  portENTER_CRITICAL(&s_lock);
+  s_pending.active = false;
+  for (int i = 0; i < EPOCH_SLOTS; ++i) {
+    if (s_epochs[i][PT_SENTENCE] == fix_us && fix_us != 0) {
+      memcpy(s_pending.t, s_epochs[i], sizeof(s_epochs[i]));
+      s_pending.active = true;
+      break;
+    }
+  }
+  if (s_pending.active) {
+    // Woken just before the fix was stored: it waited for nothing.
+    s_pending.t[PT_WAKE] = wake_us > s_pending.t[PT_PUBLISH]
+                               ? wake_us
+                               : s_pending.t[PT_PUBLISH];
+  } else {
+    s_unmatched++;
+  }
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void fix_latency_encoded(void) {
+  const int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&s_lock);
+  s_pending.t[PT_ENCODE] = now;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void fix_latency_issued(int64_t issue_us) {
+  portENTER_CRITICAL(&s_lock);
+  s_inflight = s_pending;
+  s_inflight.t[PT_ISSUE] = issue_us;
+  s_pending.active = false;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void fix_latency_abort(void) {
+  portENTER_CRITICAL(&s_lock);
+  s_inflight.active = false;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void fix_latency_done(bool ok) {
+  const int64_t now = esp_timer_get_time();
+  fix_lat_rec_t rec;
+  portENTER_CRITICAL(&s_lock);
+  const bool record = ok && s_inflight.active;
+  s_inflight.active = false;
+  if (record) {
+    s_inflight.t[PT_DONE] = now;
+    for (int p = PT_SENTENCE; p < PT_COUNT; ++p) {
+      const int64_t d = s_inflight.t[p] - s_inflight.t[PT_RX];
+      rec.off_us[p - 1] = d > 0 ? (uint32_t)d : 0;
+    }
+    s_ring[s_total++ % ALPHALOC_FIX_LATENCY_RECORDS] = rec;
+  }
+  portEXIT_CRITICAL(&s_lock);
+  if (record) {
+    TRACE_D("Fix latency: rmc=%lu pub=%lu wake=%lu enc=%lu issue=%lu ack=%lu",
+            (unsigned long)rec.off_us[0], (unsigned long)rec.off_us[1],
+            (unsigned long)rec.off_us[2], (unsigned long)rec.off_us[3],
+            (unsigned long)rec.off_us[4], (unsigned long)rec.off_us[5]);
+  }
+}
+
+static int cmp_u32(const void *a, const void *b) {
+  const uint32_t x = *(const uint32_t *)a;
+  const uint32_t y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+bool fix_latency_get_summary(fix_lat_summary_t *out) {
+  uint32_t v[ALPHALOC_FIX_LATENCY_RECORDS];
+  memset(out, 0, sizeof(*out));
+  for (int hop = 0; hop < FIX_LAT_HOP_COUNT; ++hop) {
+    // Records completed between hops shift the window a little; each hop
+    // is still a consistent set.
+    portENTER_CRITICAL(&s_lock);
+    out->total = s_total;
+    out->unmatched = s_unmatched;
+    const uint32_t n = s_total < ALPHALOC_FIX_LATENCY_RECORDS
+                           ? s_total
+                           : ALPHALOC_FIX_LATENCY_RECORDS;
+    for (uint32_t i = 0; i < n; ++i) {
+      const uint32_t *off = s_ring[i].off_us;
+      if (hop == FIX_LAT_TOTAL) {
+        v[i] = off[PT_DONE - 1];
+      } else {
+        v[i] = off[hop] - (hop > 0 ? off[hop - 1] : 0);
+      }
+    }
+    portEXIT_CRITICAL(&s_lock);
+    out->records = n;
+    if (n == 0) {
+      return false;
+    }
+    qsort(v, n, sizeof(v[0]), cmp_u32);
+    fix_lat_pct_t *pct = &out->hop[hop];
+    pct->p50_us = v[(n * 50 + 99) / 100 - 1];
+    pct->p99_us = v[(n * 99 + 99) / 100 - 1];
+    pct->max_us = v[n - 1];
+  }
+  return true;
+}
+
+#else
+
+void fix_latency_epoch(int64_t rx_us, int64_t sentence_us,
+                       int64_t publish_us) {
+  (void)rx_us;
+  (void)sentence_us;
+  (void)publish_us;
+}
+
+void fix_latency_wake(int64_t fix_us, int64_t wake_us) {
+  (void)fix_us;
+  (void)wake_us;
+}
+
+void fix_latency_encoded(void) {}
+
+void fix_latency_issued(int64_t issue_us) { (void)issue_us; }
+
+void fix_latency_abort(void) {}
+
+void fix_latency_done(bool ok) { (void)ok; }
+
+bool fix_latency_get_summary(fix_lat_summary_t *out) {
+  memset(out, 0, sizeof(*out));
+  return false;
+}
+
+#endif
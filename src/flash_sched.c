@@ -0,0 +1,204 @@
+#include "flash_sched.h"
+
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "task_plan.h"
+
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+// Longest a queued write may wait for the link to go quiet before it is
+// written anyway.
+#ifndef ALPHALOC_FLASH_DEADLINE_MS
+#define ALPHALOC_FLASH_DEADLINE_MS 30000
+#endif
+// How often a due job re-checks a busy link.
+#define FLASH_POLL_MS 50
+
+static const char *TAG = "flash_sched";
+
+typedef struct {
+  bool pending;
+  flash_job_fn_t fn;
+  void *ctx;
+  int64_t not_before_us;
+  int64_t deadline_us;
+} flash_slot_t;
+
+static flash_slot_t s_slots[FLASH_JOB_COUNT];
+static flash_sched_busy_fn_t s_busy;
+static flash_sched_stats_t s_stats;
+static TaskHandle_t s_task;
+static SemaphoreHandle_t s_mutex;
+// Held while jobs run, so a flush returns only after an in-flight write.
+static SemaphoreHandle_t s_run_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_mutex_buf;
+static StaticSemaphore_t s_run_mutex_buf;
+#endif
+
+static const char *const k_job_names[FLASH_JOB_COUNT] = {
+    [FLASH_JOB_CONFIG] = "config",
+    [FLASH_JOB_BOND] = "bond",
+    [FLASH_JOB_WIFI] = "wifi",
+    [FLASH_JOB_OTA] = "ota",
+    [FLASH_JOB_TRACK] = "track",
+    [FLASH_JOB_GPS_AID] = "gps_aid",
+    [FLASH_JOB_TRACE] = "trace",
+};
+
+static void lock(void) {
+  if (s_mutex) {
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+  }
+}
+
+static void unlock(void) {
+  if (s_mutex) {
+    xSemaphoreGive(s_mutex);
+  }
+}
+
+void flash_sched_record_stall(uint32_t stall_us) {
+  if (stall_us == 0) {
+    return;
+  }
+  lock();
+  s_stats.last_stall_us = stall_us;
+  if (stall_us > s_stats.max_stall_us) {
+    s_stats.max_stall_us = stall_us;
+    ESP_LOGI(TAG, "Longest flash stall so far: %lu us",
+             (unsigned long)stall_us);
+  }
+  unlock();
+}
+
+static void run_job(flash_job_t job, flash_job_fn_t fn, void *ctx,
+                    bool forced) {
+  uint32_t stall_us = fn(ctx);
+  lock();
+  s_stats.runs++;
+  if (forced) {
+    s_stats.forced++;
+  }
+  unlock();
+  if (forced) {
+    ESP_LOGW(TAG, "%s write forced by deadline (%lu us)", k_job_names[job],
+             (unsigned long)stall_us);
+  }
+  flash_sched_record_stall(stall_us);
+}
+
+// Runs what is due and returns how long the worker may sleep.
+static TickType_t run_due(bool flush) {
+  TickType_t wait = portMAX_DELAY;
+  if (s_run_mutex) {
+    xSemaphoreTake(s_run_mutex, portMAX_DELAY);
+  }
+  for (int i = 0; i < FLASH_JOB_COUNT; ++i) {
+    const bool busy = s_busy && s_busy();
+    const int64_t now = esp_timer_get_time();
+    lock();
+    flash_slot_t slot = s_slots[i];
+    if (!slot.pending) {
+      unlock();
+      continue;
+    }
+    const bool overdue = now >= slot.deadline_us;
+    const bool ready = now >= slot.not_before_us;
+    if (!flush && !overdue && (!ready || busy)) {
+      unlock();
+      TickType_t t = pdMS_TO_TICKS(FLASH_POLL_MS);
+      if (!ready) {
+        int64_t until = slot.not_before_us < slot.deadline_us
+                            ? slot.not_before_us
+                            : slot.deadline_us;
+        t = pdMS_TO_TICKS((until - now) / 1000) + 1;
+      }
+      if (t < wait) {
+        wait = t;
+      }
+      continue;
+    }
+    s_slots[i].pending = false;
+    unlock();
+    run_job((flash_job_t)i, slot.fn, slot.ctx, overdue && busy && !flush);
+  }
+  if (s_run_mutex) {
+    xSemaphoreGive(s_run_mutex);
+  }
+  return wait;
+}
+
+static void flash_sched_task(void *arg) {
+  (void)arg;
+  TickType_t wait = portMAX_DELAY;
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, wait);
+    wait = run_due(false);
+  }
+}
+
+void flash_sched_submit(flash_job_t job, flash_job_fn_t fn, void *ctx,
+                        uint32_t settle_ms) {
+  if (job >= FLASH_JOB_COUNT || !fn) {
+    return;
+  }
+  if (!s_task) {
+    run_job(job, fn, ctx, false);
+    return;
+  }
+  const int64_t now = esp_timer_get_time();
+  lock();
+  flash_slot_t *slot = &s_slots[job];
+  if (!slot->pending) {
+    slot->pending = true;
+    slot->deadline_us = now + (int64_t)ALPHALOC_FLASH_DEADLINE_MS * 1000;
+  }
+  slot->fn = fn;
+  slot->ctx = ctx;
+  slot->not_before_us = now + (int64_t)settle_ms * 1000;
+  unlock();
+  xTaskNotifyGive(s_task);
+}
+
+void flash_sched_kick(void) {
+  if (s_task) {
+    xTaskNotifyGive(s_task);
+  }
+}
+
+void flash_sched_flush(void) {
+  run_due(true);
+}
+
+void flash_sched_get_stats(flash_sched_stats_t *out) {
+  if (!out) {
+    return;
+  }
+  lock();
+  *out = s_stats;
+  unlock();
+}
+
+void flash_sched_start(flash_sched_busy_fn_t busy) {
+  s_busy = busy;
+#if ALPHALOC_STATIC_ALLOC
+  s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+  s_run_mutex = xSemaphoreCreateMutexStatic(&s_run_mutex_buf);
+#else
+  s_mutex = xSemaphoreCreateMutex();
+  s_run_mutex = xSemaphoreCreateMutex();
+#endif
+  memset(s_slots, 0, sizeof(s_slots));
+  if (task_plan_create(TASK_ROLE_FLASH, flash_sched_task, "flash_sched", 3072,
+                       NULL, &s_task) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create flash_sched_task, writing inline");
+    s_task = NULL;
+  }
+}
@@ -1,48 +1,53 @@
 #include "gps.h"
 
-#include <ctype.h>
-#include <math.h>
 #include <stdio.h>
 #include <string.h>
 
+#include "boot_profile.h"
+#include "driver/gpio.h"
 #include "driver/uart.h"
+#include "esp_attr.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "fix_latency.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "freertos/task.h"
+#include "gps_aid.h"
+#include "gps_source.h"
+#include "nmea_parse.h"
+#include "task_plan.h"
+#include "time_sync.h"
+#include "trace_log.h"
 
 #define GPS_UART_BUF_SIZE 2048
-#define GPS_LINE_MAX 128
+#define GPS_LINE_MAX NMEA_LINE_MAX
+// Output after a pause this long starts the burst of a new epoch.
+#define GPS_BURST_GAP_US 50000
+// Empty reads (of 200 ms) before the task falls back to the slow idle poll.
+#define GPS_IDLE_READS 5
+// Interval of the "Fix" trace while the fix holds.
+#define GPS_FIX_TRACE_US 5000000
 
 static const char *TAG = "gps";
 
-#ifndef ALPHALOC_FAKE_GPS
-#define ALPHALOC_FAKE_GPS 0
+#ifndef ALPHALOC_LOG_NMEA
+#define ALPHALOC_LOG_NMEA 0
 #endif
 
-#define FAKE_LAT_DEG 48.137154
-#define FAKE_LON_DEG 11.576124
-#define FAKE_YEAR 2024
-#define FAKE_MONTH 1
-#define FAKE_DAY 1
-#define FAKE_HOUR 12
-#define FAKE_MINUTE 0
-#define FAKE_SECOND 0
-
-#ifndef ALPHALOC_VERBOSE
-#define ALPHALOC_VERBOSE 0
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
 #endif
 
-#ifndef ALPHALOC_LOG_NMEA
-#define ALPHALOC_LOG_NMEA 0
+// Receiver chipset: 0 = detect, 1 = MTK, 2 = u-blox (gps_receiver_t).
+#ifndef ALPHALOC_GPS_RECEIVER
+#define ALPHALOC_GPS_RECEIVER 0
 #endif
 
-#if ALPHALOC_VERBOSE
-#define VLOGI(...) ESP_LOGI(TAG, __VA_ARGS__)
-#else
-#define VLOGI(...) ((void)0)
-#endif
+// UBX-RXM-PMREQ: backup mode until woken by activity on RX.
+#define UBX_CLASS_RXM 0x02
+#define UBX_ID_RXM_PMREQ 0x41
+#define UBX_PMREQ_BACKUP 0x02
 
 #if ALPHALOC_LOG_NMEA
 #define NMEALOGI(...) ESP_LOGI(TAG, __VA_ARGS__)
@@ -52,118 +57,100 @@ static const char *TAG = "gps";
 
 static gps_fix_t s_latest_fix;
 static SemaphoreHandle_t s_fix_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_fix_mutex_buf;
+#endif
 static gps_config_t s_cfg;
 static gps_status_t s_status;
 static int64_t s_last_no_fix_log_us;
-
-static void update_status_gga(const char *line) {
-  // GGA fields: 6=fix quality, 7=satellites, 8=HDOP
-  char buf[GPS_LINE_MAX];
-  strncpy(buf, line, sizeof(buf) - 1);
-  buf[sizeof(buf) - 1] = '\0';
-
-  const char *fields[12] = {0};
-  int field_count = 0;
-  char *saveptr = NULL;
-  char *token = strtok_r(buf, ",", &saveptr);
-  while (token && field_count < 12) {
-    fields[field_count++] = token;
-    token = strtok_r(NULL, ",", &saveptr);
-  }
-  if (field_count < 9) {
+static int64_t s_last_fix_log_us;
+static const gps_source_t *s_source;
+static bool s_standby;
+static gps_epoch_cb_t s_epoch_cb;
+static void *s_epoch_ctx;
+static gps_raw_cb_t s_raw_cb;
+static void *s_raw_ctx;
+// The receiver sends each epoch's burst at a fixed delay after the epoch, so
+// its start is a steadier time reference than when a sentence is parsed.
+static int64_t s_burst_us;
+static int64_t s_last_rx_us;
+// Survives deep sleep: a standby wake puts the receiver back to sleep before
+// it has said anything.
+static RTC_DATA_ATTR gps_receiver_t s_receiver = ALPHALOC_GPS_RECEIVER;
+static bool s_on_uart;
+static bool s_probe_due;
+// Aiding (gps_aid.h) is for the UART receiver; restarted on every wake.
+static bool s_aid_on;
+static volatile bool s_aid_restart;
+
+void gps_send_sentence(const char *body) {
+  if (!s_source) {
     return;
   }
-
-  int fix_quality = atoi(fields[6]);
-  int sats = atoi(fields[7]);
-  if (xSemaphoreTake(s_fix_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-    s_status.has_lock = (fix_quality > 0);
-    s_status.satellites = (uint8_t)sats;
-    if (strncmp(line, "$GPGGA", 6) == 0) {
-      s_status.constellations = GPS_CONSTELLATION_GPS;
-    } else if (strncmp(line, "$GNGGA", 6) == 0) {
-      s_status.constellations =
-          (GPS_CONSTELLATION_GPS | GPS_CONSTELLATION_GLONASS);
-    }
-    xSemaphoreGive(s_fix_mutex);
+  uint8_t cs = 0;
+  for (const char *p = body; *p; ++p) {
+    cs ^= (uint8_t)*p;
   }
-}
-
-static double parse_deg_min(const char *value) {
-  if (value == NULL || value[0] == '\0') {
-    return 0.0;
+  char line[GPS_LINE_MAX];
+  int n = snprintf(line, sizeof(line), "$%s*%02X\r\n", body, cs);
+  if (n > 0 && n < (int)sizeof(line)) {
+    s_source->write(line, (size_t)n);
   }
-  double v = strtod(value, NULL);
-  double deg = floor(v / 100.0);
-  double min = v - (deg * 100.0);
-  return deg + (min / 60.0);
 }
 
-static bool parse_rmc(const char *line, gps_fix_t *out) {
-  char buf[GPS_LINE_MAX];
-  strncpy(buf, line, sizeof(buf) - 1);
-  buf[sizeof(buf) - 1] = '\0';
-
-  const char *fields[20] = {0};
-  int field_count = 0;
-  char *saveptr = NULL;
-  char *token = strtok_r(buf, ",", &saveptr);
-  while (token && field_count < 20) {
-    fields[field_count++] = token;
-    token = strtok_r(NULL, ",", &saveptr);
+void gps_send_ubx(uint8_t cls, uint8_t id, const void *payload, size_t len) {
+  if (!s_source || len > GPS_LINE_MAX - 8) {
+    return;
   }
-
-  if (field_count < 10) {
-    return false;
+  uint8_t frame[GPS_LINE_MAX];
+  frame[0] = 0xB5;
+  frame[1] = 0x62;
+  frame[2] = cls;
+  frame[3] = id;
+  frame[4] = (uint8_t)len;
+  frame[5] = (uint8_t)(len >> 8);
+  memcpy(frame + 6, payload, len);
+  uint8_t ck_a = 0, ck_b = 0;
+  for (size_t i = 2; i < 6 + len; ++i) {
+    ck_a += frame[i];
+    ck_b += ck_a;
   }
+  frame[6 + len] = ck_a;
+  frame[7 + len] = ck_b;
+  s_source->write((const char *)frame, len + 8);
+}
 
-  if (fields[2][0] != 'A') {
-    return false;
-  }
+gps_receiver_t gps_get_receiver(void) { return s_receiver; }
 
-  out->time_valid = false;
-  out->year = 0;
-  out->month = 0;
-  out->day = 0;
-  out->hour = 0;
-  out->minute = 0;
-  out->second = 0;
-  bool time_ok = false;
-  if (fields[1][0] != '\0') {
-    int hh = 0, mm = 0, ss = 0;
-    if (sscanf(fields[1], "%2d%2d%2d", &hh, &mm, &ss) == 3) {
-      out->hour = (uint8_t)hh;
-      out->minute = (uint8_t)mm;
-      out->second = (uint8_t)ss;
-      time_ok = true;
+// Both probes are harmless to the other chipset: MTK acknowledges PMTK000
+// with PMTK001, u-blox answers the PUBX,00 poll with a PUBX,00 sentence.
+static void detect_receiver(const char *line) {
+  if (s_probe_due) {
+    s_probe_due = false;
+    if (s_receiver == GPS_RECEIVER_UNKNOWN) {
+      gps_send_sentence("PMTK000");
+      gps_send_sentence("PUBX,00");
     }
   }
-
-  if (fields[9][0] != '\0') {
-    int dd = 0, mm = 0, yy = 0;
-    if (sscanf(fields[9], "%2d%2d%2d", &dd, &mm, &yy) == 3) {
-      out->day = (uint8_t)dd;
-      out->month = (uint8_t)mm;
-      out->year = (uint16_t)(2000 + yy);
-    }
+  if (s_receiver != GPS_RECEIVER_UNKNOWN) {
+    return;
   }
-  out->time_valid = time_ok;
-
-  double lat = parse_deg_min(fields[3]);
-  if (fields[4][0] == 'S') {
-    lat = -lat;
+  if (strncmp(line, "$PMTK", 5) == 0) {
+    s_receiver = GPS_RECEIVER_MTK;
+  } else if (strncmp(line, "$PUBX,", 6) == 0 || strstr(line, "u-blox")) {
+    s_receiver = GPS_RECEIVER_UBLOX;
+  } else {
+    return;
   }
+  ESP_LOGI(TAG, "Receiver: %s",
+           s_receiver == GPS_RECEIVER_MTK ? "MTK" : "u-blox");
+}
 
-  double lon = parse_deg_min(fields[5]);
-  if (fields[6][0] == 'W') {
-    lon = -lon;
+static void update_status(const gps_status_t *status) {
+  if (xSemaphoreTake(s_fix_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
+    s_status = *status;
+    xSemaphoreGive(s_fix_mutex);
   }
-
-  out->lat_deg = lat;
-  out->lon_deg = lon;
-  out->valid = true;
-  out->last_fix_time_us = esp_timer_get_time();
-  return true;
 }
 
 static void update_fix(const gps_fix_t *fix, bool has_fix) {
@@ -172,6 +159,11 @@ static void update_fix(const gps_fix_t *fix, bool has_fix) {
     if (has_fix) {
       const bool date_present =
           (fix->year != 0 && fix->month != 0 && fix->day != 0);
+      // Traced when the fix is (re)gained, then every few seconds rather
+      // than every epoch.
+      const int64_t now = esp_timer_get_time();
+      const bool trace = !s_latest_fix.valid ||
+                         now - s_last_fix_log_us > GPS_FIX_TRACE_US;
       s_latest_fix.lat_deg = fix->lat_deg;
       s_latest_fix.lon_deg = fix->lon_deg;
       s_latest_fix.altitude_m = fix->altitude_m;
@@ -188,15 +180,19 @@ static void update_fix(const gps_fix_t *fix, bool has_fix) {
         s_latest_fix.month = fix->month;
         s_latest_fix.day = fix->day;
       }
-      VLOGI("Fix lat=%.7f lon=%.7f time=%04u-%02u-%02u %02u:%02u:%02u",
-            fix->lat_deg, fix->lon_deg, fix->year, fix->month, fix->day,
-            fix->hour, fix->minute, fix->second);
+      boot_profile_mark(BOOT_MARK_FIRST_FIX);
+      if (trace) {
+        s_last_fix_log_us = now;
+        TRACE_I("Fix lat=%.7f lon=%.7f time=%04u-%02u-%02u %02u:%02u:%02u",
+                fix->lat_deg, fix->lon_deg, fix->year, fix->month, fix->day,
+                fix->hour, fix->minute, fix->second);
+      }
     } else {
       s_latest_fix.valid = false;
       int64_t now = esp_timer_get_time();
       if (now - s_last_no_fix_log_us > 5000000) {
         s_last_no_fix_log_us = now;
-        VLOGI("No valid fix");
+        TRACE_I("No valid fix");
       }
     }
     xSemaphoreGive(s_fix_mutex);
@@ -222,173 +218,255 @@ static void update_time_date(const gps_fix_t *fix, bool time_present,
   }
 }
 
-static bool parse_zda(const char *line, gps_fix_t *out, bool *time_ok,
-                      bool *date_ok) {
-  char buf[GPS_LINE_MAX];
-  strncpy(buf, line, sizeof(buf) - 1);
-  buf[sizeof(buf) - 1] = '\0';
-
-  const char *fields[8] = {0};
-  int field_count = 0;
-  char *saveptr = NULL;
-  char *token = strtok_r(buf, ",", &saveptr);
-  while (token && field_count < 8) {
-    fields[field_count++] = token;
-    token = strtok_r(NULL, ",", &saveptr);
-  }
-
-  if (field_count < 5) {
-    return false;
+static void handle_sentence(const char *line, void *ctx) {
+  (void)ctx;
+  NMEALOGI("NMEA: %s", line);
+  nmea_sentence_t st;
+  nmea_parse(line, &st);
+  if (s_on_uart) {
+    detect_receiver(line);
   }
-
-  *time_ok = false;
-  *date_ok = false;
-  if (fields[1][0] != '\0') {
-    int hh = 0, mm = 0, ss = 0;
-    if (sscanf(fields[1], "%2d%2d%2d", &hh, &mm, &ss) == 3) {
-      out->hour = (uint8_t)hh;
-      out->minute = (uint8_t)mm;
-      out->second = (uint8_t)ss;
-      *time_ok = true;
-    }
+  if (s_aid_on) {
+    gps_aid_on_sentence(line, &st);
   }
-
-  if (fields[2][0] != '\0' && fields[3][0] != '\0' && fields[4][0] != '\0') {
-    int dd = 0, mm = 0, yyyy = 0;
-    if (sscanf(fields[2], "%2d", &dd) == 1 &&
-        sscanf(fields[3], "%2d", &mm) == 1 &&
-        sscanf(fields[4], "%4d", &yyyy) == 1) {
-      out->day = (uint8_t)dd;
-      out->month = (uint8_t)mm;
-      out->year = (uint16_t)yyyy;
-      *date_ok = true;
-    }
+  switch (st.kind) {
+    case NMEA_GGA:
+      if (st.status_ok) {
+        update_status(&st.status);
+      }
+      if (s_epoch_cb) {
+        s_epoch_cb(s_epoch_ctx);
+      }
+      break;
+    case NMEA_RMC:
+      st.fix.last_fix_time_us = esp_timer_get_time();
+      update_fix(&st.fix, st.fix_ok);
+      if (st.fix_ok) {
+        fix_latency_epoch(s_burst_us, st.fix.last_fix_time_us,
+                          esp_timer_get_time());
+        time_sync_gnss(&st.fix, st.time_ms, s_burst_us);
+      }
+      break;
+    case NMEA_ZDA:
+      if (st.time_ok || st.date_ok) {
+        update_time_date(&st.fix, st.time_ok, st.date_ok);
+      }
+      break;
+    default:
+      break;
   }
-
-  return *time_ok || *date_ok;
 }
 
 static void gps_task(void *arg) {
   uint8_t rx_buf[GPS_UART_BUF_SIZE];
-  char line_buf[GPS_LINE_MAX];
-  size_t line_len = 0;
+  nmea_line_t line = {0};
+  int idle_reads = 0;
 
   while (true) {
-    int len = uart_read_bytes(s_cfg.uart_num, rx_buf, sizeof(rx_buf),
-                              pdMS_TO_TICKS(200));
+    if (s_aid_on) {
+      if (s_aid_restart) {
+        s_aid_restart = false;
+        gps_aid_start(s_source, s_cfg.baud_rate);
+      }
+      gps_aid_poll();
+    }
+    int len = s_source->read(rx_buf, sizeof(rx_buf), 200);
 
-    // Add error handling for UART read failures
+    // Add error handling for read failures
     if (len < 0) {
-      ESP_LOGE(TAG, "UART read error: %d", len);
+      ESP_LOGE(TAG, "GPS read error: %d", len);
       vTaskDelay(pdMS_TO_TICKS(100));
-      line_len = 0; // Reset buffer on error
+      nmea_line_reset(&line); // Reset buffer on error
       continue;
     }
 
     if (len == 0) {
-      vTaskDelay(pdMS_TO_TICKS(s_cfg.update_interval_ms));
+      // The gaps between epochs are normal; only a receiver that stays
+      // silent (standby, unplugged) drops to the slow poll.
+      if (++idle_reads >= GPS_IDLE_READS) {
+        vTaskDelay(pdMS_TO_TICKS(s_cfg.update_interval_ms));
+      }
       continue;
     }
+    idle_reads = 0;
+    const int64_t now = esp_timer_get_time();
+    if (now - s_last_rx_us > GPS_BURST_GAP_US) {
+      s_burst_us = now;
+    }
+    s_last_rx_us = now;
 
 #if ALPHALOC_LOG_NMEA
     ESP_LOG_BUFFER_CHAR(TAG, rx_buf, len);
 #endif
+    if (s_raw_cb) {
+      s_raw_cb(rx_buf, (size_t)len, s_raw_ctx);
+    }
+    nmea_line_feed(&line, rx_buf, (size_t)len, handle_sentence, NULL);
+  }
+}
 
-    for (int i = 0; i < len; ++i) {
-      char c = (char)rx_buf[i];
-      if (c == '\n' || c == '\r') {
-        if (line_len == 0) {
-          continue;
-        }
-        line_buf[line_len] = '\0';
-
-        // Validate minimum NMEA sentence length before parsing
-        if (line_len >= 7 && line_buf[0] == '$') {
-          NMEALOGI("NMEA: %s", line_buf);
-          if (strncmp(line_buf, "$GPGGA", 6) == 0 ||
-              strncmp(line_buf, "$GNGGA", 6) == 0) {
-            update_status_gga(line_buf);
-          }
-          gps_fix_t fix = {0};
-          if (strncmp(line_buf, "$GPRMC", 6) == 0 ||
-              strncmp(line_buf, "$GNRMC", 6) == 0) {
-            if (parse_rmc(line_buf, &fix)) {
-              update_fix(&fix, true);
-            } else {
-              update_fix(&fix, false);
-            }
-          } else if (strncmp(line_buf, "$GPZDA", 6) == 0 ||
-                     strncmp(line_buf, "$GNZDA", 6) == 0) {
-            bool time_ok = false;
-            bool date_ok = false;
-            if (parse_zda(line_buf, &fix, &time_ok, &date_ok)) {
-              update_time_date(&fix, time_ok, date_ok);
-            }
-          }
-        }
-        line_len = 0;
-        continue;
-      }
+// The receiver on the GPS UART.
+static void uart_source_start(const gps_config_t *cfg) {
+  uart_config_t uart_cfg = {
+      .baud_rate = cfg->baud_rate,
+      .data_bits = UART_DATA_8_BITS,
+      .parity = UART_PARITY_DISABLE,
+      .stop_bits = UART_STOP_BITS_1,
+      .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+  };
 
-      // Add bounds check to prevent buffer overflow
-      if (isprint((unsigned char)c) && line_len < sizeof(line_buf) - 1) {
-        line_buf[line_len++] = c;
-      } else if (line_len >= sizeof(line_buf) - 1) {
-        // Buffer full, discard this sentence
-        line_len = 0;
-      }
+  ESP_ERROR_CHECK(
+      uart_driver_install(cfg->uart_num, GPS_UART_BUF_SIZE, 0, 0, NULL, 0));
+  ESP_ERROR_CHECK(uart_param_config(cfg->uart_num, &uart_cfg));
+  ESP_ERROR_CHECK(uart_set_pin(cfg->uart_num, cfg->tx_pin, cfg->rx_pin,
+                               UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+#ifdef ALPHALOC_GPS_ENABLE_PIN
+  // Release a hold left over from deep sleep before driving the pin again.
+  gpio_hold_dis(ALPHALOC_GPS_ENABLE_PIN);
+  gpio_config_t en_cfg = {
+      .pin_bit_mask = 1ULL << ALPHALOC_GPS_ENABLE_PIN,
+      .mode = GPIO_MODE_OUTPUT,
+      .pull_up_en = GPIO_PULLUP_DISABLE,
+      .pull_down_en = GPIO_PULLDOWN_DISABLE,
+      .intr_type = GPIO_INTR_DISABLE,
+  };
+  ESP_ERROR_CHECK(gpio_config(&en_cfg));
+  ESP_ERROR_CHECK(gpio_set_level(ALPHALOC_GPS_ENABLE_PIN, 1));
+#endif
+}
+
+static int uart_source_read(uint8_t *buf, size_t cap, uint32_t timeout_ms) {
+  // Return as soon as data arrives rather than when the timeout runs out,
+  // so the read time tells when a burst started.
+  int n = uart_read_bytes(s_cfg.uart_num, buf, 1, pdMS_TO_TICKS(timeout_ms));
+  if (n <= 0) {
+    return n;
+  }
+  size_t more = 0;
+  uart_get_buffered_data_len(s_cfg.uart_num, &more);
+  if (more > cap - 1) {
+    more = cap - 1;
+  }
+  if (more > 0) {
+    const int m = uart_read_bytes(s_cfg.uart_num, buf + 1, more, 0);
+    if (m > 0) {
+      n += m;
     }
   }
+  return n;
+}
+
+static void uart_source_write(const char *data, size_t len) {
+  uart_write_bytes(s_cfg.uart_num, data, len);
 }
 
+static void uart_source_set_standby(bool standby) {
+#ifdef ALPHALOC_GPS_ENABLE_PIN
+  gpio_set_level(ALPHALOC_GPS_ENABLE_PIN, standby ? 0 : 1);
+  if (standby) {
+    // Keep the receiver off while the chip is in deep sleep.
+    gpio_hold_en(ALPHALOC_GPS_ENABLE_PIN);
+    gpio_deep_sleep_hold_en();
+  }
+#else
+  // Not identified yet: both commands, each ignored by the other chipset.
+  const gps_receiver_t rx = s_receiver;
+  if (standby) {
+    if (rx != GPS_RECEIVER_UBLOX) {
+      // MTK standby: RF off, ephemeris kept for a hot start.
+      gps_send_sentence("PMTK161,0");
+    }
+    if (rx != GPS_RECEIVER_MTK) {
+      // u-blox backup mode: everything but the RTC and backup RAM off.
+      const uint8_t pmreq[8] = {0, 0, 0, 0, UBX_PMREQ_BACKUP, 0, 0, 0};
+      gps_send_ubx(UBX_CLASS_RXM, UBX_ID_RXM_PMREQ, pmreq, sizeof(pmreq));
+    }
+  } else {
+    // Any byte on RX wakes an MTK receiver; a u-blox one needs some edges
+    // on RX before it listens again.
+    if (rx != GPS_RECEIVER_MTK) {
+      static const char k_wake[] = {'\xFF', '\xFF', '\xFF', '\xFF',
+                                    '\xFF', '\xFF', '\xFF', '\xFF'};
+      s_source->write(k_wake, sizeof(k_wake));
+    }
+    if (rx != GPS_RECEIVER_UBLOX) {
+      gps_send_sentence("PMTK000");
+    }
+  }
+  uart_wait_tx_done(s_cfg.uart_num, pdMS_TO_TICKS(100));
+#endif
+}
+
+static const gps_source_t s_uart_source = {
+    .name = "uart",
+    .start = uart_source_start,
+    .read = uart_source_read,
+    .write = uart_source_write,
+    .set_standby = uart_source_set_standby,
+};
+
 void gps_init(const gps_config_t *cfg) {
   s_cfg = *cfg;
+#if ALPHALOC_STATIC_ALLOC
+  s_fix_mutex = xSemaphoreCreateMutexStatic(&s_fix_mutex_buf);
+#else
   s_fix_mutex = xSemaphoreCreateMutex();
+#endif
   memset(&s_latest_fix, 0, sizeof(s_latest_fix));
   memset(&s_status, 0, sizeof(s_status));
   s_last_no_fix_log_us = 0;
+  s_last_fix_log_us = 0;
 
-#if ALPHALOC_FAKE_GPS
-  if (xSemaphoreTake(s_fix_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-    const int64_t now = esp_timer_get_time();
-    s_latest_fix.lat_deg = FAKE_LAT_DEG;
-    s_latest_fix.lon_deg = FAKE_LON_DEG;
-    s_latest_fix.valid = true;
-    s_latest_fix.time_valid = true;
-    s_latest_fix.year = FAKE_YEAR;
-    s_latest_fix.month = FAKE_MONTH;
-    s_latest_fix.day = FAKE_DAY;
-    s_latest_fix.hour = FAKE_HOUR;
-    s_latest_fix.minute = FAKE_MINUTE;
-    s_latest_fix.second = FAKE_SECOND;
-    s_latest_fix.last_fix_time_us = now;
-    s_latest_fix.last_update_time_us = now;
-    s_status.has_lock = true;
-    s_status.satellites = 8;
-    s_status.constellations = GPS_CONSTELLATION_GPS;
-    xSemaphoreGive(s_fix_mutex);
-  }
-  ESP_LOGI(TAG, "Fake GPS enabled");
-  return;
-#endif
+  s_source = cfg->source ? cfg->source : &s_uart_source;
+  s_source->start(&s_cfg);
+  s_on_uart = s_source == &s_uart_source;
+  s_aid_on = s_on_uart;
+  s_probe_due = s_on_uart;
+  s_aid_restart = true;
 
-  uart_config_t uart_cfg = {
-      .baud_rate = s_cfg.baud_rate,
-      .data_bits = UART_DATA_8_BITS,
-      .parity = UART_PARITY_DISABLE,
-      .stop_bits = UART_STOP_BITS_1,
-      .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
-  };
+  // Bump stack to avoid overflow when parsing/logging NMEA sentences.
+  task_plan_create(TASK_ROLE_GPS, gps_task, "gps_task", 6144, NULL, NULL);
+  ESP_LOGI(TAG, "GPS task started (%s)", s_source->name);
+}
 
-  ESP_ERROR_CHECK(
-      uart_driver_install(s_cfg.uart_num, GPS_UART_BUF_SIZE, 0, 0, NULL, 0));
-  ESP_ERROR_CHECK(uart_param_config(s_cfg.uart_num, &uart_cfg));
-  ESP_ERROR_CHECK(uart_set_pin(s_cfg.uart_num, s_cfg.tx_pin, s_cfg.rx_pin,
-                               UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+void gps_set_update_interval(uint32_t interval_ms) {
+  // Only paces the idle poll; the receiver keeps its own fix rate.
+  s_cfg.update_interval_ms = interval_ms;
+}
 
-  // Bump stack to avoid overflow when parsing/logging NMEA sentences.
-  xTaskCreate(gps_task, "gps_task", 6144, NULL, 5, NULL);
-  ESP_LOGI(TAG, "GPS task started");
+void gps_set_epoch_callback(gps_epoch_cb_t cb, void *ctx) {
+  s_epoch_ctx = ctx;
+  s_epoch_cb = cb;
+}
+
+void gps_set_raw_callback(gps_raw_cb_t cb, void *ctx) {
+  s_raw_ctx = ctx;
+  s_raw_cb = cb;
+}
+
+void gps_set_standby(bool standby) {
+  if (!s_source || standby == s_standby) {
+    return;
+  }
+  s_standby = standby;
+  s_source->set_standby(standby);
+  if (!standby) {
+    s_aid_restart = true;  // measure the time to fix from the wake
+    s_probe_due = s_on_uart;
+  }
+  ESP_LOGI(TAG, "GPS %s", standby ? "standby" : "active");
+}
+
+void gps_restore_fix(const gps_fix_t *fix) {
+  if (!fix || !s_fix_mutex) {
+    return;
+  }
+  if (xSemaphoreTake(s_fix_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
+    if (!s_latest_fix.valid && !s_latest_fix.time_valid) {
+      s_latest_fix = *fix;
+    }
+    xSemaphoreGive(s_fix_mutex);
+  }
 }
 
 bool gps_get_latest(gps_fix_t *out_fix) {
@@ -0,0 +1,760 @@
+#include "gps_aid.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "flash_sched.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "gps.h"
+#include "nvs.h"
+#include "time_sync.h"
+#include "track_codec.h"
+
+#ifndef ALPHALOC_GPS_AID
+#define ALPHALOC_GPS_AID 1
+#endif
+
+// 6-hour EPO segments sent per transfer. At 9600 baud one takes about
+// 2.5 s, during which the receiver sends no NMEA.
+#ifndef ALPHALOC_GPS_AID_EPO_SEGMENTS
+#define ALPHALOC_GPS_AID_EPO_SEGMENTS 12
+#endif
+
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+
+#if ALPHALOC_GPS_AID
+
+static const char *TAG = "gps_aid";
+
+// Stored file: a header, then the EPO file as uploaded.
+#define EPO_PARTITION_SUBTYPE 0x41
+#define EPO_MAGIC 0x314F5045u  // "EPO1"
+#define EPO_HDR_LEN 16
+#define EPO_SECTOR_SIZE 4096
+// MTK EPO: per 6-hour segment, one 60-byte record for each of 32 GPS SVs.
+// The first three bytes of a record hold the segment's GPS hour.
+#define EPO_SV_LEN 60
+#define EPO_SV_PER_SET 32
+#define EPO_SET_LEN (EPO_SV_PER_SET * EPO_SV_LEN)
+#define EPO_SET_S (6 * 3600)
+// The receiver gets new data when its own ends within a day.
+#define EPO_REFRESH_S (24 * 3600)
+// A receiver that does not answer PMTK607 this fast has no EPO support.
+#define EPO_QUERY_US (2 * 1000000)
+// How long aiding waits for gps.c to tell the chipset from its probe
+// replies before it sends both kinds of aiding.
+#define AID_DETECT_US (2 * 1000000)
+
+#define GPS_EPOCH_UNIX 315964800u  // 1980-01-06
+#define GPS_UTC_LEAP_S 18
+
+// MTK binary packets: 0x04 0x24, length, command, payload, XOR checksum
+// over length to payload, CR LF.
+#define MTK_BIN_SET_NMEA 253
+#define MTK_BIN_EPO 722
+#define MTK_BIN_EPO_ACK 723
+#define MTK_BIN_OVERHEAD 9
+#define MTK_EPO_SV_PER_PACKET 3
+#define MTK_EPO_PAYLOAD (2 + MTK_EPO_SV_PER_PACKET * EPO_SV_LEN)
+#define MTK_EPO_END_SEQ 0xFFFF
+#define MTK_ACK_LEN 12
+#define MTK_ACK_TIMEOUT_US (1000 * 1000)
+#define MTK_RETRIES 3
+
+// UBX-AID-INI (u-blox 6; later generations still accept it): position as
+// latitude/longitude/altitude and the time as GPS week and time of week.
+#define UBX_CLASS_AID 0x0B
+#define UBX_ID_AID_INI 0x01
+#define UBX_AID_INI_LEN 48
+#define UBX_AID_INI_POS 0x01
+#define UBX_AID_INI_TIME 0x02
+#define UBX_AID_INI_LLA 0x20
+// The saved position may be up to AID_SAVE_DIST_M old and the device may
+// have travelled while off; the RTC drifts through deep sleep.
+#define UBX_AID_POS_ACC_CM (100 * 1000 * 100)
+#define UBX_AID_TIME_ACC_MS 2000
+
+// The last position, rewritten after moving this far.
+#define AID_NAMESPACE "gps_aid"
+#define AID_POS_KEY "pos"
+#define AID_SAVE_DIST_M 10000.0
+
+typedef struct {
+  uint32_t magic;
+  uint32_t len;
+  uint32_t crc;
+  uint32_t reserved;
+} epo_hdr_t;
+
+typedef struct {
+  int32_t lat_udeg;
+  int32_t lon_udeg;
+  int32_t alt_m;
+  uint32_t t;  // UTC of the fix
+} aid_pos_t;
+
+// RTC slow memory: kept across deep sleep, lost on power-on.
+typedef struct {
+  bool time_ok;  // the system time has been set from GNSS since then
+  uint32_t aided_n;
+  uint32_t aided_total_ms;
+  uint32_t unaided_n;
+  uint32_t unaided_total_ms;
+} aid_rtc_t;
+
+typedef enum {
+  AID_IDLE,
+  AID_WAIT_RX,      // started, receiver not heard yet
+  AID_WAIT_DETECT,  // heard, chipset not known yet
+  AID_EPO_QUERY,    // aiding sent, waiting for PMTK707
+  AID_RUNNING,
+} aid_phase_t;
+
+static RTC_DATA_ATTR aid_rtc_t s_rtc;
+
+static SemaphoreHandle_t s_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_mutex_buf;
+#endif
+static const esp_partition_t *s_part;
+
+// GPS task.
+static const gps_source_t *s_src;
+static int s_baud;
+static aid_phase_t s_phase = AID_IDLE;
+static int64_t s_start_us;
+static int64_t s_query_us;
+static uint8_t s_aid;
+static bool s_fixed;
+static uint32_t s_ttff_ms;
+static bool s_rx_epo_known;  // PMTK707 seen this start
+static uint32_t s_rx_epo_end;
+static bool s_epo_checked;
+static aid_pos_t s_pos;
+static bool s_pos_valid;
+static aid_pos_t s_pos_save;  // handed to the flash job
+
+// Under s_mutex: the stored file and an upload into it.
+static uint32_t s_epo_len;  // 0 = none
+static uint32_t s_epo_first_hour;
+static bool s_epo_forced;
+static bool s_transferring;
+static uint32_t s_transfers;
+static bool s_up_active;
+static size_t s_up_len;
+static size_t s_up_pos;
+static size_t s_up_erased;
+static uint32_t s_up_crc;
+
+static uint32_t gps_hour_to_utc(uint32_t hour) {
+  return GPS_EPOCH_UNIX + hour * 3600u - GPS_UTC_LEAP_S;
+}
+
+static uint32_t epo_stored_end(void) {
+  return s_epo_len ? gps_hour_to_utc(s_epo_first_hour) +
+                         (s_epo_len / EPO_SET_LEN) * EPO_SET_S
+                   : 0;
+}
+
+// UTC now, if known: from the disciplined clock, or from the system time
+// the RTC kept through deep sleep.
+static bool now_utc(uint32_t *utc) {
+  int64_t us;
+  if (time_sync_now_us(&us)) {
+    *utc = (uint32_t)(us / 1000000);
+    return true;
+  }
+  if (!s_rtc.time_ok) {
+    return false;
+  }
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  *utc = (uint32_t)tv.tv_sec;
+  return true;
+}
+
+static void load_pos(void) {
+  nvs_handle_t nvs;
+  if (nvs_open(AID_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+    return;
+  }
+  size_t len = sizeof(s_pos);
+  s_pos_valid = nvs_get_blob(nvs, AID_POS_KEY, &s_pos, &len) == ESP_OK &&
+                len == sizeof(s_pos);
+  nvs_close(nvs);
+}
+
+static uint32_t save_pos_job(void *ctx) {
+  (void)ctx;
+  const int64_t start_us = esp_timer_get_time();
+  nvs_handle_t nvs;
+  if (nvs_open(AID_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+    return 0;
+  }
+  esp_err_t err = nvs_set_blob(nvs, AID_POS_KEY, &s_pos_save,
+                               sizeof(s_pos_save));
+  if (err == ESP_OK) {
+    err = nvs_commit(nvs);
+  }
+  nvs_close(nvs);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Position save failed: %s", esp_err_to_name(err));
+  }
+  return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void load_epo(void) {
+  s_part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)EPO_PARTITION_SUBTYPE,
+      "epo");
+  if (!s_part) {
+    ESP_LOGW(TAG, "No epo partition, EPO upload off");
+    return;
+  }
+  epo_hdr_t hdr;
+  uint8_t rec[4];
+  if (esp_partition_read(s_part, 0, &hdr, sizeof(hdr)) != ESP_OK ||
+      hdr.magic != EPO_MAGIC || hdr.len == 0 || hdr.len % EPO_SET_LEN != 0 ||
+      hdr.len > s_part->size - EPO_HDR_LEN ||
+      esp_partition_read(s_part, EPO_HDR_LEN, rec, sizeof(rec)) != ESP_OK) {
+    return;
+  }
+  s_epo_len = hdr.len;
+  s_epo_first_hour = rec[0] | rec[1] << 8 | (uint32_t)rec[2] << 16;
+}
+
+// --- MTK binary protocol ------------------------------------------------
+
+static size_t mtk_packet(uint8_t *out, uint16_t cmd, const uint8_t *payload,
+                         size_t len) {
+  const size_t total = len + MTK_BIN_OVERHEAD;
+  out[0] = 0x04;
+  out[1] = 0x24;
+  out[2] = (uint8_t)total;
+  out[3] = (uint8_t)(total >> 8);
+  out[4] = (uint8_t)cmd;
+  out[5] = (uint8_t)(cmd >> 8);
+  memcpy(out + 6, payload, len);
+  uint8_t cs = 0;
+  for (size_t i = 2; i < 6 + len; ++i) {
+    cs ^= out[i];
+  }
+  out[6 + len] = cs;
+  out[7 + len] = '\r';
+  out[8 + len] = '\n';
+  return total;
+}
+
+// Waits for the receiver's 723 acknowledgement of seq. True if it took the
+// packet.
+static bool wait_epo_ack(uint16_t seq) {
+  uint8_t win[MTK_ACK_LEN] = {0};
+  uint8_t buf[64];
+  const int64_t deadline = esp_timer_get_time() + MTK_ACK_TIMEOUT_US;
+  while (esp_timer_get_time() < deadline) {
+    const int n = s_src->read(buf, sizeof(buf), 50);
+    for (int i = 0; i < n; ++i) {
+      memmove(win, win + 1, MTK_ACK_LEN - 1);
+      win[MTK_ACK_LEN - 1] = buf[i];
+      if (win[0] != 0x04 || win[1] != 0x24 || win[2] != MTK_ACK_LEN ||
+          win[3] != 0 || win[4] != (MTK_BIN_EPO_ACK & 0xFF) ||
+          win[5] != (MTK_BIN_EPO_ACK >> 8) || win[10] != '\r' ||
+          win[11] != '\n') {
+        continue;
+      }
+      uint8_t cs = 0;
+      for (int k = 2; k < 9; ++k) {
+        cs ^= win[k];
+      }
+      if (cs == win[9] && (win[6] | win[7] << 8) == seq) {
+        return win[8] == 1;
+      }
+    }
+  }
+  return false;
+}
+
+static bool send_epo_packet(uint8_t *payload, uint16_t seq) {
+  uint8_t pkt[MTK_EPO_PAYLOAD + MTK_BIN_OVERHEAD];
+  payload[0] = (uint8_t)seq;
+  payload[1] = (uint8_t)(seq >> 8);
+  const size_t len = mtk_packet(pkt, MTK_BIN_EPO, payload, MTK_EPO_PAYLOAD);
+  for (int attempt = 0; attempt < MTK_RETRIES; ++attempt) {
+    s_src->write((const char *)pkt, len);
+    if (wait_epo_ack(seq)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void drain_rx(void) {
+  uint8_t buf[64];
+  while (s_src->read(buf, sizeof(buf), 0) > 0) {
+  }
+}
+
+// Streams the stored segments from the one covering now, switching the
+// receiver to binary mode and back.
+static void epo_transfer(void) {
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  const uint32_t len = s_epo_len;
+  const uint32_t first_hour = s_epo_first_hour;
+  const bool busy = s_up_active || len == 0;
+  s_transferring = !busy;
+  xSemaphoreGive(s_mutex);
+  if (busy) {
+    return;
+  }
+
+  const uint32_t sets = len / EPO_SET_LEN;
+  uint32_t first = 0;
+  uint32_t utc;
+  if (now_utc(&utc)) {
+    while (first < sets &&
+           gps_hour_to_utc(first_hour) + (first + 1) * EPO_SET_S <= utc) {
+      first++;
+    }
+  }
+  uint32_t count = sets - first;
+  if (count > ALPHALOC_GPS_AID_EPO_SEGMENTS) {
+    count = ALPHALOC_GPS_AID_EPO_SEGMENTS;
+  }
+  if (count == 0) {
+    ESP_LOGW(TAG, "Stored EPO has expired; upload a new file");
+  } else {
+    const int64_t start_us = esp_timer_get_time();
+    gps_send_sentence("PMTK253,1,0");
+    vTaskDelay(pdMS_TO_TICKS(100));
+    drain_rx();
+
+    uint8_t payload[MTK_EPO_PAYLOAD];
+    const uint32_t total = count * EPO_SV_PER_SET;
+    uint16_t seq = 0;
+    bool ok = true;
+    for (uint32_t r = 0; r < total && ok; r += MTK_EPO_SV_PER_PACKET, ++seq) {
+      const uint32_t n = total - r < MTK_EPO_SV_PER_PACKET
+                             ? total - r
+                             : MTK_EPO_SV_PER_PACKET;
+      memset(payload, 0, sizeof(payload));
+      ok = esp_partition_read(
+               s_part, EPO_HDR_LEN + (first * EPO_SV_PER_SET + r) * EPO_SV_LEN,
+               payload + 2, n * EPO_SV_LEN) == ESP_OK &&
+           send_epo_packet(payload, seq);
+    }
+    memset(payload, 0, sizeof(payload));
+    send_epo_packet(payload, MTK_EPO_END_SEQ);
+
+    uint8_t fmt[5] = {0, (uint8_t)s_baud, (uint8_t)(s_baud >> 8),
+                      (uint8_t)(s_baud >> 16), (uint8_t)(s_baud >> 24)};
+    uint8_t pkt[sizeof(fmt) + MTK_BIN_OVERHEAD];
+    s_src->write((const char *)pkt,
+                 mtk_packet(pkt, MTK_BIN_SET_NMEA, fmt, sizeof(fmt)));
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    const uint32_t ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+    if (ok) {
+      s_rx_epo_end = gps_hour_to_utc(first_hour) + (first + count) * EPO_SET_S;
+      ESP_LOGI(TAG, "EPO: %lu segments sent in %lu ms",
+               (unsigned long)count, (unsigned long)ms);
+    } else {
+      ESP_LOGW(TAG, "EPO transfer failed at packet %u after %lu ms",
+               (unsigned)(seq - 1), (unsigned long)ms);
+    }
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  s_transferring = false;
+  s_transfers++;
+  xSemaphoreGive(s_mutex);
+}
+
+// --- Starts -------------------------------------------------------------
+
+static void inject_mtk(uint32_t utc) {
+  int y, mo, d, h, mi, s;
+  track_unix_to_civil(utc, &y, &mo, &d, &h, &mi, &s);
+  char body[96];
+  snprintf(body, sizeof(body), "PMTK740,%04d,%02d,%02d,%02d,%02d,%02d", y, mo,
+           d, h, mi, s);
+  gps_send_sentence(body);
+  if (s_pos_valid) {
+    snprintf(body, sizeof(body),
+             "PMTK741,%.6f,%.6f,%ld,%04d,%02d,%02d,%02d,%02d,%02d",
+             s_pos.lat_udeg / 1e6, s_pos.lon_udeg / 1e6, (long)s_pos.alt_m, y,
+             mo, d, h, mi, s);
+    gps_send_sentence(body);
+  }
+}
+
+static void put_le(uint8_t *p, uint32_t v, int n) {
+  for (int i = 0; i < n; ++i) {
+    p[i] = (uint8_t)(v >> (8 * i));
+  }
+}
+
+static void inject_ubx(uint32_t utc) {
+  uint8_t p[UBX_AID_INI_LEN] = {0};
+  const uint32_t gps = utc + GPS_UTC_LEAP_S - GPS_EPOCH_UNIX;
+  uint32_t flags = UBX_AID_INI_TIME;
+  if (s_pos_valid) {
+    put_le(p, (uint32_t)(s_pos.lat_udeg * 10), 4);  // 1e-7 deg
+    put_le(p + 4, (uint32_t)(s_pos.lon_udeg * 10), 4);
+    put_le(p + 8, (uint32_t)(s_pos.alt_m * 100), 4);  // cm
+    put_le(p + 12, UBX_AID_POS_ACC_CM, 4);
+    flags |= UBX_AID_INI_POS | UBX_AID_INI_LLA;
+  }
+  put_le(p + 18, gps / 604800u, 2);
+  put_le(p + 20, (gps % 604800u) * 1000u, 4);  // ms
+  put_le(p + 28, UBX_AID_TIME_ACC_MS, 4);
+  put_le(p + 44, flags, 4);
+  gps_send_ubx(UBX_CLASS_AID, UBX_ID_AID_INI, p, sizeof(p));
+}
+
+// Each chipset gets its own commands; one not identified yet gets both,
+// which the other ignores.
+static void inject(gps_receiver_t rx) {
+  uint32_t utc;
+  if (!now_utc(&utc)) {
+    ESP_LOGI(TAG, "No time since power-on, start without time/position");
+    return;
+  }
+  if (rx != GPS_RECEIVER_UBLOX) {
+    inject_mtk(utc);
+  }
+  if (rx != GPS_RECEIVER_MTK) {
+    inject_ubx(utc);
+  }
+  s_aid |= GPS_AID_TIME;
+  if (s_pos_valid) {
+    s_aid |= GPS_AID_POS;
+  }
+  ESP_LOGI(TAG, "Injected time%s (%s)", s_pos_valid ? " and position" : "",
+           rx == GPS_RECEIVER_MTK     ? "PMTK"
+           : rx == GPS_RECEIVER_UBLOX ? "UBX"
+                                      : "PMTK and UBX");
+}
+
+// EPO is MTK's format: a u-blox receiver only gets time and position.
+static void aid_receiver(void) {
+  const gps_receiver_t rx = gps_get_receiver();
+  inject(rx);
+  if (rx == GPS_RECEIVER_UBLOX) {
+    s_phase = AID_RUNNING;
+    return;
+  }
+  gps_send_sentence("PMTK607");
+  s_query_us = esp_timer_get_time();
+  s_phase = AID_EPO_QUERY;
+}
+
+static void aid_str(uint8_t aid, char *out, size_t len) {
+  snprintf(out, len, "%s%s%s", aid & GPS_AID_TIME ? " time" : "",
+           aid & GPS_AID_POS ? " pos" : "", aid & GPS_AID_EPO ? " epo" : "");
+}
+
+static void on_fix(const gps_fix_t *fix) {
+  if (fix->time_valid && fix->year != 0) {
+    s_rtc.time_ok = true;
+  }
+  if (!s_fixed) {
+    s_fixed = true;
+    s_ttff_ms = (uint32_t)((esp_timer_get_time() - s_start_us) / 1000);
+    if (s_aid) {
+      s_rtc.aided_n++;
+      s_rtc.aided_total_ms += s_ttff_ms;
+    } else {
+      s_rtc.unaided_n++;
+      s_rtc.unaided_total_ms += s_ttff_ms;
+    }
+    char aid[20];
+    aid_str(s_aid, aid, sizeof(aid));
+    ESP_LOGI(TAG,
+             "TTFF %lu ms, %s%s; avg aided %lu ms (n=%lu), unaided %lu ms "
+             "(n=%lu)",
+             (unsigned long)s_ttff_ms, s_aid ? "aided:" : "unaided", aid,
+             (unsigned long)(s_rtc.aided_n
+                                 ? s_rtc.aided_total_ms / s_rtc.aided_n
+                                 : 0),
+             (unsigned long)s_rtc.aided_n,
+             (unsigned long)(s_rtc.unaided_n
+                                 ? s_rtc.unaided_total_ms / s_rtc.unaided_n
+                                 : 0),
+             (unsigned long)s_rtc.unaided_n);
+  }
+
+  const aid_pos_t pos = {
+      .lat_udeg = (int32_t)lround(fix->lat_deg * 1e6),
+      .lon_udeg = (int32_t)lround(fix->lon_deg * 1e6),
+      .alt_m = (int32_t)lround(fix->altitude_m),
+      .t = fix->time_valid && fix->year
+               ? track_unix_time(fix->year, fix->month, fix->day, fix->hour,
+                                 fix->minute, fix->second)
+               : 0,
+  };
+  if (s_pos_valid) {
+    // Equirectangular distance; only "far enough" matters.
+    const double k = 6371000.0 * M_PI / 180.0 / 1e6;
+    const double dy = (pos.lat_udeg - s_pos.lat_udeg) * k;
+    const double dx = (pos.lon_udeg - s_pos.lon_udeg) * k *
+                      cos(fix->lat_deg * M_PI / 180.0);
+    if (dx * dx + dy * dy < AID_SAVE_DIST_M * AID_SAVE_DIST_M) {
+      return;
+    }
+  }
+  s_pos = pos;
+  s_pos_valid = true;
+  s_pos_save = pos;
+  flash_sched_submit(FLASH_JOB_GPS_AID, save_pos_job, NULL, 0);
+}
+
+static void on_epo_status(const char *fields) {
+  unsigned sets, fwn, ftow, lwn, ltow;
+  if (sscanf(fields, "%u,%u,%u,%u,%u", &sets, &fwn, &ftow, &lwn, &ltow) != 5) {
+    return;
+  }
+  s_rx_epo_known = true;
+  s_rx_epo_end = sets ? GPS_EPOCH_UNIX + lwn * 604800u + ltow -
+                            GPS_UTC_LEAP_S + EPO_SET_S
+                      : 0;
+  uint32_t utc;
+  if (!s_fixed && sets && (!now_utc(&utc) || s_rx_epo_end > utc)) {
+    s_aid |= GPS_AID_EPO;
+  }
+  ESP_LOGI(TAG, "Receiver EPO: %u segments, until %lu", sets,
+           (unsigned long)s_rx_epo_end);
+  if (s_phase == AID_EPO_QUERY) {
+    s_phase = AID_RUNNING;
+  }
+}
+
+void gps_aid_start(const gps_source_t *src, int baud) {
+  s_src = src;
+  s_baud = baud;
+  s_phase = AID_WAIT_RX;
+  s_start_us = esp_timer_get_time();
+  s_aid = 0;
+  s_fixed = false;
+  s_ttff_ms = 0;
+  s_rx_epo_known = false;
+  s_epo_checked = false;
+}
+
+void gps_aid_on_sentence(const char *line, const nmea_sentence_t *st) {
+  if (s_phase == AID_IDLE) {
+    return;
+  }
+  if (s_phase == AID_WAIT_RX) {
+    s_query_us = esp_timer_get_time();
+    s_phase = AID_WAIT_DETECT;
+  }
+  if (s_phase == AID_WAIT_DETECT &&
+      gps_get_receiver() != GPS_RECEIVER_UNKNOWN) {
+    aid_receiver();
+  }
+  if (st->kind == NMEA_RMC && st->fix_ok) {
+    on_fix(&st->fix);
+  } else if (st->kind == NMEA_OTHER && strncmp(line, "$PMTK707,", 9) == 0) {
+    on_epo_status(line + 9);
+  }
+}
+
+void gps_aid_poll(void) {
+  if (s_phase == AID_WAIT_DETECT &&
+      esp_timer_get_time() - s_query_us > AID_DETECT_US) {
+    aid_receiver();
+  }
+  if (s_phase == AID_EPO_QUERY &&
+      esp_timer_get_time() - s_query_us > EPO_QUERY_US) {
+    ESP_LOGI(TAG, "No PMTK707 reply, receiver without EPO support");
+    s_phase = AID_RUNNING;
+  }
+  // A transfer stops NMEA output for seconds, so it waits until the start
+  // has its first fix instead of adding to the time to it.
+  if (!s_fixed) {
+    return;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  bool due = s_epo_forced;
+  s_epo_forced = false;
+  const uint32_t stored_end = epo_stored_end();
+  xSemaphoreGive(s_mutex);
+  uint32_t utc;
+  if (!due && s_rx_epo_known && !s_epo_checked && now_utc(&utc)) {
+    // Once per start.
+    s_epo_checked = true;
+    due = stored_end > utc && stored_end > s_rx_epo_end &&
+          s_rx_epo_end < utc + EPO_REFRESH_S;
+  }
+  if (due && s_src) {
+    epo_transfer();
+  }
+}
+
+// --- Upload -------------------------------------------------------------
+
+esp_err_t gps_aid_epo_begin(size_t len) {
+  if (!s_part) {
+    return ESP_ERR_NOT_FOUND;
+  }
+  if (len == 0 || len % EPO_SET_LEN != 0) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  if (len > s_part->size - EPO_HDR_LEN) {
+    return ESP_ERR_NO_MEM;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  const bool busy = s_up_active || s_transferring;
+  if (!busy) {
+    s_up_active = true;
+    s_epo_len = 0;
+    s_up_len = len;
+    s_up_pos = 0;
+    s_up_erased = 0;
+    s_up_crc = 0;
+  }
+  xSemaphoreGive(s_mutex);
+  return busy ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
+
+esp_err_t gps_aid_epo_write(const void *data, size_t len) {
+  if (!s_up_active) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  if (s_up_pos + len > s_up_len) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  const size_t off = EPO_HDR_LEN + s_up_pos;
+  const int64_t start_us = esp_timer_get_time();
+  esp_err_t err = ESP_OK;
+  while (err == ESP_OK && s_up_erased < off + len) {
+    err = esp_partition_erase_range(s_part, s_up_erased, EPO_SECTOR_SIZE);
+    s_up_erased += EPO_SECTOR_SIZE;
+  }
+  if (err == ESP_OK) {
+    err = esp_partition_write(s_part, off, data, len);
+  }
+  flash_sched_record_stall((uint32_t)(esp_timer_get_time() - start_us));
+  if (err != ESP_OK) {
+    gps_aid_epo_abort();
+    return err;
+  }
+  s_up_crc = esp_rom_crc32_le(s_up_crc, data, len);
+  s_up_pos += len;
+  return ESP_OK;
+}
+
+esp_err_t gps_aid_epo_finish(void) {
+  if (!s_up_active) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  // Consecutive 6-hour segments, or it is not an MTK EPO file.
+  const uint32_t sets = s_up_len / EPO_SET_LEN;
+  uint32_t first = 0;
+  bool valid = s_up_pos == s_up_len;
+  for (uint32_t k = 0; valid && k < sets; ++k) {
+    uint8_t rec[4];
+    valid = esp_partition_read(s_part, EPO_HDR_LEN + k * EPO_SET_LEN, rec,
+                               sizeof(rec)) == ESP_OK;
+    const uint32_t hour = rec[0] | rec[1] << 8 | (uint32_t)rec[2] << 16;
+    if (k == 0) {
+      first = hour;
+    }
+    valid = valid && hour == first + 6 * k;
+  }
+  const epo_hdr_t hdr = {
+      .magic = EPO_MAGIC, .len = (uint32_t)s_up_len, .crc = s_up_crc};
+  if (!valid || esp_partition_write(s_part, 0, &hdr, sizeof(hdr)) != ESP_OK) {
+    gps_aid_epo_abort();
+    return ESP_ERR_INVALID_RESPONSE;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  s_epo_len = hdr.len;
+  s_epo_first_hour = first;
+  s_epo_forced = true;
+  s_up_active = false;
+  const uint32_t end = epo_stored_end();
+  xSemaphoreGive(s_mutex);
+  ESP_LOGI(TAG, "EPO stored: %lu segments, until %lu", (unsigned long)sets,
+           (unsigned long)end);
+  return ESP_OK;
+}
+
+void gps_aid_epo_abort(void) {
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  s_up_active = false;
+  xSemaphoreGive(s_mutex);
+}
+
+void gps_aid_init(void) {
+#if ALPHALOC_STATIC_ALLOC
+  s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+#else
+  s_mutex = xSemaphoreCreateMutex();
+#endif
+  load_pos();
+  load_epo();
+}
+
+void gps_aid_get_stats(gps_aid_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+  out->last_ttff_ms = s_ttff_ms;
+  out->last_aid = s_aid;
+  out->aided_n = s_rtc.aided_n;
+  out->aided_avg_ms = s_rtc.aided_n ? s_rtc.aided_total_ms / s_rtc.aided_n : 0;
+  out->unaided_n = s_rtc.unaided_n;
+  out->unaided_avg_ms =
+      s_rtc.unaided_n ? s_rtc.unaided_total_ms / s_rtc.unaided_n : 0;
+  if (s_mutex) {
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    out->epo_bytes = s_epo_len;
+    out->epo_end = epo_stored_end();
+    out->epo_transfers = s_transfers;
+    xSemaphoreGive(s_mutex);
+  }
+}
+
+#else
+
+void gps_aid_init(void) {}
+
+void gps_aid_start(const gps_source_t *src, int baud) {
+  (void)src;
+  (void)baud;
+}
+
+void gps_aid_on_sentence(const char *line, const nmea_sentence_t *st) {
+  (void)line;
+  (void)st;
+}
+
+void gps_aid_poll(void) {}
+
+esp_err_t gps_aid_epo_begin(size_t len) {
+  (void)len;
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t gps_aid_epo_write(const void *data, size_t len) {
+  (void)data;
+  (void)len;
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t gps_aid_epo_finish(void) { return ESP_ERR_NOT_SUPPORTED; }
+
+void gps_aid_epo_abort(void) {}
+
+void gps_aid_get_stats(gps_aid_stats_t *out) { memset(out, 0, sizeof(*out)); }
+
+#endif
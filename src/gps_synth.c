@@ -0,0 +1,409 @@
+#include "gps_synth.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "track_codec.h"
+
+#ifndef ALPHALOC_FAKE_GPS
+#define ALPHALOC_FAKE_GPS 0
+#endif
+
+// The script played from boot. The default is the old fixed test location,
+// now with a running clock.
+#ifndef ALPHALOC_FAKE_GPS_SCRIPT
+#define ALPHALOC_FAKE_GPS_SCRIPT \
+  "time 2024-01-01 12:00:00; pos 48.137154 11.576124 520; sats 8"
+#endif
+
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+
+#if ALPHALOC_FAKE_GPS
+
+static const char *TAG = "gps_synth";
+
+#define SYNTH_MAX_STEPS 32
+#define SYNTH_CMD_MAX 80
+#define SYNTH_EARTH_R_M 6371000.0
+#define SYNTH_DEG (M_PI / 180.0)
+#define SYNTH_MS_TO_KNOTS 1.943844
+
+typedef enum {
+  STEP_TIME,
+  STEP_POS,
+  STEP_RATE,
+  STEP_SATS,
+  STEP_GO,
+  STEP_HOLD,
+  STEP_DROP,
+  STEP_LOOP,
+} step_op_t;
+
+typedef struct {
+  step_op_t op;
+  double a;
+  double b;
+  double c;
+} synth_step_t;
+
+typedef struct {
+  synth_step_t steps[SYNTH_MAX_STEPS];
+  size_t count;
+} synth_script_t;
+
+// Generator state. The GPS task advances it; a script load resets it.
+typedef struct {
+  size_t pc;
+  bool in_step;  // steps[pc] is a go/hold/drop in progress
+  bool looped;   // time commands only apply on the first pass
+  int64_t left_ms;
+  uint64_t t_ms;  // UTC, milliseconds since 1970
+  double lat_deg;
+  double lon_deg;
+  double alt_m;
+  double speed_ms;
+  double course_deg;
+  uint32_t period_ms;
+  uint8_t sats;
+  bool fix;
+} synth_gen_t;
+
+// s_script and s_gen are guarded by s_mutex. s_parsed is the parse buffer
+// of gps_synth_load, which only the httpd task calls.
+static synth_script_t s_script;
+static synth_script_t s_parsed;
+static synth_gen_t s_gen;
+static SemaphoreHandle_t s_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_mutex_buf;
+#endif
+static TickType_t s_wake;
+static volatile bool s_standby;
+static int64_t s_paused_us;
+
+static bool parse_command(const char *cmd, synth_step_t *st, bool *timed) {
+  char word[8];
+  if (sscanf(cmd, "%7s", word) != 1) {
+    return false;
+  }
+  double a = 0, b = 0, c = 0;
+  const int n = sscanf(cmd, "%*s %lf %lf %lf", &a, &b, &c);
+  st->a = a;
+  st->b = b;
+  st->c = c;
+  if (strcmp(word, "time") == 0) {
+    int y, mo, d, h, mi, s;
+    if (sscanf(cmd, "%*s %d-%d-%d %d:%d:%d", &y, &mo, &d, &h, &mi, &s) != 6 ||
+        y < 1970 || y > 2105 || mo < 1 || mo > 12 || d < 1 || d > 31 ||
+        h > 23 || mi > 59 || s > 59 || h < 0 || mi < 0 || s < 0) {
+      return false;
+    }
+    st->op = STEP_TIME;
+    st->a = track_unix_time(y, mo, d, h, mi, s);
+    return true;
+  }
+  if (strcmp(word, "pos") == 0) {
+    st->op = STEP_POS;
+    return n >= 2 && fabs(a) <= 90.0 && fabs(b) <= 180.0;
+  }
+  if (strcmp(word, "rate") == 0) {
+    st->op = STEP_RATE;
+    return n == 1 && a >= 1.0 && a <= 10.0;
+  }
+  if (strcmp(word, "sats") == 0) {
+    st->op = STEP_SATS;
+    return n == 1 && a >= 0.0 && a <= 99.0;
+  }
+  if (strcmp(word, "go") == 0) {
+    st->op = STEP_GO;
+    *timed = true;
+    return n == 3 && fabs(a) <= 90.0 && fabs(b) <= 180.0 && c > 0.0 &&
+           c <= 1000.0;
+  }
+  if (strcmp(word, "hold") == 0 || strcmp(word, "drop") == 0) {
+    st->op = word[0] == 'h' ? STEP_HOLD : STEP_DROP;
+    *timed = true;
+    return n == 1 && a > 0.0;
+  }
+  if (strcmp(word, "loop") == 0) {
+    // Without a timed command the generator would spin.
+    st->op = STEP_LOOP;
+    return n <= 0 && *timed;
+  }
+  return false;
+}
+
+static bool parse_script(const char *text, synth_script_t *out, char *err,
+                         size_t err_len) {
+  out->count = 0;
+  bool timed = false;
+  int line = 1;
+  for (const char *p = text; *p;) {
+    const size_t len = strcspn(p, ";\n");
+    char cmd[SYNTH_CMD_MAX];
+    const size_t copy = len < sizeof(cmd) - 1 ? len : sizeof(cmd) - 1;
+    memcpy(cmd, p, copy);
+    cmd[copy] = '\0';
+    char *hash = strchr(cmd, '#');
+    if (hash) {
+      *hash = '\0';
+    }
+    char word[2];
+    if (sscanf(cmd, "%1s", word) == 1) {
+      if (len >= sizeof(cmd) || out->count == SYNTH_MAX_STEPS ||
+          !parse_command(cmd, &out->steps[out->count], &timed)) {
+        snprintf(err, err_len, "line %d: %s%s", line, cmd,
+                 out->count == SYNTH_MAX_STEPS ? " (too many commands)" : "");
+        return false;
+      }
+      out->count++;
+    }
+    p += len;
+    if (*p == '\n') {
+      line++;
+    }
+    if (*p) {
+      p++;
+    }
+  }
+  return true;
+}
+
+static void step_done(void) {
+  s_gen.in_step = false;
+  s_gen.pc++;
+}
+
+static void advance_go(const synth_step_t *st) {
+  const double north_m = (st->a - s_gen.lat_deg) * SYNTH_DEG * SYNTH_EARTH_R_M;
+  const double east_m = (st->b - s_gen.lon_deg) * SYNTH_DEG *
+                        SYNTH_EARTH_R_M * cos(s_gen.lat_deg * SYNTH_DEG);
+  const double dist_m = sqrt(north_m * north_m + east_m * east_m);
+  const double step_m = st->c * s_gen.period_ms / 1000.0;
+  s_gen.speed_ms = st->c;
+  if (dist_m > 0.0) {
+    s_gen.course_deg = fmod(atan2(east_m, north_m) / SYNTH_DEG + 360.0, 360.0);
+  }
+  if (dist_m <= step_m) {
+    s_gen.lat_deg = st->a;
+    s_gen.lon_deg = st->b;
+    step_done();
+    return;
+  }
+  // Straight in degrees; fine for the short legs of a bench route.
+  const double f = step_m / dist_m;
+  s_gen.lat_deg += (st->a - s_gen.lat_deg) * f;
+  s_gen.lon_deg += (st->b - s_gen.lon_deg) * f;
+}
+
+// Runs commands up to the next timed one and advances that by one epoch.
+static void gen_epoch(void) {
+  s_gen.speed_ms = 0.0;
+  s_gen.fix = true;
+  // A loop always has a timed command before it, so this pass ends; the
+  // bound only guards against a bad script table.
+  for (size_t guard = 0; !s_gen.in_step && guard <= SYNTH_MAX_STEPS;
+       ++guard) {
+    if (s_gen.pc >= s_script.count) {
+      return;  // past the end: hold
+    }
+    const synth_step_t *st = &s_script.steps[s_gen.pc];
+    switch (st->op) {
+      case STEP_TIME:
+        if (!s_gen.looped) {
+          s_gen.t_ms = (uint64_t)st->a * 1000;
+        }
+        break;
+      case STEP_POS:
+        s_gen.lat_deg = st->a;
+        s_gen.lon_deg = st->b;
+        s_gen.alt_m = st->c;
+        break;
+      case STEP_RATE:
+        s_gen.period_ms = (uint32_t)(1000.0 / st->a);
+        break;
+      case STEP_SATS:
+        s_gen.sats = (uint8_t)st->a;
+        break;
+      case STEP_LOOP:
+        s_gen.pc = 0;
+        s_gen.looped = true;
+        continue;
+      case STEP_GO:
+        s_gen.in_step = true;
+        continue;
+      case STEP_HOLD:
+      case STEP_DROP:
+        s_gen.in_step = true;
+        s_gen.left_ms = (int64_t)(st->a * 1000.0);
+        continue;
+    }
+    s_gen.pc++;
+  }
+  if (!s_gen.in_step) {
+    return;
+  }
+  const synth_step_t *st = &s_script.steps[s_gen.pc];
+  if (st->op == STEP_GO) {
+    advance_go(st);
+    return;
+  }
+  s_gen.fix = st->op != STEP_DROP;
+  s_gen.left_ms -= s_gen.period_ms;
+  if (s_gen.left_ms <= 0) {
+    step_done();
+  }
+}
+
+static size_t append_sentence(char *buf, size_t cap, size_t len,
+                              const char *body) {
+  uint8_t cs = 0;
+  for (const char *p = body; *p; ++p) {
+    cs ^= (uint8_t)*p;
+  }
+  const int n = snprintf(buf + len, cap - len, "$%s*%02X\r\n", body, cs);
+  return n > 0 && (size_t)n < cap - len ? len + (size_t)n : len;
+}
+
+// "ddmm.mmmmm" (width 2 for latitude, 3 for longitude).
+static void format_deg_min(char *out, size_t cap, double deg, int width) {
+  const double a = fabs(deg);
+  const int d = (int)a;
+  snprintf(out, cap, "%0*d%08.5f", width, d, (a - d) * 60.0);
+}
+
+static size_t gen_nmea(char *buf, size_t cap) {
+  int y, mo, d, h, mi, s;
+  track_unix_to_civil((uint32_t)(s_gen.t_ms / 1000), &y, &mo, &d, &h, &mi,
+                      &s);
+  char tm[16];
+  snprintf(tm, sizeof(tm), "%02d%02d%02d.%02u", h, mi, s,
+           (unsigned)(s_gen.t_ms % 1000 / 10));
+  char body[112];
+  size_t len = 0;
+  if (!s_gen.fix) {
+    snprintf(body, sizeof(body), "GPRMC,%s,V,,,,,,,%02d%02d%02d,,,N", tm, d, mo,
+             y % 100);
+    len = append_sentence(buf, cap, len, body);
+    snprintf(body, sizeof(body), "GPGGA,%s,,,,,0,00,99.99,,,,,,", tm);
+    return append_sentence(buf, cap, len, body);
+  }
+  char lat[16], lon[16];
+  format_deg_min(lat, sizeof(lat), s_gen.lat_deg, 2);
+  format_deg_min(lon, sizeof(lon), s_gen.lon_deg, 3);
+  const char ns = s_gen.lat_deg < 0 ? 'S' : 'N';
+  const char ew = s_gen.lon_deg < 0 ? 'W' : 'E';
+  // RMC first: the GGA that follows ends the epoch in gps.c.
+  snprintf(body, sizeof(body),
+           "GPRMC,%s,A,%s,%c,%s,%c,%.2f,%.1f,%02d%02d%02d,,,A", tm, lat, ns,
+           lon, ew, s_gen.speed_ms * SYNTH_MS_TO_KNOTS, s_gen.course_deg, d,
+           mo, y % 100);
+  len = append_sentence(buf, cap, len, body);
+  snprintf(body, sizeof(body), "GPGGA,%s,%s,%c,%s,%c,1,%02u,0.9,%.1f,M,0.0,M,,",
+           tm, lat, ns, lon, ew, s_gen.sats, s_gen.alt_m);
+  return append_sentence(buf, cap, len, body);
+}
+
+static void synth_start(const gps_config_t *cfg) {
+  (void)cfg;
+#if ALPHALOC_STATIC_ALLOC
+  s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+#else
+  s_mutex = xSemaphoreCreateMutex();
+#endif
+  s_gen.t_ms = (uint64_t)track_unix_time(2024, 1, 1, 12, 0, 0) * 1000;
+  s_gen.period_ms = 1000;
+  s_gen.sats = 8;
+  char err[SYNTH_CMD_MAX + 32];
+  if (!parse_script(ALPHALOC_FAKE_GPS_SCRIPT, &s_script, err, sizeof(err))) {
+    ESP_LOGE(TAG, "ALPHALOC_FAKE_GPS_SCRIPT %s", err);
+    s_script.count = 0;
+  }
+  s_wake = xTaskGetTickCount();
+  ESP_LOGI(TAG, "Synthetic GPS, %u commands", (unsigned)s_script.count);
+}
+
+static int synth_read(uint8_t *buf, size_t cap, uint32_t timeout_ms) {
+  if (s_standby) {
+    if (s_paused_us == 0) {
+      s_paused_us = esp_timer_get_time();
+    }
+    vTaskDelay(pdMS_TO_TICKS(timeout_ms));
+    return 0;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  if (s_paused_us != 0) {
+    // The clock kept running while the receiver was off.
+    s_gen.t_ms += (uint64_t)(esp_timer_get_time() - s_paused_us) / 1000;
+    s_paused_us = 0;
+    s_wake = xTaskGetTickCount();
+  }
+  const uint32_t period_ms = s_gen.period_ms;
+  xSemaphoreGive(s_mutex);
+
+  vTaskDelayUntil(&s_wake, pdMS_TO_TICKS(period_ms));
+
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  gen_epoch();
+  const size_t n = gen_nmea((char *)buf, cap);
+  s_gen.t_ms += s_gen.period_ms;
+  xSemaphoreGive(s_mutex);
+  return (int)n;
+}
+
+static void synth_write(const char *data, size_t len) {
+  // Receiver commands have nothing to configure here.
+  (void)data;
+  (void)len;
+}
+
+static void synth_set_standby(bool standby) { s_standby = standby; }
+
+static const gps_source_t s_synth_source = {
+    .name = "synthetic",
+    .start = synth_start,
+    .read = synth_read,
+    .write = synth_write,
+    .set_standby = synth_set_standby,
+};
+
+const gps_source_t *gps_synth_source(void) { return &s_synth_source; }
+
+bool gps_synth_load(const char *script, char *err, size_t err_len) {
+  if (!s_mutex) {
+    snprintf(err, err_len, "Synthetic GPS not running");
+    return false;
+  }
+  if (!parse_script(script, &s_parsed, err, err_len)) {
+    ESP_LOGW(TAG, "Script rejected, %s", err);
+    return false;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  s_script = s_parsed;
+  s_gen.pc = 0;
+  s_gen.in_step = false;
+  s_gen.looped = false;
+  xSemaphoreGive(s_mutex);
+  ESP_LOGI(TAG, "Script loaded, %u commands", (unsigned)s_parsed.count);
+  return true;
+}
+
+#else
+
+const gps_source_t *gps_synth_source(void) { return NULL; }
+
+bool gps_synth_load(const char *script, char *err, size_t err_len) {
+  (void)script;
+  snprintf(err, err_len, "Built without ALPHALOC_FAKE_GPS");
+  return false;
+}
+
+#endif
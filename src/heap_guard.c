@@ -0,0 +1,112 @@
+#include "heap_guard.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "task_plan.h"
+
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+// Seconds after boot before the heap is expected to stay flat.
+#ifndef ALPHALOC_HEAP_SETTLE_S
+#define ALPHALOC_HEAP_SETTLE_S 30
+#endif
+#ifndef ALPHALOC_HEAP_CHECK_S
+#define ALPHALOC_HEAP_CHECK_S 10
+#endif
+// 1 = record steady-state allocations with the heap tracer and abort on the
+// first one (needs CONFIG_HEAP_TRACING_STANDALONE).
+#ifndef ALPHALOC_HEAP_TRACE
+#define ALPHALOC_HEAP_TRACE 0
+#endif
+
+#if ALPHALOC_HEAP_TRACE
+#include "esp_heap_trace.h"
+#define HEAP_TRACE_RECORDS 32
+static heap_trace_record_t s_trace_records[HEAP_TRACE_RECORDS];
+#endif
+
+static const char *TAG = "heap_guard";
+static heap_guard_busy_fn_t s_busy;
+
+#if ALPHALOC_HEAP_TRACE
+static bool s_tracing;
+
+static void trace_arm(bool on) {
+  if (on == s_tracing) {
+    return;
+  }
+  if (on) {
+    heap_trace_start(HEAP_TRACE_ALL);
+  } else {
+    heap_trace_stop();
+  }
+  s_tracing = on;
+}
+#endif
+
+static void heap_guard_task(void *arg) {
+  (void)arg;
+  vTaskDelay(pdMS_TO_TICKS(ALPHALOC_HEAP_SETTLE_S * 1000));
+  size_t baseline_min = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  size_t baseline_free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  ESP_LOGI(TAG, "Steady state: free=%u min=%u largest=%u",
+           (unsigned)baseline_free, (unsigned)baseline_min,
+           (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+#if ALPHALOC_HEAP_TRACE
+  trace_arm(true);
+#endif
+  while (true) {
+    vTaskDelay(pdMS_TO_TICKS(ALPHALOC_HEAP_CHECK_S * 1000));
+    if (s_busy && s_busy()) {
+      // Re-baseline after the allocating phase ends.
+#if ALPHALOC_HEAP_TRACE
+      trace_arm(false);
+#endif
+      baseline_min = 0;
+      continue;
+    }
+    size_t min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    if (baseline_min == 0) {
+      baseline_min = min_free;
+#if ALPHALOC_HEAP_TRACE
+      trace_arm(true);
+#endif
+      continue;
+    }
+    if (min_free < baseline_min) {
+      ESP_LOGW(TAG, "Heap low-water mark dropped by %u bytes (min=%u)",
+               (unsigned)(baseline_min - min_free), (unsigned)min_free);
+      baseline_min = min_free;
+    }
+#if ALPHALOC_HEAP_TRACE
+    if (heap_trace_get_count() > 0) {
+      ESP_LOGE(TAG, "Allocation in steady state");
+      heap_trace_dump();
+#if ALPHALOC_STATIC_ALLOC
+      abort();
+#endif
+      trace_arm(false);
+      trace_arm(true);
+    }
+#endif
+  }
+}
+
+void heap_guard_start(heap_guard_busy_fn_t busy) {
+  s_busy = busy;
+#if ALPHALOC_HEAP_TRACE
+  ESP_ERROR_CHECK(
+      heap_trace_init_standalone(s_trace_records, HEAP_TRACE_RECORDS));
+#endif
+  if (task_plan_create(TASK_ROLE_HEAP_GUARD, heap_guard_task, "heap_guard",
+                       2560, NULL, NULL) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create heap_guard_task");
+  }
+}
@@ -1,19 +1,32 @@
 #include <string.h>
 
 #include "ble_client.h"
+#include "boot_profile.h"
 #if ALPHALOC_BLE_CONFIG
 #include "ble_config_server.h"
 #endif
 #include "config.h"
 #include "driver/gpio.h"
 #include "driver/uart.h"
+#include "esp_attr.h"
 #include "esp_log.h"
 #include "esp_rom_sys.h"
 #include "esp_timer.h"
+#include "fix_latency.h"
+#include "flash_sched.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "gps.h"
+#include "gps_aid.h"
+#include "gps_synth.h"
+#include "heap_guard.h"
+#include "nmea_capture.h"
 #include "nvs_flash.h"
+#include "ota_update.h"
+#include "sdkconfig.h"
+#include "task_plan.h"
+#include "time_sync.h"
+#include "trace_log.h"
 
 #ifndef ALPHALOC_BATTERY_MONITOR
 #define ALPHALOC_BATTERY_MONITOR 0
@@ -35,6 +48,80 @@
 #include "wifi_web.h"
 #endif
 
+// Forward the raw receiver output on TCP port 10110 while WiFi is up.
+#ifndef ALPHALOC_NMEA_TCP
+#define ALPHALOC_NMEA_TCP ALPHALOC_WIFI_WEB
+#endif
+
+#if ALPHALOC_NMEA_TCP
+#include "nmea_tcp.h"
+#endif
+
+// Both servers are up together while the config window is open, and lwIP
+// refuses new sockets past CONFIG_LWIP_MAX_SOCKETS.
+#if ALPHALOC_WIFI_WEB && ALPHALOC_NMEA_TCP
+_Static_assert(WIFI_WEB_SOCKETS + NMEA_TCP_SOCKETS <= CONFIG_LWIP_MAX_SOCKETS,
+               "Raise CONFIG_LWIP_MAX_SOCKETS in sdkconfig.<env> for the web "
+               "viewers and NMEA clients");
+#endif
+
+// Record every GPS epoch to the compressed log in the "track" partition.
+#ifndef ALPHALOC_TRACK_LOG
+#define ALPHALOC_TRACK_LOG 1
+#endif
+
+#if ALPHALOC_TRACK_LOG
+#include "track_log.h"
+#endif
+
+#ifndef ALPHALOC_STANDBY
+#define ALPHALOC_STANDBY 1
+#endif
+// No camera for this long puts the device into deep-sleep standby.
+#ifndef ALPHALOC_STANDBY_IDLE_S
+#define ALPHALOC_STANDBY_IDLE_S 900
+#endif
+// Deep-sleep period between standby wake-ups.
+#ifndef ALPHALOC_STANDBY_WAKE_S
+#define ALPHALOC_STANDBY_WAKE_S 60
+#endif
+// How long a standby wake-up scans for the camera before sleeping again.
+#ifndef ALPHALOC_STANDBY_SCAN_S
+#define ALPHALOC_STANDBY_SCAN_S 8
+#endif
+
+#if ALPHALOC_STANDBY
+#include "standby.h"
+#endif
+
+// Longest time an automatic config window waits for the camera link before
+// bringing up WiFi anyway.
+#ifndef ALPHALOC_CONFIG_WINDOW_DEFER_MS
+#define ALPHALOC_CONFIG_WINDOW_DEFER_MS 20000
+#endif
+// Push button (active low) that opens the config window when held. Defaults
+// to the BOOT button of the dev boards; -1 = none.
+#ifndef ALPHALOC_CONFIG_BUTTON_PIN
+#if CONFIG_IDF_TARGET_ESP32C6
+#define ALPHALOC_CONFIG_BUTTON_PIN 9
+#elif CONFIG_IDF_TARGET_ESP32S3
+#define ALPHALOC_CONFIG_BUTTON_PIN 0
+#else
+#define ALPHALOC_CONFIG_BUTTON_PIN -1
+#endif
+#endif
+#define HAS_CONFIG_BUTTON (ALPHALOC_CONFIG_BUTTON_PIN >= 0)
+#ifndef ALPHALOC_CONFIG_BUTTON_HOLD_MS
+#define ALPHALOC_CONFIG_BUTTON_HOLD_MS 2000
+#endif
+
+#define CONFIG_WINDOW_REQ_AUTO (1u << 0)
+#define CONFIG_WINDOW_REQ_USER (1u << 1)
+// Re-arms BLE config advertising for an idle period without opening WiFi.
+#define CONFIG_WINDOW_REQ_BLE (1u << 2)
+// Publisher poll period while the camera is ready but nothing was sent.
+#define LOCATION_RETRY_MS 200
+
 #define GPS_UART_NUM UART_NUM_1
 #ifndef GPS_UART_TX_PIN
 #error "GPS_UART_TX_PIN must be set via build_flags"
@@ -50,48 +137,37 @@
 #define ALPHALOC_FAKE_GPS 0
 #endif
 
-#define FAKE_LAT_DEG 48.137154
-#define FAKE_LON_DEG 11.576124
-#define FAKE_YEAR 2024
-#define FAKE_MONTH 1
-#define FAKE_DAY 1
-#define FAKE_HOUR 12
-#define FAKE_MINUTE 0
-#define FAKE_SECOND 0
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+#ifndef ALPHALOC_HEAP_TRACE
+#define ALPHALOC_HEAP_TRACE 0
+#endif
 
 static const char *TAG = "main";
 static app_config_t s_cfg;
-static int64_t s_config_window_end_time_us = 0;
+static TaskHandle_t s_config_window_task;
+static TaskHandle_t s_publisher_task;
+static volatile bool s_config_window_active;
+#if HAS_CONFIG_BUTTON
+static TaskHandle_t s_button_task;
+#endif
 
 static bool get_location_for_send(gps_fix_t *out_fix) {
   gps_fix_t fix;
   if (gps_get_latest(&fix) && fix.valid) {
+    // The fix carries the time of its RMC; between fixes and in a dropout
+    // the disciplined clock keeps the timestamp moving.
+    time_sync_stamp(&fix);
     *out_fix = fix;
     return true;
   }
-#if ALPHALOC_FAKE_GPS
-  memset(&fix, 0, sizeof(fix));
-  fix.lat_deg = FAKE_LAT_DEG;
-  fix.lon_deg = FAKE_LON_DEG;
-  fix.valid = true;
-  fix.time_valid = true;
-  fix.year = FAKE_YEAR;
-  fix.month = FAKE_MONTH;
-  fix.day = FAKE_DAY;
-  fix.hour = FAKE_HOUR;
-  fix.minute = FAKE_MINUTE;
-  fix.second = FAKE_SECOND;
-  fix.last_fix_time_us = esp_timer_get_time();
-  fix.last_update_time_us = fix.last_fix_time_us;
-  *out_fix = fix;
-  return true;
-#else
   return false;
-#endif
 }
 
 static void focus_update_cb(void *ctx) {
   app_config_t *cfg = (app_config_t *)ctx;
+  const int64_t wake_us = esp_timer_get_time();
   gps_fix_t fix;
   if (!get_location_for_send(&fix)) {
     return;
@@ -100,51 +176,354 @@ static void focus_update_cb(void *ctx) {
   if ((now - fix.last_fix_time_us) > (int64_t)cfg->max_gps_age_s * 1000000LL) {
     return;
   }
+  fix_latency_wake(fix.last_fix_time_us, wake_us);
   ble_client_send_location(&fix);
 }
 
 static void location_publisher_task(void *arg) {
   const app_config_t *cfg = (const app_config_t *)arg;
   while (true) {
+    const int64_t wake_us = esp_timer_get_time();
     gps_fix_t fix;
+    bool sent = false;
     if (get_location_for_send(&fix)) {
       int64_t now = esp_timer_get_time();
       if ((now - fix.last_fix_time_us) <=
           (int64_t)cfg->max_gps_age_s * 1000000LL) {
-        ble_client_send_location(&fix);
+        fix_latency_wake(fix.last_fix_time_us, wake_us);
+        sent = ble_client_send_location(&fix);
       }
     }
-    vTaskDelay(pdMS_TO_TICKS(cfg->gps_interval_ms));
+#if ALPHALOC_STANDBY
+    if (sent) {
+      standby_note_location_sent();
+    }
+#endif
+    // Retry quickly while the camera takes locations, so the first geotag
+    // after a fix does not wait a full interval. Without a camera ready
+    // for them the task keeps the normal period and lets the chip sleep.
+    uint32_t delay_ms = cfg->gps_interval_ms;
+    if (!sent && delay_ms > LOCATION_RETRY_MS &&
+        ble_client_is_connected() && ble_client_is_location_enabled()) {
+      delay_ms = LOCATION_RETRY_MS;
+    }
+    // A config change wakes the task early so a new period applies now.
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay_ms));
+  }
+}
+
+static void config_changed_cb(const app_config_t *cfg, uint32_t changed,
+                              void *ctx) {
+  (void)ctx;
+  if (changed & CONFIG_CHANGED_GPS_INTERVAL) {
+    gps_set_update_interval(cfg->gps_interval_ms);
+    if (s_publisher_task) {
+      xTaskNotifyGive(s_publisher_task);
+    }
   }
 }
 
+static bool config_window_is_active(void) { return s_config_window_active; }
+
+static void config_window_request(uint32_t reason) {
+  if (s_config_window_task) {
+    xTaskNotify(s_config_window_task, reason, eSetBits);
+  }
+}
+
+#if ALPHALOC_BLE_CONFIG
+static void ble_config_window_cb(void *ctx) {
+  (void)ctx;
+  config_window_request(CONFIG_WINDOW_REQ_USER);
+}
+#endif
+
+static int64_t config_window_last_activity_us(int64_t since_us) {
+  // Only traffic counts: a phone that stays joined to the AP with nothing
+  // open does not keep the window up.
+  int64_t last = since_us;
+#if ALPHALOC_WIFI_WEB
+  int64_t web_us = wifi_web_last_activity_us();
+  if (web_us > last) {
+    last = web_us;
+  }
+#endif
+#if ALPHALOC_NMEA_TCP
+  // A navigation app reading the NMEA stream keeps the window open.
+  int64_t nmea_us = nmea_tcp_last_activity_us();
+  if (nmea_us > last) {
+    last = nmea_us;
+  }
+#endif
+#if ALPHALOC_BLE_CONFIG
+  int64_t ble_us = ble_config_server_last_activity_us();
+  if (ble_us > last) {
+    last = ble_us;
+  }
+#endif
+  return last;
+}
+
+// Opens WiFi/httpd (and BLE config advertising) on request and closes them
+// again once no client has been active for config_window_s.
 static void config_window_task(void *arg) {
   app_config_t *cfg = (app_config_t *)arg;
+  int64_t activity_since_us = 0;
 #if ALPHALOC_BLE_CONFIG
+  // BLE config stays discoverable for one idle period after boot so a write
+  // to its control characteristic can open the WiFi window.
+  bool ble_adv = true;
   ble_config_server_start();
 #endif
+
+  while (true) {
+    uint32_t reasons = 0;
+    bool polling = s_config_window_active;
+#if ALPHALOC_BLE_CONFIG
+    polling = polling || ble_adv;
+#endif
+    xTaskNotifyWait(0, UINT32_MAX, &reasons,
+                    polling ? pdMS_TO_TICKS(1000) : portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    const int64_t idle_us = (int64_t)cfg->config_window_s * 1000000LL;
+
+    if (reasons & CONFIG_WINDOW_REQ_BLE) {
+      reasons &= ~CONFIG_WINDOW_REQ_BLE;
+#if ALPHALOC_BLE_CONFIG
+      if (!ble_adv) {
+        ESP_LOGI(TAG, "BLE config advertising re-armed");
+        ble_config_server_start();
+        ble_adv = true;
+        activity_since_us = now;
+      }
+#endif
+    }
+    if (reasons != 0 && s_config_window_active) {
+      activity_since_us = now;
+    } else if (reasons != 0) {
+      if ((reasons & CONFIG_WINDOW_REQ_USER) == 0) {
+        // Keep WiFi off the air while the camera link comes up; coexistence
+        // would otherwise stretch the BLE bring-up.
+        const int64_t defer_until_us =
+            now + (int64_t)ALPHALOC_CONFIG_WINDOW_DEFER_MS * 1000LL;
+        while (!ble_client_is_location_enabled() &&
+               esp_timer_get_time() < defer_until_us) {
+          vTaskDelay(pdMS_TO_TICKS(250));
+        }
+      }
+      ESP_LOGI(TAG, "Config window open (%s)",
+               (reasons & CONFIG_WINDOW_REQ_USER) ? "user" : "auto");
+#if ALPHALOC_BLE_CONFIG
+      ble_config_server_start();
+      ble_adv = true;
+#endif
+#if ALPHALOC_WIFI_WEB
+      wifi_web_start(cfg);
+      boot_profile_mark(BOOT_MARK_WIFI_STARTED);
+#endif
+#if ALPHALOC_NMEA_TCP
+      nmea_tcp_start();
+#endif
+      s_config_window_active = true;
+      activity_since_us = esp_timer_get_time();
+      continue;
+    }
+
+    if (s_config_window_active &&
+        now - config_window_last_activity_us(activity_since_us) >= idle_us) {
+      ESP_LOGI(TAG, "Config window idle, closing");
+#if ALPHALOC_NMEA_TCP
+      nmea_tcp_stop();
+#endif
+#if ALPHALOC_WIFI_WEB
+      wifi_web_stop();
+#endif
+      s_config_window_active = false;
+#if ALPHALOC_BLE_CONFIG
+      ble_config_server_stop();
+      ble_adv = false;
+#endif
+    }
+#if ALPHALOC_BLE_CONFIG
+    if (ble_adv && !s_config_window_active &&
+        now - config_window_last_activity_us(activity_since_us) >= idle_us) {
+      ble_config_server_stop();
+      ble_adv = false;
+    }
+#endif
+  }
+}
+
+#if HAS_CONFIG_BUTTON
+static void IRAM_ATTR config_button_isr(void *arg) {
+  (void)arg;
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(s_button_task, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+static void config_button_task(void *arg) {
+  (void)arg;
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    int held_ms = 0;
+    while (gpio_get_level(ALPHALOC_CONFIG_BUTTON_PIN) == 0 &&
+           held_ms < ALPHALOC_CONFIG_BUTTON_HOLD_MS) {
+      vTaskDelay(pdMS_TO_TICKS(50));
+      held_ms += 50;
+    }
+    if (held_ms >= ALPHALOC_CONFIG_BUTTON_HOLD_MS) {
+      ESP_LOGI(TAG, "Config button held");
+      config_window_request(CONFIG_WINDOW_REQ_USER);
+      while (gpio_get_level(ALPHALOC_CONFIG_BUTTON_PIN) == 0) {
+        vTaskDelay(pdMS_TO_TICKS(50));
+      }
+    } else if (held_ms > 0) {
+      // A short press only makes the BLE config service discoverable again.
+      config_window_request(CONFIG_WINDOW_REQ_BLE);
+    }
+    // Drop edges from bouncing while the button was being held.
+    ulTaskNotifyTake(pdTRUE, 0);
+  }
+}
+
+static void config_button_init(void) {
+  BaseType_t ret =
+      task_plan_create(TASK_ROLE_BUTTON, config_button_task, "cfg_button", 2048,
+                       NULL, &s_button_task);
+  if (ret != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create config_button_task");
+    return;
+  }
+  gpio_config_t btn_cfg = {
+      .pin_bit_mask = 1ULL << ALPHALOC_CONFIG_BUTTON_PIN,
+      .mode = GPIO_MODE_INPUT,
+      .pull_up_en = GPIO_PULLUP_ENABLE,
+      .pull_down_en = GPIO_PULLDOWN_DISABLE,
+      .intr_type = GPIO_INTR_NEGEDGE,
+  };
+  ESP_ERROR_CHECK(gpio_config(&btn_cfg));
+  esp_err_t err = gpio_install_isr_service(0);
+  if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+    ESP_LOGE(TAG, "GPIO ISR service failed: %s", esp_err_to_name(err));
+    return;
+  }
+  ESP_ERROR_CHECK(
+      gpio_isr_handler_add(ALPHALOC_CONFIG_BUTTON_PIN, config_button_isr, NULL));
+}
+#endif
+
+#if ALPHALOC_STANDBY
+static void standby_task(void *arg) {
+  (void)arg;
+  // A standby wake-up only scans briefly; once the camera has been seen the
+  // normal idle timeout applies.
+  int64_t idle_limit_us =
+      (int64_t)(standby_boot_kind() == STANDBY_BOOT_WAKE
+                    ? ALPHALOC_STANDBY_SCAN_S
+                    : ALPHALOC_STANDBY_IDLE_S) *
+      1000000LL;
+  int64_t last_active_us = esp_timer_get_time();
+  while (true) {
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    int64_t now = esp_timer_get_time();
+    if (ble_client_is_connected()) {
+      gps_set_standby(false);
+      idle_limit_us = (int64_t)ALPHALOC_STANDBY_IDLE_S * 1000000LL;
+      last_active_us = now;
+      continue;
+    }
+    if (s_config_window_active) {
+      last_active_us = now;
+      continue;
+    }
+    if (now - last_active_us >= idle_limit_us) {
+      ESP_LOGI(TAG, "No camera for %lld s, entering standby",
+               (long long)((now - last_active_us) / 1000000LL));
+#ifdef ALPHALOC_NEOPIXEL_PIN
+      neopixel_set_rgb(0, 0, 0);
+#endif
+#if ALPHALOC_TRACK_LOG
+      track_log_flush();
+#endif
+      trace_log_mirror();
+      flash_sched_flush();
+      standby_enter(ALPHALOC_STANDBY_WAKE_S);
+    }
+  }
+}
+#endif
+
+// Boot self-test for a freshly updated image: the camera path is up (the
+// NimBLE host synced and started scanning) and the GPS UART delivers NMEA.
+static bool self_test_passed(void) {
+  if (boot_profile_get_us(BOOT_MARK_FIRST_SCAN) == 0) {
+    return false;
+  }
+  gps_fix_t fix;
+  return gps_get_latest(&fix) && fix.last_update_time_us != 0;
+}
+
+#if ALPHALOC_WIFI_WEB
+// GPS epochs, camera link changes and battery reads feed the web status
+// stream; wifi_web only sends what actually changed.
+static void web_status_cb(void *ctx) {
+  (void)ctx;
+  wifi_web_notify_status();
+}
+#endif
+
+#if ALPHALOC_WIFI_WEB || ALPHALOC_BLE_CONFIG
+static void camera_state_cb(void *ctx) {
 #if ALPHALOC_WIFI_WEB
-  wifi_web_start(cfg);
+  web_status_cb(ctx);
 #endif
-  s_config_window_end_time_us =
-      esp_timer_get_time() + ((int64_t)cfg->config_window_s * 1000000LL);
-  vTaskDelay(pdMS_TO_TICKS(cfg->config_window_s * 1000));
 #if ALPHALOC_BLE_CONFIG
-  ble_config_server_stop();
+  // A camera coming back re-arms BLE config advertising for an idle period.
+  static bool s_was_connected;
+  const bool connected = ble_client_is_connected();
+  if (connected && !s_was_connected) {
+    config_window_request(CONFIG_WINDOW_REQ_BLE);
+  }
+  s_was_connected = connected;
+#endif
+}
+#endif
+
+#if ALPHALOC_TRACK_LOG || ALPHALOC_WIFI_WEB
+static void gps_epoch_cb(void *ctx) {
+  (void)ctx;
+#if ALPHALOC_TRACK_LOG
+  gps_fix_t fix;
+  if (gps_get_latest(&fix)) {
+    track_log_epoch(&fix);
+  }
 #endif
 #if ALPHALOC_WIFI_WEB
-  wifi_web_stop();
+  wifi_web_notify_status();
+#endif
+}
+#endif
+
+static void gps_raw_cb(const uint8_t *data, size_t len, void *ctx) {
+  (void)ctx;
+  nmea_capture_feed(data, len);
+#if ALPHALOC_NMEA_TCP
+  nmea_tcp_feed(data, len);
 #endif
-  vTaskDelete(NULL);
 }
 
 #if ALPHALOC_BATTERY_MONITOR
 static void battery_task(void *arg) {
   (void)arg;
+  battery_init();
   battery_read_now();
   while (true) {
     vTaskDelay(pdMS_TO_TICKS(60000));
     battery_read_now();
+#if ALPHALOC_WIFI_WEB
+    web_status_cb(NULL);
+#endif
   }
 }
 #endif
@@ -212,10 +591,7 @@ static void status_led_task(void *arg) {
 
     // Wi-Fi status: blue if web server/AP active.
 #if ALPHALOC_WIFI_WEB
-    int64_t now = esp_timer_get_time();
-    bool window_active =
-        (s_config_window_end_time_us == 0 || now < s_config_window_end_time_us);
-    if (window_active) {
+    if (s_config_window_active) {
       neopixel_set_rgb(0, 0, 255);
       vTaskDelay(on_ms);
       neopixel_set_rgb(0, 0, 0);
@@ -232,6 +608,8 @@ static void status_led_task(void *arg) {
 #endif
 
 void app_main(void) {
+  boot_profile_mark(BOOT_MARK_APP_MAIN);
+  trace_log_init();
   ESP_LOGI(TAG, "AlphaLoc starting");
 
 #if CONFIG_PM_ENABLE
@@ -273,7 +651,33 @@ void app_main(void) {
 #endif
   }
 
-  config_load(&s_cfg);
+  boot_profile_mark(BOOT_MARK_NVS_READY);
+
+  const bool provisioned = config_load(&s_cfg);
+  boot_profile_mark(BOOT_MARK_CONFIG_LOADED);
+
+#if ALPHALOC_STANDBY
+  standby_init();
+  const bool standby_wake = standby_boot_kind() == STANDBY_BOOT_WAKE;
+  ble_handle_cache_t cached_handles;
+  if (standby_restore_handles(&cached_handles)) {
+    ble_client_set_handle_cache(&cached_handles);
+  }
+#else
+  const bool standby_wake = false;
+#endif
+
+  // Before BLE so bond writes during the first pairing are already deferred.
+  flash_sched_start(ble_client_is_busy);
+#if ALPHALOC_TRACK_LOG
+  track_log_init();
+#endif
+
+  // Camera path first: the NimBLE host syncs and starts scanning in its own
+  // task while the rest of the bring-up continues here.
+  ble_client_init(&s_cfg);
+  ble_client_set_focus_callback(focus_update_cb, &s_cfg);
+  boot_profile_mark(BOOT_MARK_BLE_STARTED);
 
   gps_config_t gps_cfg = {
       .uart_num = GPS_UART_NUM,
@@ -281,38 +685,92 @@ void app_main(void) {
       .rx_pin = GPS_UART_RX_PIN,
       .baud_rate = GPS_UART_BAUD,
       .update_interval_ms = s_cfg.gps_interval_ms,
+      .source = gps_synth_source(),
   };
+  nmea_capture_init();
+  time_sync_init();
+#if ALPHALOC_STANDBY
+  // Until the receiver reports time again, the RTC-kept system time stamps
+  // locations, so a restored fix does not go out with its pre-sleep time.
+  int64_t rtc_utc_us;
+  if (standby_restore_time(&rtc_utc_us)) {
+    time_sync_seed(rtc_utc_us);
+  }
+#endif
+  gps_aid_init();
   gps_init(&gps_cfg);
+#if ALPHALOC_TRACK_LOG || ALPHALOC_WIFI_WEB
+  gps_set_epoch_callback(gps_epoch_cb, NULL);
+#endif
+#if ALPHALOC_WIFI_WEB || ALPHALOC_BLE_CONFIG
+  ble_client_set_state_callback(camera_state_cb, NULL);
+#endif
+  gps_set_raw_callback(gps_raw_cb, NULL);
+  boot_profile_mark(BOOT_MARK_GPS_STARTED);
+#if ALPHALOC_STANDBY
+  if (standby_wake) {
+    // Keep the receiver asleep until the camera actually shows up.
+    gps_set_standby(true);
+    gps_fix_t rtc_fix;
+    if (standby_restore_fix(&rtc_fix)) {
+      gps_restore_fix(&rtc_fix);
+    }
+  }
+#endif
 
-  ble_client_init(&s_cfg);
-  ble_client_set_focus_callback(focus_update_cb, &s_cfg);
-
+  task_plan_log();
   BaseType_t ret;
+  ret = task_plan_create(TASK_ROLE_LOCATION, location_publisher_task,
+                         "location_pub", 4096, &s_cfg, &s_publisher_task);
+  if (ret != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create location_publisher_task");
+  }
+  config_add_listener(config_changed_cb, NULL);
+
+  // Everything below is off the camera path and initializes in its own task.
 #if ALPHALOC_BATTERY_MONITOR
-  battery_init();
-  ret = xTaskCreate(battery_task, "battery", 3072, NULL, 4, NULL);
+  ret = task_plan_create(TASK_ROLE_BATTERY, battery_task, "battery", 3072, NULL,
+                         NULL);
   if (ret != pdPASS) {
     ESP_LOGE(TAG, "Failed to create battery_task");
   }
 #endif
-  ret = xTaskCreate(location_publisher_task, "location_pub", 4096, &s_cfg, 5,
-                    NULL);
-  if (ret != pdPASS) {
-    ESP_LOGE(TAG, "Failed to create location_publisher_task");
-  }
 
+  // The config window only opens on demand (button, BLE write) or, on a
+  // device that has never been configured, automatically.
   if (s_cfg.config_window_s > 0) {
-    ret =
-        xTaskCreate(config_window_task, "config_window", 4096, &s_cfg, 5, NULL);
+    ret = task_plan_create(TASK_ROLE_CONFIG_WINDOW, config_window_task,
+                           "config_window", 4096, &s_cfg, &s_config_window_task);
     if (ret != pdPASS) {
       ESP_LOGE(TAG, "Failed to create config_window_task");
+    } else if (!provisioned && !standby_wake) {
+      config_window_request(CONFIG_WINDOW_REQ_AUTO);
     }
+#if ALPHALOC_BLE_CONFIG
+    ble_config_server_set_window_callback(ble_config_window_cb, NULL);
+#endif
+#if HAS_CONFIG_BUTTON
+    config_button_init();
+#endif
+  }
+#if ALPHALOC_STANDBY
+  ret = task_plan_create(TASK_ROLE_STANDBY, standby_task, "standby", 3072, NULL,
+                         NULL);
+  if (ret != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create standby_task");
   }
+#endif
 #ifdef ALPHALOC_NEOPIXEL_PIN
-  ret = xTaskCreate(status_led_task, "status_led", 3072, &s_cfg, 1, NULL);
+  ret = task_plan_create(TASK_ROLE_LED, status_led_task, "status_led", 3072,
+                         &s_cfg, NULL);
   if (ret != pdPASS) {
     ESP_LOGE(TAG, "Failed to create status_led_task");
   }
+#endif
+  task_plan_start_stats();
+  ota_update_start_self_test(self_test_passed);
+#if ALPHALOC_STATIC_ALLOC || ALPHALOC_HEAP_TRACE
+  heap_guard_start(config_window_is_active);
 #endif
   ESP_LOGI(TAG, "AlphaLoc started");
 }
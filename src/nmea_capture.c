@@ -0,0 +1,181 @@
+#include "nmea_capture.h"
+
+#include <string.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Keeps the raw receiver output with arrival times in RAM for download
+// (/api/nmea/capture) and replay on the host. Off by default: it costs
+// ALPHALOC_NMEA_CAPTURE_BYTES of RAM.
+#ifndef ALPHALOC_NMEA_CAPTURE
+#define ALPHALOC_NMEA_CAPTURE 0
+#endif
+#ifndef ALPHALOC_NMEA_CAPTURE_BYTES
+#define ALPHALOC_NMEA_CAPTURE_BYTES 32768
+#endif
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+_Static_assert((ALPHALOC_NMEA_CAPTURE_BYTES &
+                (ALPHALOC_NMEA_CAPTURE_BYTES - 1)) == 0,
+               "ALPHALOC_NMEA_CAPTURE_BYTES must be a power of two");
+
+#if ALPHALOC_NMEA_CAPTURE
+
+#define RING_MASK (ALPHALOC_NMEA_CAPTURE_BYTES - 1)
+#define REC_DATA_MAX (ALPHALOC_NMEA_CAPTURE_BYTES / 2)
+
+// Positions count bytes ever written and wrap with uint32_t; s_tail is
+// always at a record boundary.
+static uint8_t s_ring[ALPHALOC_NMEA_CAPTURE_BYTES];
+static uint32_t s_head;
+static uint32_t s_tail;
+static uint32_t s_records;
+static uint32_t s_overwritten;
+static SemaphoreHandle_t s_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_mutex_buf;
+#endif
+
+static void ring_put(uint32_t pos, const void *src, size_t n) {
+  const size_t off = pos & RING_MASK;
+  const size_t first =
+      n < ALPHALOC_NMEA_CAPTURE_BYTES - off ? n : ALPHALOC_NMEA_CAPTURE_BYTES - off;
+  memcpy(&s_ring[off], src, first);
+  memcpy(s_ring, (const uint8_t *)src + first, n - first);
+}
+
+static void ring_get(uint32_t pos, void *dst, size_t n) {
+  const size_t off = pos & RING_MASK;
+  const size_t first =
+      n < ALPHALOC_NMEA_CAPTURE_BYTES - off ? n : ALPHALOC_NMEA_CAPTURE_BYTES - off;
+  memcpy(dst, &s_ring[off], first);
+  memcpy((uint8_t *)dst + first, s_ring, n - first);
+}
+
+static uint16_t rec_len_at(uint32_t pos) {
+  uint8_t hdr[NMEA_CAPTURE_REC_HDR];
+  ring_get(pos, hdr, sizeof(hdr));
+  return (uint16_t)(hdr[4] | hdr[5] << 8);
+}
+
+static void lock(void) { xSemaphoreTake(s_mutex, portMAX_DELAY); }
+
+static void unlock(void) { xSemaphoreGive(s_mutex); }
+
+void nmea_capture_init(void) {
+#if ALPHALOC_STATIC_ALLOC
+  s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+#else
+  s_mutex = xSemaphoreCreateMutex();
+#endif
+}
+
+bool nmea_capture_enabled(void) { return true; }
+
+void nmea_capture_feed(const uint8_t *data, size_t len) {
+  if (!s_mutex || len == 0) {
+    return;
+  }
+  if (len > REC_DATA_MAX) {
+    data += len - REC_DATA_MAX;
+    len = REC_DATA_MAX;
+  }
+  const uint32_t t_ms = (uint32_t)(esp_timer_get_time() / 1000);
+  const uint8_t hdr[NMEA_CAPTURE_REC_HDR] = {
+      (uint8_t)t_ms,         (uint8_t)(t_ms >> 8), (uint8_t)(t_ms >> 16),
+      (uint8_t)(t_ms >> 24), (uint8_t)len,         (uint8_t)(len >> 8),
+  };
+  const uint32_t rec = NMEA_CAPTURE_REC_HDR + (uint32_t)len;
+  lock();
+  while (s_head + rec - s_tail > ALPHALOC_NMEA_CAPTURE_BYTES) {
+    s_tail += NMEA_CAPTURE_REC_HDR + rec_len_at(s_tail);
+    s_records--;
+    s_overwritten++;
+  }
+  ring_put(s_head, hdr, sizeof(hdr));
+  ring_put(s_head + NMEA_CAPTURE_REC_HDR, data, len);
+  s_head += rec;
+  s_records++;
+  unlock();
+}
+
+void nmea_capture_span(uint32_t *begin, uint32_t *end) {
+  if (!s_mutex) {
+    *begin = 0;
+    *end = 0;
+    return;
+  }
+  lock();
+  *begin = s_tail;
+  *end = s_head;
+  unlock();
+}
+
+size_t nmea_capture_read(uint32_t *cursor, uint32_t end, uint8_t *buf,
+                         size_t cap) {
+  size_t n = 0;
+  if (!s_mutex) {
+    return 0;
+  }
+  lock();
+  if (*cursor - s_tail > s_head - s_tail) {
+    *cursor = s_tail;
+  }
+  while (*cursor != end && end - *cursor <= s_head - *cursor) {
+    const uint32_t rec = NMEA_CAPTURE_REC_HDR + rec_len_at(*cursor);
+    if (n + rec > cap) {
+      break;
+    }
+    ring_get(*cursor, buf + n, rec);
+    n += rec;
+    *cursor += rec;
+  }
+  unlock();
+  return n;
+}
+
+void nmea_capture_get_stats(nmea_capture_stats_t *out) {
+  if (!s_mutex) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  lock();
+  out->records = s_records;
+  out->bytes = s_head - s_tail;
+  out->overwritten = s_overwritten;
+  unlock();
+}
+
+#else
+
+void nmea_capture_init(void) {}
+
+bool nmea_capture_enabled(void) { return false; }
+
+void nmea_capture_feed(const uint8_t *data, size_t len) {
+  (void)data;
+  (void)len;
+}
+
+void nmea_capture_span(uint32_t *begin, uint32_t *end) {
+  *begin = 0;
+  *end = 0;
+}
+
+size_t nmea_capture_read(uint32_t *cursor, uint32_t end, uint8_t *buf,
+                         size_t cap) {
+  (void)cursor;
+  (void)end;
+  (void)buf;
+  (void)cap;
+  return 0;
+}
+
+void nmea_capture_get_stats(nmea_capture_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+}
+
+#endif
@@ -0,0 +1,226 @@
+#include "nmea_parse.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void nmea_line_reset(nmea_line_t *lb) { lb->len = 0; }
+
+void nmea_line_feed(nmea_line_t *lb, const uint8_t *data, size_t len,
+                    nmea_line_fn_t fn, void *ctx) {
+  for (size_t i = 0; i < len; ++i) {
+    char c = (char)data[i];
+    if (c == '\n' || c == '\r') {
+      if (lb->len == 0) {
+        continue;
+      }
+      lb->buf[lb->len] = '\0';
+
+      // Validate minimum NMEA sentence length before parsing
+      if (lb->len >= 7 && lb->buf[0] == '$') {
+        fn(lb->buf, ctx);
+      }
+      lb->len = 0;
+      continue;
+    }
+
+    // Add bounds check to prevent buffer overflow
+    if (isprint((unsigned char)c) && lb->len < sizeof(lb->buf) - 1) {
+      lb->buf[lb->len++] = c;
+    } else if (lb->len >= sizeof(lb->buf) - 1) {
+      // Buffer full, discard this sentence
+      lb->len = 0;
+    }
+  }
+}
+
+// Splits buf in place at commas. Unlike strtok, empty fields are kept, so
+// field numbers stay put when a receiver without a fix leaves them blank.
+static int split_fields(char *buf, const char **fields, int max) {
+  int n = 0;
+  char *p = buf;
+  while (n < max) {
+    fields[n++] = p;
+    char *comma = strchr(p, ',');
+    if (!comma) {
+      break;
+    }
+    *comma = '\0';
+    p = comma + 1;
+  }
+  return n;
+}
+
+static void parse_gga(const char *line, nmea_sentence_t *out) {
+  // GGA fields: 6=fix quality, 7=satellites, 8=HDOP
+  char buf[NMEA_LINE_MAX];
+  strncpy(buf, line, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+
+  const char *fields[12] = {0};
+  const int field_count = split_fields(buf, fields, 12);
+  if (field_count < 9) {
+    return;
+  }
+
+  int fix_quality = atoi(fields[6]);
+  int sats = atoi(fields[7]);
+  out->status_ok = true;
+  out->status.has_lock = (fix_quality > 0);
+  out->status.satellites = (uint8_t)sats;
+  if (strncmp(line, "$GPGGA", 6) == 0) {
+    out->status.constellations = GPS_CONSTELLATION_GPS;
+  } else {
+    out->status.constellations =
+        (GPS_CONSTELLATION_GPS | GPS_CONSTELLATION_GLONASS);
+  }
+}
+
+// Milliseconds from the fraction of an hhmmss.sss field.
+static uint16_t parse_time_ms(const char *field) {
+  const char *dot = strchr(field, '.');
+  if (dot == NULL) {
+    return 0;
+  }
+  uint16_t ms = 0;
+  int scale = 100;
+  for (const char *p = dot + 1; isdigit((unsigned char)*p) && scale > 0;
+       ++p, scale /= 10) {
+    ms = (uint16_t)(ms + (*p - '0') * scale);
+  }
+  return ms;
+}
+
+static double parse_deg_min(const char *value) {
+  if (value == NULL || value[0] == '\0') {
+    return 0.0;
+  }
+  double v = strtod(value, NULL);
+  double deg = floor(v / 100.0);
+  double min = v - (deg * 100.0);
+  return deg + (min / 60.0);
+}
+
+static bool parse_rmc(const char *line, gps_fix_t *out, uint16_t *time_ms) {
+  char buf[NMEA_LINE_MAX];
+  strncpy(buf, line, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+
+  const char *fields[20] = {0};
+  const int field_count = split_fields(buf, fields, 20);
+
+  if (field_count < 10) {
+    return false;
+  }
+
+  if (fields[2][0] != 'A') {
+    return false;
+  }
+
+  out->time_valid = false;
+  out->year = 0;
+  out->month = 0;
+  out->day = 0;
+  out->hour = 0;
+  out->minute = 0;
+  out->second = 0;
+  bool time_ok = false;
+  if (fields[1][0] != '\0') {
+    int hh = 0, mm = 0, ss = 0;
+    if (sscanf(fields[1], "%2d%2d%2d", &hh, &mm, &ss) == 3) {
+      out->hour = (uint8_t)hh;
+      out->minute = (uint8_t)mm;
+      out->second = (uint8_t)ss;
+      *time_ms = parse_time_ms(fields[1]);
+      time_ok = true;
+    }
+  }
+
+  if (fields[9][0] != '\0') {
+    int dd = 0, mm = 0, yy = 0;
+    if (sscanf(fields[9], "%2d%2d%2d", &dd, &mm, &yy) == 3) {
+      out->day = (uint8_t)dd;
+      out->month = (uint8_t)mm;
+      out->year = (uint16_t)(2000 + yy);
+    }
+  }
+  out->time_valid = time_ok;
+
+  double lat = parse_deg_min(fields[3]);
+  if (fields[4][0] == 'S') {
+    lat = -lat;
+  }
+
+  double lon = parse_deg_min(fields[5]);
+  if (fields[6][0] == 'W') {
+    lon = -lon;
+  }
+
+  out->lat_deg = lat;
+  out->lon_deg = lon;
+  out->valid = true;
+  return true;
+}
+
+static bool parse_zda(const char *line, gps_fix_t *out, uint16_t *time_ms,
+                      bool *time_ok, bool *date_ok) {
+  char buf[NMEA_LINE_MAX];
+  strncpy(buf, line, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+
+  const char *fields[8] = {0};
+  const int field_count = split_fields(buf, fields, 8);
+
+  if (field_count < 5) {
+    return false;
+  }
+
+  *time_ok = false;
+  *date_ok = false;
+  if (fields[1][0] != '\0') {
+    int hh = 0, mm = 0, ss = 0;
+    if (sscanf(fields[1], "%2d%2d%2d", &hh, &mm, &ss) == 3) {
+      out->hour = (uint8_t)hh;
+      out->minute = (uint8_t)mm;
+      out->second = (uint8_t)ss;
+      *time_ms = parse_time_ms(fields[1]);
+      *time_ok = true;
+    }
+  }
+
+  if (fields[2][0] != '\0' && fields[3][0] != '\0' && fields[4][0] != '\0') {
+    int dd = 0, mm = 0, yyyy = 0;
+    if (sscanf(fields[2], "%2d", &dd) == 1 &&
+        sscanf(fields[3], "%2d", &mm) == 1 &&
+        sscanf(fields[4], "%4d", &yyyy) == 1) {
+      out->day = (uint8_t)dd;
+      out->month = (uint8_t)mm;
+      out->year = (uint16_t)yyyy;
+      *date_ok = true;
+    }
+  }
+
+  return *time_ok || *date_ok;
+}
+
+void nmea_parse(const char *line, nmea_sentence_t *out) {
+  memset(out, 0, sizeof(*out));
+  if (strncmp(line, "$GPGGA", 6) == 0 || strncmp(line, "$GNGGA", 6) == 0) {
+    out->kind = NMEA_GGA;
+    parse_gga(line, out);
+  } else if (strncmp(line, "$GPRMC", 6) == 0 ||
+             strncmp(line, "$GNRMC", 6) == 0) {
+    out->kind = NMEA_RMC;
+    out->fix_ok = parse_rmc(line, &out->fix, &out->time_ms);
+  } else if (strncmp(line, "$GPZDA", 6) == 0 ||
+             strncmp(line, "$GNZDA", 6) == 0) {
+    out->kind = NMEA_ZDA;
+    if (!parse_zda(line, &out->fix, &out->time_ms, &out->time_ok,
+                   &out->date_ok)) {
+      out->time_ok = false;
+      out->date_ok = false;
+    }
+  }
+}
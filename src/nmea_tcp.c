@@ -0,0 +1,272 @@
+#include "nmea_tcp.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+#include "task_plan.h"
+
+// 10110 is the IANA port for NMEA 0183 over TCP (what gpsd and most
+// navigation apps try first).
+#ifndef ALPHALOC_NMEA_TCP_PORT
+#define ALPHALOC_NMEA_TCP_PORT 10110
+#endif
+// Backlog shared by all clients; one that falls this far behind is dropped.
+#ifndef ALPHALOC_NMEA_TCP_RING
+#define ALPHALOC_NMEA_TCP_RING 4096
+#endif
+_Static_assert((ALPHALOC_NMEA_TCP_RING & (ALPHALOC_NMEA_TCP_RING - 1)) == 0,
+               "ALPHALOC_NMEA_TCP_RING must be a power of two");
+
+#define RING_MASK (ALPHALOC_NMEA_TCP_RING - 1)
+// Accept/retry period; new data wakes the task directly.
+#define NMEA_TCP_POLL_MS 100
+
+static const char *TAG = "nmea_tcp";
+
+typedef struct {
+  int fd;
+  uint32_t cursor;
+} nmea_client_t;
+
+// The GPS task is the only writer. Each client sends straight out of the
+// ring from its own cursor, so fan-out costs no copies beyond the one into
+// the ring. Positions count bytes ever written and wrap with uint32_t.
+static uint8_t s_ring[ALPHALOC_NMEA_TCP_RING];
+static uint32_t s_head;
+static nmea_client_t s_clients[ALPHALOC_NMEA_TCP_MAX_CLIENTS];
+static volatile int s_client_count;
+static volatile bool s_running;
+static int s_listen_fd = -1;
+static TaskHandle_t s_task;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static nmea_tcp_stats_t s_stats;
+static int64_t s_last_send_us;  // under s_stats_lock
+
+void nmea_tcp_feed(const uint8_t *data, size_t len) {
+  if (s_client_count == 0 || len == 0) {
+    return;
+  }
+  const int64_t start_us = esp_timer_get_time();
+  if (len > ALPHALOC_NMEA_TCP_RING) {
+    data += len - ALPHALOC_NMEA_TCP_RING;
+    len = ALPHALOC_NMEA_TCP_RING;
+  }
+  const uint32_t head = __atomic_load_n(&s_head, __ATOMIC_RELAXED);
+  const size_t off = head & RING_MASK;
+  const size_t first =
+      len < ALPHALOC_NMEA_TCP_RING - off ? len : ALPHALOC_NMEA_TCP_RING - off;
+  memcpy(&s_ring[off], data, first);
+  memcpy(s_ring, data + first, len - first);
+  __atomic_store_n(&s_head, head + (uint32_t)len, __ATOMIC_RELEASE);
+  xTaskNotifyGive(s_task);
+
+  const uint32_t spent_us = (uint32_t)(esp_timer_get_time() - start_us);
+  portENTER_CRITICAL(&s_stats_lock);
+  s_stats.bytes_in += len;
+  s_stats.feeds++;
+  s_stats.feed_total_us += spent_us;
+  if (spent_us > s_stats.feed_max_us) {
+    s_stats.feed_max_us = spent_us;
+  }
+  portEXIT_CRITICAL(&s_stats_lock);
+}
+
+static void close_client(int i, const char *why) {
+  close(s_clients[i].fd);
+  s_clients[i].fd = -1;
+  s_client_count--;
+  ESP_LOGI(TAG, "Client %d %s (%d left)", i, why, s_client_count);
+}
+
+static void drop_slow_client(int i) {
+  portENTER_CRITICAL(&s_stats_lock);
+  s_stats.dropped++;
+  portEXIT_CRITICAL(&s_stats_lock);
+  close_client(i, "too slow, dropped");
+}
+
+static void close_all(void) {
+  for (int i = 0; i < ALPHALOC_NMEA_TCP_MAX_CLIENTS; ++i) {
+    if (s_clients[i].fd >= 0) {
+      close_client(i, "closed");
+    }
+  }
+  if (s_listen_fd >= 0) {
+    close(s_listen_fd);
+    s_listen_fd = -1;
+  }
+}
+
+static bool open_listener(void) {
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+  if (fd < 0) {
+    return false;
+  }
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr = {0};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(ALPHALOC_NMEA_TCP_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+      listen(fd, 2) != 0) {
+    ESP_LOGE(TAG, "Cannot listen on port %d: errno %d", ALPHALOC_NMEA_TCP_PORT,
+             errno);
+    close(fd);
+    return false;
+  }
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  s_listen_fd = fd;
+  ESP_LOGI(TAG, "Serving NMEA on TCP port %d", ALPHALOC_NMEA_TCP_PORT);
+  return true;
+}
+
+static void accept_clients(void) {
+  while (true) {
+    int fd = accept(s_listen_fd, NULL, NULL);
+    if (fd < 0) {
+      return;
+    }
+    int slot = -1;
+    for (int i = 0; i < ALPHALOC_NMEA_TCP_MAX_CLIENTS; ++i) {
+      if (s_clients[i].fd < 0) {
+        slot = i;
+        break;
+      }
+    }
+    if (slot < 0) {
+      ESP_LOGW(TAG, "Client limit reached, refusing connection");
+      close(fd);
+      continue;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    // New clients start at the next byte the receiver delivers.
+    s_clients[slot].cursor = __atomic_load_n(&s_head, __ATOMIC_ACQUIRE);
+    s_clients[slot].fd = fd;
+    s_client_count++;
+    ESP_LOGI(TAG, "Client %d connected (%d open)", slot, s_client_count);
+  }
+}
+
+// Sends everything up to head the client has not seen yet. A full socket
+// buffer leaves the rest for the next wake-up; the client is dropped once the
+// GPS task laps it.
+static void service_client(int i, uint32_t head) {
+  nmea_client_t *c = &s_clients[i];
+  // Clients may send commands (e.g. gpsd's ?WATCH); there is nothing to
+  // answer, but reading tells a closed connection apart.
+  char discard[64];
+  int n = recv(c->fd, discard, sizeof(discard), MSG_DONTWAIT);
+  if (n == 0) {
+    close_client(i, "disconnected");
+    return;
+  }
+  if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+    close_client(i, "failed");
+    return;
+  }
+  while (c->cursor != head) {
+    const uint32_t lag = head - c->cursor;
+    if (lag > ALPHALOC_NMEA_TCP_RING) {
+      drop_slow_client(i);
+      return;
+    }
+    const size_t off = c->cursor & RING_MASK;
+    const size_t chunk = lag < ALPHALOC_NMEA_TCP_RING - off
+                             ? lag
+                             : ALPHALOC_NMEA_TCP_RING - off;
+    int sent = send(c->fd, &s_ring[off], chunk, MSG_DONTWAIT);
+    if (sent < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        close_client(i, "failed");
+      }
+      return;
+    }
+    // The bytes are only valid if the writer did not lap the cursor while
+    // lwIP copied them out.
+    if (__atomic_load_n(&s_head, __ATOMIC_ACQUIRE) - c->cursor >
+        ALPHALOC_NMEA_TCP_RING) {
+      drop_slow_client(i);
+      return;
+    }
+    c->cursor += (uint32_t)sent;
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.bytes_out += (uint32_t)sent;
+    if (sent > 0) {
+      s_last_send_us = esp_timer_get_time();
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
+  }
+}
+
+static void nmea_tcp_task(void *arg) {
+  (void)arg;
+  while (true) {
+    if (!s_running) {
+      close_all();
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    if (s_listen_fd >= 0 || open_listener()) {
+      accept_clients();
+      const uint32_t head = __atomic_load_n(&s_head, __ATOMIC_ACQUIRE);
+      for (int i = 0; i < ALPHALOC_NMEA_TCP_MAX_CLIENTS; ++i) {
+        if (s_clients[i].fd >= 0) {
+          service_client(i, head);
+        }
+      }
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NMEA_TCP_POLL_MS));
+  }
+}
+
+void nmea_tcp_start(void) {
+  if (!s_task) {
+    for (int i = 0; i < ALPHALOC_NMEA_TCP_MAX_CLIENTS; ++i) {
+      s_clients[i].fd = -1;
+    }
+    // Created once and parked while the network is down, so the static
+    // stack pool can serve it.
+    if (task_plan_create(TASK_ROLE_NMEA_TCP, nmea_tcp_task, "nmea_tcp", 3072,
+                         NULL, &s_task) != pdPASS) {
+      ESP_LOGE(TAG, "Failed to create nmea_tcp_task");
+      s_task = NULL;
+      return;
+    }
+  }
+  s_running = true;
+  xTaskNotifyGive(s_task);
+}
+
+void nmea_tcp_stop(void) {
+  if (!s_task) {
+    return;
+  }
+  s_running = false;
+  xTaskNotifyGive(s_task);
+}
+
+int nmea_tcp_client_count(void) { return s_client_count; }
+
+int64_t nmea_tcp_last_activity_us(void) {
+  portENTER_CRITICAL(&s_stats_lock);
+  const int64_t t = s_last_send_us;
+  portEXIT_CRITICAL(&s_stats_lock);
+  return t;
+}
+
+void nmea_tcp_get_stats(nmea_tcp_stats_t *out) {
+  if (!out) {
+    return;
+  }
+  portENTER_CRITICAL(&s_stats_lock);
+  *out = s_stats;
+  portEXIT_CRITICAL(&s_stats_lock);
+  out->clients = (uint32_t)s_client_count;
+}
@@ -0,0 +1,225 @@
+#include "ota_update.h"
+
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_timer.h"
+#include "flash_sched.h"
+#include "mbedtls/sha256.h"
+
+// Time a freshly updated image gets to pass its self-test before the
+// bootloader is told to go back to the previous one.
+#ifndef ALPHALOC_OTA_SELF_TEST_S
+#define ALPHALOC_OTA_SELF_TEST_S 60
+#endif
+#define SELF_TEST_POLL_US (500 * 1000)
+
+static const char *TAG = "ota";
+
+static bool s_active;
+static esp_ota_handle_t s_handle;
+static const esp_partition_t *s_part;
+static mbedtls_sha256_context s_sha;
+static uint8_t s_expected[32];
+static bool s_has_expected;
+static uint32_t s_bytes;
+static int64_t s_start_us;
+static size_t s_heap_start;
+static size_t s_heap_min;
+
+static ota_self_test_fn_t s_self_test;
+static esp_timer_handle_t s_self_test_timer;
+static int64_t s_self_test_deadline_us;
+
+static int hex_nibble(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+static bool parse_sha256(const char *hex, uint8_t out[32]) {
+  if (strlen(hex) != 64) {
+    return false;
+  }
+  for (int i = 0; i < 32; ++i) {
+    int hi = hex_nibble(hex[2 * i]);
+    int lo = hex_nibble(hex[2 * i + 1]);
+    if (hi < 0 || lo < 0) {
+      return false;
+    }
+    out[i] = (uint8_t)((hi << 4) | lo);
+  }
+  return true;
+}
+
+static void sample_heap(void) {
+  size_t free_now = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  if (free_now < s_heap_min) {
+    s_heap_min = free_now;
+  }
+}
+
+bool ota_update_in_progress(void) { return s_active; }
+
+esp_err_t ota_update_begin(const char *sha256_hex) {
+  if (s_active) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  s_has_expected = sha256_hex && sha256_hex[0] != '\0';
+  if (s_has_expected && !parse_sha256(sha256_hex, s_expected)) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  s_part = esp_ota_get_next_update_partition(NULL);
+  if (!s_part) {
+    ESP_LOGE(TAG, "No OTA slot in the partition table");
+    return ESP_ERR_NOT_FOUND;
+  }
+  s_heap_start = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  s_heap_min = s_heap_start;
+  // Sequential writes erase each sector just before it is written instead
+  // of the whole slot up front, which would stall the flash for seconds.
+  esp_err_t err = esp_ota_begin(s_part, OTA_WITH_SEQUENTIAL_WRITES, &s_handle);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "esp_ota_begin failed: %s", esp_err_to_name(err));
+    return err;
+  }
+  mbedtls_sha256_init(&s_sha);
+  mbedtls_sha256_starts(&s_sha, 0);
+  s_bytes = 0;
+  s_start_us = esp_timer_get_time();
+  s_active = true;
+  sample_heap();
+  ESP_LOGI(TAG, "Update started into %s (0x%lx, %lu bytes)%s", s_part->label,
+           (unsigned long)s_part->address, (unsigned long)s_part->size,
+           s_has_expected ? ", sha256 given" : "");
+  return ESP_OK;
+}
+
+esp_err_t ota_update_write(const void *data, size_t len) {
+  if (!s_active) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  esp_err_t err = esp_ota_write(s_handle, data, len);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Write at %lu failed: %s", (unsigned long)s_bytes,
+             esp_err_to_name(err));
+    ota_update_abort();
+    return err;
+  }
+  mbedtls_sha256_update(&s_sha, (const unsigned char *)data, len);
+  s_bytes += (uint32_t)len;
+  sample_heap();
+  return ESP_OK;
+}
+
+void ota_update_abort(void) {
+  if (!s_active) {
+    return;
+  }
+  esp_ota_abort(s_handle);
+  mbedtls_sha256_free(&s_sha);
+  s_active = false;
+  ESP_LOGW(TAG, "Update aborted after %lu bytes", (unsigned long)s_bytes);
+}
+
+esp_err_t ota_update_finish(ota_update_stats_t *out) {
+  if (!s_active) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&s_sha, digest);
+  mbedtls_sha256_free(&s_sha);
+  if (s_has_expected && memcmp(digest, s_expected, sizeof(digest)) != 0) {
+    ESP_LOGE(TAG, "SHA-256 mismatch, discarding upload");
+    esp_ota_abort(s_handle);
+    s_active = false;
+    return ESP_ERR_INVALID_CRC;
+  }
+  s_active = false;
+  // Checks the image header, chip id and the checksum/hash appended by the
+  // build before anything points at the new slot.
+  esp_err_t err = esp_ota_end(s_handle);
+  if (err == ESP_OK) {
+    err = esp_ota_set_boot_partition(s_part);
+  }
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Image rejected: %s", esp_err_to_name(err));
+    return err;
+  }
+
+  ota_update_stats_t st = {0};
+  st.bytes = s_bytes;
+  st.elapsed_ms = (uint32_t)((esp_timer_get_time() - s_start_us) / 1000);
+  st.kib_per_s =
+      st.elapsed_ms ? (uint32_t)((uint64_t)s_bytes * 1000 / 1024 / st.elapsed_ms)
+                    : 0;
+  st.peak_heap_bytes = (uint32_t)(s_heap_start - s_heap_min);
+  ESP_LOGI(TAG, "Update of %lu bytes done in %lu ms (%lu KiB/s, peak heap %lu)",
+           (unsigned long)st.bytes, (unsigned long)st.elapsed_ms,
+           (unsigned long)st.kib_per_s, (unsigned long)st.peak_heap_bytes);
+  if (out) {
+    *out = st;
+  }
+  return ESP_OK;
+}
+
+// Writing otadata stalls the flash like an NVS commit, so it waits for the
+// camera link to be quiet as well.
+static uint32_t mark_valid_job(void *ctx) {
+  (void)ctx;
+  const int64_t start_us = esp_timer_get_time();
+  esp_err_t err = esp_ota_mark_app_valid_cancel_rollback();
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Marking image valid failed: %s", esp_err_to_name(err));
+  } else {
+    ESP_LOGI(TAG, "Self-test passed, image marked valid");
+  }
+  return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void self_test_poll(void *arg) {
+  (void)arg;
+  if (s_self_test()) {
+    esp_timer_stop(s_self_test_timer);
+    flash_sched_submit(FLASH_JOB_OTA, mark_valid_job, NULL, 0);
+    return;
+  }
+  if (esp_timer_get_time() >= s_self_test_deadline_us) {
+    ESP_LOGE(TAG, "Self-test failed after %d s, rolling back",
+             ALPHALOC_OTA_SELF_TEST_S);
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+  }
+}
+
+void ota_update_start_self_test(ota_self_test_fn_t test) {
+  const esp_partition_t *running = esp_ota_get_running_partition();
+  esp_ota_img_states_t state = ESP_OTA_IMG_UNDEFINED;
+  if (!running || esp_ota_get_state_partition(running, &state) != ESP_OK ||
+      state != ESP_OTA_IMG_PENDING_VERIFY) {
+    return;
+  }
+  ESP_LOGI(TAG, "Running new image from %s, self-test pending",
+           running->label);
+  s_self_test = test;
+  s_self_test_deadline_us =
+      esp_timer_get_time() + (int64_t)ALPHALOC_OTA_SELF_TEST_S * 1000000LL;
+  const esp_timer_create_args_t args = {
+      .callback = self_test_poll,
+      .name = "ota_self_test",
+  };
+  if (esp_timer_create(&args, &s_self_test_timer) != ESP_OK ||
+      esp_timer_start_periodic(s_self_test_timer, SELF_TEST_POLL_US) !=
+          ESP_OK) {
+    // Leave the image pending: the next reset rolls back.
+    ESP_LOGE(TAG, "Failed to start self-test timer");
+  }
+}
@@ -0,0 +1,151 @@
+#include "standby.h"
+
+#include <stddef.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "time_sync.h"
+
+#define STANDBY_RTC_MAGIC 0x414C5354u
+
+static const char *TAG = "standby";
+
+// Lives in RTC slow memory: survives deep sleep, lost on power-on reset.
+typedef struct {
+  uint32_t magic;
+  uint32_t wake_count;
+  bool fix_valid;
+  gps_fix_t fix;
+  int64_t fix_age_us;
+  struct timeval saved_at;
+  bool time_ok;  // the system time followed GNSS when saved_at was taken
+  ble_handle_cache_t handles;
+  uint32_t ttl_cold_ms;
+  uint32_t ttl_wake_ms;
+  uint32_t crc;
+} standby_rtc_t;
+
+static RTC_DATA_ATTR standby_rtc_t s_rtc;
+static standby_boot_t s_boot = STANDBY_BOOT_COLD;
+static bool s_location_sent;
+
+static uint32_t rtc_crc(const standby_rtc_t *st) {
+  return esp_rom_crc32_le(0, (const uint8_t *)st, offsetof(standby_rtc_t, crc));
+}
+
+static bool rtc_valid(void) {
+  return s_rtc.magic == STANDBY_RTC_MAGIC && s_rtc.crc == rtc_crc(&s_rtc);
+}
+
+static void rtc_seal(void) {
+  s_rtc.magic = STANDBY_RTC_MAGIC;
+  s_rtc.crc = rtc_crc(&s_rtc);
+}
+
+void standby_init(void) {
+  bool timer_wake = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+  if (!rtc_valid()) {
+    memset(&s_rtc, 0, sizeof(s_rtc));
+    rtc_seal();
+    s_boot = STANDBY_BOOT_COLD;
+    return;
+  }
+  if (!timer_wake) {
+    // Reset or button wake: keep the benchmark numbers, drop the session.
+    s_rtc.fix_valid = false;
+    s_rtc.time_ok = false;
+    s_rtc.handles.valid = false;
+    rtc_seal();
+    s_boot = STANDBY_BOOT_COLD;
+    return;
+  }
+  s_boot = STANDBY_BOOT_WAKE;
+  s_rtc.wake_count++;
+  rtc_seal();
+  ESP_LOGI(TAG, "Woke from standby (#%u)", (unsigned)s_rtc.wake_count);
+}
+
+standby_boot_t standby_boot_kind(void) { return s_boot; }
+
+bool standby_restore_fix(gps_fix_t *out_fix) {
+  if (s_boot != STANDBY_BOOT_WAKE || !s_rtc.fix_valid || !out_fix) {
+    return false;
+  }
+  // esp_timer restarts at zero after deep sleep; the RTC-backed wall clock
+  // tells how long we slept, so the restored fix keeps its true age.
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  int64_t slept_us =
+      (int64_t)(now.tv_sec - s_rtc.saved_at.tv_sec) * 1000000LL +
+      (now.tv_usec - s_rtc.saved_at.tv_usec);
+  if (slept_us < 0) {
+    slept_us = 0;
+  }
+  int64_t boot_now = esp_timer_get_time();
+  *out_fix = s_rtc.fix;
+  out_fix->last_fix_time_us = boot_now - s_rtc.fix_age_us - slept_us;
+  out_fix->last_update_time_us = out_fix->last_fix_time_us;
+  return true;
+}
+
+bool standby_restore_time(int64_t *out_utc_us) {
+  if (s_boot != STANDBY_BOOT_WAKE || !s_rtc.time_ok || !out_utc_us) {
+    return false;
+  }
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  *out_utc_us = (int64_t)now.tv_sec * 1000000LL + now.tv_usec;
+  return true;
+}
+
+bool standby_restore_handles(ble_handle_cache_t *out_cache) {
+  if (s_boot != STANDBY_BOOT_WAKE || !s_rtc.handles.valid || !out_cache) {
+    return false;
+  }
+  *out_cache = s_rtc.handles;
+  return true;
+}
+
+void standby_note_location_sent(void) {
+  if (s_location_sent) {
+    return;
+  }
+  s_location_sent = true;
+  uint32_t ttl_ms = (uint32_t)(esp_timer_get_time() / 1000);
+  if (s_boot == STANDBY_BOOT_WAKE) {
+    s_rtc.ttl_wake_ms = ttl_ms;
+  } else {
+    s_rtc.ttl_cold_ms = ttl_ms;
+  }
+  rtc_seal();
+  ESP_LOGI(TAG, "Time to first location: %u ms (%s); last cold=%u ms wake=%u ms",
+           (unsigned)ttl_ms, s_boot == STANDBY_BOOT_WAKE ? "wake" : "cold",
+           (unsigned)s_rtc.ttl_cold_ms, (unsigned)s_rtc.ttl_wake_ms);
+}
+
+void standby_enter(uint32_t wake_interval_s) {
+  gps_fix_t fix;
+  s_rtc.fix_valid = gps_get_latest(&fix) && (fix.valid || fix.time_valid);
+  if (s_rtc.fix_valid) {
+    s_rtc.fix = fix;
+    s_rtc.fix_age_us = esp_timer_get_time() - fix.last_fix_time_us;
+  }
+  ble_handle_cache_t handles;
+  if (ble_client_get_handle_cache(&handles)) {
+    s_rtc.handles = handles;
+  }
+  int64_t utc_us;
+  s_rtc.time_ok = time_sync_now_us(&utc_us);
+  gettimeofday(&s_rtc.saved_at, NULL);
+  rtc_seal();
+
+  gps_set_standby(true);
+  ESP_LOGI(TAG, "Entering deep sleep for %u s", (unsigned)wake_interval_s);
+  esp_sleep_enable_timer_wakeup((uint64_t)wake_interval_s * 1000000ULL);
+  esp_deep_sleep_start();
+}
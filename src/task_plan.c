@@ -0,0 +1,315 @@
+#include "task_plan.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "ble_client.h"
+#include "coex_policy.h"
+#include "esp_log.h"
+#include "fix_latency.h"
+#include "flash_sched.h"
+#include "gps_aid.h"
+#include "nmea_tcp.h"
+#include "sdkconfig.h"
+#include "time_sync.h"
+#include "track_log.h"
+
+// 0 = legacy placement (unpinned, original priorities), 1 = split radio/app.
+#ifndef ALPHALOC_TASK_PLAN
+#define ALPHALOC_TASK_PLAN 1
+#endif
+// Period of the run-time stats dump, 0 = off. Needs
+// CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS and run-time stats enabled.
+#ifndef ALPHALOC_TASK_STATS_S
+#define ALPHALOC_TASK_STATS_S 0
+#endif
+// 1 = create tasks from static stacks/TCBs instead of the heap.
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+// Upper bound for the static stack pool in bytes; the build fails above it.
+#ifndef ALPHALOC_STATIC_STACK_BUDGET
+#define ALPHALOC_STATIC_STACK_BUDGET 40960
+#endif
+
+static const char *TAG = "task_plan";
+
+// Core that runs the NimBLE host; everything latency-critical for the camera
+// stays with it, the rest goes to the other core.
+#if defined(CONFIG_FREERTOS_UNICORE) && CONFIG_FREERTOS_UNICORE
+#define CORE_RADIO 0
+#define CORE_APP 0
+#elif defined(CONFIG_BT_NIMBLE_PINNED_TO_CORE)
+#define CORE_RADIO CONFIG_BT_NIMBLE_PINNED_TO_CORE
+#define CORE_APP (1 - CONFIG_BT_NIMBLE_PINNED_TO_CORE)
+#else
+#define CORE_RADIO 0
+#define CORE_APP 1
+#endif
+
+typedef struct {
+  BaseType_t core;
+  UBaseType_t priority;
+} task_slot_t;
+
+#if ALPHALOC_TASK_PLAN
+// With a single core the placement collapses onto core 0, so the priorities
+// carry the plan: the focus/location path outranks GNSS parsing, which
+// outranks httpd and the housekeeping tasks. The NimBLE host
+// (configMAX_PRIORITIES - 4) stays above all of them.
+static const task_slot_t k_plan[TASK_ROLE_COUNT] = {
+    [TASK_ROLE_LOCATION] = {CORE_RADIO, 6},
+    [TASK_ROLE_GPS] = {CORE_APP, 5},
+    [TASK_ROLE_HTTPD] = {CORE_APP, 3},
+    [TASK_ROLE_CONFIG_WINDOW] = {CORE_APP, 3},
+    [TASK_ROLE_BATTERY] = {CORE_APP, 2},
+    [TASK_ROLE_STANDBY] = {CORE_RADIO, 2},
+    [TASK_ROLE_BUTTON] = {CORE_RADIO, 2},
+    [TASK_ROLE_LED] = {CORE_APP, 1},
+    [TASK_ROLE_STATS] = {CORE_APP, 1},
+    [TASK_ROLE_HEAP_GUARD] = {CORE_APP, 1},
+    [TASK_ROLE_FLASH] = {CORE_APP, 2},
+    [TASK_ROLE_NMEA_TCP] = {CORE_APP, 3},
+    [TASK_ROLE_BLE_HOST] = {CORE_RADIO, configMAX_PRIORITIES - 4},
+};
+#else
+static const task_slot_t k_plan[TASK_ROLE_COUNT] = {
+    [TASK_ROLE_LOCATION] = {tskNO_AFFINITY, 5},
+    [TASK_ROLE_GPS] = {tskNO_AFFINITY, 5},
+    [TASK_ROLE_HTTPD] = {tskNO_AFFINITY, tskIDLE_PRIORITY + 5},
+    [TASK_ROLE_CONFIG_WINDOW] = {tskNO_AFFINITY, 5},
+    [TASK_ROLE_BATTERY] = {tskNO_AFFINITY, 4},
+    [TASK_ROLE_STANDBY] = {tskNO_AFFINITY, 3},
+    [TASK_ROLE_BUTTON] = {tskNO_AFFINITY, 2},
+    [TASK_ROLE_LED] = {tskNO_AFFINITY, 1},
+    [TASK_ROLE_STATS] = {tskNO_AFFINITY, 1},
+    [TASK_ROLE_HEAP_GUARD] = {tskNO_AFFINITY, 1},
+    [TASK_ROLE_FLASH] = {tskNO_AFFINITY, 2},
+    [TASK_ROLE_NMEA_TCP] = {tskNO_AFFINITY, 4},
+    [TASK_ROLE_BLE_HOST] = {CORE_RADIO, configMAX_PRIORITIES - 4},
+};
+#endif
+
+#if ALPHALOC_STATIC_ALLOC
+// Largest stack each role may ask for; every role gets its slice of the pool
+// whether or not the task is compiled in. httpd allocates its own task while
+// the config window is open and is not covered.
+#define STACK_STATS (ALPHALOC_TASK_STATS_S > 0 ? 3072 : 0)
+#define STACK_BLE_HOST CONFIG_BT_NIMBLE_HOST_TASK_STACK_SIZE
+#define STACK_POOL                                                          \
+  (4096 + 6144 + 4096 + 3072 + 3072 + 2048 + 3072 + STACK_STATS + 2560 + \
+   3072 + 3072 + STACK_BLE_HOST)
+_Static_assert(STACK_POOL <= ALPHALOC_STATIC_STACK_BUDGET,
+               "static task stacks exceed ALPHALOC_STATIC_STACK_BUDGET");
+
+static const uint32_t k_static_stack[TASK_ROLE_COUNT] = {
+    [TASK_ROLE_LOCATION] = 4096,
+    [TASK_ROLE_GPS] = 6144,
+    [TASK_ROLE_HTTPD] = 0,
+    [TASK_ROLE_CONFIG_WINDOW] = 4096,
+    [TASK_ROLE_BATTERY] = 3072,
+    [TASK_ROLE_STANDBY] = 3072,
+    [TASK_ROLE_BUTTON] = 2048,
+    [TASK_ROLE_LED] = 3072,
+    [TASK_ROLE_STATS] = STACK_STATS,
+    [TASK_ROLE_HEAP_GUARD] = 2560,
+    [TASK_ROLE_FLASH] = 3072,
+    [TASK_ROLE_NMEA_TCP] = 3072,
+    [TASK_ROLE_BLE_HOST] = STACK_BLE_HOST,
+};
+static StackType_t s_stack_pool[STACK_POOL];
+static StaticTask_t s_tcbs[TASK_ROLE_COUNT];
+static bool s_static_used[TASK_ROLE_COUNT];
+
+static TaskHandle_t create_static(task_role_t role, TaskFunction_t fn,
+                                  const char *name, uint32_t stack_size,
+                                  void *arg) {
+  if (stack_size > k_static_stack[role] || s_static_used[role]) {
+    ESP_LOGE(TAG, "No static stack for %s (%lu bytes)", name,
+             (unsigned long)stack_size);
+    return NULL;
+  }
+  size_t offset = 0;
+  for (int i = 0; i < role; ++i) {
+    offset += k_static_stack[i];
+  }
+  s_static_used[role] = true;
+  return xTaskCreateStaticPinnedToCore(
+      fn, name, k_static_stack[role], arg, k_plan[role].priority,
+      &s_stack_pool[offset], &s_tcbs[role], k_plan[role].core);
+}
+#endif
+
+BaseType_t task_plan_create(task_role_t role, TaskFunction_t fn,
+                            const char *name, uint32_t stack_size, void *arg,
+                            TaskHandle_t *out_handle) {
+  if (role >= TASK_ROLE_COUNT) {
+    return pdFAIL;
+  }
+#if ALPHALOC_STATIC_ALLOC
+  TaskHandle_t handle = create_static(role, fn, name, stack_size, arg);
+  if (out_handle) {
+    *out_handle = handle;
+  }
+  return handle ? pdPASS : pdFAIL;
+#else
+  return xTaskCreatePinnedToCore(fn, name, stack_size, arg,
+                                 k_plan[role].priority, out_handle,
+                                 k_plan[role].core);
+#endif
+}
+
+BaseType_t task_plan_core(task_role_t role) {
+  return role < TASK_ROLE_COUNT ? k_plan[role].core : tskNO_AFFINITY;
+}
+
+UBaseType_t task_plan_priority(task_role_t role) {
+  return role < TASK_ROLE_COUNT ? k_plan[role].priority : 1;
+}
+
+void task_plan_log(void) {
+  ESP_LOGI(TAG, "Task plan %d: radio core %d, app core %d",
+           ALPHALOC_TASK_PLAN, CORE_RADIO, CORE_APP);
+}
+
+#if ALPHALOC_TASK_STATS_S > 0 && defined(CONFIG_FREERTOS_USE_TRACE_FACILITY) && \
+    defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)
+// Tasks in the run time table; with more, the table is skipped.
+#define STATS_MAX_TASKS 32
+#define STATS_LINE_LEN 48
+
+static void log_run_time_stats(void) {
+  static TaskStatus_t tasks[STATS_MAX_TASKS];
+  static char buf[STATS_LINE_LEN * STATS_MAX_TASKS];
+  configRUN_TIME_COUNTER_TYPE total = 0;
+  // Fills nothing and returns 0 when the array is too small.
+  const UBaseType_t count = uxTaskGetSystemState(tasks, STATS_MAX_TASKS, &total);
+  if (count == 0) {
+    ESP_LOGW(TAG, "Run time stats: %u tasks, more than %d",
+             (unsigned)uxTaskGetNumberOfTasks(), STATS_MAX_TASKS);
+    return;
+  }
+  size_t n = 0;
+  for (UBaseType_t i = 0; i < count && n < sizeof(buf); ++i) {
+    const TaskStatus_t *t = &tasks[i];
+    const unsigned pct =
+        total ? (unsigned)((uint64_t)t->ulRunTimeCounter * 100 / total) : 0;
+    const int len = snprintf(buf + n, sizeof(buf) - n,
+                             "%-16s p%-2u %3u%% %10lu free %5lu\n",
+                             t->pcTaskName, (unsigned)t->uxCurrentPriority, pct,
+                             (unsigned long)t->ulRunTimeCounter,
+                             (unsigned long)t->usStackHighWaterMark);
+    if (len < 0 || (size_t)len >= sizeof(buf) - n) {
+      break;
+    }
+    n += (size_t)len;
+  }
+  buf[n] = '\0';
+  ESP_LOGI(TAG, "Run time stats (%u tasks):\n%s", (unsigned)count, buf);
+}
+
+static void stats_task(void *arg) {
+  (void)arg;
+  while (true) {
+    vTaskDelay(pdMS_TO_TICKS(ALPHALOC_TASK_STATS_S * 1000));
+    log_run_time_stats();
+    ble_focus_stats_t focus;
+    ble_client_get_focus_stats(&focus);
+    if (focus.count > 0) {
+      ESP_LOGI(TAG, "Focus->location: n=%lu avg=%lluus max=%lluus last=%lluus",
+               (unsigned long)focus.count,
+               (unsigned long long)(focus.total_us / focus.count),
+               (unsigned long long)focus.max_us,
+               (unsigned long long)focus.last_us);
+    }
+    coex_latency_t lat[2];
+    coex_policy_get_latency(&lat[0], &lat[1]);
+    for (int i = 0; i < 2; ++i) {
+      if (lat[i].count > 0) {
+        ESP_LOGI(TAG, "Location write, WiFi %s: n=%lu avg=%lluus max=%lluus",
+                 i ? "on" : "off", (unsigned long)lat[i].count,
+                 (unsigned long long)(lat[i].total_us / lat[i].count),
+                 (unsigned long long)lat[i].max_us);
+      }
+    }
+    fix_lat_summary_t fix_lat;
+    if (fix_latency_get_summary(&fix_lat)) {
+      const fix_lat_pct_t *t = &fix_lat.hop[FIX_LAT_TOTAL];
+      ESP_LOGI(TAG, "UART->location ack: n=%lu p50=%luus p99=%luus max=%luus",
+               (unsigned long)fix_lat.records, (unsigned long)t->p50_us,
+               (unsigned long)t->p99_us, (unsigned long)t->max_us);
+    }
+    flash_sched_stats_t flash;
+    flash_sched_get_stats(&flash);
+    if (flash.runs > 0) {
+      ESP_LOGI(TAG, "Flash writes: n=%lu forced=%lu max=%luus last=%luus",
+               (unsigned long)flash.runs, (unsigned long)flash.forced,
+               (unsigned long)flash.max_stall_us,
+               (unsigned long)flash.last_stall_us);
+    }
+    nmea_tcp_stats_t nmea;
+    nmea_tcp_get_stats(&nmea);
+    if (nmea.feeds > 0) {
+      ESP_LOGI(TAG,
+               "NMEA TCP: clients=%lu in=%lluB out=%lluB dropped=%lu "
+               "feed avg=%lluus max=%luus",
+               (unsigned long)nmea.clients, (unsigned long long)nmea.bytes_in,
+               (unsigned long long)nmea.bytes_out, (unsigned long)nmea.dropped,
+               (unsigned long long)(nmea.feed_total_us / nmea.feeds),
+               (unsigned long)nmea.feed_max_us);
+    }
+    track_log_stats_t track;
+    track_log_get_stats(&track);
+    if (track.points > 0) {
+      const uint32_t centi = (uint32_t)(100ULL * track.payload_bytes /
+                                        track.points);
+      ESP_LOGI(TAG,
+               "Track log: points=%lu blocks=%lu %lu.%02luB/pt dropped=%lu "
+               "encode avg=%lluus max=%luus",
+               (unsigned long)track.points, (unsigned long)track.blocks,
+               (unsigned long)(centi / 100), (unsigned long)(centi % 100),
+               (unsigned long)track.dropped_blocks,
+               (unsigned long long)(track.encode_total_us / track.points),
+               (unsigned long)track.encode_max_us);
+    }
+    time_sync_stats_t ts;
+    time_sync_get_stats(&ts);
+    if (ts.synced) {
+      ESP_LOGI(TAG,
+               "Clock: drift=%.2fppm fixes=%lu steps=%lu holdover n=%lu "
+               "last=%+ldus max=%+ldus gap %lus=%+ldus",
+               ts.drift_ppm, (unsigned long)ts.samples,
+               (unsigned long)ts.steps, (unsigned long)ts.holdover_checks,
+               (long)ts.holdover_err_us, (long)ts.holdover_max_us,
+               (unsigned long)ts.gap_s, (long)ts.gap_err_us);
+    }
+    gps_aid_stats_t aid;
+    gps_aid_get_stats(&aid);
+    if (aid.aided_n + aid.unaided_n > 0) {
+      ESP_LOGI(TAG,
+               "GPS aid: ttff=%lums aided avg=%lums n=%lu unaided avg=%lums "
+               "n=%lu epo=%luB until %lu transfers=%lu",
+               (unsigned long)aid.last_ttff_ms,
+               (unsigned long)aid.aided_avg_ms, (unsigned long)aid.aided_n,
+               (unsigned long)aid.unaided_avg_ms, (unsigned long)aid.unaided_n,
+               (unsigned long)aid.epo_bytes, (unsigned long)aid.epo_end,
+               (unsigned long)aid.epo_transfers);
+    }
+  }
+}
+
+void task_plan_start_stats(void) {
+  if (task_plan_create(TASK_ROLE_STATS, stats_task, "task_stats", 3072, NULL,
+                       NULL) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create stats task");
+  }
+}
+#else
+void task_plan_start_stats(void) {
+#if ALPHALOC_TASK_STATS_S > 0
+  ESP_LOGW(TAG, "ALPHALOC_TASK_STATS_S needs "
+                "CONFIG_FREERTOS_USE_TRACE_FACILITY and "
+                "CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS");
+#endif
+}
+#endif
@@ -0,0 +1,261 @@
+#include "time_sync.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "track_codec.h"
+
+#ifndef ALPHALOC_TIME_SYNC
+#define ALPHALOC_TIME_SYNC 1
+#endif
+
+#ifndef ALPHALOC_TIME_HOLDOVER_CHECK_S
+#define ALPHALOC_TIME_HOLDOVER_CHECK_S 300
+#endif
+
+#ifndef ALPHALOC_VERBOSE
+#define ALPHALOC_VERBOSE 0
+#endif
+
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+
+#if ALPHALOC_VERBOSE
+#define VLOGI(...) ESP_LOGI(TAG, __VA_ARGS__)
+#else
+#define VLOGI(...) ((void)0)
+#endif
+
+#if ALPHALOC_TIME_SYNC
+
+static const char *TAG = "time_sync";
+
+// A fix this far off the clock starts a new time base (first fix after a
+// restored one, leap second, receiver reset) instead of counting as drift.
+#define TIME_STEP_US 500000
+// Drift is measured against an anchor fix at least this far back, so the
+// few milliseconds of timestamp jitter stay well below 1 ppm. A first,
+// coarser estimate is used from TIME_DRIFT_MIN_SPAN_US on.
+#define TIME_DRIFT_MIN_SPAN_US (60LL * 1000000)
+#define TIME_DRIFT_SPAN_US (900LL * 1000000)
+// The system time is set again when it strays this far from the clock.
+#define TIME_SYSTEM_TOLERANCE_US 20000
+// Shorter gaps between fixes are normal epochs, not holdover.
+#define TIME_GAP_US (10LL * 1000000)
+
+typedef struct {
+  int64_t utc_us;   // UTC at mono_us
+  int64_t mono_us;  // esp_timer_get_time() of the fix
+  double drift_ppm;
+} clock_model_t;
+
+static SemaphoreHandle_t s_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_mutex_buf;
+#endif
+// All guarded by s_mutex.
+static bool s_synced;
+static bool s_seeded;  // running from time_sync_seed() until the first fix
+static clock_model_t s_model;
+static int64_t s_anchor_utc_us;
+static int64_t s_anchor_mono_us;
+static bool s_drift_valid;  // estimated over a full TIME_DRIFT_SPAN_US
+static clock_model_t s_check;
+static bool s_check_valid;
+static int64_t s_last_mono_us;
+static time_sync_stats_t s_stats;
+
+static int64_t predict(const clock_model_t *m, int64_t mono_us) {
+  const int64_t dt = mono_us - m->mono_us;
+  return m->utc_us + dt + (int64_t)((double)dt * m->drift_ppm * 1e-6);
+}
+
+static void set_system_time(int64_t utc_us) {
+  const struct timeval tv = {.tv_sec = (time_t)(utc_us / 1000000),
+                             .tv_usec = (suseconds_t)(utc_us % 1000000)};
+  settimeofday(&tv, NULL);
+}
+
+static int32_t clamp_us(int64_t us) {
+  return us > INT32_MAX ? INT32_MAX : us < INT32_MIN ? INT32_MIN : (int32_t)us;
+}
+
+void time_sync_init(void) {
+#if ALPHALOC_STATIC_ALLOC
+  s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+#else
+  s_mutex = xSemaphoreCreateMutex();
+#endif
+}
+
+void time_sync_gnss(const gps_fix_t *fix, uint16_t ms, int64_t rx_us) {
+  if (!s_mutex || !fix->time_valid || fix->year == 0 || fix->month == 0 ||
+      fix->day == 0) {
+    return;
+  }
+  const int64_t utc_us =
+      (int64_t)track_unix_time(fix->year, fix->month, fix->day, fix->hour,
+                               fix->minute, fix->second) * 1000000 +
+      (int64_t)ms * 1000;
+
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  s_stats.samples++;
+  const int64_t gap_us = rx_us - s_last_mono_us;
+  s_last_mono_us = rx_us;
+  const int64_t err_us = utc_us - predict(&s_model, rx_us);
+  if (!s_synced || llabs(err_us) > TIME_STEP_US) {
+    if (s_synced) {
+      s_stats.steps++;
+    }
+    s_synced = true;
+    s_seeded = false;
+    s_model.utc_us = utc_us;
+    s_model.mono_us = rx_us;
+    s_anchor_utc_us = utc_us;
+    s_anchor_mono_us = rx_us;
+    s_check_valid = false;
+    s_stats.synced = true;
+    xSemaphoreGive(s_mutex);
+    set_system_time(utc_us + (esp_timer_get_time() - rx_us));
+    ESP_LOGI(TAG, "Clock set from GNSS (%lld us off)", (long long)err_us);
+    return;
+  }
+
+  if (gap_us >= TIME_GAP_US) {
+    s_stats.gap_s = (uint32_t)(gap_us / 1000000);
+    s_stats.gap_err_us = clamp_us(err_us);
+    ESP_LOGI(TAG, "Holdover %lus: %+ld us", (unsigned long)s_stats.gap_s,
+             (long)s_stats.gap_err_us);
+  }
+  if (s_check_valid && rx_us - s_check.mono_us >=
+                           (int64_t)ALPHALOC_TIME_HOLDOVER_CHECK_S * 1000000) {
+    const int32_t check_us = clamp_us(utc_us - predict(&s_check, rx_us));
+    s_stats.holdover_checks++;
+    s_stats.holdover_err_us = check_us;
+    if (abs(check_us) > abs(s_stats.holdover_max_us)) {
+      s_stats.holdover_max_us = check_us;
+    }
+    s_check_valid = false;
+    VLOGI("Holdover check %ds: %+ld us", ALPHALOC_TIME_HOLDOVER_CHECK_S,
+          (long)check_us);
+  }
+
+  const int64_t span_us = rx_us - s_anchor_mono_us;
+  if (span_us >= TIME_DRIFT_MIN_SPAN_US) {
+    const double ppm =
+        (double)((utc_us - s_anchor_utc_us) - span_us) * 1e6 / (double)span_us;
+    if (span_us >= TIME_DRIFT_SPAN_US) {
+      s_model.drift_ppm =
+          s_drift_valid ? (s_model.drift_ppm + ppm) / 2.0 : ppm;
+      s_drift_valid = true;
+      s_anchor_utc_us = utc_us;
+      s_anchor_mono_us = rx_us;
+    } else if (!s_drift_valid) {
+      s_model.drift_ppm = ppm;
+    }
+  }
+  // Take a quarter of the error per fix: single timestamps jitter by a
+  // few milliseconds, the clock itself does not.
+  s_model.utc_us = predict(&s_model, rx_us) + err_us / 4;
+  s_model.mono_us = rx_us;
+  s_stats.drift_ppm = (float)s_model.drift_ppm;
+  if (!s_check_valid && ALPHALOC_TIME_HOLDOVER_CHECK_S > 0) {
+    s_check = s_model;
+    s_check_valid = true;
+  }
+  const int64_t now_us = esp_timer_get_time();
+  const int64_t model_now_us = predict(&s_model, now_us);
+  xSemaphoreGive(s_mutex);
+
+  // Keep gettimeofday (logs, file times) on the disciplined clock.
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  const int64_t sys_us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+  if (llabs(sys_us - model_now_us) > TIME_SYSTEM_TOLERANCE_US) {
+    set_system_time(model_now_us);
+  }
+}
+
+void time_sync_seed(int64_t utc_us) {
+  if (!s_mutex) {
+    return;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  if (!s_synced) {
+    s_seeded = true;
+    s_model.utc_us = utc_us;
+    s_model.mono_us = esp_timer_get_time();
+    s_model.drift_ppm = 0;
+  }
+  xSemaphoreGive(s_mutex);
+}
+
+bool time_sync_now_us(int64_t *utc_us) {
+  if (!s_mutex) {
+    return false;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  const bool ok = s_synced || s_seeded;
+  if (ok) {
+    *utc_us = predict(&s_model, esp_timer_get_time());
+  }
+  xSemaphoreGive(s_mutex);
+  return ok;
+}
+
+void time_sync_get_stats(time_sync_stats_t *out) {
+  if (!s_mutex) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  *out = s_stats;
+  xSemaphoreGive(s_mutex);
+}
+
+#else
+
+void time_sync_init(void) {}
+
+void time_sync_gnss(const gps_fix_t *fix, uint16_t ms, int64_t rx_us) {
+  (void)fix;
+  (void)ms;
+  (void)rx_us;
+}
+
+void time_sync_seed(int64_t utc_us) { (void)utc_us; }
+
+bool time_sync_now_us(int64_t *utc_us) {
+  (void)utc_us;
+  return false;
+}
+
+void time_sync_get_stats(time_sync_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+}
+
+#endif
+
+bool time_sync_stamp(gps_fix_t *fix) {
+  int64_t utc_us;
+  if (!time_sync_now_us(&utc_us)) {
+    return false;
+  }
+  int year, month, day, hour, minute, second;
+  track_unix_to_civil((uint32_t)(utc_us / 1000000), &year, &month, &day, &hour,
+                      &minute, &second);
+  fix->year = (uint16_t)year;
+  fix->month = (uint8_t)month;
+  fix->day = (uint8_t)day;
+  fix->hour = (uint8_t)hour;
+  fix->minute = (uint8_t)minute;
+  fix->second = (uint8_t)second;
+  fix->time_valid = true;
+  return true;
+}
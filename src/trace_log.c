@@ -0,0 +1,309 @@
+#include "trace_log.h"
+
+#include <string.h>
+
+#include "esp_app_desc.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "flash_sched.h"
+
+// Ring size in bytes (power of two). It lives in .noinit RAM, so a panic or
+// watchdog reset keeps the records that led up to it.
+#ifndef ALPHALOC_TRACE_BYTES
+#define ALPHALOC_TRACE_BYTES 8192
+#endif
+// Copy the ring to the "trace" partition this often (and before deep
+// sleep); 0 = RAM only.
+#ifndef ALPHALOC_TRACE_FLASH_S
+#define ALPHALOC_TRACE_FLASH_S 0
+#endif
+_Static_assert((ALPHALOC_TRACE_BYTES & (ALPHALOC_TRACE_BYTES - 1)) == 0 &&
+                   ALPHALOC_TRACE_BYTES >= 1024,
+               "ALPHALOC_TRACE_BYTES must be a power of two, at least 1024");
+
+#if ALPHALOC_TRACE
+
+static const char *TAG = "trace";
+
+#define RING_WORDS (ALPHALOC_TRACE_BYTES / 4)
+#define RING_MASK (RING_WORDS - 1)
+#define TRACE_RAM_MAGIC 0x31435254u  // "TRC1"
+// Hex prefix of the ELF hash: records from another build decode to the
+// wrong strings, so an update clears the ring.
+#define BUILD_ID_LEN 17
+
+typedef struct {
+  uint32_t magic;
+  uint32_t ring_words;
+  char build[BUILD_ID_LEN];
+  uint32_t head;  // words ever reserved since the ring was cleared
+  uint32_t ring[RING_WORDS];
+} trace_ram_t;
+
+static __NOINIT_ATTR trace_ram_t s_ram;
+static bool s_ready;
+static bool s_kept;
+
+#if ALPHALOC_TRACE_FLASH_S > 0
+// Data subtype of the optional "trace" entry in the partition table.
+#define TRACE_PARTITION_SUBTYPE 0x42
+#define TRACE_SECTOR_SIZE 4096
+#define COPY_WORDS 256
+
+static const esp_partition_t *s_part;
+static esp_timer_handle_t s_mirror_timer;
+static uint32_t s_copy_buf[COPY_WORDS];  // flash job only
+static uint32_t s_mirrored_end;
+static uint32_t s_flash_copies;
+#endif
+
+void trace_log_write(uint8_t level, const char *tag, const char *fmt,
+                     const uint32_t *args, size_t n) {
+  if (!s_ready) {
+    return;
+  }
+  const uint32_t words = TRACE_REC_HDR_WORDS + (uint32_t)n;
+  const uint64_t t = (uint64_t)esp_timer_get_time();
+  const uint32_t pos =
+      __atomic_fetch_add(&s_ram.head, words, __ATOMIC_RELAXED);
+  uint32_t *const ring = s_ram.ring;
+  ring[(pos + 1) & RING_MASK] = (uint32_t)t;
+  ring[(pos + 2) & RING_MASK] = (uint32_t)(t >> 32);
+  ring[(pos + 3) & RING_MASK] = (uint32_t)(uintptr_t)fmt;
+  ring[(pos + 4) & RING_MASK] = (uint32_t)(uintptr_t)tag;
+  for (size_t i = 0; i < n; ++i) {
+    ring[(pos + TRACE_REC_HDR_WORDS + i) & RING_MASK] = args[i];
+  }
+  // The header goes last: a reader that sees it also sees the rest.
+  const uint32_t hdr = TRACE_REC_MAGIC << 24 |
+                       ((pos / RING_WORDS) & 0xFF) << 16 |
+                       (uint32_t)(esp_cpu_get_core_id() & 1) << 11 |
+                       (uint32_t)(level & 7) << 8 | words;
+  __atomic_store_n(&ring[pos & RING_MASK], hdr, __ATOMIC_RELEASE);
+}
+
+bool trace_log_enabled(void) { return true; }
+
+void trace_log_span(uint32_t *begin, uint32_t *end) {
+  // Always the whole ring; never-written words are zero and skipped by the
+  // decoder.
+  *end = __atomic_load_n(&s_ram.head, __ATOMIC_ACQUIRE);
+  *begin = *end - RING_WORDS;
+}
+
+size_t trace_log_read(uint32_t *cursor, uint32_t end, uint32_t *buf,
+                      size_t cap) {
+  size_t n = end - *cursor;
+  if (n > cap) {
+    n = cap;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    buf[i] = s_ram.ring[(*cursor + i) & RING_MASK];
+  }
+  // Writers that lapped these words during the copy replaced them.
+  const uint32_t head = __atomic_load_n(&s_ram.head, __ATOMIC_ACQUIRE);
+  for (size_t i = 0; i < n && head - (*cursor + (uint32_t)i) > RING_WORDS;
+       ++i) {
+    buf[i] = 0;
+  }
+  *cursor += (uint32_t)n;
+  return n;
+}
+
+void trace_log_dump_header(trace_dump_hdr_t *out, uint32_t begin,
+                           uint32_t end) {
+  memset(out, 0, sizeof(*out));
+  memcpy(out->magic, TRACE_DUMP_MAGIC, sizeof(out->magic));
+  out->ring_words = RING_WORDS;
+  out->begin = begin;
+  out->end = end;
+  out->uptime_s = (uint32_t)(esp_timer_get_time() / 1000000);
+  strncpy(out->version, esp_app_get_description()->version,
+          sizeof(out->version) - 1);
+  memcpy(out->build, s_ram.build, sizeof(s_ram.build));
+}
+
+#if ALPHALOC_TRACE_FLASH_S > 0
+// Words first, header last: a copy cut short by a reset has no header.
+static uint32_t mirror_job(void *ctx) {
+  (void)ctx;
+  uint32_t begin, end;
+  trace_log_span(&begin, &end);
+  trace_dump_hdr_t hdr;
+  trace_log_dump_header(&hdr, begin, end);
+  const size_t bytes = sizeof(hdr) + (size_t)RING_WORDS * 4;
+  const int64_t start_us = esp_timer_get_time();
+  esp_err_t err = esp_partition_erase_range(
+      s_part, 0,
+      (bytes + TRACE_SECTOR_SIZE - 1) / TRACE_SECTOR_SIZE * TRACE_SECTOR_SIZE);
+  size_t off = sizeof(hdr);
+  size_t n;
+  while (err == ESP_OK &&
+         (n = trace_log_read(&begin, end, s_copy_buf, COPY_WORDS)) > 0) {
+    err = esp_partition_write(s_part, off, s_copy_buf, n * 4);
+    off += n * 4;
+  }
+  if (err == ESP_OK) {
+    err = esp_partition_write(s_part, 0, &hdr, sizeof(hdr));
+  }
+  if (err == ESP_OK) {
+    __atomic_store_n(&s_mirrored_end, end, __ATOMIC_RELAXED);
+    s_flash_copies++;
+  } else {
+    ESP_LOGW(TAG, "Flash copy failed: %s", esp_err_to_name(err));
+  }
+  return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void mirror_timer_cb(void *arg) {
+  (void)arg;
+  trace_log_mirror();
+}
+
+static void mirror_init(void) {
+  s_part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA,
+      (esp_partition_subtype_t)TRACE_PARTITION_SUBTYPE, "trace");
+  if (!s_part || s_part->size < sizeof(trace_dump_hdr_t) + RING_WORDS * 4) {
+    ESP_LOGW(TAG, "No trace partition for %u bytes, flash copy off",
+             (unsigned)(sizeof(trace_dump_hdr_t) + RING_WORDS * 4));
+    s_part = NULL;
+    return;
+  }
+  const esp_timer_create_args_t args = {.callback = mirror_timer_cb,
+                                        .name = "trace_mirror"};
+  if (esp_timer_create(&args, &s_mirror_timer) == ESP_OK) {
+    esp_timer_start_periodic(s_mirror_timer,
+                             (uint64_t)ALPHALOC_TRACE_FLASH_S * 1000000ULL);
+  }
+}
+
+void trace_log_mirror(void) {
+  if (s_part && __atomic_load_n(&s_ram.head, __ATOMIC_RELAXED) !=
+                    __atomic_load_n(&s_mirrored_end, __ATOMIC_RELAXED)) {
+    flash_sched_submit(FLASH_JOB_TRACE, mirror_job, NULL, 0);
+  }
+}
+
+bool trace_log_flash_read(size_t off, void *buf, size_t len, size_t *total) {
+  trace_dump_hdr_t hdr;
+  *total = 0;
+  if (!s_part || esp_partition_read(s_part, 0, &hdr, sizeof(hdr)) != ESP_OK ||
+      memcmp(hdr.magic, TRACE_DUMP_MAGIC, sizeof(hdr.magic)) != 0 ||
+      hdr.end - hdr.begin != hdr.ring_words ||
+      sizeof(hdr) + (size_t)hdr.ring_words * 4 > s_part->size) {
+    return false;
+  }
+  *total = sizeof(hdr) + (size_t)hdr.ring_words * 4;
+  if (len == 0 || off >= *total) {
+    return true;
+  }
+  if (len > *total - off) {
+    len = *total - off;
+  }
+  return esp_partition_read(s_part, off, buf, len) == ESP_OK;
+}
+#else
+void trace_log_mirror(void) {}
+
+bool trace_log_flash_read(size_t off, void *buf, size_t len, size_t *total) {
+  (void)off;
+  (void)buf;
+  (void)len;
+  *total = 0;
+  return false;
+}
+#endif
+
+void trace_log_init(void) {
+  const esp_reset_reason_t reason = esp_reset_reason();
+  char build[BUILD_ID_LEN];
+  esp_app_get_elf_sha256(build, sizeof(build));
+  const bool crash = reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+                     reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT ||
+                     reason == ESP_RST_SW;
+  s_kept = crash && s_ram.magic == TRACE_RAM_MAGIC &&
+           s_ram.ring_words == RING_WORDS &&
+           memcmp(s_ram.build, build, sizeof(build)) == 0;
+  if (!s_kept) {
+    memset(&s_ram, 0, sizeof(s_ram));
+    s_ram.magic = TRACE_RAM_MAGIC;
+    s_ram.ring_words = RING_WORDS;
+    memcpy(s_ram.build, build, sizeof(build));
+  }
+  s_ready = true;
+#if ALPHALOC_TRACE_FLASH_S > 0
+  mirror_init();
+#endif
+  TRACE_I("Boot, reset reason %d", (int)reason);
+  if (s_kept) {
+    ESP_LOGI(TAG, "Kept %u bytes of trace from before the reset",
+             (unsigned)ALPHALOC_TRACE_BYTES);
+  }
+}
+
+void trace_log_get_stats(trace_log_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+  out->ring_words = RING_WORDS;
+  out->written_words = __atomic_load_n(&s_ram.head, __ATOMIC_RELAXED);
+  out->kept = s_kept;
+#if ALPHALOC_TRACE_FLASH_S > 0
+  out->flash_copies = s_flash_copies;
+#endif
+}
+
+#else
+
+void trace_log_init(void) {}
+
+bool trace_log_enabled(void) { return false; }
+
+void trace_log_write(uint8_t level, const char *tag, const char *fmt,
+                     const uint32_t *args, size_t n) {
+  (void)level;
+  (void)tag;
+  (void)fmt;
+  (void)args;
+  (void)n;
+}
+
+void trace_log_span(uint32_t *begin, uint32_t *end) {
+  *begin = 0;
+  *end = 0;
+}
+
+size_t trace_log_read(uint32_t *cursor, uint32_t end, uint32_t *buf,
+                      size_t cap) {
+  (void)cursor;
+  (void)end;
+  (void)buf;
+  (void)cap;
+  return 0;
+}
+
+void trace_log_dump_header(trace_dump_hdr_t *out, uint32_t begin,
+                           uint32_t end) {
+  (void)begin;
+  (void)end;
+  memset(out, 0, sizeof(*out));
+}
+
+void trace_log_mirror(void) {}
+
+bool trace_log_flash_read(size_t off, void *buf, size_t len, size_t *total) {
+  (void)off;
+  (void)buf;
+  (void)len;
+  *total = 0;
+  return false;
+}
+
+void trace_log_get_stats(trace_log_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+}
+
+#endif
@@ -0,0 +1,330 @@
+#include "track_codec.h"
+
+#include <string.h>
+
+// Worst case for one varint of a 64-bit value.
+#define VARINT_MAX 10
+
+uint32_t track_crc32(uint32_t crc, const void *data, size_t len) {
+  // Reflected CRC-32 (IEEE), nibble table; same result as zlib's crc32().
+  static const uint32_t k_table[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+      0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+      0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= p[i];
+    crc = (crc >> 4) ^ k_table[crc & 0x0F];
+    crc = (crc >> 4) ^ k_table[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+bool track_sector_hdr_valid(const track_sector_hdr_t *hdr) {
+  return hdr->magic == TRACK_SECTOR_MAGIC &&
+         hdr->crc == track_crc32(0, hdr, offsetof(track_sector_hdr_t, crc));
+}
+
+void track_sector_hdr_seal(track_sector_hdr_t *hdr) {
+  hdr->magic = TRACK_SECTOR_MAGIC;
+  hdr->crc = track_crc32(0, hdr, offsetof(track_sector_hdr_t, crc));
+}
+
+size_t track_first_block_offset(void) { return sizeof(track_sector_hdr_t); }
+
+static uint32_t block_crc(const track_block_hdr_t *hdr,
+                          const uint8_t *payload) {
+  uint32_t crc = track_crc32(0, hdr, offsetof(track_block_hdr_t, crc));
+  return track_crc32(crc, payload, hdr->len);
+}
+
+void track_block_hdr_seal(track_block_hdr_t *hdr, const uint8_t *payload,
+                          uint16_t len, uint16_t count) {
+  hdr->len = len;
+  hdr->count = count;
+  hdr->crc = block_crc(hdr, payload);
+}
+
+bool track_block_valid(const track_block_hdr_t *hdr, const uint8_t *payload) {
+  return hdr->len != TRACK_BLOCK_ERASED &&
+         hdr->len <= TRACK_BLOCK_PAYLOAD_MAX && hdr->count > 0 &&
+         hdr->crc == block_crc(hdr, payload);
+}
+
+bool track_sector_has_data(const uint8_t *sector, track_sector_hdr_t *hdr) {
+  memcpy(hdr, sector, sizeof(*hdr));
+  if (!track_sector_hdr_valid(hdr)) {
+    return false;
+  }
+  const uint8_t *first = sector + track_first_block_offset();
+  track_block_hdr_t bh;
+  memcpy(&bh, first, sizeof(bh));
+  return bh.len <= TRACK_BLOCK_PAYLOAD_MAX - sizeof(track_sector_hdr_t) &&
+         track_block_valid(&bh, first + sizeof(bh));
+}
+
+// Days since 1970-01-01 (proleptic Gregorian).
+static int64_t days_from_civil(int y, int m, int d) {
+  y -= m <= 2;
+  const int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const int64_t yoe = y - era * 400;
+  const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+uint32_t track_unix_time(int year, int month, int day, int hour, int minute,
+                         int second) {
+  return (uint32_t)(days_from_civil(year, month, day) * 86400 + hour * 3600 +
+                    minute * 60 + second);
+}
+
+void track_unix_to_civil(uint32_t t, int *year, int *month, int *day,
+                         int *hour, int *minute, int *second) {
+  int64_t z = t / 86400 + 719468;
+  const uint32_t secs = t % 86400;
+  const int64_t era = z / 146097;
+  const int64_t doe = z - era * 146097;
+  const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const int64_t mp = (5 * doy + 2) / 153;
+  const int d = (int)(doy - (153 * mp + 2) / 5 + 1);
+  const int m = (int)(mp < 10 ? mp + 3 : mp - 9);
+  *year = (int)(yoe + era * 400 + (m <= 2));
+  *month = m;
+  *day = d;
+  *hour = (int)(secs / 3600);
+  *minute = (int)(secs / 60 % 60);
+  *second = (int)(secs % 60);
+}
+
+static uint64_t zigzag(int64_t v) {
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static int64_t unzigzag(uint64_t v) {
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+static size_t varint_len(uint64_t v) {
+  size_t n = 1;
+  while (v >= 0x80) {
+    v >>= 7;
+    ++n;
+  }
+  return n;
+}
+
+static void put_varint(track_encoder_t *enc, uint64_t v) {
+  while (v >= 0x80) {
+    enc->buf[enc->len++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  enc->buf[enc->len++] = (uint8_t)v;
+}
+
+static bool get_varint(track_decoder_t *dec, uint64_t *out) {
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (dec->pos >= dec->len) {
+      return false;
+    }
+    uint8_t b = dec->buf[dec->pos++];
+    v |= (uint64_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      *out = v;
+      return true;
+    }
+  }
+  return false;
+}
+
+static int64_t abs64(int64_t v) { return v < 0 ? -v : v; }
+
+// Micro-degrees to TRACK_QUANT_UDEG steps, rounding half away from zero.
+static int32_t quantize(int32_t udeg) {
+  const int32_t half = TRACK_QUANT_UDEG / 2;
+  return (udeg >= 0 ? udeg + half : udeg - half) / TRACK_QUANT_UDEG;
+}
+
+void track_enc_begin(track_encoder_t *enc, size_t cap, int32_t tol_udeg,
+                     int32_t tol_alt_m) {
+  memset(enc, 0, sizeof(*enc));
+  enc->cap = cap < sizeof(enc->buf) ? cap : sizeof(enc->buf);
+  enc->tol_udeg = tol_udeg;
+  enc->tol_alt_m = tol_alt_m;
+}
+
+static size_t run_len(const track_encoder_t *enc) {
+  return enc->run ? varint_len((uint64_t)enc->run << 1) : 0;
+}
+
+static void flush_run(track_encoder_t *enc) {
+  if (enc->run) {
+    put_varint(enc, (uint64_t)enc->run << 1);
+    enc->run = 0;
+  }
+}
+
+bool track_enc_add(track_encoder_t *enc, const track_point_t *in) {
+  const track_point_t q = {
+      .t = in->t,
+      .lat_udeg = quantize(in->lat_udeg),
+      .lon_udeg = quantize(in->lon_udeg),
+      .alt_m = in->alt_m,
+  };
+  const track_point_t *p = &q;
+  if (enc->count == 0) {
+    const size_t need = varint_len(p->t) + varint_len(zigzag(p->lat_udeg)) +
+                        varint_len(zigzag(p->lon_udeg)) +
+                        varint_len(zigzag(p->alt_m));
+    if (enc->cap - enc->len < need) {
+      return false;
+    }
+    put_varint(enc, p->t);
+    put_varint(enc, zigzag(p->lat_udeg));
+    put_varint(enc, zigzag(p->lon_udeg));
+    put_varint(enc, zigzag(p->alt_m));
+    enc->last = *p;
+    enc->t_first = p->t;
+    enc->t_last = p->t;
+    enc->count = 1;
+    return true;
+  }
+  if (p->t <= enc->last.t || enc->count == UINT16_MAX) {
+    // Out of order or duplicate epochs are dropped; a full count ends the
+    // block like a full buffer.
+    return enc->count != UINT16_MAX;
+  }
+
+  const uint32_t dt = p->t - enc->last.t;
+  const int64_t pred_lat = (int64_t)enc->last.lat_udeg + enc->v_lat;
+  const int64_t pred_lon = (int64_t)enc->last.lon_udeg + enc->v_lon;
+  const int64_t pred_alt = (int64_t)enc->last.alt_m + enc->v_alt;
+  const int64_t dd_lat = p->lat_udeg - pred_lat;
+  const int64_t dd_lon = p->lon_udeg - pred_lon;
+  const int64_t dd_alt = p->alt_m - pred_alt;
+
+  // The run tolerance is held against the unquantized input, so a run never
+  // drifts further from the receiver's fix than tol_udeg.
+  if (enc->dt != 0 && dt == enc->dt &&
+      abs64(pred_lat * TRACK_QUANT_UDEG - in->lat_udeg) <= enc->tol_udeg &&
+      abs64(pred_lon * TRACK_QUANT_UDEG - in->lon_udeg) <= enc->tol_udeg &&
+      abs64(dd_alt) <= enc->tol_alt_m) {
+    // Covered by the prediction: the decoder reproduces the predicted point,
+    // so the encoder continues from it as well.
+    const size_t need = varint_len((uint64_t)(enc->run + 1) << 1);
+    if (enc->cap - enc->len < need) {
+      return false;
+    }
+    enc->run++;
+    enc->last.t += dt;
+    enc->last.lat_udeg = (int32_t)pred_lat;
+    enc->last.lon_udeg = (int32_t)pred_lon;
+    enc->last.alt_m = (int32_t)pred_alt;
+    enc->t_last = enc->last.t;
+    enc->count++;
+    return true;
+  }
+
+  const uint64_t head = (zigzag((int64_t)dt - (int64_t)enc->dt) << 1) | 1;
+  const size_t need = run_len(enc) + varint_len(head) +
+                      varint_len(zigzag(dd_lat)) + varint_len(zigzag(dd_lon)) +
+                      varint_len(zigzag(dd_alt));
+  if (enc->cap - enc->len < need) {
+    return false;
+  }
+  flush_run(enc);
+  put_varint(enc, head);
+  put_varint(enc, zigzag(dd_lat));
+  put_varint(enc, zigzag(dd_lon));
+  put_varint(enc, zigzag(dd_alt));
+  enc->v_lat = (int32_t)(p->lat_udeg - (int64_t)enc->last.lat_udeg);
+  enc->v_lon = (int32_t)(p->lon_udeg - (int64_t)enc->last.lon_udeg);
+  enc->v_alt = (int32_t)(p->alt_m - (int64_t)enc->last.alt_m);
+  enc->dt = dt;
+  enc->last = *p;
+  enc->t_last = p->t;
+  enc->count++;
+  return true;
+}
+
+size_t track_enc_finish(track_encoder_t *enc) {
+  // A run's varint was already accounted for when it grew.
+  flush_run(enc);
+  return enc->len;
+}
+
+void track_dec_begin(track_decoder_t *dec, const uint8_t *payload, size_t len,
+                     uint16_t count) {
+  memset(dec, 0, sizeof(*dec));
+  dec->buf = payload;
+  dec->len = len;
+  dec->count = count;
+}
+
+static void dec_predict(track_decoder_t *dec) {
+  dec->last.t += dec->dt;
+  dec->last.lat_udeg += dec->v_lat;
+  dec->last.lon_udeg += dec->v_lon;
+  dec->last.alt_m += dec->v_alt;
+}
+
+bool track_dec_next(track_decoder_t *dec, track_point_t *out) {
+  if (dec->emitted >= dec->count) {
+    return false;
+  }
+  uint64_t a, b, c, d;
+  if (dec->emitted == 0) {
+    if (!get_varint(dec, &a) || !get_varint(dec, &b) || !get_varint(dec, &c) ||
+        !get_varint(dec, &d)) {
+      return false;
+    }
+    dec->last.t = (uint32_t)a;
+    dec->last.lat_udeg = (int32_t)unzigzag(b);
+    dec->last.lon_udeg = (int32_t)unzigzag(c);
+    dec->last.alt_m = (int32_t)unzigzag(d);
+  } else if (dec->run > 0) {
+    dec->run--;
+    dec_predict(dec);
+  } else {
+    uint64_t head;
+    if (!get_varint(dec, &head)) {
+      return false;
+    }
+    if (!(head & 1)) {
+      dec->run = (uint32_t)(head >> 1);
+      if (dec->run == 0) {
+        return false;
+      }
+      dec->run--;
+      dec_predict(dec);
+    } else {
+      if (!get_varint(dec, &b) || !get_varint(dec, &c) ||
+          !get_varint(dec, &d)) {
+        return false;
+      }
+      const uint32_t dt = (uint32_t)((int64_t)dec->dt + unzigzag(head >> 1));
+      const int32_t lat = (int32_t)(dec->last.lat_udeg + dec->v_lat +
+                                    unzigzag(b));
+      const int32_t lon = (int32_t)(dec->last.lon_udeg + dec->v_lon +
+                                    unzigzag(c));
+      const int32_t alt = (int32_t)(dec->last.alt_m + dec->v_alt + unzigzag(d));
+      dec->v_lat = lat - dec->last.lat_udeg;
+      dec->v_lon = lon - dec->last.lon_udeg;
+      dec->v_alt = alt - dec->last.alt_m;
+      dec->dt = dt;
+      dec->last.t += dt;
+      dec->last.lat_udeg = lat;
+      dec->last.lon_udeg = lon;
+      dec->last.alt_m = alt;
+    }
+  }
+  dec->emitted++;
+  *out = dec->last;
+  out->lat_udeg *= TRACK_QUANT_UDEG;
+  out->lon_udeg *= TRACK_QUANT_UDEG;
+  return true;
+}
@@ -0,0 +1,417 @@
+#include "track_log.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "flash_sched.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "track_codec.h"
+
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+// Longest a partly filled block waits in RAM; bounds what a power loss can
+// take. A stationary device writes one small block per period.
+#ifndef ALPHALOC_TRACK_FLUSH_S
+#define ALPHALOC_TRACK_FLUSH_S 300
+#endif
+// Position error (micro-degrees, ~0.1 m per unit) a run of predicted epochs
+// may hide; well below GNSS noise.
+#ifndef ALPHALOC_TRACK_TOLERANCE_UDEG
+#define ALPHALOC_TRACK_TOLERANCE_UDEG 10
+#endif
+#define TRACK_ALT_TOLERANCE_M 2
+// Data subtype of the "track" entry in the partition table.
+#define TRACK_PARTITION_SUBTYPE 0x40
+// Finished blocks waiting for flash_sched.
+#define TRACK_PENDING_MAX 4
+#define PAGES_PER_SECTOR (TRACK_SECTOR_SIZE / TRACK_PAGE_SIZE)
+// Epochs with an older fix than this are not logged again.
+#define TRACK_FIX_MAX_AGE_US 2000000
+
+static const char *TAG = "track_log";
+
+typedef struct {
+  uint32_t page;  // absolute page index in the partition
+  uint32_t t_first;
+  track_block_hdr_t hdr;
+  uint8_t payload[TRACK_BLOCK_PAYLOAD_MAX];
+} track_pending_t;
+
+static const esp_partition_t *s_part;
+static uint32_t s_pages;
+// Page the block being encoded will occupy; pages are claimed in order, a
+// new sector is opened (erased) when a block lands on its first page.
+static uint32_t s_plan_page;
+static uint32_t s_seq;  // written by the flash job only
+// Page after the last one the flash job wrote; readers stop there.
+static uint32_t s_written_page;
+static track_encoder_t s_enc;
+static int64_t s_block_start_us;
+static track_pending_t s_pending[TRACK_PENDING_MAX];
+static int s_pending_count;
+static track_log_stats_t s_stats;
+static SemaphoreHandle_t s_mutex;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_mutex_buf;
+#endif
+
+static size_t page_payload_cap(uint32_t page) {
+  return page % PAGES_PER_SECTOR == 0
+             ? TRACK_BLOCK_PAYLOAD_MAX - sizeof(track_sector_hdr_t)
+             : TRACK_BLOCK_PAYLOAD_MAX;
+}
+
+static size_t page_offset(uint32_t page) {
+  return (size_t)page * TRACK_PAGE_SIZE +
+         (page % PAGES_PER_SECTOR == 0 ? sizeof(track_sector_hdr_t) : 0);
+}
+
+static void begin_block(void) {
+  track_enc_begin(&s_enc, page_payload_cap(s_plan_page),
+                  ALPHALOC_TRACK_TOLERANCE_UDEG, TRACK_ALT_TOLERANCE_M);
+}
+
+static uint32_t write_job(void *ctx) {
+  (void)ctx;
+  static track_pending_t batch[TRACK_PENDING_MAX];
+  static uint8_t page_buf[TRACK_PAGE_SIZE];
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  const int n = s_pending_count;
+  memcpy(batch, s_pending, sizeof(batch[0]) * n);
+  s_pending_count = 0;
+  xSemaphoreGive(s_mutex);
+
+  const int64_t start_us = esp_timer_get_time();
+  for (int i = 0; i < n; ++i) {
+    const track_pending_t *b = &batch[i];
+    esp_err_t err = ESP_OK;
+    if (b->page % PAGES_PER_SECTOR == 0) {
+      // Opening a sector overwrites the oldest one: the ring wraps and every
+      // sector is erased once per lap.
+      const size_t sector_off = (size_t)b->page * TRACK_PAGE_SIZE;
+      track_sector_hdr_t sh = {.seq = ++s_seq, .t_first = b->t_first};
+      track_sector_hdr_seal(&sh);
+      err = esp_partition_erase_range(s_part, sector_off, TRACK_SECTOR_SIZE);
+      if (err == ESP_OK) {
+        err = esp_partition_write(s_part, sector_off, &sh, sizeof(sh));
+      }
+    }
+    if (err == ESP_OK) {
+      // Header and payload go out in one program operation.
+      memcpy(page_buf, &b->hdr, sizeof(b->hdr));
+      memcpy(page_buf + sizeof(b->hdr), b->payload, b->hdr.len);
+      err = esp_partition_write(s_part, page_offset(b->page), page_buf,
+                                sizeof(b->hdr) + b->hdr.len);
+    }
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Write of page %lu failed: %s", (unsigned long)b->page,
+               esp_err_to_name(err));
+    }
+    __atomic_store_n(&s_written_page, (b->page + 1) % s_pages,
+                     __ATOMIC_RELEASE);
+  }
+  return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+// Seals the current block into the pending queue. Caller holds s_mutex, and
+// on true submits write_job after releasing it: without the flash_sched task
+// the job runs inline and takes s_mutex itself.
+static bool finish_block_locked(void) {
+  if (s_enc.count == 0) {
+    return false;
+  }
+  bool queued = false;
+  const size_t len = track_enc_finish(&s_enc);
+  if (s_pending_count == TRACK_PENDING_MAX) {
+    // The page stays unclaimed, so the log has no hole.
+    s_stats.dropped_blocks++;
+    ESP_LOGW(TAG, "Write queue full, dropping %u points",
+             (unsigned)s_enc.count);
+  } else {
+    track_pending_t *b = &s_pending[s_pending_count++];
+    b->page = s_plan_page;
+    b->t_first = s_enc.t_first;
+    memcpy(b->payload, s_enc.buf, len);
+    track_block_hdr_seal(&b->hdr, b->payload, (uint16_t)len, s_enc.count);
+    s_plan_page = (s_plan_page + 1) % s_pages;
+    s_stats.blocks++;
+    s_stats.payload_bytes += (uint32_t)len;
+    queued = true;
+  }
+  begin_block();
+  return queued;
+}
+
+void track_log_epoch(const gps_fix_t *fix) {
+  if (!s_part || !fix->valid || !fix->time_valid || fix->year == 0 ||
+      esp_timer_get_time() - fix->last_fix_time_us > TRACK_FIX_MAX_AGE_US) {
+    return;
+  }
+  const int64_t start_us = esp_timer_get_time();
+  const track_point_t p = {
+      .t = track_unix_time(fix->year, fix->month, fix->day, fix->hour,
+                           fix->minute, fix->second),
+      .lat_udeg = (int32_t)lround(fix->lat_deg * 1e6),
+      .lon_udeg = (int32_t)lround(fix->lon_deg * 1e6),
+      .alt_m = (int32_t)lround(fix->altitude_m),
+  };
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  if (s_enc.count > 0 && p.t <= s_enc.t_last) {
+    // Same epoch seen again (GGA and RMC arrive separately).
+    xSemaphoreGive(s_mutex);
+    return;
+  }
+  if (s_enc.count == 0) {
+    s_block_start_us = start_us;
+  }
+  bool queued = false;
+  if (!track_enc_add(&s_enc, &p)) {
+    queued = finish_block_locked();
+    s_block_start_us = start_us;
+    track_enc_add(&s_enc, &p);
+  }
+  s_stats.points++;
+  if (start_us - s_block_start_us >= (int64_t)ALPHALOC_TRACK_FLUSH_S * 1000000) {
+    queued |= finish_block_locked();
+  }
+  const uint32_t spent_us = (uint32_t)(esp_timer_get_time() - start_us);
+  s_stats.encode_total_us += spent_us;
+  if (spent_us > s_stats.encode_max_us) {
+    s_stats.encode_max_us = spent_us;
+  }
+  xSemaphoreGive(s_mutex);
+  if (queued) {
+    flash_sched_submit(FLASH_JOB_TRACK, write_job, NULL, 0);
+  }
+}
+
+void track_log_flush(void) {
+  if (!s_part) {
+    return;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  const bool queued = finish_block_locked();
+  xSemaphoreGive(s_mutex);
+  if (queued) {
+    flash_sched_submit(FLASH_JOB_TRACK, write_job, NULL, 0);
+  }
+}
+
+void track_log_get_stats(track_log_stats_t *out) {
+  if (!out) {
+    return;
+  }
+  if (!s_mutex) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  xSemaphoreTake(s_mutex, portMAX_DELAY);
+  *out = s_stats;
+  xSemaphoreGive(s_mutex);
+}
+
+// Finds the newest sector and the first free page after its last intact
+// block. A torn block ends its sector; logging continues in the next one.
+static void recover(void) {
+  const uint32_t sectors = s_pages / PAGES_PER_SECTOR;
+  uint32_t newest = 0;
+  bool found = false;
+  for (uint32_t i = 0; i < sectors; ++i) {
+    track_sector_hdr_t sh;
+    if (esp_partition_read(s_part, (size_t)i * TRACK_SECTOR_SIZE, &sh,
+                           sizeof(sh)) == ESP_OK &&
+        track_sector_hdr_valid(&sh) && (!found || sh.seq > s_seq)) {
+      s_seq = sh.seq;
+      newest = i;
+      found = true;
+    }
+  }
+  if (!found) {
+    s_seq = 0;
+    s_plan_page = 0;
+    return;
+  }
+  static uint8_t payload[TRACK_BLOCK_PAYLOAD_MAX];
+  uint32_t page = newest * PAGES_PER_SECTOR;
+  for (int i = 0; i < PAGES_PER_SECTOR; ++i, ++page) {
+    track_block_hdr_t bh;
+    if (esp_partition_read(s_part, page_offset(page), &bh, sizeof(bh)) !=
+        ESP_OK) {
+      break;
+    }
+    if (bh.len == TRACK_BLOCK_ERASED) {
+      s_plan_page = page;
+      return;
+    }
+    if (bh.len > page_payload_cap(page) ||
+        esp_partition_read(s_part, page_offset(page) + sizeof(bh), payload,
+                           bh.len) != ESP_OK ||
+        !track_block_valid(&bh, payload)) {
+      ESP_LOGW(TAG, "Torn block at page %lu, continuing in next sector",
+               (unsigned long)page);
+      break;
+    }
+  }
+  s_plan_page = ((newest + 1) % sectors) * PAGES_PER_SECTOR;
+}
+
+bool track_log_init(void) {
+  s_part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)TRACK_PARTITION_SUBTYPE,
+      "track");
+  if (!s_part) {
+    ESP_LOGW(TAG, "No track partition, logging off");
+    return false;
+  }
+#if ALPHALOC_STATIC_ALLOC
+  s_mutex = xSemaphoreCreateMutexStatic(&s_mutex_buf);
+#else
+  s_mutex = xSemaphoreCreateMutex();
+#endif
+  s_pages = (s_part->size / TRACK_SECTOR_SIZE) * PAGES_PER_SECTOR;
+  s_stats.sectors = s_pages / PAGES_PER_SECTOR;
+  const int64_t start_us = esp_timer_get_time();
+  recover();
+  s_written_page = s_plan_page;
+  begin_block();
+  ESP_LOGI(TAG, "Track log: %lu KB, seq %lu, next page %lu (scan %lld ms)",
+           (unsigned long)(s_part->size / 1024), (unsigned long)s_seq,
+           (unsigned long)s_plan_page,
+           (long long)((esp_timer_get_time() - start_us) / 1000));
+  return true;
+}
+
+// False for never used sectors and for one left with only a header.
+static bool read_sector_hdr(const track_reader_t *r, uint32_t sector,
+                            track_sector_hdr_t *out) {
+  return track_sector_has_data(r->base + (size_t)sector * TRACK_SECTOR_SIZE,
+                               out);
+}
+
+bool track_reader_open(track_reader_t *r, uint32_t t_from, uint32_t t_to) {
+  memset(r, 0, sizeof(*r));
+  if (!s_part) {
+    return false;
+  }
+  track_log_flush();
+  const void *base;
+  if (esp_partition_mmap(s_part, 0, s_part->size, ESP_PARTITION_MMAP_DATA,
+                         &base, &r->map) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot map the track partition");
+    return false;
+  }
+  r->base = (const uint8_t *)base;
+  r->sectors = s_pages / PAGES_PER_SECTOR;
+  r->t_from = t_from;
+  r->t_to = t_to;
+
+  // The sector after the newest written one is the oldest; from there the
+  // sectors are in time order, with never used ones first. A sector whose
+  // header made it to flash but whose first block did not sits at the write
+  // head, i.e. in the oldest slot, and counts as never used; otherwise its
+  // recent t_first would end the export before it started. Find the last
+  // sector that starts no later than t_from.
+  const uint32_t written = __atomic_load_n(&s_written_page, __ATOMIC_ACQUIRE);
+  const uint32_t newest =
+      ((written + s_pages - 1) % s_pages) / PAGES_PER_SECTOR;
+  const uint32_t oldest = (newest + 1) % r->sectors;
+  uint32_t lo = 0;
+  uint32_t hi = r->sectors;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    track_sector_hdr_t sh;
+    if (!read_sector_hdr(r, (oldest + mid) % r->sectors, &sh) ||
+        sh.t_first <= t_from) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  const uint32_t start = lo > 0 ? lo - 1 : 0;
+  r->sector = (oldest + start) % r->sectors;
+  r->left = r->sectors - start;
+  return true;
+}
+
+static void next_sector(track_reader_t *r) {
+  r->sector = (r->sector + 1) % r->sectors;
+  r->page = 0;
+  r->left--;
+}
+
+bool track_reader_next(track_reader_t *r, track_point_t *out) {
+  while (r->left > 0) {
+    if (r->in_block) {
+      if (track_dec_next(&r->dec, out)) {
+        if (out->t < r->t_from) {
+          continue;
+        }
+        if (out->t > r->t_to) {
+          r->left = 0;
+          return false;
+        }
+        return true;
+      }
+      r->in_block = false;
+    }
+    if (r->page == PAGES_PER_SECTOR) {
+      next_sector(r);
+      continue;
+    }
+    if (r->page == 0) {
+      track_sector_hdr_t sh;
+      if (!read_sector_hdr(r, r->sector, &sh)) {
+        next_sector(r);
+        continue;
+      }
+      if (sh.t_first > r->t_to) {
+        r->left = 0;
+        return false;
+      }
+    }
+    const uint32_t page = r->sector * PAGES_PER_SECTOR + r->page++;
+    const uint8_t *p = r->base + page_offset(page);
+    track_block_hdr_t bh;
+    memcpy(&bh, p, sizeof(bh));
+    if (bh.len > page_payload_cap(page) ||
+        !track_block_valid(&bh, p + sizeof(bh))) {
+      // Erased (the end of what was written) or torn: nothing follows in
+      // this sector.
+      r->page = PAGES_PER_SECTOR;
+      continue;
+    }
+    track_dec_begin(&r->dec, p + sizeof(bh), bh.len, bh.count);
+    r->in_block = true;
+    r->blocks++;
+  }
+  return false;
+}
+
+const uint8_t *track_reader_next_sector(track_reader_t *r) {
+  while (r->left > 0) {
+    const uint32_t sector = r->sector;
+    next_sector(r);
+    track_sector_hdr_t sh;
+    if (!read_sector_hdr(r, sector, &sh)) {
+      continue;
+    }
+    if (sh.t_first > r->t_to) {
+      r->left = 0;
+      break;
+    }
+    return r->base + (size_t)sector * TRACK_SECTOR_SIZE;
+  }
+  return NULL;
+}
+
+void track_reader_close(track_reader_t *r) {
+  if (r->base) {
+    esp_partition_munmap(r->map);
+    r->base = NULL;
+  }
+}
@@ -0,0 +1,4009 @@
+// Generated by tools/tzgen.c, do not edit. Source: zone.tab nearest city within 1500 km + tz_fixes.csv, tzdata 2025b, 4 cells/deg.
+
+#include "tz_data.h"
+
+#ifndef ALPHALOC_TZ_LOOKUP
+#define ALPHALOC_TZ_LOOKUP 1
+#endif
+
+#if ALPHALOC_TZ_LOOKUP
+
+const tz_grid_t tz_grid = {4, 720, 1440, 418,
+                           "zone.tab nearest city within 1500 km + tz_fixes.csv, tzdata 2025b, 4 cells/deg"};
+
+const tz_rule_t tz_rules[] = {
+    {60, 60, 3, 5, 0, 10, 5, 0, 120, 180},
+    {240, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {270, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-240, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {60, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {720, 60, 9, 5, 0, 4, 1, 0, 120, 180},
+    {480, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {420, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {600, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {300, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-180, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {180, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 120, 3, 5, 0, 10, 5, 0, 60, 180},
+    {-660, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {630, 30, 10, 1, 0, 4, 1, 0, 120, 120},
+    {600, 60, 10, 1, 0, 4, 1, 0, 120, 180},
+    {570, 60, 10, 1, 0, 4, 1, 0, 120, 180},
+    {570, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {525, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {120, 60, 3, 5, 0, 10, 5, 0, 180, 240},
+    {360, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {120, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-240, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-120, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-300, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-300, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-360, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-210, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-360, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-420, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-420, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-480, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {390, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-600, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-240, 60, 9, 1, 6, 4, 1, 6, 1440, 1440},
+    {-360, 60, 9, 1, 6, 4, 1, 6, 1320, 1320},
+    {-300, 60, 3, 2, 0, 11, 1, 0, 0, 60},
+    {-60, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {120, 60, 4, 5, 5, 10, 5, 4, 0, 1440},
+    {0, 60, 3, 5, 0, 10, 5, 0, 60, 120},
+    {720, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {660, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-120, 60, 3, 5, 0, 10, 5, 0, -60, 0},
+    {540, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {120, 60, 3, 4, 4, 10, 5, 0, 1560, 120},
+    {330, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {210, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {780, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {840, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {120, 60, 3, 5, 0, 10, 5, 0, 0, 0},
+    {120, 60, 3, 5, 0, 10, 5, 0, 120, 180},
+    {660, 60, 10, 1, 0, 4, 1, 0, 120, 180},
+    {345, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {765, 60, 9, 5, 0, 4, 1, 0, 165, 225},
+    {-570, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-540, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {-180, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-480, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {120, 60, 3, 4, 4, 10, 4, 4, 3000, 3000},
+    {-60, 60, 3, 5, 0, 10, 5, 0, 0, 60},
+    {-540, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+    {-600, 60, 3, 2, 0, 11, 1, 0, 120, 120},
+};
+
+const tz_zone_t tz_zones[] = {
+    {"Africa/Abidjan", 21},
+    {"Africa/Accra", 21},
+    {"Africa/Addis_Ababa", 11},
+    {"Africa/Algiers", 4},
+    {"Africa/Asmara", 11},
+    {"Africa/Bamako", 21},
+    {"Africa/Bangui", 4},
+    {"Africa/Banjul", 21},
+    {"Africa/Bissau", 21},
+    {"Africa/Blantyre", 22},
+    {"Africa/Brazzaville", 4},
+    {"Africa/Bujumbura", 22},
+    {"Africa/Cairo", 39},
+    {"Africa/Casablanca", 4},
+    {"Africa/Ceuta", 0},
+    {"Africa/Conakry", 21},
+    {"Africa/Dakar", 21},
+    {"Africa/Dar_es_Salaam", 11},
+    {"Africa/Djibouti", 11},
+    {"Africa/Douala", 4},
+    {"Africa/El_Aaiun", 4},
+    {"Africa/Freetown", 21},
+    {"Africa/Gaborone", 22},
+    {"Africa/Harare", 22},
+    {"Africa/Johannesburg", 22},
+    {"Africa/Juba", 22},
+    {"Africa/Kampala", 11},
+    {"Africa/Khartoum", 22},
+    {"Africa/Kigali", 22},
+    {"Africa/Kinshasa", 4},
+    {"Africa/Lagos", 4},
+    {"Africa/Libreville", 4},
+    {"Africa/Lome", 21},
+    {"Africa/Luanda", 4},
+    {"Africa/Lubumbashi", 22},
+    {"Africa/Lusaka", 22},
+    {"Africa/Malabo", 4},
+    {"Africa/Maputo", 22},
+    {"Africa/Maseru", 22},
+    {"Africa/Mbabane", 22},
+    {"Africa/Mogadishu", 11},
+    {"Africa/Monrovia", 21},
+    {"Africa/Nairobi", 11},
+    {"Africa/Ndjamena", 4},
+    {"Africa/Niamey", 4},
+    {"Africa/Nouakchott", 21},
+    {"Africa/Ouagadougou", 21},
+    {"Africa/Porto-Novo", 4},
+    {"Africa/Sao_Tome", 21},
+    {"Africa/Tripoli", 22},
+    {"Africa/Tunis", 4},
+    {"Africa/Windhoek", 22},
+    {"America/Adak", 62},
+    {"America/Anchorage", 61},
+    {"America/Anguilla", 3},
+    {"America/Antigua", 3},
+    {"America/Araguaina", 10},
+    {"America/Argentina/Buenos_Aires", 10},
+    {"America/Argentina/Catamarca", 10},
+    {"America/Argentina/Cordoba", 10},
+    {"America/Argentina/Jujuy", 10},
+    {"America/Argentina/La_Rioja", 10},
+    {"America/Argentina/Mendoza", 10},
+    {"America/Argentina/Rio_Gallegos", 10},
+    {"America/Argentina/Salta", 10},
+    {"America/Argentina/San_Juan", 10},
+    {"America/Argentina/San_Luis", 10},
+    {"America/Argentina/Tucuman", 10},
+    {"America/Argentina/Ushuaia", 10},
+    {"America/Aruba", 3},
+    {"America/Asuncion", 10},
+    {"America/Atikokan", 25},
+    {"America/Bahia", 10},
+    {"America/Bahia_Banderas", 27},
+    {"America/Barbados", 3},
+    {"America/Belem", 10},
+    {"America/Belize", 27},
+    {"America/Blanc-Sablon", 3},
+    {"America/Boa_Vista", 3},
+    {"America/Bogota", 25},
+    {"America/Boise", 30},
+    {"America/Cambridge_Bay", 30},
+    {"America/Campo_Grande", 3},
+    {"America/Cancun", 25},
+    {"America/Caracas", 3},
+    {"America/Cayenne", 10},
+    {"America/Cayman", 25},
+    {"America/Chicago", 29},
+    {"America/Chihuahua", 27},
+    {"America/Ciudad_Juarez", 30},
+    {"America/Costa_Rica", 27},
+    {"America/Coyhaique", 10},
+    {"America/Creston", 31},
+    {"America/Cuiaba", 3},
+    {"America/Curacao", 3},
+    {"America/Danmarkshavn", 21},
+    {"America/Dawson", 31},
+    {"America/Dawson_Creek", 31},
+    {"America/Denver", 30},
+    {"America/Detroit", 26},
+    {"America/Dominica", 3},
+    {"America/Edmonton", 30},
+    {"America/Eirunepe", 25},
+    {"America/El_Salvador", 27},
+    {"America/Fort_Nelson", 31},
+    {"America/Fortaleza", 10},
+    {"America/Glace_Bay", 23},
+    {"America/Goose_Bay", 23},
+    {"America/Grand_Turk", 26},
+    {"America/Grenada", 3},
+    {"America/Guadeloupe", 3},
+    {"America/Guatemala", 27},
+    {"America/Guayaquil", 25},
+    {"America/Guyana", 3},
+    {"America/Halifax", 23},
+    {"America/Havana", 37},
+    {"America/Hermosillo", 31},
+    {"America/Indiana/Indianapolis", 26},
+    {"America/Indiana/Knox", 29},
+    {"America/Indiana/Marengo", 26},
+    {"America/Indiana/Petersburg", 26},
+    {"America/Indiana/Tell_City", 29},
+    {"America/Indiana/Vevay", 26},
+    {"America/Indiana/Vincennes", 26},
+    {"America/Indiana/Winamac", 26},
+    {"America/Inuvik", 30},
+    {"America/Iqaluit", 26},
+    {"America/Jamaica", 25},
+    {"America/Juneau", 61},
+    {"America/Kentucky/Louisville", 26},
+    {"America/Kentucky/Monticello", 26},
+    {"America/Kralendijk", 3},
+    {"America/La_Paz", 3},
+    {"America/Lima", 25},
+    {"America/Los_Angeles", 32},
+    {"America/Lower_Princes", 3},
+    {"America/Maceio", 10},
+    {"America/Managua", 27},
+    {"America/Manaus", 3},
+    {"America/Marigot", 3},
+    {"America/Martinique", 3},
+    {"America/Matamoros", 29},
+    {"America/Mazatlan", 31},
+    {"America/Menominee", 29},
+    {"America/Merida", 27},
+    {"America/Metlakatla", 61},
+    {"America/Mexico_City", 27},
+    {"America/Miquelon", 57},
+    {"America/Moncton", 23},
+    {"America/Monterrey", 27},
+    {"America/Montevideo", 10},
+    {"America/Montserrat", 3},
+    {"America/Nassau", 26},
+    {"America/New_York", 26},
+    {"America/Nome", 61},
+    {"America/Noronha", 24},
+    {"America/North_Dakota/Beulah", 29},
+    {"America/North_Dakota/Center", 29},
+    {"America/North_Dakota/New_Salem", 29},
+    {"America/Nuuk", 43},
+    {"America/Ojinaga", 29},
+    {"America/Panama", 25},
+    {"America/Paramaribo", 10},
+    {"America/Phoenix", 31},
+    {"America/Port-au-Prince", 26},
+    {"America/Port_of_Spain", 3},
+    {"America/Porto_Velho", 3},
+    {"America/Puerto_Rico", 3},
+    {"America/Punta_Arenas", 10},
+    {"America/Rankin_Inlet", 29},
+    {"America/Recife", 10},
+    {"America/Regina", 27},
+    {"America/Resolute", 29},
+    {"America/Rio_Branco", 25},
+    {"America/Santarem", 10},
+    {"America/Santiago", 35},
+    {"America/Santo_Domingo", 3},
+    {"America/Sao_Paulo", 10},
+    {"America/Scoresbysund", 43},
+    {"America/Sitka", 61},
+    {"America/St_Barthelemy", 3},
+    {"America/St_Johns", 28},
+    {"America/St_Kitts", 3},
+    {"America/St_Lucia", 3},
+    {"America/St_Thomas", 3},
+    {"America/St_Vincent", 3},
+    {"America/Swift_Current", 27},
+    {"America/Tegucigalpa", 27},
+    {"America/Thule", 23},
+    {"America/Tijuana", 32},
+    {"America/Toronto", 26},
+    {"America/Tortola", 3},
+    {"America/Vancouver", 32},
+    {"America/Whitehorse", 31},
+    {"America/Winnipeg", 29},
+    {"America/Yakutat", 61},
+    {"Antarctica/Casey", 6},
+    {"Antarctica/Davis", 7},
+    {"Antarctica/DumontDUrville", 8},
+    {"Antarctica/Macquarie", 15},
+    {"Antarctica/Mawson", 9},
+    {"Antarctica/McMurdo", 5},
+    {"Antarctica/Palmer", 10},
+    {"Antarctica/Rothera", 10},
+    {"Antarctica/Syowa", 11},
+    {"Antarctica/Troll", 12},
+    {"Antarctica/Vostok", 9},
+    {"Arctic/Longyearbyen", 0},
+    {"Asia/Aden", 11},
+    {"Asia/Almaty", 9},
+    {"Asia/Amman", 11},
+    {"Asia/Anadyr", 41},
+    {"Asia/Aqtau", 9},
+    {"Asia/Aqtobe", 9},
+    {"Asia/Ashgabat", 9},
+    {"Asia/Atyrau", 9},
+    {"Asia/Baghdad", 11},
+    {"Asia/Bahrain", 11},
+    {"Asia/Baku", 1},
+    {"Asia/Bangkok", 7},
+    {"Asia/Barnaul", 7},
+    {"Asia/Beirut", 50},
+    {"Asia/Bishkek", 20},
+    {"Asia/Brunei", 6},
+    {"Asia/Chita", 44},
+    {"Asia/Colombo", 46},
+    {"Asia/Damascus", 11},
+    {"Asia/Dhaka", 20},
+    {"Asia/Dili", 44},
+    {"Asia/Dubai", 1},
+    {"Asia/Dushanbe", 9},
+    {"Asia/Famagusta", 19},
+    {"Asia/Gaza", 59},
+    {"Asia/Hebron", 59},
+    {"Asia/Ho_Chi_Minh", 7},
+    {"Asia/Hong_Kong", 6},
+    {"Asia/Hovd", 7},
+    {"Asia/Irkutsk", 6},
+    {"Asia/Jakarta", 7},
+    {"Asia/Jayapura", 44},
+    {"Asia/Jerusalem", 45},
+    {"Asia/Kabul", 2},
+    {"Asia/Kamchatka", 41},
+    {"Asia/Karachi", 9},
+    {"Asia/Kathmandu", 53},
+    {"Asia/Khandyga", 44},
+    {"Asia/Kolkata", 46},
+    {"Asia/Krasnoyarsk", 7},
+    {"Asia/Kuala_Lumpur", 6},
+    {"Asia/Kuching", 6},
+    {"Asia/Kuwait", 11},
+    {"Asia/Macau", 6},
+    {"Asia/Magadan", 42},
+    {"Asia/Makassar", 6},
+    {"Asia/Manila", 6},
+    {"Asia/Muscat", 1},
+    {"Asia/Nicosia", 19},
+    {"Asia/Novokuznetsk", 7},
+    {"Asia/Novosibirsk", 7},
+    {"Asia/Omsk", 20},
+    {"Asia/Oral", 9},
+    {"Asia/Phnom_Penh", 7},
+    {"Asia/Pontianak", 7},
+    {"Asia/Pyongyang", 44},
+    {"Asia/Qatar", 11},
+    {"Asia/Qostanay", 9},
+    {"Asia/Qyzylorda", 9},
+    {"Asia/Riyadh", 11},
+    {"Asia/Sakhalin", 42},
+    {"Asia/Samarkand", 9},
+    {"Asia/Seoul", 44},
+    {"Asia/Shanghai", 6},
+    {"Asia/Singapore", 6},
+    {"Asia/Srednekolymsk", 42},
+    {"Asia/Taipei", 6},
+    {"Asia/Tashkent", 9},
+    {"Asia/Tbilisi", 1},
+    {"Asia/Tehran", 47},
+    {"Asia/Thimphu", 20},
+    {"Asia/Tokyo", 44},
+    {"Asia/Tomsk", 7},
+    {"Asia/Ulaanbaatar", 6},
+    {"Asia/Urumqi", 20},
+    {"Asia/Ust-Nera", 8},
+    {"Asia/Vientiane", 7},
+    {"Asia/Vladivostok", 8},
+    {"Asia/Yakutsk", 44},
+    {"Asia/Yangon", 33},
+    {"Asia/Yekaterinburg", 9},
+    {"Asia/Yerevan", 1},
+    {"Atlantic/Azores", 60},
+    {"Atlantic/Bermuda", 23},
+    {"Atlantic/Canary", 40},
+    {"Atlantic/Cape_Verde", 38},
+    {"Atlantic/Faroe", 40},
+    {"Atlantic/Madeira", 40},
+    {"Atlantic/Reykjavik", 21},
+    {"Atlantic/South_Georgia", 24},
+    {"Atlantic/St_Helena", 21},
+    {"Atlantic/Stanley", 10},
+    {"Australia/Adelaide", 16},
+    {"Australia/Brisbane", 8},
+    {"Australia/Broken_Hill", 16},
+    {"Australia/Darwin", 17},
+    {"Australia/Eucla", 18},
+    {"Australia/Hobart", 15},
+    {"Australia/Lindeman", 8},
+    {"Australia/Lord_Howe", 14},
+    {"Australia/Melbourne", 15},
+    {"Australia/Perth", 6},
+    {"Australia/Sydney", 15},
+    {"Europe/Amsterdam", 0},
+    {"Europe/Andorra", 0},
+    {"Europe/Astrakhan", 1},
+    {"Europe/Athens", 19},
+    {"Europe/Belgrade", 0},
+    {"Europe/Berlin", 0},
+    {"Europe/Bratislava", 0},
+    {"Europe/Brussels", 0},
+    {"Europe/Bucharest", 19},
+    {"Europe/Budapest", 0},
+    {"Europe/Busingen", 0},
+    {"Europe/Chisinau", 51},
+    {"Europe/Copenhagen", 0},
+    {"Europe/Dublin", 40},
+    {"Europe/Gibraltar", 0},
+    {"Europe/Guernsey", 40},
+    {"Europe/Helsinki", 19},
+    {"Europe/Isle_of_Man", 40},
+    {"Europe/Istanbul", 11},
+    {"Europe/Jersey", 40},
+    {"Europe/Kaliningrad", 22},
+    {"Europe/Kirov", 11},
+    {"Europe/Kyiv", 19},
+    {"Europe/Lisbon", 40},
+    {"Europe/Ljubljana", 0},
+    {"Europe/London", 40},
+    {"Europe/Luxembourg", 0},
+    {"Europe/Madrid", 0},
+    {"Europe/Malta", 0},
+    {"Europe/Mariehamn", 19},
+    {"Europe/Minsk", 11},
+    {"Europe/Monaco", 0},
+    {"Europe/Moscow", 11},
+    {"Europe/Oslo", 0},
+    {"Europe/Paris", 0},
+    {"Europe/Podgorica", 0},
+    {"Europe/Prague", 0},
+    {"Europe/Riga", 19},
+    {"Europe/Rome", 0},
+    {"Europe/Samara", 1},
+    {"Europe/San_Marino", 0},
+    {"Europe/Sarajevo", 0},
+    {"Europe/Saratov", 1},
+    {"Europe/Simferopol", 11},
+    {"Europe/Skopje", 0},
+    {"Europe/Sofia", 19},
+    {"Europe/Stockholm", 0},
+    {"Europe/Tallinn", 19},
+    {"Europe/Tirane", 0},
+    {"Europe/Ulyanovsk", 1},
+    {"Europe/Vaduz", 0},
+    {"Europe/Vatican", 0},
+    {"Europe/Vienna", 0},
+    {"Europe/Vilnius", 19},
+    {"Europe/Volgograd", 11},
+    {"Europe/Warsaw", 0},
+    {"Europe/Zagreb", 0},
+    {"Europe/Zurich", 0},
+    {"Indian/Antananarivo", 11},
+    {"Indian/Chagos", 20},
+    {"Indian/Christmas", 7},
+    {"Indian/Cocos", 33},
+    {"Indian/Comoro", 11},
+    {"Indian/Kerguelen", 9},
+    {"Indian/Mahe", 1},
+    {"Indian/Maldives", 9},
+    {"Indian/Mauritius", 1},
+    {"Indian/Mayotte", 11},
+    {"Indian/Reunion", 1},
+    {"Pacific/Apia", 48},
+    {"Pacific/Auckland", 5},
+    {"Pacific/Bougainville", 42},
+    {"Pacific/Chatham", 54},
+    {"Pacific/Chuuk", 8},
+    {"Pacific/Easter", 36},
+    {"Pacific/Efate", 42},
+    {"Pacific/Fakaofo", 48},
+    {"Pacific/Fiji", 41},
+    {"Pacific/Funafuti", 41},
+    {"Pacific/Galapagos", 27},
+    {"Pacific/Gambier", 56},
+    {"Pacific/Guadalcanal", 42},
+    {"Pacific/Guam", 8},
+    {"Pacific/Honolulu", 34},
+    {"Pacific/Kanton", 48},
+    {"Pacific/Kiritimati", 49},
+    {"Pacific/Kosrae", 42},
+    {"Pacific/Kwajalein", 41},
+    {"Pacific/Majuro", 41},
+    {"Pacific/Marquesas", 55},
+    {"Pacific/Midway", 13},
+    {"Pacific/Nauru", 41},
+    {"Pacific/Niue", 13},
+    {"Pacific/Norfolk", 52},
+    {"Pacific/Noumea", 42},
+    {"Pacific/Pago_Pago", 13},
+    {"Pacific/Palau", 44},
+    {"Pacific/Pitcairn", 58},
+    {"Pacific/Pohnpei", 42},
+    {"Pacific/Port_Moresby", 8},
+    {"Pacific/Rarotonga", 34},
+    {"Pacific/Saipan", 8},
+    {"Pacific/Tahiti", 34},
+    {"Pacific/Tarawa", 41},
+    {"Pacific/Tongatapu", 48},
+    {"Pacific/Wake", 41},
+    {"Pacific/Wallis", 41},
+};
+
+const uint32_t tz_row_start[] = {
+    0, 6, 11, 16, 21, 26, 31, 36,
+    41, 46, 51, 56, 61, 67, 73, 79,
+    85, 91, 97, 103, 109, 115, 121, 127,
+    133, 139, 145, 151, 157, 163, 169, 175,
+    181, 187, 193, 199, 205, 214, 223, 232,
+    241, 250, 259, 268, 277, 286, 295, 304,
+    314, 325, 335, 345, 355, 365, 375, 385,
+    395, 405, 415, 425, 436, 447, 459, 471,
+    483, 496, 511, 528, 544, 560, 576, 592,
+    608, 626, 645, 663, 681, 699, 718, 737,
+    757, 778, 799, 821, 844, 869, 893, 917,
+    941, 965, 989, 1013, 1039, 1065, 1091, 1116,
+    1141, 1166, 1190, 1214, 1240, 1266, 1292, 1318,
+    1345, 1371, 1397, 1424, 1451, 1478, 1505, 1532,
+    1558, 1585, 1612, 1638, 1665, 1692, 1719, 1747,
+    1775, 1803, 1833, 1864, 1893, 1922, 1952, 1984,
+    2016, 2049, 2083, 2118, 2156, 2193, 2231, 2271,
+    2312, 2352, 2394, 2436, 2476, 2518, 2561, 2604,
+    2653, 2700, 2746, 2793, 2838, 2882, 2925, 2969,
+    3012, 3056, 3102, 3150, 3195, 3242, 3287, 3329,
+    3372, 3414, 3454, 3497, 3546, 3589, 3632, 3676,
+    3724, 3771, 3815, 3857, 3902, 3948, 3994, 4041,
+    4086, 4131, 4175, 4223, 4271, 4316, 4361, 4405,
+    4449, 4493, 4537, 4582, 4628, 4677, 4726, 4773,
+    4819, 4864, 4913, 4964, 5013, 5058, 5102, 5147,
+    5191, 5240, 5287, 5330, 5372, 5411, 5450, 5491,
+    5534, 5573, 5606, 5637, 5670, 5706, 5749, 5793,
+    5838, 5880, 5918, 5953, 5987, 6022, 6060, 6097,
+    6134, 6171, 6208, 6244, 6281, 6319, 6357, 6397,
+    6436, 6472, 6511, 6549, 6590, 6629, 6667, 6706,
+    6745, 6783, 6819, 6856, 6895, 6934, 6975, 7019,
+    7067, 7116, 7162, 7208, 7256, 7305, 7350, 7395,
+    7438, 7485, 7529, 7572, 7613, 7654, 7694, 7735,
+    7776, 7818, 7860, 7902, 7947, 7993, 8041, 8090,
+    8139, 8187, 8237, 8284, 8331, 8380, 8426, 8472,
+    8518, 8566, 8612, 8661, 8710, 8757, 8805, 8854,
+    8900, 8945, 8991, 9036, 9079, 9123, 9170, 9218,
+    9267, 9321, 9374, 9429, 9483, 9539, 9592, 9646,
+    9700, 9754, 9807, 9859, 9911, 9964, 10016, 10067,
+    10117, 10166, 10216, 10268, 10319, 10370, 10425, 10482,
+    10537, 10590, 10647, 10703, 10759, 10816, 10873, 10931,
+    10987, 11041, 11095, 11149, 11201, 11253, 11305, 11356,
+    11406, 11454, 11503, 11550, 11596, 11642, 11687, 11734,
+    11781, 11829, 11874, 11918, 11961, 12004, 12048, 12093,
+    12138, 12181, 12222, 12263, 12304, 12347, 12390, 12434,
+    12479, 12524, 12569, 12614, 12657, 12699, 12741, 12785,
+    12828, 12869, 12911, 12953, 12995, 13037, 13077, 13119,
+    13161, 13203, 13245, 13286, 13328, 13371, 13413, 13454,
+    13493, 13532, 13570, 13610, 13651, 13693, 13736, 13779,
+    13822, 13865, 13908, 13950, 13994, 14035, 14074, 14114,
+    14154, 14193, 14232, 14270, 14308, 14346, 14385, 14425,
+    14463, 14502, 14540, 14578, 14616, 14658, 14699, 14740,
+    14783, 14827, 14870, 14912, 14955, 14997, 15039, 15083,
+    15127, 15171, 15215, 15259, 15302, 15343, 15383, 15421,
+    15458, 15495, 15531, 15567, 15603, 15640, 15677, 15712,
+    15746, 15780, 15815, 15851, 15886, 15921, 15957, 15993,
+    16029, 16064, 16098, 16132, 16169, 16206, 16242, 16278,
+    16315, 16353, 16393, 16432, 16471, 16508, 16545, 16583,
+    16619, 16654, 16688, 16721, 16755, 16789, 16823, 16858,
+    16893, 16927, 16962, 16996, 17030, 17064, 17099, 17133,
+    17167, 17199, 17231, 17263, 17296, 17326, 17356, 17387,
+    17418, 17450, 17481, 17512, 17542, 17572, 17602, 17632,
+    17663, 17695, 17725, 17754, 17781, 17807, 17833, 17857,
+    17883, 17908, 17932, 17956, 17980, 18004, 18028, 18053,
+    18077, 18101, 18125, 18147, 18170, 18193, 18216, 18238,
+    18260, 18282, 18304, 18325, 18345, 18364, 18383, 18402,
+    18421, 18440, 18457, 18474, 18491, 18506, 18522, 18537,
+    18552, 18567, 18583, 18599, 18615, 18630, 18645, 18658,
+    18671, 18684, 18695, 18706, 18717, 18729, 18741, 18753,
+    18765, 18777, 18789, 18801, 18813, 18826, 18839, 18851,
+    18863, 18875, 18887, 18899, 18911, 18923, 18935, 18947,
+    18959, 18971, 18983, 18996, 19011, 19026, 19040, 19055,
+    19069, 19083, 19097, 19111, 19125, 19138, 19151, 19167,
+    19182, 19197, 19213, 19228, 19243, 19258, 19273, 19287,
+    19301, 19315, 19329, 19346, 19363, 19379, 19394, 19410,
+    19425, 19440, 19453, 19465, 19477, 19489, 19501, 19513,
+    19525, 19537, 19549, 19561, 19573, 19585, 19597, 19609,
+    19621, 19633, 19645, 19657, 19670, 19683, 19696, 19708,
+    19720, 19732, 19744, 19756, 19768, 19780, 19791, 19802,
+    19813, 19824, 19835, 19846, 19857, 19868, 19879, 19890,
+    19900, 19910, 19920, 19930, 19940, 19950, 19960, 19970,
+    19981, 19992, 20004, 20014, 20024, 20034, 20044, 20054,
+    20064, 20074, 20084, 20093, 20102, 20111, 20120, 20129,
+    20138, 20147, 20156, 20165, 20174, 20182, 20190, 20198,
+    20205, 20212, 20219, 20226, 20233, 20241, 20249, 20257,
+    20265, 20273, 20281, 20289, 20297, 20303, 20309, 20314,
+    20319, 20324, 20329, 20334, 20339, 20344, 20349, 20354,
+    20359, 20364, 20369, 20374, 20380, 20386, 20392, 20396,
+    20400, 20404, 20408, 20412, 20416, 20420, 20424, 20428,
+    20432, 20436, 20440, 20444, 20448, 20452, 20456, 20460,
+    20464,
+};
+
+const tz_run_t tz_runs[] = {
+    {0, 65535}, {370, 188}, {520, 65535}, {536, 95}, {548, 207}, {1026, 65535},
+    {0, 65535}, {332, 188}, {530, 95}, {559, 207}, {1038, 65535}, {0, 65535},
+    {306, 188}, {531, 95}, {569, 207}, {1048, 65535}, {0, 65535}, {287, 188},
+    {531, 95}, {579, 207}, {1056, 65535}, {0, 65535}, {271, 188}, {532, 95},
+    {587, 207}, {1063, 65535}, {0, 65535}, {257, 188}, {533, 95}, {595, 207},
+    {1069, 65535}, {0, 65535}, {246, 188}, {533, 95}, {602, 207}, {1075, 65535},
+    {0, 65535}, {236, 188}, {534, 95}, {609, 207}, {1079, 65535}, {0, 65535},
+    {228, 188}, {535, 95}, {615, 207}, {1083, 65535}, {0, 65535}, {220, 188},
+    {535, 95}, {621, 207}, {1086, 65535}, {0, 65535}, {214, 188}, {536, 95},
+    {627, 207}, {1089, 65535}, {0, 65535}, {208, 188}, {536, 95}, {632, 207},
+    {1091, 65535}, {0, 65535}, {196, 172}, {221, 188}, {537, 95}, {637, 207},
+    {1093, 65535}, {0, 65535}, {185, 172}, {232, 188}, {537, 95}, {641, 207},
+    {1094, 65535}, {0, 65535}, {176, 172}, {242, 188}, {537, 95}, {645, 207},
+    {1095, 65535}, {0, 65535}, {169, 172}, {251, 188}, {538, 95}, {649, 207},
+    {1096, 65535}, {0, 65535}, {162, 172}, {259, 188}, {538, 95}, {653, 207},
+    {1096, 65535}, {0, 65535}, {156, 172}, {267, 188}, {539, 95}, {657, 207},
+    {1097, 65535}, {0, 65535}, {150, 172}, {275, 188}, {539, 95}, {660, 207},
+    {1097, 65535}, {0, 65535}, {145, 172}, {281, 188}, {539, 95}, {663, 207},
+    {1096, 65535}, {0, 65535}, {141, 172}, {288, 188}, {539, 95}, {666, 207},
+    {1096, 65535}, {0, 65535}, {137, 172}, {294, 188}, {540, 95}, {669, 207},
+    {1095, 65535}, {0, 65535}, {134, 172}, {299, 188}, {540, 95}, {672, 207},
+    {1094, 65535}, {0, 65535}, {131, 172}, {305, 188}, {540, 95}, {674, 207},
+    {1093, 65535}, {0, 65535}, {128, 172}, {310, 188}, {541, 95}, {677, 207},
+    {1092, 65535}, {0, 65535}, {126, 172}, {314, 188}, {541, 95}, {679, 207},
+    {1091, 65535}, {0, 65535}, {124, 172}, {319, 188}, {541, 95}, {681, 207},
+    {1090, 65535}, {0, 65535}, {122, 172}, {323, 188}, {541, 95}, {684, 207},
+    {1088, 65535}, {0, 65535}, {120, 172}, {327, 188}, {541, 95}, {686, 207},
+    {1087, 65535}, {0, 65535}, {119, 172}, {331, 188}, {542, 95}, {687, 207},
+    {1085, 65535}, {0, 65535}, {117, 172}, {335, 188}, {542, 95}, {689, 207},
+    {1084, 65535}, {0, 65535}, {117, 172}, {338, 188}, {542, 95}, {691, 207},
+    {1082, 65535}, {0, 65535}, {116, 172}, {341, 188}, {542, 95}, {693, 207},
+    {1080, 65535}, {0, 65535}, {115, 172}, {345, 188}, {542, 95}, {694, 207},
+    {1078, 65535}, {0, 65535}, {115, 172}, {348, 188}, {543, 95}, {696, 207},
+    {1076, 65535}, {0, 65535}, {114, 172}, {351, 188}, {543, 95}, {697, 207},
+    {1074, 65535}, {0, 65535}, {110, 125}, {118, 172}, {353, 188}, {543, 95},
+    {699, 207}, {1072, 65535}, {1313, 273}, {1357, 65535}, {0, 65535}, {101, 125},
+    {127, 172}, {356, 188}, {543, 95}, {700, 207}, {1069, 65535}, {1292, 273},
+    {1378, 65535}, {0, 65535}, {94, 125}, {134, 172}, {358, 188}, {543, 95},
+    {701, 207}, {1067, 65535}, {1278, 273}, {1391, 65535}, {0, 65535}, {88, 125},
+    {141, 172}, {361, 188}, {543, 95}, {702, 207}, {1065, 65535}, {1268, 273},
+    {1402, 65535}, {0, 65535}, {83, 125}, {148, 172}, {363, 188}, {543, 95},
+    {704, 207}, {1062, 65535}, {1260, 273}, {1410, 65535}, {0, 65535}, {78, 125},
+    {154, 172}, {365, 188}, {544, 95}, {705, 207}, {1060, 65535}, {1252, 273},
+    {1417, 65535}, {0, 65535}, {73, 125}, {160, 172}, {367, 188}, {544, 95},
+    {706, 207}, {1058, 65535}, {1246, 273}, {1424, 65535}, {0, 65535}, {69, 125},
+    {166, 172}, {369, 188}, {544, 95}, {707, 207}, {1055, 65535}, {1240, 273},
+    {1429, 65535}, {0, 65535}, {66, 125}, {171, 172}, {371, 188}, {544, 95},
+    {708, 207}, {1053, 65535}, {1235, 273}, {1434, 65535}, {0, 65535}, {62, 125},
+    {176, 172}, {373, 188}, {544, 95}, {709, 207}, {1050, 65535}, {1231, 273},
+    {1439, 65535}, {0, 273}, {3, 65535}, {59, 125}, {180, 172}, {375, 188},
+    {544, 95}, {710, 207}, {1047, 65535}, {1227, 273}, {0, 273}, {5, 211},
+    {12, 65535}, {56, 125}, {185, 172}, {377, 188}, {544, 95}, {711, 207},
+    {1045, 65535}, {1223, 273}, {0, 273}, {3, 211}, {29, 65535}, {36, 154},
+    {56, 125}, {189, 172}, {379, 188}, {544, 95}, {711, 207}, {1042, 65535},
+    {1220, 273}, {0, 273}, {1, 211}, {31, 154}, {58, 125}, {193, 172},
+    {380, 188}, {544, 95}, {712, 207}, {1039, 65535}, {1216, 273}, {0, 211},
+    {31, 154}, {60, 125}, {197, 172}, {382, 188}, {544, 95}, {713, 207},
+    {1037, 65535}, {1214, 273}, {1439, 211}, {0, 211}, {31, 154}, {63, 125},
+    {201, 172}, {383, 188}, {545, 95}, {714, 207}, {1034, 65535}, {1211, 273},
+    {1437, 211}, {0, 211}, {31, 154}, {65, 125}, {204, 172}, {385, 188},
+    {545, 95}, {714, 207}, {1031, 65535}, {1209, 273}, {1435, 211}, {0, 211},
+    {31, 154}, {67, 125}, {208, 172}, {386, 188}, {545, 95}, {715, 207},
+    {1028, 65535}, {1206, 273}, {1433, 211}, {0, 211}, {30, 154}, {69, 125},
+    {211, 172}, {387, 188}, {545, 95}, {716, 207}, {1026, 65535}, {1204, 273},
+    {1431, 211}, {0, 211}, {30, 154}, {71, 125}, {214, 172}, {389, 188},
+    {545, 95}, {716, 207}, {1023, 65535}, {1202, 273}, {1429, 211}, {0, 211},
+    {30, 154}, {73, 125}, {217, 172}, {390, 188}, {545, 95}, {717, 207},
+    {1020, 65535}, {1201, 273}, {1428, 211}, {0, 211}, {30, 154}, {75, 125},
+    {220, 172}, {391, 188}, {545, 95}, {718, 207}, {1017, 65535}, {1199, 273},
+    {1426, 211}, {0, 211}, {30, 154}, {77, 125}, {223, 172}, {392, 188},
+    {545, 95}, {718, 207}, {1014, 65535}, {1198, 273}, {1424, 211}, {0, 211},
+    {29, 154}, {78, 125}, {226, 172}, {393, 188}, {545, 95}, {719, 207},
+    {1011, 65535}, {1196, 283}, {1200, 273}, {1423, 211}, {0, 211}, {29, 154},
+    {80, 125}, {228, 172}, {395, 188}, {545, 95}, {719, 207}, {1008, 65535},
+    {1193, 283}, {1206, 273}, {1421, 211}, {0, 211}, {29, 154}, {82, 125},
+    {231, 172}, {396, 188}, {545, 95}, {720, 207}, {1005, 65535}, {1187, 286},
+    {1193, 283}, {1211, 273}, {1419, 211}, {0, 211}, {29, 154}, {83, 125},
+    {233, 172}, {397, 188}, {545, 95}, {720, 207}, {1002, 65535}, {1181, 286},
+    {1196, 283}, {1217, 273}, {1418, 211}, {0, 211}, {29, 154}, {85, 125},
+    {236, 172}, {398, 188}, {545, 95}, {721, 207}, {999, 65535}, {1175, 286},
+    {1198, 283}, {1222, 273}, {1416, 211}, {0, 211}, {29, 154}, {87, 125},
+    {237, 81}, {250, 172}, {398, 188}, {545, 95}, {721, 207}, {995, 65535},
+    {1171, 286}, {1201, 283}, {1227, 273}, {1415, 211}, {0, 211}, {28, 154},
+    {88, 125}, {237, 81}, {264, 172}, {399, 188}, {546, 95}, {568, 178},
+    {638, 95}, {722, 207}, {992, 65535}, {1166, 286}, {1203, 283}, {1231, 273},
+    {1414, 211}, {0, 211}, {28, 154}, {90, 125}, {237, 81}, {275, 172},
+    {400, 188}, {546, 95}, {549, 178}, {657, 95}, {722, 207}, {989, 65535},
+    {1018, 288}, {1022, 65535}, {1162, 286}, {1205, 283}, {1235, 273}, {1412, 211},
+    {0, 211}, {28, 154}, {91, 125}, {238, 81}, {285, 172}, {401, 188},
+    {544, 178}, {670, 95}, {723, 207}, {986, 65535}, {1015, 288}, {1027, 65535},
+    {1159, 286}, {1208, 283}, {1240, 273}, {1411, 211}, {0, 211}, {28, 154},
+    {92, 125}, {238, 81}, {293, 172}, {402, 188}, {543, 178}, {681, 95},
+    {723, 207}, {983, 65535}, {1011, 288}, {1032, 65535}, {1155, 286}, {1210, 283},
+    {1244, 273}, {1410, 211}, {0, 211}, {28, 154}, {94, 125}, {238, 81},
+    {300, 172}, {403, 188}, {541, 178}, {691, 95}, {723, 207}, {979, 65535},
+    {1007, 288}, {1037, 65535}, {1152, 286}, {1212, 283}, {1247, 273}, {1408, 211},
+    {0, 211}, {28, 154}, {95, 125}, {238, 81}, {307, 172}, {404, 188},
+    {540, 178}, {699, 95}, {724, 207}, {976, 65535}, {1004, 288}, {1040, 65535},
+    {1150, 286}, {1214, 283}, {1251, 273}, {1407, 211}, {0, 211}, {27, 154},
+    {96, 125}, {239, 81}, {314, 172}, {404, 188}, {538, 178}, {707, 95},
+    {724, 207}, {972, 65535}, {1000, 288}, {1041, 65535}, {1147, 286}, {1216, 283},
+    {1255, 273}, {1406, 211}, {0, 211}, {27, 154}, {46, 53}, {55, 154},
+    {98, 125}, {239, 81}, {319, 172}, {405, 188}, {537, 178}, {714, 95},
+    {724, 207}, {969, 65535}, {997, 288}, {1042, 65535}, {1145, 286}, {1218, 283},
+    {1258, 273}, {1405, 211}, {0, 211}, {27, 154}, {46, 53}, {73, 154},
+    {99, 125}, {239, 81}, {325, 172}, {406, 188}, {529, 159}, {537, 178},
+    {720, 95}, {725, 207}, {966, 65535}, {993, 288}, {1043, 65535}, {1143, 286},
+    {1220, 283}, {1261, 273}, {1404, 211}, {0, 211}, {27, 154}, {45, 53},
+    {92, 154}, {100, 125}, {240, 81}, {330, 172}, {406, 188}, {517, 159},
+    {540, 178}, {725, 207}, {962, 65535}, {989, 288}, {1044, 65535}, {1141, 286},
+    {1222, 283}, {1264, 273}, {1402, 211}, {0, 211}, {27, 154}, {45, 53},
+    {110, 125}, {240, 81}, {335, 172}, {407, 188}, {507, 159}, {542, 178},
+    {727, 207}, {948, 332}, {966, 65535}, {986, 288}, {1045, 65535}, {1139, 286},
+    {1224, 283}, {1268, 273}, {1401, 211}, {0, 211}, {27, 154}, {45, 53},
+    {128, 125}, {240, 81}, {339, 172}, {408, 188}, {499, 159}, {544, 178},
+    {729, 207}, {935, 332}, {971, 65535}, {984, 288}, {1046, 65535}, {1137, 286},
+    {1226, 283}, {1270, 273}, {1400, 211}, {0, 211}, {27, 154}, {45, 53},
+    {147, 125}, {240, 81}, {344, 172}, {408, 188}, {491, 159}, {546, 178},
+    {731, 207}, {925, 332}, {976, 65535}, {983, 288}, {1047, 65535}, {1135, 286},
+    {1227, 245}, {1228, 283}, {1273, 273}, {1399, 211}, {0, 211}, {27, 154},
+    {45, 53}, {156, 125}, {241, 81}, {348, 172}, {409, 188}, {484, 159},
+    {548, 178}, {732, 207}, {916, 332}, {980, 65535}, {983, 288}, {1048, 65535},
+    {1134, 286}, {1228, 245}, {1230, 283}, {1276, 273}, {1398, 211}, {0, 211},
+    {26, 154}, {45, 53}, {156, 125}, {241, 81}, {352, 172}, {409, 188},
+    {435, 126}, {460, 188}, {478, 159}, {550, 178}, {734, 207}, {908, 332},
+    {982, 288}, {1048, 65535}, {1133, 286}, {1229, 245}, {1233, 283}, {1279, 273},
+    {1397, 211}, {0, 211}, {26, 154}, {45, 53}, {156, 125}, {241, 81},
+    {356, 172}, {410, 126}, {475, 159}, {552, 178}, {736, 207}, {836, 343},
+    {900, 207}, {901, 332}, {982, 288}, {1049, 280}, {1075, 65535}, {1131, 286},
+    {1230, 245}, {1235, 283}, {1281, 273}, {1396, 211}, {0, 211}, {26, 154},
+    {45, 53}, {156, 125}, {241, 81}, {359, 172}, {406, 126}, {476, 159},
+    {554, 178}, {733, 294}, {739, 207}, {836, 343}, {900, 332}, {981, 288},
+    {1050, 280}, {1087, 65535}, {1130, 286}, {1231, 245}, {1237, 283}, {1284, 273},
+    {1395, 211}, {0, 211}, {26, 154}, {45, 53}, {156, 125}, {241, 81},
+    {363, 172}, {402, 126}, {476, 159}, {556, 178}, {725, 294}, {744, 207},
+    {836, 343}, {900, 332}, {979, 288}, {1051, 280}, {1091, 247}, {1108, 65535},
+    {1129, 286}, {1231, 245}, {1240, 283}, {1286, 273}, {1394, 211}, {0, 211},
+    {26, 154}, {45, 53}, {156, 125}, {242, 81}, {366, 172}, {399, 126},
+    {476, 159}, {557, 178}, {719, 294}, {749, 207}, {808, 327}, {836, 343},
+    {900, 332}, {978, 288}, {1052, 280}, {1091, 247}, {1119, 65535}, {1128, 286},
+    {1232, 245}, {1242, 283}, {1289, 273}, {1393, 211}, {0, 211}, {26, 154},
+    {45, 53}, {156, 125}, {242, 81}, {369, 172}, {396, 126}, {476, 159},
+    {559, 178}, {712, 294}, {750, 344}, {778, 340}, {799, 357}, {805, 340},
+    {807, 327}, {835, 343}, {900, 332}, {977, 288}, {1053, 280}, {1090, 247},
+    {1127, 286}, {1233, 245}, {1244, 283}, {1291, 273}, {1392, 211}, {0, 211},
+    {26, 154}, {45, 53}, {156, 125}, {242, 81}, {366, 169}, {393, 126},
+    {476, 159}, {561, 178}, {707, 294}, {749, 344}, {778, 340}, {795, 357},
+    {807, 327}, {835, 343}, {900, 332}, {972, 288}, {1054, 280}, {1090, 247},
+    {1128, 286}, {1234, 245}, {1246, 283}, {1293, 273}, {1392, 211}, {0, 211},
+    {26, 154}, {45, 53}, {156, 125}, {242, 81}, {362, 169}, {394, 126},
+    {477, 159}, {562, 178}, {701, 294}, {748, 344}, {778, 340}, {792, 357},
+    {808, 327}, {835, 343}, {900, 332}, {967, 288}, {1055, 280}, {1090, 247},
+    {1129, 286}, {1235, 245}, {1248, 283}, {1295, 273}, {1391, 211}, {0, 211},
+    {26, 154}, {45, 53}, {156, 125}, {242, 81}, {357, 169}, {394, 126},
+    {477, 159}, {564, 178}, {696, 294}, {747, 344}, {778, 340}, {790, 357},
+    {809, 327}, {837, 343}, {900, 332}, {962, 288}, {1056, 280}, {1089, 247},
+    {1130, 286}, {1236, 245}, {1250, 283}, {1297, 273}, {1390, 211}, {0, 211},
+    {25, 154}, {45, 53}, {156, 125}, {243, 81}, {353, 169}, {394, 126},
+    {477, 159}, {565, 178}, {691, 294}, {747, 344}, {778, 340}, {788, 357},
+    {810, 327}, {838, 343}, {900, 332}, {960, 288}, {1056, 280}, {1089, 247},
+    {1132, 286}, {1236, 245}, {1251, 283}, {1300, 273}, {1389, 211}, {0, 211},
+    {25, 154}, {45, 53}, {156, 125}, {243, 81}, {349, 169}, {395, 126},
+    {477, 159}, {567, 178}, {687, 294}, {746, 344}, {778, 340}, {787, 357},
+    {812, 327}, {840, 343}, {900, 332}, {960, 288}, {1057, 280}, {1088, 247},
+    {1133, 286}, {1237, 245}, {1253, 283}, {1302, 273}, {1388, 211}, {0, 211},
+    {25, 154}, {44, 53}, {156, 125}, {243, 81}, {346, 169}, {395, 126},
+    {477, 159}, {568, 178}, {682, 294}, {745, 344}, {778, 340}, {786, 357},
+    {813, 327}, {839, 343}, {900, 332}, {960, 288}, {1057, 280}, {1088, 247},
+    {1134, 286}, {1238, 245}, {1255, 283}, {1303, 273}, {1387, 211}, {0, 211},
+    {25, 154}, {44, 53}, {156, 125}, {243, 81}, {342, 169}, {395, 126},
+    {477, 159}, {570, 178}, {603, 296}, {666, 178}, {678, 294}, {744, 344},
+    {779, 340}, {785, 357}, {814, 327}, {837, 343}, {900, 332}, {959, 288},
+    {1057, 280}, {1088, 247}, {1135, 286}, {1239, 245}, {1257, 283}, {1305, 273},
+    {1387, 211}, {0, 211}, {25, 154}, {44, 53}, {156, 96}, {160, 125},
+    {243, 81}, {339, 169}, {395, 126}, {478, 159}, {571, 178}, {587, 296},
+    {675, 294}, {743, 344}, {779, 340}, {784, 357}, {814, 327}, {836, 343},
+    {900, 332}, {959, 288}, {1058, 280}, {1087, 247}, {1136, 286}, {1239, 245},
+    {1258, 283}, {1307, 273}, {1386, 211}, {0, 211}, {25, 154}, {44, 53},
+    {156, 96}, {165, 125}, {244, 81}, {335, 169}, {396, 126}, {478, 159},
+    {573, 178}, {575, 296}, {675, 294}, {743, 344}, {779, 340}, {783, 357},
+    {815, 327}, {837, 343}, {900, 332}, {959, 288}, {1058, 280}, {1087, 247},
+    {1137, 286}, {1240, 245}, {1260, 283}, {1309, 273}, {1385, 211}, {0, 211},
+    {25, 154}, {44, 53}, {156, 96}, {170, 125}, {244, 81}, {332, 169},
+    {396, 126}, {478, 159}, {573, 296}, {674, 294}, {742, 344}, {779, 340},
+    {782, 357}, {815, 327}, {838, 343}, {900, 332}, {959, 288}, {1059, 280},
+    {1086, 247}, {1138, 286}, {1241, 245}, {1262, 283}, {1311, 273}, {1384, 211},
+    {0, 211}, {25, 154}, {44, 53}, {156, 96}, {175, 125}, {244, 81},
+    {329, 169}, {396, 126}, {478, 159}, {573, 296}, {673, 294}, {741, 344},
+    {779, 340}, {781, 357}, {816, 327}, {839, 343}, {900, 332}, {959, 288},
+    {1059, 280}, {1086, 247}, {1139, 286}, {1241, 245}, {1263, 283}, {1313, 273},
+    {1384, 211}, {0, 211}, {25, 154}, {44, 53}, {156, 96}, {179, 125},
+    {244, 81}, {326, 169}, {396, 126}, {478, 159}, {573, 296}, {672, 294},
+    {740, 344}, {779, 340}, {780, 357}, {816, 327}, {840, 343}, {900, 332},
+    {959, 288}, {1060, 280}, {1086, 247}, {1140, 286}, {1242, 245}, {1265, 283},
+    {1314, 273}, {1383, 211}, {0, 211}, {25, 154}, {43, 53}, {156, 96},
+    {183, 125}, {244, 81}, {323, 169}, {397, 126}, {478, 159}, {573, 296},
+    {671, 294}, {740, 344}, {779, 357}, {812, 327}, {840, 343}, {900, 332},
+    {959, 288}, {1060, 280}, {1085, 247}, {1141, 286}, {1243, 245}, {1266, 283},
+    {1316, 273}, {1382, 211}, {0, 211}, {24, 154}, {42, 53}, {156, 96},
+    {187, 125}, {244, 81}, {321, 169}, {397, 126}, {479, 159}, {573, 296},
+    {670, 294}, {739, 344}, {777, 357}, {808, 327}, {840, 343}, {900, 332},
+    {958, 288}, {1060, 280}, {1085, 247}, {1142, 286}, {1243, 245}, {1268, 283},
+    {1317, 273}, {1382, 211}, {0, 211}, {24, 154}, {40, 53}, {156, 96},
+    {191, 125}, {242, 104}, {246, 81}, {318, 169}, {397, 126}, {479, 159},
+    {573, 296}, {669, 294}, {738, 344}, {776, 357}, {807, 340}, {809, 327},
+    {839, 343}, {900, 332}, {958, 288}, {1061, 280}, {1085, 247}, {1143, 286},
+    {1244, 245}, {1269, 283}, {1319, 273}, {1381, 211}, {0, 211}, {24, 154},
+    {39, 53}, {156, 96}, {195, 125}, {236, 104}, {249, 81}, {315, 169},
+    {397, 126}, {479, 159}, {573, 296}, {669, 294}, {738, 344}, {775, 357},
+    {807, 340}, {809, 327}, {839, 343}, {900, 332}, {958, 288}, {1061, 280},
+    {1084, 247}, {1144, 286}, {1245, 245}, {1271, 283}, {1321, 273}, {1380, 211},
+    {0, 211}, {24, 154}, {38, 53}, {156, 96}, {199, 125}, {230, 104},
+    {253, 81}, {313, 169}, {397, 126}, {479, 159}, {573, 296}, {668, 294},
+    {737, 344}, {774, 357}, {807, 340}, {809, 327}, {839, 343}, {900, 332},
+    {958, 288}, {1062, 280}, {1084, 247}, {1145, 286}, {1245, 245}, {1272, 283},
+    {1322, 273}, {1380, 211}, {0, 211}, {24, 154}, {36, 53}, {156, 96},
+    {202, 125}, {225, 104}, {256, 81}, {310, 169}, {398, 126}, {479, 159},
+    {573, 296}, {667, 294}, {736, 344}, {773, 357}, {806, 340}, {809, 327},
+    {841, 343}, {900, 332}, {958, 288}, {1062, 280}, {1084, 247}, {1146, 286},
+    {1246, 245}, {1273, 283}, {1324, 273}, {1379, 211}, {0, 211}, {24, 154},
+    {35, 53}, {156, 96}, {200, 193}, {211, 125}, {219, 104}, {259, 81},
+    {308, 169}, {398, 126}, {479, 159}, {573, 296}, {666, 294}, {736, 344},
+    {772, 357}, {805, 340}, {809, 327}, {842, 343}, {900, 332}, {958, 288},
+    {1062, 280}, {1083, 247}, {1147, 286}, {1246, 245}, {1275, 283}, {1325, 273},
+    {1379, 211}, {0, 211}, {24, 154}, {34, 53}, {156, 96}, {196, 193},
+    {216, 104}, {262, 81}, {306, 169}, {398, 126}, {480, 159}, {573, 296},
+    {666, 294}, {735, 344}, {770, 357}, {804, 340}, {809, 327}, {840, 343},
+    {900, 332}, {957, 288}, {1062, 280}, {1083, 247}, {1147, 286}, {1247, 245},
+    {1276, 283}, {1326, 273}, {1378, 211}, {0, 211}, {24, 154}, {33, 53},
+    {156, 96}, {191, 193}, {216, 104}, {265, 81}, {303, 169}, {398, 126},
+    {480, 159}, {573, 296}, {665, 294}, {734, 344}, {769, 357}, {803, 340},
+    {809, 327}, {840, 343}, {900, 332}, {957, 288}, {1063, 280}, {1083, 247},
+    {1148, 286}, {1248, 245}, {1277, 283}, {1328, 273}, {1377, 211}, {0, 211},
+    {24, 154}, {33, 53}, {156, 96}, {187, 193}, {215, 104}, {268, 81},
+    {301, 169}, {398, 126}, {480, 159}, {573, 296}, {664, 294}, {734, 344},
+    {769, 357}, {802, 340}, {809, 327}, {842, 343}, {900, 332}, {956, 288},
+    {1063, 280}, {1083, 247}, {1149, 286}, {1248, 245}, {1278, 283}, {1326, 252},
+    {1336, 273}, {1377, 211}, {0, 211}, {24, 154}, {33, 53}, {156, 96},
+    {182, 193}, {214, 104}, {271, 81}, {299, 169}, {399, 126}, {480, 159},
+    {573, 296}, {663, 294}, {733, 344}, {769, 357}, {799, 340}, {809, 327},
+    {844, 343}, {900, 332}, {955, 288}, {1063, 280}, {1082, 247}, {1150, 286},
+    {1249, 245}, {1280, 283}, {1322, 252}, {1346, 273}, {1376, 211}, {0, 211},
+    {24, 154}, {32, 53}, {156, 96}, {179, 193}, {213, 104}, {274, 81},
+    {297, 169}, {399, 126}, {480, 159}, {573, 296}, {663, 294}, {733, 344},
+    {769, 357}, {796, 340}, {809, 327}, {846, 343}, {900, 332}, {954, 288},
+    {1063, 280}, {1082, 247}, {1151, 286}, {1249, 245}, {1281, 283}, {1319, 252},
+    {1355, 273}, {1376, 211}, {0, 211}, {24, 154}, {32, 53}, {156, 96},
+    {175, 193}, {213, 104}, {276, 81}, {295, 169}, {399, 126}, {480, 159},
+    {573, 296}, {662, 294}, {732, 344}, {769, 357}, {792, 340}, {809, 327},
+    {845, 343}, {900, 332}, {954, 288}, {1063, 280}, {1082, 247}, {1152, 286},
+    {1250, 245}, {1282, 283}, {1316, 252}, {1363, 273}, {1375, 211}, {0, 211},
+    {24, 154}, {32, 53}, {156, 96}, {171, 193}, {212, 104}, {279, 81},
+    {293, 169}, {399, 126}, {480, 159}, {573, 296}, {661, 294}, {732, 344},
+    {769, 357}, {790, 340}, {809, 327}, {843, 343}, {900, 332}, {953, 288},
+    {1064, 280}, {1081, 247}, {1152, 286}, {1250, 245}, {1283, 283}, {1313, 252},
+    {1369, 273}, {1375, 211}, {0, 211}, {24, 154}, {32, 53}, {156, 96},
+    {168, 193}, {211, 104}, {281, 81}, {291, 169}, {399, 126}, {480, 159},
+    {573, 296}, {661, 294}, {731, 344}, {769, 357}, {790, 340}, {809, 327},
+    {842, 343}, {900, 332}, {952, 288}, {1064, 280}, {1081, 247}, {1153, 286},
+    {1251, 245}, {1284, 283}, {1309, 252}, {1374, 211}, {0, 211}, {23, 154},
+    {33, 53}, {156, 96}, {164, 193}, {210, 104}, {284, 81}, {289, 169},
+    {400, 126}, {481, 159}, {573, 296}, {660, 294}, {730, 344}, {769, 357},
+    {790, 340}, {809, 327}, {841, 343}, {900, 332}, {951, 288}, {1064, 280},
+    {1081, 247}, {1153, 237}, {1155, 286}, {1251, 245}, {1285, 283}, {1306, 252},
+    {1375, 211}, {0, 211}, {23, 154}, {34, 53}, {156, 195}, {164, 193},
+    {210, 104}, {286, 81}, {287, 169}, {400, 126}, {481, 159}, {573, 296},
+    {659, 294}, {730, 344}, {769, 357}, {790, 340}, {809, 327}, {839, 343},
+    {900, 332}, {951, 288}, {1061, 280}, {1081, 247}, {1151, 237}, {1156, 286},
+    {1252, 245}, {1287, 283}, {1304, 252}, {1376, 211}, {0, 211}, {23, 154},
+    {35, 53}, {156, 195}, {165, 193}, {209, 104}, {287, 169}, {400, 126},
+    {481, 159}, {573, 296}, {659, 294}, {729, 344}, {769, 357}, {789, 340},
+    {810, 327}, {838, 343}, {900, 332}, {950, 288}, {1058, 280}, {1080, 247},
+    {1149, 237}, {1158, 286}, {1252, 245}, {1288, 283}, {1301, 252}, {1377, 211},
+    {0, 211}, {23, 154}, {36, 53}, {156, 195}, {166, 193}, {208, 104},
+    {288, 169}, {400, 126}, {481, 159}, {573, 296}, {658, 294}, {729, 344},
+    {769, 357}, {789, 340}, {810, 327}, {836, 343}, {900, 332}, {949, 288},
+    {1054, 280}, {1080, 247}, {1148, 237}, {1158, 224}, {1161, 286}, {1253, 245},
+    {1289, 283}, {1298, 252}, {1378, 211}, {0, 211}, {23, 154}, {38, 53},
+    {156, 195}, {167, 193}, {208, 104}, {288, 169}, {400, 126}, {481, 159},
+    {573, 296}, {658, 294}, {728, 344}, {769, 357}, {790, 340}, {810, 327},
+    {834, 343}, {900, 332}, {949, 288}, {1046, 280}, {1080, 247}, {1147, 237},
+    {1158, 224}, {1165, 286}, {1253, 245}, {1290, 283}, {1295, 252}, {1379, 211},
+    {0, 211}, {23, 154}, {39, 53}, {156, 195}, {168, 193}, {207, 104},
+    {289, 169}, {400, 126}, {481, 159}, {573, 296}, {657, 294}, {728, 344},
+    {770, 357}, {792, 340}, {810, 327}, {832, 343}, {900, 332}, {948, 288},
+    {1034, 280}, {1080, 247}, {1145, 237}, {1158, 224}, {1168, 286}, {1254, 245},
+    {1291, 283}, {1293, 252}, {1380, 211}, {0, 211}, {23, 154}, {40, 53},
+    {156, 195}, {169, 193}, {206, 104}, {286, 101}, {291, 169}, {401, 126},
+    {481, 159}, {573, 296}, {656, 294}, {727, 344}, {771, 357}, {794, 340},
+    {810, 327}, {831, 343}, {900, 332}, {947, 288}, {1027, 259}, {1028, 280},
+    {1079, 247}, {1144, 237}, {1158, 224}, {1171, 286}, {1254, 245}, {1291, 252},
+    {1380, 211}, {0, 211}, {23, 154}, {41, 53}, {161, 195}, {170, 193},
+    {206, 104}, {283, 101}, {293, 169}, {401, 126}, {481, 159}, {573, 296},
+    {656, 294}, {727, 344}, {770, 357}, {794, 340}, {810, 327}, {831, 343},
+    {900, 332}, {947, 288}, {1026, 259}, {1028, 280}, {1079, 247}, {1142, 237},
+    {1158, 224}, {1174, 286}, {1255, 245}, {1290, 252}, {1381, 211}, {0, 211},
+    {23, 154}, {42, 53}, {165, 192}, {222, 104}, {240, 101}, {295, 169},
+    {401, 126}, {481, 159}, {573, 296}, {655, 294}, {726, 344}, {767, 357},
+    {795, 340}, {810, 358}, {815, 327}, {831, 343}, {900, 332}, {946, 288},
+    {1025, 259}, {1029, 280}, {1079, 247}, {1141, 237}, {1158, 224}, {1177, 286},
+    {1255, 245}, {1289, 252}, {1382, 211}, {0, 211}, {23, 154}, {42, 53},
+    {167, 192}, {176, 53}, {179, 192}, {223, 104}, {240, 101}, {296, 169},
+    {401, 126}, {482, 159}, {573, 296}, {655, 294}, {726, 344}, {767, 357},
+    {797, 340}, {809, 358}, {828, 327}, {832, 343}, {900, 332}, {945, 288},
+    {1024, 259}, {1029, 280}, {1079, 247}, {1140, 237}, {1158, 224}, {1179, 286},
+    {1255, 245}, {1289, 252}, {1383, 211}, {0, 211}, {23, 154}, {42, 53},
+    {169, 192}, {172, 53}, {181, 192}, {223, 104}, {240, 101}, {298, 169},
+    {401, 126}, {481, 107}, {482, 159}, {573, 296}, {654, 294}, {725, 344},
+    {766, 357}, {798, 340}, {809, 358}, {832, 343}, {900, 332}, {945, 288},
+    {1023, 259}, {1030, 280}, {1078, 247}, {1138, 237}, {1158, 224}, {1182, 286},
+    {1256, 245}, {1288, 252}, {1381, 242}, {1384, 211}, {0, 211}, {23, 154},
+    {42, 53}, {182, 192}, {223, 104}, {240, 101}, {300, 169}, {401, 126},
+    {476, 107}, {487, 159}, {573, 296}, {654, 294}, {725, 344}, {766, 357},
+    {800, 340}, {808, 358}, {832, 343}, {900, 332}, {944, 288}, {1022, 259},
+    {1030, 280}, {1078, 247}, {1137, 237}, {1158, 224}, {1185, 286}, {1256, 245},
+    {1287, 252}, {1377, 242}, {1387, 211}, {0, 211}, {23, 154}, {42, 53},
+    {184, 192}, {224, 104}, {240, 101}, {302, 169}, {401, 126}, {470, 107},
+    {492, 159}, {573, 296}, {653, 294}, {725, 344}, {765, 357}, {801, 340},
+    {808, 358}, {831, 343}, {900, 332}, {943, 288}, {994, 259}, {1031, 280},
+    {1078, 247}, {1136, 237}, {1158, 224}, {1187, 286}, {1257, 245}, {1286, 252},
+    {1373, 242}, {1389, 211}, {0, 211}, {14, 52}, {26, 154}, {42, 53},
+    {185, 192}, {224, 104}, {240, 101}, {303, 169}, {402, 126}, {465, 107},
+    {497, 159}, {573, 296}, {653, 294}, {724, 344}, {764, 357}, {803, 340},
+    {807, 358}, {831, 343}, {900, 332}, {943, 288}, {994, 259}, {1031, 280},
+    {1078, 247}, {1134, 237}, {1158, 224}, {1190, 286}, {1257, 245}, {1285, 252},
+    {1369, 242}, {1391, 211}, {0, 211}, {5, 52}, {31, 154}, {42, 53},
+    {186, 128}, {187, 192}, {224, 104}, {240, 101}, {305, 169}, {402, 126},
+    {460, 107}, {501, 159}, {573, 296}, {652, 294}, {716, 328}, {724, 344},
+    {765, 357}, {804, 340}, {806, 358}, {830, 343}, {900, 332}, {942, 288},
+    {993, 259}, {1032, 280}, {1077, 247}, {1133, 237}, {1157, 224}, {1192, 286},
+    {1258, 245}, {1285, 252}, {1365, 242}, {1394, 211}, {0, 52}, {35, 154},
+    {42, 53}, {187, 128}, {188, 192}, {225, 104}, {240, 101}, {306, 169},
+    {402, 126}, {456, 107}, {505, 159}, {573, 296}, {652, 294}, {700, 328},
+    {726, 344}, {765, 357}, {804, 348}, {821, 358}, {831, 343}, {900, 332},
+    {942, 288}, {993, 259}, {1032, 280}, {1077, 247}, {1132, 237}, {1157, 224},
+    {1194, 286}, {1258, 245}, {1284, 252}, {1362, 242}, {1396, 211}, {1437, 52},
+    {0, 52}, {39, 154}, {42, 53}, {188, 128}, {190, 192}, {225, 104},
+    {240, 101}, {308, 169}, {402, 126}, {452, 107}, {509, 159}, {573, 296},
+    {651, 294}, {689, 328}, {727, 344}, {766, 357}, {803, 348}, {832, 358},
+    {847, 343}, {892, 332}, {941, 288}, {992, 259}, {1032, 258}, {1035, 280},
+    {1077, 247}, {1131, 237}, {1157, 224}, {1197, 286}, {1258, 245}, {1283, 252},
+    {1359, 242}, {1398, 211}, {1430, 52}, {0, 52}, {42, 53}, {189, 128},
+    {191, 192}, {226, 104}, {240, 101}, {309, 171}, {310, 169}, {402, 126},
+    {448, 107}, {513, 159}, {573, 296}, {651, 294}, {680, 328}, {728, 344},
+    {762, 323}, {766, 357}, {802, 348}, {841, 358}, {846, 343}, {893, 332},
+    {941, 288}, {992, 259}, {1033, 258}, {1037, 280}, {1077, 247}, {1130, 237},
+    {1157, 224}, {1199, 286}, {1259, 245}, {1283, 252}, {1355, 242}, {1400, 211},
+    {1424, 52}, {0, 52}, {42, 53}, {190, 128}, {193, 192}, {227, 104},
+    {236, 97}, {240, 101}, {308, 171}, {314, 169}, {402, 126}, {444, 107},
+    {517, 159}, {573, 296}, {650, 294}, {667, 324}, {677, 328}, {730, 344},
+    {755, 323}, {767, 357}, {800, 348}, {845, 343}, {893, 332}, {940, 288},
+    {991, 259}, {1033, 258}, {1040, 280}, {1077, 247}, {1128, 237}, {1157, 224},
+    {1201, 286}, {1259, 245}, {1282, 252}, {1352, 242}, {1402, 211}, {1418, 52},
+    {0, 52}, {42, 53}, {191, 128}, {194, 192}, {228, 104}, {232, 97},
+    {240, 101}, {307, 171}, {317, 169}, {402, 126}, {440, 107}, {520, 77},
+    {521, 159}, {573, 296}, {650, 294}, {655, 324}, {679, 328}, {730, 311},
+    {732, 344}, {748, 323}, {768, 357}, {799, 348}, {844, 341}, {845, 343},
+    {894, 332}, {939, 288}, {991, 259}, {1033, 258}, {1043, 280}, {1076, 247},
+    {1127, 237}, {1157, 224}, {1203, 286}, {1259, 245}, {1281, 252}, {1349, 242},
+    {1404, 211}, {1413, 52}, {0, 52}, {42, 53}, {192, 145}, {196, 192},
+    {228, 97}, {240, 101}, {305, 171}, {321, 169}, {403, 126}, {436, 107},
+    {518, 77}, {527, 159}, {573, 296}, {649, 324}, {680, 328}, {730, 311},
+    {737, 344}, {742, 323}, {768, 357}, {798, 331}, {801, 348}, {841, 341},
+    {845, 343}, {895, 332}, {939, 288}, {990, 259}, {1033, 258}, {1045, 280},
+    {1076, 247}, {1126, 237}, {1157, 224}, {1199, 286}, {1260, 245}, {1281, 252},
+    {1346, 242}, {1406, 211}, {1408, 52}, {0, 52}, {42, 53}, {193, 145},
+    {197, 192}, {229, 97}, {240, 101}, {304, 171}, {321, 194}, {330, 169},
+    {403, 126}, {433, 107}, {516, 77}, {532, 159}, {573, 296}, {646, 324},
+    {682, 328}, {729, 311}, {741, 323}, {769, 357}, {785, 323}, {788, 331},
+    {803, 348}, {838, 341}, {846, 343}, {895, 360}, {908, 332}, {938, 288},
+    {990, 259}, {1033, 258}, {1048, 280}, {1076, 247}, {1125, 237}, {1157, 224},
+    {1199, 286}, {1260, 245}, {1280, 252}, {1343, 242}, {1407, 52}, {0, 52},
+    {42, 53}, {195, 145}, {198, 192}, {230, 97}, {240, 101}, {303, 171},
+    {321, 194}, {340, 169}, {403, 126}, {430, 107}, {514, 77}, {537, 159},
+    {573, 296}, {644, 324}, {684, 328}, {728, 311}, {742, 323}, {770, 357},
+    {785, 323}, {788, 331}, {805, 348}, {834, 364}, {835, 341}, {847, 343},
+    {894, 360}, {916, 343}, {925, 332}, {938, 288}, {989, 259}, {1033, 258},
+    {1050, 280}, {1076, 247}, {1124, 237}, {1157, 224}, {1199, 286}, {1261, 245},
+    {1279, 252}, {1340, 242}, {1406, 52}, {0, 52}, {42, 53}, {198, 145},
+    {199, 192}, {231, 97}, {240, 101}, {302, 171}, {321, 194}, {348, 169},
+    {403, 126}, {426, 107}, {512, 77}, {542, 159}, {573, 296}, {642, 324},
+    {685, 328}, {728, 311}, {743, 323}, {770, 357}, {783, 323}, {788, 331},
+    {807, 348}, {827, 364}, {834, 341}, {847, 343}, {894, 360}, {914, 343},
+    {931, 332}, {937, 288}, {986, 265}, {989, 259}, {1033, 258}, {1052, 280},
+    {1076, 247}, {1123, 237}, {1157, 224}, {1199, 286}, {1261, 245}, {1279, 252},
+    {1338, 242}, {1406, 52}, {0, 52}, {42, 53}, {200, 192}, {231, 97},
+    {240, 101}, {300, 171}, {321, 194}, {355, 169}, {403, 126}, {423, 107},
+    {510, 77}, {547, 159}, {573, 296}, {640, 324}, {687, 328}, {727, 311},
+    {745, 323}, {770, 357}, {781, 323}, {787, 331}, {809, 348}, {820, 364},
+    {833, 341}, {848, 343}, {894, 360}, {912, 343}, {934, 350}, {937, 288},
+    {982, 265}, {990, 259}, {1033, 258}, {1055, 280}, {1075, 247}, {1122, 237},
+    {1157, 224}, {1199, 286}, {1261, 245}, {1278, 252}, {1335, 242}, {1406, 52},
+    {0, 52}, {42, 53}, {199, 192}, {232, 97}, {240, 101}, {299, 171},
+    {321, 194}, {356, 71}, {384, 169}, {403, 126}, {420, 107}, {508, 77},
+    {551, 159}, {573, 296}, {638, 324}, {688, 328}, {726, 311}, {746, 323},
+    {771, 357}, {779, 323}, {787, 331}, {811, 348}, {814, 364}, {831, 341},
+    {848, 343}, {893, 360}, {911, 343}, {936, 350}, {938, 288}, {978, 265},
+    {990, 259}, {1033, 258}, {1057, 280}, {1072, 257}, {1076, 247}, {1121, 237},
+    {1157, 224}, {1199, 286}, {1262, 245}, {1277, 252}, {1333, 242}, {1406, 52},
+    {0, 52}, {42, 53}, {199, 192}, {233, 97}, {240, 101}, {298, 171},
+    {320, 194}, {356, 71}, {398, 169}, {403, 126}, {417, 107}, {506, 77},
+    {555, 159}, {573, 296}, {636, 324}, {690, 328}, {726, 311}, {748, 323},
+    {787, 331}, {812, 364}, {830, 341}, {849, 343}, {893, 360}, {912, 343},
+    {936, 350}, {940, 288}, {974, 265}, {991, 259}, {996, 209}, {998, 259},
+    {1033, 258}, {1059, 280}, {1068, 257}, {1077, 247}, {1120, 237}, {1156, 224},
+    {1199, 286}, {1259, 285}, {1263, 245}, {1277, 252}, {1330, 242}, {1406, 52},
+    {0, 52}, {42, 53}, {198, 192}, {234, 97}, {240, 101}, {297, 171},
+    {320, 194}, {355, 71}, {404, 126}, {414, 107}, {504, 77}, {559, 159},
+    {573, 296}, {634, 324}, {691, 328}, {725, 311}, {749, 323}, {786, 331},
+    {812, 364}, {829, 341}, {849, 343}, {892, 360}, {913, 343}, {935, 350},
+    {941, 288}, {970, 265}, {992, 209}, {1003, 259}, {1033, 258}, {1061, 280},
+    {1064, 257}, {1079, 247}, {1119, 237}, {1156, 224}, {1199, 286}, {1259, 285},
+    {1270, 245}, {1276, 252}, {1328, 242}, {1406, 52}, {0, 52}, {42, 53},
+    {156, 179}, {171, 53}, {198, 192}, {236, 97}, {240, 101}, {296, 171},
+    {320, 194}, {355, 71}, {406, 126}, {412, 107}, {502, 77}, {559, 181},
+    {565, 159}, {573, 296}, {633, 324}, {692, 328}, {725, 311}, {750, 323},
+    {786, 331}, {812, 364}, {828, 341}, {850, 343}, {892, 360}, {914, 343},
+    {935, 350}, {942, 288}, {966, 265}, {989, 209}, {1004, 259}, {1033, 258},
+    {1062, 257}, {1080, 247}, {1118, 237}, {1156, 224}, {1199, 286}, {1259, 285},
+    {1275, 245}, {1276, 252}, {1325, 242}, {1406, 52}, {0, 52}, {42, 53},
+    {148, 179}, {176, 145}, {194, 53}, {196, 192}, {237, 97}, {240, 101},
+    {295, 171}, {320, 194}, {354, 71}, {408, 126}, {409, 107}, {500, 77},
+    {555, 181}, {572, 159}, {573, 296}, {631, 324}, {694, 328}, {724, 311},
+    {752, 323}, {785, 331}, {812, 364}, {827, 341}, {851, 343}, {892, 360},
+    {916, 343}, {933, 350}, {943, 288}, {963, 265}, {985, 209}, {1004, 259},
+    {1033, 258}, {1061, 257}, {1081, 247}, {1117, 237}, {1156, 224}, {1199, 286},
+    {1259, 285}, {1276, 268}, {1277, 252}, {1323, 242}, {1405, 52}, {0, 52},
+    {42, 53}, {140, 195}, {143, 179}, {175, 145}, {191, 192}, {238, 97},
+    {240, 101}, {294, 171}, {320, 194}, {353, 71}, {409, 107}, {498, 77},
+    {552, 181}, {574, 296}, {629, 324}, {695, 328}, {722, 336}, {725, 311},
+    {753, 323}, {785, 331}, {812, 364}, {826, 341}, {851, 343}, {891, 360},
+    {922, 343}, {931, 350}, {944, 288}, {959, 265}, {980, 209}, {1004, 259},
+    {1033, 258}, {1058, 220}, {1061, 257}, {1082, 247}, {1116, 237}, {1156, 224},
+    {1199, 286}, {1259, 285}, {1277, 268}, {1283, 252}, {1321, 242}, {1405, 52},
+    {0, 52}, {42, 53}, {132, 195}, {142, 179}, {173, 145}, {187, 192},
+    {239, 97}, {240, 101}, {292, 186}, {294, 171}, {319, 194}, {353, 71},
+    {409, 107}, {497, 77}, {549, 181}, {576, 296}, {627, 324}, {697, 328},
+    {720, 336}, {725, 311}, {754, 323}, {774, 316}, {786, 331}, {812, 364},
+    {825, 341}, {852, 343}, {890, 353}, {892, 360}, {920, 350}, {925, 343},
+    {928, 350}, {945, 288}, {956, 265}, {973, 209}, {1005, 259}, {1025, 209},
+    {1026, 259}, {1033, 258}, {1052, 220}, {1061, 257}, {1083, 247}, {1115, 237},
+    {1156, 224}, {1199, 286}, {1258, 285}, {1279, 268}, {1289, 252}, {1318, 242},
+    {1405, 52}, {0, 52}, {42, 53}, {127, 195}, {141, 179}, {171, 145},
+    {188, 192}, {240, 101}, {290, 186}, {294, 171}, {319, 194}, {352, 71},
+    {410, 107}, {495, 77}, {545, 181}, {577, 296}, {626, 324}, {698, 328},
+    {718, 336}, {726, 311}, {755, 323}, {763, 316}, {787, 331}, {812, 364},
+    {824, 341}, {852, 343}, {889, 353}, {896, 360}, {918, 350}, {945, 213},
+    {948, 288}, {953, 265}, {970, 209}, {1012, 259}, {1021, 209}, {1028, 259},
+    {1033, 258}, {1046, 220}, {1061, 257}, {1084, 247}, {1114, 237}, {1156, 224},
+    {1199, 286}, {1258, 285}, {1280, 268}, {1294, 252}, {1316, 242}, {1405, 52},
+    {0, 52}, {42, 53}, {126, 195}, {139, 179}, {170, 145}, {189, 192},
+    {241, 101}, {289, 186}, {294, 171}, {319, 194}, {352, 71}, {410, 190},
+    {411, 107}, {493, 77}, {542, 181}, {579, 296}, {624, 324}, {699, 328},
+    {716, 336}, {726, 311}, {756, 316}, {787, 331}, {812, 364}, {823, 341},
+    {853, 343}, {888, 353}, {900, 360}, {916, 350}, {943, 213}, {952, 265},
+    {969, 209}, {1014, 259}, {1018, 209}, {1029, 259}, {1033, 258}, {1041, 220},
+    {1062, 257}, {1086, 247}, {1113, 237}, {1156, 224}, {1199, 286}, {1258, 285},
+    {1281, 268}, {1299, 252}, {1314, 242}, {1405, 52}, {0, 52}, {42, 53},
+    {126, 195}, {138, 179}, {169, 145}, {190, 192}, {242, 101}, {287, 186},
+    {294, 171}, {319, 194}, {351, 71}, {408, 190}, {412, 107}, {491, 77},
+    {539, 181}, {580, 296}, {622, 324}, {700, 328}, {715, 336}, {727, 311},
+    {756, 316}, {788, 331}, {797, 366}, {813, 364}, {822, 341}, {853, 343},
+    {886, 353}, {903, 360}, {914, 350}, {942, 213}, {953, 265}, {969, 209},
+    {1031, 259}, {1033, 258}, {1036, 220}, {1062, 257}, {1087, 247}, {1112, 237},
+    {1156, 224}, {1199, 286}, {1209, 271}, {1216, 286}, {1257, 285}, {1282, 268},
+    {1304, 252}, {1312, 242}, {1405, 52}, {0, 52}, {42, 53}, {125, 195},
+    {137, 179}, {167, 145}, {191, 192}, {244, 101}, {285, 186}, {294, 171},
+    {319, 194}, {350, 71}, {407, 190}, {414, 107}, {490, 77}, {536, 181},
+    {582, 296}, {621, 324}, {702, 328}, {713, 336}, {727, 311}, {756, 316},
+    {789, 366}, {815, 364}, {821, 341}, {849, 333}, {856, 343}, {885, 353},
+    {907, 360}, {912, 350}, {941, 213}, {955, 265}, {968, 209}, {1032, 259},
+    {1033, 220}, {1062, 257}, {1088, 247}, {1111, 237}, {1156, 224}, {1205, 271},
+    {1220, 286}, {1256, 285}, {1283, 268}, {1308, 252}, {1310, 242}, {1405, 52},
+    {0, 52}, {42, 53}, {125, 195}, {135, 179}, {166, 145}, {192, 192},
+    {245, 101}, {284, 186}, {294, 171}, {318, 194}, {350, 71}, {406, 190},
+    {415, 107}, {488, 77}, {533, 181}, {583, 296}, {619, 324}, {703, 328},
+    {711, 336}, {728, 311}, {756, 316}, {789, 366}, {816, 364}, {820, 341},
+    {846, 333}, {858, 343}, {883, 353}, {910, 360}, {911, 350}, {936, 260},
+    {941, 213}, {956, 265}, {964, 209}, {1033, 220}, {1063, 257}, {1089, 247},
+    {1110, 237}, {1156, 224}, {1205, 271}, {1222, 286}, {1255, 285}, {1283, 268},
+    {1310, 242}, {1405, 52}, {0, 52}, {42, 53}, {124, 195}, {134, 179},
+    {164, 145}, {193, 192}, {246, 101}, {282, 186}, {294, 171}, {318, 194},
+    {349, 71}, {405, 190}, {417, 107}, {487, 77}, {530, 181}, {585, 296},
+    {617, 324}, {704, 328}, {710, 336}, {728, 311}, {756, 316}, {789, 366},
+    {818, 364}, {819, 341}, {842, 333}, {860, 343}, {882, 353}, {911, 350},
+    {931, 260}, {940, 213}, {957, 265}, {963, 209}, {1034, 220}, {1063, 257},
+    {1090, 247}, {1109, 237}, {1156, 224}, {1204, 271}, {1223, 286}, {1254, 285},
+    {1284, 268}, {1311, 242}, {1404, 52}, {0, 52}, {42, 53}, {70, 52},
+    {81, 53}, {124, 195}, {133, 179}, {163, 145}, {194, 192}, {247, 101},
+    {280, 186}, {294, 171}, {318, 194}, {349, 71}, {404, 190}, {418, 107},
+    {485, 77}, {528, 181}, {586, 296}, {616, 324}, {705, 328}, {708, 336},
+    {729, 311}, {757, 316}, {789, 366}, {819, 341}, {839, 333}, {862, 343},
+    {881, 353}, {912, 350}, {926, 260}, {940, 213}, {958, 265}, {963, 209},
+    {1034, 220}, {1063, 257}, {1091, 247}, {1108, 237}, {1156, 224}, {1203, 271},
+    {1224, 286}, {1253, 285}, {1284, 268}, {1312, 242}, {1404, 52}, {0, 52},
+    {42, 53}, {51, 52}, {82, 53}, {124, 195}, {131, 179}, {162, 145},
+    {195, 192}, {248, 101}, {280, 186}, {294, 171}, {318, 194}, {348, 71},
+    {402, 190}, {420, 107}, {483, 77}, {525, 181}, {587, 296}, {614, 324},
+    {706, 336}, {729, 311}, {757, 316}, {789, 366}, {820, 341}, {836, 333},
+    {864, 343}, {879, 353}, {913, 350}, {922, 260}, {939, 213}, {960, 265},
+    {964, 209}, {1035, 220}, {1064, 257}, {1092, 247}, {1108, 237}, {1156, 224},
+    {1202, 271}, {1225, 286}, {1252, 285}, {1285, 268}, {1313, 242}, {1404, 52},
+    {0, 52}, {83, 53}, {123, 195}, {130, 179}, {160, 145}, {196, 192},
+    {249, 101}, {280, 186}, {294, 171}, {318, 194}, {348, 71}, {401, 190},
+    {421, 148}, {424, 107}, {482, 77}, {522, 181}, {588, 65535}, {590, 296},
+    {613, 324}, {706, 336}, {730, 311}, {757, 316}, {789, 366}, {820, 341},
+    {833, 333}, {866, 343}, {878, 353}, {914, 350}, {917, 260}, {939, 213},
+    {961, 265}, {964, 209}, {1036, 220}, {1064, 257}, {1091, 236}, {1098, 247},
+    {1107, 237}, {1156, 224}, {1201, 271}, {1226, 286}, {1251, 285}, {1284, 268},
+    {1314, 242}, {1404, 52}, {0, 52}, {84, 53}, {123, 195}, {129, 179},
+    {159, 145}, {197, 192}, {250, 101}, {280, 186}, {295, 171}, {317, 194},
+    {347, 71}, {400, 190}, {421, 148}, {431, 107}, {480, 77}, {520, 181},
+    {589, 65535}, {595, 296}, {611, 324}, {705, 336}, {729, 318}, {738, 311},
+    {757, 316}, {784, 347}, {789, 366}, {821, 341}, {830, 333}, {867, 343},
+    {877, 353}, {915, 260}, {923, 209}, {931, 260}, {939, 213}, {962, 265},
+    {965, 209}, {1037, 220}, {1064, 257}, {1088, 236}, {1106, 237}, {1155, 224},
+    {1200, 271}, {1227, 286}, {1250, 285}, {1284, 268}, {1315, 242}, {1404, 52},
+    {0, 52}, {84, 53}, {122, 195}, {128, 179}, {158, 145}, {199, 192},
+    {250, 101}, {280, 186}, {295, 171}, {317, 194}, {347, 71}, {399, 190},
+    {465, 107}, {479, 77}, {517, 181}, {589, 65535}, {600, 296}, {610, 324},
+    {702, 326}, {707, 336}, {729, 318}, {744, 311}, {751, 337}, {757, 316},
+    {778, 347}, {790, 366}, {822, 341}, {827, 333}, {869, 343}, {875, 365},
+    {877, 353}, {915, 260}, {916, 209}, {934, 260}, {938, 213}, {963, 265},
+    {966, 209}, {1038, 220}, {1064, 257}, {1084, 236}, {1107, 237}, {1155, 224},
+    {1200, 271}, {1227, 286}, {1249, 285}, {1284, 268}, {1316, 242}, {1404, 52},
+    {0, 52}, {85, 53}, {122, 195}, {127, 179}, {156, 145}, {201, 192},
+    {250, 101}, {280, 186}, {295, 171}, {317, 194}, {346, 71}, {398, 190},
+    {468, 107}, {478, 77}, {515, 181}, {589, 65535}, {606, 296}, {609, 324},
+    {700, 326}, {709, 336}, {728, 318}, {747, 337}, {759, 316}, {772, 347},
+    {791, 366}, {822, 341}, {824, 333}, {871, 343}, {873, 365}, {882, 353},
+    {914, 209}, {937, 260}, {938, 213}, {964, 209}, {1039, 220}, {1065, 257},
+    {1081, 236}, {1108, 237}, {1155, 224}, {1199, 271}, {1228, 286}, {1247, 285},
+    {1283, 268}, {1317, 242}, {1404, 52}, {0, 52}, {86, 53}, {122, 195},
+    {125, 179}, {155, 145}, {202, 192}, {250, 101}, {280, 186}, {295, 171},
+    {317, 194}, {346, 71}, {397, 190}, {470, 107}, {476, 77}, {513, 181},
+    {589, 65535}, {600, 290}, {611, 324}, {697, 326}, {711, 336}, {728, 318},
+    {745, 337}, {760, 316}, {767, 347}, {792, 366}, {822, 333}, {872, 365},
+    {887, 353}, {914, 260}, {915, 209}, {939, 213}, {946, 209}, {958, 213},
+    {961, 209}, {1040, 220}, {1048, 209}, {1053, 220}, {1065, 257}, {1078, 236},
+    {1109, 237}, {1155, 224}, {1198, 271}, {1228, 286}, {1246, 285}, {1283, 268},
+    {1318, 242}, {1404, 52}, {0, 52}, {87, 53}, {121, 195}, {124, 179},
+    {154, 145}, {200, 192}, {251, 101}, {280, 186}, {295, 171}, {317, 194},
+    {345, 71}, {395, 143}, {396, 190}, {472, 107}, {475, 77}, {510, 181},
+    {589, 65535}, {595, 290}, {613, 324}, {695, 326}, {713, 336}, {728, 318},
+    {744, 337}, {761, 316}, {762, 347}, {793, 366}, {822, 333}, {871, 365},
+    {892, 353}, {914, 260}, {915, 209}, {942, 213}, {943, 209}, {1054, 220},
+    {1065, 257}, {1075, 236}, {1110, 237}, {1152, 281}, {1156, 224}, {1198, 271},
+    {1228, 286}, {1245, 285}, {1283, 268}, {1319, 242}, {1403, 52}, {0, 52},
+    {88, 53}, {121, 195}, {123, 179}, {153, 145}, {199, 192}, {251, 101},
+    {280, 186}, {295, 171}, {317, 194}, {345, 71}, {393, 143}, {395, 190},
+    {474, 77}, {508, 181}, {590, 65535}, {591, 290}, {615, 324}, {692, 326},
+    {716, 336}, {726, 345}, {728, 318}, {742, 337}, {761, 347}, {792, 317},
+    {794, 366}, {821, 333}, {871, 365}, {897, 353}, {910, 209}, {1055, 220},
+    {1066, 257}, {1072, 236}, {1111, 237}, {1147, 281}, {1158, 224}, {1197, 271},
+    {1229, 286}, {1244, 285}, {1282, 268}, {1320, 242}, {1403, 52}, {0, 52},
+    {89, 53}, {120, 195}, {122, 179}, {151, 145}, {197, 192}, {251, 101},
+    {280, 186}, {295, 171}, {316, 194}, {344, 71}, {390, 143}, {395, 190},
+    {474, 77}, {506, 181}, {589, 290}, {618, 324}, {690, 326}, {716, 330},
+    {718, 336}, {724, 345}, {731, 318}, {740, 337}, {760, 321}, {761, 347},
+    {790, 317}, {797, 366}, {821, 333}, {871, 365}, {901, 353}, {909, 209},
+    {1057, 220}, {1066, 257}, {1069, 236}, {1111, 237}, {1143, 281}, {1160, 224},
+    {1196, 271}, {1229, 286}, {1244, 285}, {1282, 268}, {1321, 242}, {1403, 52},
+    {0, 52}, {89, 53}, {120, 195}, {121, 179}, {150, 145}, {195, 192},
+    {252, 101}, {280, 186}, {295, 171}, {316, 194}, {344, 71}, {388, 143},
+    {395, 190}, {474, 77}, {504, 181}, {588, 290}, {620, 324}, {687, 326},
+    {714, 330}, {721, 345}, {733, 318}, {739, 337}, {758, 321}, {762, 347},
+    {788, 317}, {799, 320}, {800, 366}, {820, 333}, {870, 365}, {905, 353},
+    {909, 209}, {1060, 220}, {1066, 236}, {1112, 237}, {1139, 281}, {1161, 224},
+    {1194, 271}, {1230, 286}, {1244, 285}, {1282, 268}, {1322, 242}, {1403, 52},
+    {0, 52}, {90, 53}, {120, 179}, {149, 145}, {194, 192}, {252, 101},
+    {280, 186}, {295, 171}, {316, 194}, {343, 71}, {385, 143}, {394, 190},
+    {474, 77}, {502, 181}, {587, 290}, {622, 324}, {685, 326}, {713, 330},
+    {721, 345}, {735, 318}, {737, 337}, {757, 321}, {763, 347}, {786, 363},
+    {788, 317}, {798, 320}, {806, 366}, {820, 333}, {870, 365}, {908, 209},
+    {1065, 236}, {1113, 237}, {1135, 281}, {1163, 224}, {1190, 271}, {1233, 286},
+    {1244, 285}, {1282, 268}, {1323, 242}, {1403, 52}, {0, 52}, {91, 53},
+    {119, 179}, {148, 145}, {192, 192}, {252, 92}, {255, 101}, {280, 186},
+    {295, 171}, {313, 156}, {318, 194}, {343, 71}, {383, 143}, {394, 190},
+    {474, 106}, {475, 77}, {500, 181}, {586, 290}, {624, 324}, {683, 326},
+    {711, 330}, {721, 345}, {737, 337}, {755, 321}, {764, 347}, {784, 363},
+    {788, 317}, {797, 320}, {811, 366}, {819, 322}, {825, 333}, {870, 365},
+    {907, 209}, {1067, 236}, {1114, 237}, {1131, 281}, {1164, 224}, {1188, 271},
+    {1238, 286}, {1244, 285}, {1282, 268}, {1324, 242}, {1403, 52}, {0, 52},
+    {92, 53}, {119, 179}, {147, 145}, {191, 192}, {252, 101}, {253, 92},
+    {255, 101}, {280, 186}, {295, 171}, {310, 156}, {319, 194}, {339, 87},
+    {340, 194}, {342, 71}, {380, 143}, {393, 190}, {474, 106}, {480, 77},
+    {488, 147}, {500, 181}, {585, 290}, {627, 324}, {681, 326}, {710, 330},
+    {721, 345}, {737, 337}, {753, 321}, {765, 347}, {781, 363}, {788, 317},
+    {796, 320}, {816, 366}, {817, 322}, {831, 333}, {870, 365}, {909, 209},
+    {1069, 236}, {1070, 282}, {1071, 236}, {1115, 237}, {1128, 281}, {1166, 224},
+    {1187, 271}, {1239, 286}, {1243, 285}, {1281, 268}, {1325, 242}, {1403, 52},
+    {0, 52}, {93, 53}, {118, 179}, {146, 145}, {189, 192}, {227, 134},
+    {256, 98}, {304, 87}, {341, 194}, {342, 71}, {378, 143}, {393, 190},
+    {471, 106}, {483, 147}, {500, 181}, {585, 290}, {629, 324}, {679, 326},
+    {708, 330}, {720, 345}, {738, 337}, {751, 321}, {765, 361}, {766, 347},
+    {779, 363}, {787, 317}, {796, 320}, {817, 322}, {836, 333}, {867, 354},
+    {870, 365}, {908, 209}, {1068, 282}, {1072, 236}, {1115, 237}, {1124, 281},
+    {1167, 224}, {1186, 271}, {1241, 286}, {1243, 285}, {1281, 268}, {1326, 242},
+    {1403, 52}, {0, 52}, {93, 53}, {117, 179}, {145, 145}, {188, 192},
+    {227, 134}, {256, 98}, {304, 87}, {348, 71}, {376, 143}, {392, 190},
+    {466, 148}, {470, 106}, {483, 147}, {500, 181}, {584, 290}, {631, 324},
+    {676, 326}, {707, 330}, {720, 345}, {738, 337}, {750, 321}, {764, 361},
+    {768, 347}, {777, 363}, {787, 317}, {795, 320}, {817, 322}, {840, 333},
+    {863, 354}, {871, 365}, {907, 209}, {1068, 282}, {1073, 236}, {1116, 237},
+    {1121, 281}, {1168, 224}, {1185, 271}, {1242, 286}, {1243, 285}, {1281, 268},
+    {1327, 242}, {1403, 52}, {0, 52}, {94, 53}, {117, 179}, {143, 145},
+    {186, 192}, {227, 134}, {256, 98}, {304, 87}, {352, 71}, {374, 143},
+    {392, 190}, {463, 148}, {470, 106}, {484, 147}, {501, 181}, {583, 290},
+    {633, 324}, {674, 326}, {705, 330}, {720, 345}, {738, 337}, {748, 321},
+    {762, 361}, {769, 347}, {775, 363}, {787, 317}, {794, 320}, {816, 322},
+    {845, 333}, {859, 354}, {872, 365}, {906, 209}, {1067, 282}, {1074, 236},
+    {1117, 237}, {1118, 281}, {1170, 224}, {1184, 271}, {1244, 285}, {1259, 271},
+    {1260, 285}, {1281, 268}, {1327, 242}, {1402, 52}, {0, 52}, {94, 65535},
+    {98, 53}, {116, 179}, {142, 145}, {185, 192}, {220, 134}, {256, 98},
+    {304, 87}, {356, 71}, {364, 99}, {369, 71}, {371, 143}, {392, 190},
+    {462, 148}, {470, 106}, {484, 147}, {501, 181}, {582, 290}, {635, 324},
+    {672, 326}, {704, 330}, {720, 345}, {739, 337}, {746, 321}, {761, 361},
+    {770, 347}, {773, 363}, {787, 317}, {793, 320}, {816, 322}, {849, 333},
+    {855, 354}, {873, 365}, {907, 209}, {1066, 282}, {1075, 236}, {1117, 281},
+    {1171, 224}, {1183, 271}, {1246, 285}, {1256, 271}, {1258, 285}, {1260, 268},
+    {1261, 285}, {1281, 268}, {1328, 242}, {1402, 52}, {0, 52}, {93, 65535},
+    {107, 53}, {116, 179}, {141, 145}, {183, 192}, {220, 134}, {256, 98},
+    {304, 87}, {361, 99}, {373, 143}, {391, 190}, {447, 148}, {470, 106},
+    {485, 147}, {501, 181}, {581, 290}, {637, 324}, {670, 326}, {702, 330},
+    {720, 345}, {739, 337}, {744, 368}, {748, 321}, {759, 361}, {771, 335},
+    {774, 363}, {787, 317}, {793, 320}, {816, 322}, {852, 354}, {873, 365},
+    {907, 313}, {908, 209}, {1065, 282}, {1077, 236}, {1117, 281}, {1172, 224},
+    {1194, 271}, {1248, 285}, {1252, 271}, {1258, 285}, {1260, 268}, {1262, 285},
+    {1280, 268}, {1329, 242}, {1402, 52}, {0, 52}, {93, 65535}, {116, 179},
+    {140, 145}, {182, 192}, {220, 134}, {257, 98}, {304, 87}, {361, 99},
+    {376, 143}, {391, 190}, {445, 148}, {470, 106}, {485, 147}, {501, 181},
+    {580, 290}, {639, 324}, {668, 326}, {701, 330}, {720, 345}, {740, 337},
+    {742, 368}, {753, 321}, {758, 361}, {770, 335}, {776, 363}, {786, 317},
+    {792, 320}, {816, 322}, {851, 354}, {874, 365}, {905, 313}, {908, 209},
+    {1064, 282}, {1078, 236}, {1117, 281}, {1174, 224}, {1196, 271}, {1257, 285},
+    {1261, 268}, {1263, 285}, {1280, 268}, {1330, 242}, {1402, 52}, {0, 52},
+    {92, 65535}, {118, 179}, {139, 145}, {181, 192}, {220, 134}, {257, 98},
+    {312, 87}, {360, 99}, {378, 143}, {391, 190}, {443, 148}, {470, 106},
+    {486, 147}, {502, 181}, {580, 290}, {640, 324}, {666, 326}, {700, 330},
+    {719, 345}, {740, 368}, {756, 361}, {770, 335}, {779, 363}, {786, 317},
+    {791, 320}, {816, 322}, {851, 354}, {875, 365}, {904, 313}, {908, 209},
+    {1063, 282}, {1080, 236}, {1117, 281}, {1175, 224}, {1198, 271}, {1257, 285},
+    {1262, 268}, {1265, 285}, {1279, 268}, {1331, 242}, {1402, 52}, {0, 52},
+    {91, 65535}, {120, 179}, {138, 145}, {179, 192}, {220, 134}, {259, 98},
+    {312, 87}, {359, 99}, {379, 143}, {390, 190}, {442, 148}, {470, 106},
+    {486, 147}, {502, 181}, {579, 290}, {642, 324}, {665, 326}, {698, 330},
+    {719, 345}, {740, 368}, {756, 361}, {769, 335}, {782, 363}, {786, 317},
+    {790, 320}, {815, 319}, {818, 322}, {850, 354}, {876, 365}, {903, 313},
+    {907, 209}, {1052, 282}, {1056, 209}, {1062, 282}, {1081, 236}, {1117, 281},
+    {1176, 224}, {1199, 271}, {1256, 285}, {1263, 268}, {1266, 285}, {1278, 268},
+    {1332, 242}, {1402, 52}, {0, 52}, {90, 65535}, {122, 179}, {137, 145},
+    {178, 192}, {220, 134}, {260, 98}, {314, 87}, {358, 99}, {381, 143},
+    {390, 190}, {441, 148}, {470, 106}, {487, 147}, {502, 181}, {578, 290},
+    {644, 324}, {663, 326}, {697, 330}, {719, 345}, {739, 368}, {755, 361},
+    {769, 335}, {782, 367}, {788, 317}, {790, 320}, {811, 315}, {815, 319},
+    {821, 322}, {849, 354}, {877, 365}, {901, 313}, {907, 209}, {922, 215},
+    {929, 209}, {1051, 282}, {1082, 236}, {1117, 281}, {1178, 224}, {1199, 271},
+    {1256, 285}, {1264, 268}, {1268, 285}, {1277, 268}, {1332, 242}, {1402, 52},
+    {0, 52}, {90, 65535}, {124, 179}, {136, 145}, {177, 192}, {220, 134},
+    {261, 98}, {315, 87}, {358, 99}, {382, 143}, {389, 190}, {440, 148},
+    {470, 106}, {487, 147}, {503, 181}, {577, 290}, {646, 324}, {661, 326},
+    {696, 330}, {719, 345}, {739, 368}, {755, 361}, {768, 335}, {782, 367},
+    {790, 320}, {807, 315}, {814, 319}, {823, 322}, {848, 354}, {877, 365},
+    {900, 313}, {907, 209}, {919, 313}, {920, 215}, {932, 209}, {1051, 282},
+    {1082, 236}, {1117, 281}, {1179, 224}, {1192, 271}, {1255, 285}, {1264, 268},
+    {1270, 285}, {1276, 268}, {1333, 242}, {1402, 52}, {0, 52}, {89, 65535},
+    {127, 179}, {135, 145}, {175, 192}, {220, 134}, {262, 98}, {318, 87},
+    {359, 143}, {360, 99}, {364, 143}, {368, 99}, {383, 143}, {389, 190},
+    {440, 148}, {470, 106}, {488, 147}, {503, 181}, {576, 290}, {647, 334},
+    {662, 326}, {695, 330}, {719, 345}, {738, 368}, {754, 361}, {768, 335},
+    {782, 367}, {791, 320}, {803, 315}, {814, 319}, {825, 322}, {847, 354},
+    {878, 365}, {899, 313}, {921, 215}, {932, 209}, {1050, 282}, {1083, 236},
+    {1117, 281}, {1180, 224}, {1187, 271}, {1255, 285}, {1265, 268}, {1271, 285},
+    {1275, 268}, {1334, 242}, {1402, 52}, {0, 52}, {88, 65535}, {129, 179},
+    {134, 145}, {174, 192}, {220, 134}, {262, 98}, {318, 87}, {363, 143},
+    {371, 99}, {385, 143}, {389, 190}, {439, 148}, {471, 106}, {488, 147},
+    {503, 181}, {576, 290}, {647, 334}, {666, 326}, {693, 330}, {719, 345},
+    {738, 368}, {754, 361}, {767, 335}, {781, 367}, {792, 320}, {799, 315},
+    {814, 319}, {827, 322}, {846, 354}, {879, 365}, {897, 313}, {921, 215},
+    {932, 209}, {1049, 282}, {1083, 236}, {1117, 281}, {1181, 224}, {1184, 271},
+    {1254, 285}, {1266, 268}, {1273, 285}, {1274, 268}, {1335, 242}, {1402, 52},
+    {0, 52}, {87, 65535}, {131, 179}, {133, 145}, {173, 192}, {220, 134},
+    {262, 98}, {318, 87}, {367, 143}, {371, 99}, {387, 143}, {388, 190},
+    {439, 148}, {468, 114}, {471, 106}, {489, 147}, {504, 181}, {575, 290},
+    {647, 334}, {670, 326}, {692, 330}, {719, 345}, {736, 342}, {742, 368},
+    {753, 361}, {767, 335}, {781, 367}, {794, 320}, {795, 315}, {814, 319},
+    {829, 322}, {846, 354}, {880, 365}, {896, 313}, {920, 212}, {924, 215},
+    {932, 209}, {1049, 282}, {1083, 236}, {1117, 281}, {1182, 271}, {1254, 285},
+    {1267, 268}, {1336, 242}, {1401, 52}, {0, 52}, {86, 65535}, {134, 145},
+    {172, 192}, {220, 134}, {262, 98}, {318, 87}, {368, 143}, {371, 99},
+    {388, 190}, {437, 148}, {466, 114}, {472, 106}, {489, 147}, {504, 181},
+    {574, 290}, {647, 334}, {674, 326}, {691, 330}, {716, 312}, {731, 345},
+    {734, 342}, {750, 368}, {753, 361}, {765, 351}, {768, 335}, {781, 367},
+    {794, 315}, {814, 319}, {831, 322}, {845, 354}, {880, 365}, {895, 313},
+    {918, 212}, {927, 215}, {932, 209}, {1050, 282}, {1084, 236}, {1117, 281},
+    {1180, 271}, {1253, 285}, {1267, 268}, {1336, 242}, {1401, 52}, {0, 52},
+    {85, 65535}, {135, 145}, {170, 192}, {220, 134}, {253, 80}, {263, 98},
+    {318, 87}, {369, 143}, {371, 87}, {372, 99}, {390, 190}, {436, 148},
+    {463, 114}, {473, 106}, {490, 147}, {504, 181}, {573, 290}, {647, 334},
+    {678, 326}, {690, 330}, {712, 312}, {734, 342}, {754, 361}, {763, 351},
+    {771, 335}, {780, 367}, {792, 352}, {794, 315}, {814, 319}, {832, 322},
+    {844, 354}, {881, 365}, {893, 313}, {916, 212}, {930, 215}, {932, 209},
+    {951, 215}, {954, 266}, {955, 209}, {1050, 282}, {1086, 236}, {1117, 281},
+    {1179, 271}, {1253, 285}, {1268, 268}, {1337, 242}, {1401, 52}, {0, 52},
+    {84, 65535}, {137, 145}, {169, 192}, {220, 134}, {253, 80}, {265, 98},
+    {318, 87}, {369, 143}, {370, 87}, {372, 99}, {390, 190}, {435, 148},
+    {461, 114}, {474, 106}, {490, 147}, {504, 181}, {572, 290}, {647, 334},
+    {682, 338}, {689, 330}, {709, 312}, {735, 342}, {758, 361}, {760, 351},
+    {773, 335}, {780, 367}, {791, 352}, {795, 315}, {813, 319}, {834, 322},
+    {843, 354}, {882, 365}, {888, 276}, {893, 313}, {915, 212}, {927, 209},
+    {946, 215}, {954, 266}, {957, 209}, {1048, 282}, {1090, 236}, {1117, 281},
+    {1177, 271}, {1246, 285}, {1269, 268}, {1338, 242}, {1401, 52}, {0, 52},
+    {83, 65535}, {139, 145}, {168, 192}, {220, 134}, {253, 80}, {267, 98},
+    {317, 87}, {372, 99}, {390, 190}, {425, 153}, {435, 148}, {458, 114},
+    {475, 106}, {491, 147}, {505, 181}, {572, 290}, {647, 334}, {682, 338},
+    {704, 330}, {705, 312}, {735, 342}, {759, 351}, {775, 335}, {780, 367},
+    {789, 352}, {796, 315}, {813, 319}, {836, 322}, {842, 354}, {882, 276},
+    {896, 313}, {913, 212}, {923, 209}, {944, 215}, {954, 266}, {959, 209},
+    {1040, 282}, {1094, 236}, {1117, 281}, {1168, 271}, {1244, 285}, {1269, 268},
+    {1339, 242}, {1401, 52}, {0, 52}, {82, 65535}, {141, 145}, {167, 192},
+    {220, 134}, {253, 80}, {268, 98}, {316, 87}, {372, 99}, {391, 190},
+    {424, 153}, {436, 148}, {456, 114}, {476, 106}, {491, 147}, {505, 181},
+    {571, 290}, {648, 334}, {683, 338}, {706, 312}, {735, 342}, {759, 351},
+    {777, 335}, {779, 367}, {788, 352}, {797, 315}, {813, 356}, {814, 319},
+    {838, 322}, {842, 354}, {881, 276}, {899, 313}, {911, 212}, {922, 209},
+    {944, 215}, {953, 266}, {961, 209}, {1041, 282}, {1097, 236}, {1117, 281},
+    {1168, 271}, {1244, 285}, {1270, 268}, {1339, 242}, {1401, 52}, {0, 52},
+    {81, 65535}, {143, 145}, {166, 192}, {220, 134}, {249, 80}, {276, 98},
+    {316, 87}, {372, 99}, {391, 190}, {422, 153}, {438, 148}, {454, 114},
+    {476, 106}, {492, 147}, {505, 181}, {570, 290}, {648, 334}, {683, 338},
+    {707, 312}, {736, 342}, {760, 351}, {779, 367}, {786, 352}, {798, 315},
+    {811, 356}, {815, 319}, {840, 322}, {841, 354}, {881, 276}, {902, 313},
+    {910, 212}, {922, 209}, {944, 215}, {953, 266}, {963, 209}, {1041, 282},
+    {1101, 236}, {1117, 281}, {1168, 271}, {1244, 285}, {1271, 268}, {1340, 242},
+    {1401, 52}, {0, 52}, {79, 65535}, {145, 145}, {164, 192}, {220, 134},
+    {247, 80}, {276, 98}, {316, 87}, {372, 99}, {392, 190}, {421, 153},
+    {439, 148}, {451, 114}, {477, 106}, {492, 147}, {506, 181}, {570, 290},
+    {648, 334}, {684, 338}, {708, 312}, {736, 342}, {760, 351}, {780, 367},
+    {784, 352}, {799, 315}, {810, 356}, {816, 319}, {841, 354}, {880, 276},
+    {905, 313}, {908, 212}, {923, 209}, {944, 215}, {953, 266}, {966, 209},
+    {1042, 282}, {1102, 271}, {1103, 236}, {1117, 281}, {1167, 271}, {1244, 285},
+    {1272, 268}, {1341, 242}, {1401, 52}, {0, 52}, {78, 65535}, {148, 145},
+    {163, 192}, {220, 134}, {247, 80}, {276, 98}, {316, 87}, {372, 99},
+    {393, 190}, {420, 153}, {440, 148}, {449, 114}, {478, 106}, {493, 147},
+    {506, 181}, {569, 290}, {648, 334}, {685, 338}, {708, 312}, {737, 342},
+    {760, 351}, {781, 367}, {783, 352}, {800, 315}, {808, 356}, {817, 319},
+    {841, 354}, {879, 276}, {907, 212}, {924, 209}, {944, 212}, {947, 215},
+    {952, 266}, {968, 209}, {1042, 282}, {1103, 271}, {1104, 236}, {1117, 281},
+    {1167, 271}, {1244, 285}, {1272, 268}, {1341, 242}, {1401, 52}, {0, 52},
+    {77, 65535}, {150, 145}, {162, 192}, {220, 134}, {247, 80}, {276, 98},
+    {316, 87}, {372, 99}, {393, 190}, {419, 153}, {441, 148}, {447, 114},
+    {479, 106}, {493, 147}, {506, 181}, {568, 290}, {648, 334}, {685, 338},
+    {709, 312}, {737, 342}, {760, 351}, {782, 352}, {800, 315}, {807, 356},
+    {818, 319}, {838, 329}, {842, 354}, {879, 276}, {908, 212}, {924, 209},
+    {944, 212}, {949, 215}, {952, 266}, {971, 209}, {1042, 282}, {1104, 271},
+    {1105, 236}, {1117, 281}, {1167, 271}, {1245, 285}, {1273, 268}, {1342, 242},
+    {1401, 52}, {0, 52}, {76, 65535}, {153, 145}, {161, 192}, {220, 134},
+    {247, 80}, {276, 98}, {316, 87}, {372, 99}, {394, 190}, {418, 153},
+    {442, 148}, {445, 114}, {480, 106}, {493, 147}, {506, 181}, {567, 290},
+    {648, 334}, {684, 338}, {713, 312}, {737, 342}, {760, 351}, {782, 352},
+    {798, 346}, {803, 355}, {807, 356}, {820, 319}, {836, 329}, {844, 354},
+    {878, 276}, {909, 212}, {925, 209}, {944, 212}, {951, 214}, {953, 266},
+    {974, 209}, {1041, 282}, {1104, 271}, {1106, 236}, {1117, 281}, {1165, 271},
+    {1245, 285}, {1274, 268}, {1343, 242}, {1401, 52}, {0, 52}, {74, 65535},
+    {156, 145}, {160, 192}, {220, 134}, {247, 80}, {276, 98}, {316, 87},
+    {372, 99}, {395, 190}, {417, 153}, {443, 114}, {480, 106}, {494, 147},
+    {507, 181}, {567, 290}, {648, 334}, {683, 338}, {716, 312}, {738, 342},
+    {760, 351}, {782, 352}, {795, 346}, {803, 355}, {807, 356}, {821, 319},
+    {834, 329}, {845, 354}, {878, 276}, {910, 212}, {925, 209}, {944, 212},
+    {949, 214}, {955, 266}, {979, 209}, {1014, 222}, {1019, 209}, {1041, 282},
+    {1105, 271}, {1107, 236}, {1117, 281}, {1163, 271}, {1245, 285}, {1274, 268},
+    {1343, 242}, {1400, 52}, {0, 52}, {73, 65535}, {159, 192}, {219, 80},
+    {220, 134}, {247, 80}, {276, 98}, {315, 87}, {372, 99}, {395, 190},
+    {416, 153}, {444, 114}, {481, 106}, {494, 147}, {507, 181}, {566, 290},
+    {648, 334}, {683, 338}, {718, 312}, {738, 342}, {760, 362}, {770, 349},
+    {782, 352}, {792, 346}, {802, 355}, {808, 356}, {822, 319}, {832, 329},
+    {847, 354}, {877, 276}, {911, 212}, {926, 209}, {944, 212}, {948, 214},
+    {957, 266}, {984, 209}, {1006, 222}, {1023, 209}, {1041, 282}, {1106, 271},
+    {1108, 236}, {1117, 281}, {1162, 271}, {1239, 285}, {1240, 271}, {1244, 285},
+    {1275, 268}, {1344, 242}, {1400, 52}, {0, 52}, {71, 65535}, {160, 192},
+    {218, 80}, {220, 134}, {247, 80}, {276, 98}, {315, 87}, {372, 99},
+    {396, 190}, {415, 153}, {445, 114}, {482, 106}, {495, 147}, {507, 181},
+    {565, 290}, {648, 334}, {683, 338}, {723, 312}, {738, 342}, {759, 362},
+    {770, 349}, {782, 352}, {789, 346}, {802, 355}, {809, 356}, {823, 319},
+    {829, 329}, {848, 354}, {877, 276}, {912, 212}, {927, 209}, {944, 212},
+    {946, 214}, {958, 266}, {985, 209}, {1003, 275}, {1007, 222}, {1024, 209},
+    {1041, 282}, {1106, 271}, {1118, 281}, {1160, 271}, {1237, 285}, {1241, 271},
+    {1243, 285}, {1276, 268}, {1345, 242}, {1400, 52}, {0, 52}, {70, 65535},
+    {161, 192}, {217, 80}, {220, 134}, {247, 80}, {276, 98}, {315, 87},
+    {372, 99}, {397, 190}, {414, 153}, {445, 114}, {483, 106}, {495, 147},
+    {507, 181}, {565, 290}, {649, 334}, {684, 338}, {733, 312}, {739, 342},
+    {759, 362}, {770, 349}, {783, 352}, {786, 346}, {802, 355}, {809, 356},
+    {824, 319}, {827, 329}, {849, 354}, {876, 276}, {912, 218}, {925, 212},
+    {928, 209}, {944, 214}, {960, 266}, {985, 209}, {1003, 275}, {1007, 222},
+    {1024, 209}, {1041, 282}, {1105, 271}, {1124, 281}, {1148, 271}, {1235, 285},
+    {1276, 268}, {1345, 242}, {1400, 52}, {0, 52}, {68, 65535}, {162, 192},
+    {215, 80}, {220, 134}, {247, 80}, {276, 98}, {315, 87}, {372, 99},
+    {397, 190}, {413, 153}, {446, 114}, {484, 106}, {496, 147}, {508, 181},
+    {564, 290}, {649, 334}, {684, 338}, {733, 312}, {739, 342}, {758, 362},
+    {770, 349}, {783, 346}, {801, 355}, {810, 356}, {825, 329}, {851, 354},
+    {875, 276}, {911, 218}, {929, 209}, {944, 214}, {962, 266}, {982, 269},
+    {984, 275}, {986, 209}, {1001, 275}, {1008, 222}, {1024, 209}, {1040, 282},
+    {1104, 271}, {1129, 281}, {1145, 271}, {1233, 285}, {1277, 268}, {1346, 242},
+    {1400, 52}, {0, 52}, {66, 65535}, {163, 192}, {214, 80}, {220, 134},
+    {264, 98}, {315, 87}, {373, 99}, {398, 190}, {412, 153}, {447, 114},
+    {484, 106}, {496, 147}, {508, 181}, {563, 290}, {649, 334}, {689, 338},
+    {733, 312}, {740, 342}, {757, 362}, {770, 349}, {784, 346}, {798, 359},
+    {802, 355}, {811, 356}, {825, 329}, {862, 354}, {875, 276}, {911, 218},
+    {934, 209}, {944, 214}, {964, 266}, {975, 269}, {986, 209}, {1000, 275},
+    {1008, 222}, {1024, 209}, {1038, 282}, {1103, 271}, {1134, 281}, {1143, 271},
+    {1231, 285}, {1277, 268}, {1347, 242}, {1400, 52}, {0, 52}, {65, 65535},
+    {164, 192}, {213, 80}, {220, 134}, {264, 98}, {315, 87}, {374, 117},
+    {381, 99}, {399, 190}, {411, 153}, {447, 114}, {485, 106}, {496, 147},
+    {508, 181}, {563, 290}, {649, 334}, {690, 338}, {732, 312}, {740, 342},
+    {757, 362}, {770, 349}, {784, 346}, {795, 359}, {803, 355}, {811, 356},
+    {824, 329}, {864, 354}, {874, 276}, {910, 218}, {937, 209}, {944, 214},
+    {966, 266}, {969, 269}, {987, 275}, {988, 209}, {998, 275}, {1009, 222},
+    {1025, 209}, {1036, 282}, {1103, 271}, {1139, 281}, {1140, 271}, {1228, 263},
+    {1233, 285}, {1278, 268}, {1347, 242}, {1397, 65535}, {1402, 52}, {0, 52},
+    {63, 65535}, {165, 192}, {211, 80}, {220, 134}, {264, 98}, {315, 87},
+    {374, 117}, {381, 118}, {382, 99}, {399, 190}, {410, 153}, {448, 114},
+    {486, 106}, {497, 147}, {508, 181}, {562, 290}, {649, 334}, {690, 338},
+    {730, 312}, {740, 342}, {756, 362}, {770, 349}, {784, 346}, {791, 359},
+    {803, 355}, {812, 356}, {824, 329}, {865, 354}, {874, 289}, {881, 276},
+    {884, 329}, {892, 276}, {910, 218}, {939, 209}, {944, 214}, {967, 269},
+    {988, 275}, {989, 209}, {996, 275}, {1009, 222}, {1025, 209}, {1034, 282},
+    {1102, 271}, {1226, 263}, {1234, 285}, {1277, 279}, {1283, 268}, {1348, 242},
+    {1395, 65535}, {1404, 52}, {0, 52}, {61, 65535}, {166, 192}, {210, 80},
+    {220, 134}, {264, 98}, {315, 87}, {372, 117}, {381, 124}, {382, 99},
+    {400, 190}, {409, 153}, {449, 114}, {486, 106}, {497, 147}, {509, 181},
+    {561, 290}, {649, 334}, {691, 338}, {729, 312}, {741, 342}, {755, 362},
+    {769, 349}, {784, 346}, {788, 359}, {804, 355}, {813, 356}, {823, 329},
+    {869, 354}, {873, 289}, {881, 329}, {894, 276}, {910, 218}, {940, 214},
+    {967, 269}, {989, 275}, {991, 209}, {993, 275}, {1010, 222}, {1025, 209},
+    {1033, 282}, {1101, 271}, {1224, 263}, {1235, 285}, {1275, 279}, {1290, 268},
+    {1349, 242}, {1392, 65535}, {1406, 52}, {0, 52}, {59, 65535}, {168, 192},
+    {209, 80}, {220, 134}, {264, 98}, {315, 87}, {372, 117}, {381, 124},
+    {383, 99}, {401, 190}, {408, 153}, {449, 114}, {487, 106}, {498, 147},
+    {509, 181}, {561, 290}, {649, 334}, {692, 338}, {727, 312}, {741, 342},
+    {755, 362}, {769, 349}, {784, 346}, {785, 359}, {805, 355}, {813, 356},
+    {823, 329}, {894, 289}, {901, 276}, {909, 218}, {940, 214}, {967, 269},
+    {990, 275}, {1010, 222}, {1025, 209}, {1031, 282}, {1100, 271}, {1222, 263},
+    {1236, 285}, {1274, 279}, {1296, 268}, {1349, 242}, {1389, 65535}, {1408, 52},
+    {0, 52}, {56, 65535}, {169, 192}, {207, 80}, {220, 134}, {264, 98},
+    {315, 87}, {370, 117}, {384, 99}, {401, 190}, {407, 153}, {450, 114},
+    {488, 106}, {498, 147}, {509, 181}, {560, 290}, {649, 334}, {692, 338},
+    {726, 312}, {741, 342}, {754, 362}, {769, 349}, {784, 359}, {805, 355},
+    {814, 356}, {822, 329}, {894, 289}, {909, 218}, {939, 214}, {968, 269},
+    {992, 275}, {1011, 222}, {1026, 209}, {1028, 282}, {1099, 271}, {1203, 263},
+    {1206, 271}, {1221, 263}, {1237, 285}, {1272, 279}, {1301, 268}, {1350, 242},
+    {1386, 65535}, {1410, 52}, {0, 52}, {54, 65535}, {170, 192}, {206, 80},
+    {220, 134}, {264, 98}, {315, 87}, {370, 117}, {385, 122}, {386, 99},
+    {402, 190}, {406, 153}, {451, 114}, {489, 106}, {499, 147}, {509, 181},
+    {559, 290}, {649, 334}, {693, 338}, {724, 312}, {742, 342}, {754, 362},
+    {769, 349}, {784, 359}, {806, 355}, {815, 356}, {819, 314}, {822, 329},
+    {895, 289}, {909, 218}, {939, 214}, {968, 269}, {993, 275}, {1011, 222},
+    {1019, 282}, {1098, 271}, {1201, 263}, {1208, 271}, {1219, 263}, {1239, 285},
+    {1270, 279}, {1306, 268}, {1351, 242}, {1382, 65535}, {1413, 52}, {0, 52},
+    {51, 65535}, {172, 192}, {205, 80}, {220, 134}, {264, 98}, {315, 87},
+    {370, 117}, {383, 122}, {389, 99}, {402, 190}, {405, 153}, {451, 114},
+    {489, 106}, {499, 147}, {510, 181}, {559, 290}, {650, 334}, {693, 338},
+    {723, 312}, {742, 342}, {753, 362}, {769, 349}, {784, 359}, {807, 355},
+    {812, 314}, {823, 329}, {895, 289}, {909, 218}, {938, 214}, {968, 269},
+    {994, 275}, {1012, 222}, {1016, 282}, {1098, 271}, {1200, 263}, {1207, 271},
+    {1218, 263}, {1240, 285}, {1268, 279}, {1311, 268}, {1351, 242}, {1378, 65535},
+    {1415, 52}, {0, 401}, {30, 52}, {49, 65535}, {173, 192}, {204, 80},
+    {220, 134}, {264, 98}, {314, 87}, {370, 117}, {381, 122}, {392, 99},
+    {403, 190}, {405, 153}, {452, 114}, {490, 106}, {499, 147}, {510, 181},
+    {558, 290}, {650, 334}, {692, 338}, {722, 312}, {735, 3}, {745, 342},
+    {749, 50}, {757, 362}, {769, 349}, {784, 359}, {808, 355}, {809, 314},
+    {824, 329}, {897, 289}, {909, 218}, {938, 214}, {969, 269}, {994, 230},
+    {999, 275}, {1012, 222}, {1016, 282}, {1097, 271}, {1198, 263}, {1207, 271},
+    {1217, 263}, {1239, 270}, {1241, 285}, {1267, 279}, {1316, 268}, {1352, 242},
+    {1372, 65535}, {1418, 401}, {0, 401}, {44, 52}, {46, 65535}, {175, 192},
+    {201, 134}, {216, 80}, {221, 134}, {264, 98}, {314, 87}, {370, 117},
+    {381, 122}, {394, 99}, {404, 153}, {453, 114}, {491, 106}, {500, 147},
+    {510, 181}, {558, 290}, {650, 334}, {690, 338}, {721, 312}, {729, 3},
+    {746, 50}, {761, 362}, {769, 349}, {784, 359}, {807, 314}, {825, 329},
+    {899, 289}, {909, 218}, {937, 214}, {969, 269}, {993, 230}, {1007, 275},
+    {1013, 222}, {1015, 282}, {1096, 271}, {1196, 263}, {1207, 271}, {1214, 263},
+    {1236, 270}, {1243, 285}, {1265, 279}, {1320, 268}, {1352, 242}, {1364, 65535},
+    {1416, 401}, {0, 401}, {47, 65535}, {176, 192}, {198, 134}, {264, 98},
+    {314, 87}, {370, 117}, {381, 122}, {397, 99}, {403, 153}, {453, 114},
+    {491, 106}, {500, 147}, {510, 181}, {557, 290}, {650, 334}, {691, 338},
+    {721, 312}, {723, 3}, {746, 50}, {765, 362}, {769, 349}, {783, 359},
+    {806, 314}, {826, 329}, {897, 277}, {900, 289}, {909, 218}, {937, 214},
+    {969, 269}, {992, 230}, {1014, 222}, {1015, 282}, {1095, 271}, {1194, 263},
+    {1206, 271}, {1211, 263}, {1234, 270}, {1245, 285}, {1264, 279}, {1325, 268},
+    {1352, 65535}, {1414, 401}, {0, 401}, {49, 65535}, {178, 192}, {194, 134},
+    {264, 98}, {314, 87}, {370, 117}, {381, 122}, {400, 99}, {403, 153},
+    {454, 114}, {492, 106}, {500, 147}, {511, 181}, {556, 290}, {650, 334},
+    {692, 338}, {721, 3}, {746, 50}, {769, 349}, {779, 339}, {785, 359},
+    {804, 314}, {827, 329}, {897, 277}, {901, 289}, {909, 277}, {913, 218},
+    {937, 214}, {970, 269}, {991, 230}, {1015, 282}, {1094, 271}, {1192, 263},
+    {1206, 271}, {1208, 263}, {1232, 270}, {1247, 285}, {1262, 279}, {1329, 268},
+    {1351, 65535}, {1412, 401}, {0, 401}, {50, 65535}, {180, 192}, {191, 134},
+    {264, 98}, {314, 87}, {369, 123}, {370, 117}, {380, 122}, {403, 153},
+    {454, 114}, {493, 106}, {501, 147}, {511, 181}, {556, 290}, {649, 295},
+    {651, 334}, {692, 338}, {720, 3}, {746, 50}, {772, 349}, {774, 339},
+    {787, 359}, {803, 314}, {828, 329}, {897, 277}, {913, 218}, {936, 214},
+    {970, 269}, {990, 230}, {1015, 282}, {1093, 271}, {1193, 263}, {1230, 270},
+    {1249, 285}, {1260, 279}, {1332, 268}, {1350, 65535}, {1411, 401}, {0, 401},
+    {52, 65535}, {181, 192}, {187, 134}, {264, 98}, {314, 87}, {369, 123},
+    {370, 117}, {379, 122}, {403, 153}, {455, 114}, {493, 106}, {501, 147},
+    {511, 181}, {555, 290}, {648, 295}, {653, 334}, {691, 338}, {720, 3},
+    {746, 50}, {772, 339}, {788, 359}, {801, 314}, {828, 329}, {897, 277},
+    {915, 218}, {935, 277}, {936, 214}, {971, 269}, {989, 230}, {1015, 282},
+    {1091, 271}, {1193, 263}, {1228, 270}, {1250, 285}, {1259, 279}, {1336, 268},
+    {1349, 65535}, {1409, 401}, {0, 401}, {53, 65535}, {183, 192}, {184, 134},
+    {264, 98}, {314, 87}, {371, 117}, {377, 129}, {379, 122}, {403, 153},
+    {454, 291}, {469, 114}, {494, 106}, {502, 147}, {511, 181}, {555, 290},
+    {647, 295}, {654, 334}, {691, 338}, {719, 3}, {746, 50}, {772, 339},
+    {790, 359}, {800, 314}, {828, 329}, {897, 277}, {916, 218}, {930, 277},
+    {936, 214}, {971, 269}, {989, 230}, {1018, 222}, {1020, 282}, {1089, 271},
+    {1194, 263}, {1226, 270}, {1252, 285}, {1257, 279}, {1340, 268}, {1347, 65535},
+    {1408, 401}, {0, 401}, {54, 65535}, {183, 134}, {264, 98}, {314, 87},
+    {374, 117}, {375, 119}, {376, 129}, {380, 122}, {404, 153}, {453, 291},
+    {481, 114}, {495, 106}, {502, 147}, {512, 181}, {554, 290}, {646, 295},
+    {655, 334}, {692, 338}, {718, 3}, {746, 50}, {772, 339}, {792, 359},
+    {799, 314}, {829, 329}, {897, 277}, {916, 218}, {925, 277}, {937, 214},
+    {943, 277}, {947, 214}, {971, 269}, {988, 230}, {1019, 222}, {1020, 282},
+    {1087, 271}, {1195, 263}, {1224, 270}, {1254, 285}, {1256, 279}, {1343, 268},
+    {1346, 65535}, {1407, 401}, {0, 401}, {55, 65535}, {183, 134}, {264, 98},
+    {314, 87}, {375, 129}, {381, 122}, {385, 130}, {404, 153}, {451, 291},
+    {490, 114}, {495, 106}, {502, 147}, {512, 181}, {553, 290}, {645, 295},
+    {657, 334}, {691, 338}, {717, 3}, {746, 50}, {771, 339}, {793, 359},
+    {797, 314}, {829, 329}, {898, 277}, {916, 218}, {920, 277}, {937, 214},
+    {940, 277}, {950, 214}, {972, 269}, {987, 230}, {1020, 282}, {1085, 271},
+    {1196, 263}, {1222, 270}, {1255, 279}, {1345, 65535}, {1406, 401}, {0, 401},
+    {57, 65535}, {183, 134}, {264, 98}, {312, 87}, {376, 129}, {380, 130},
+    {405, 153}, {450, 291}, {497, 106}, {503, 147}, {512, 181}, {553, 290},
+    {644, 295}, {658, 334}, {690, 338}, {716, 3}, {746, 50}, {771, 339},
+    {795, 359}, {796, 314}, {829, 329}, {898, 277}, {954, 214}, {972, 269},
+    {986, 230}, {1020, 282}, {1083, 271}, {1202, 263}, {1220, 270}, {1255, 279},
+    {1346, 65535}, {1404, 401}, {0, 401}, {58, 65535}, {183, 134}, {264, 98},
+    {312, 87}, {378, 130}, {405, 153}, {448, 291}, {501, 106}, {503, 147},
+    {512, 181}, {552, 290}, {643, 295}, {659, 334}, {690, 338}, {715, 3},
+    {746, 50}, {771, 339}, {796, 314}, {830, 329}, {898, 277}, {957, 214},
+    {972, 269}, {985, 230}, {1020, 282}, {1081, 271}, {1210, 263}, {1219, 270},
+    {1254, 279}, {1346, 65535}, {1403, 401}, {0, 401}, {59, 65535}, {182, 134},
+    {264, 98}, {312, 87}, {379, 130}, {406, 153}, {447, 291}, {504, 147},
+    {512, 181}, {552, 290}, {642, 295}, {661, 334}, {690, 325}, {691, 338},
+    {714, 325}, {715, 3}, {746, 50}, {770, 339}, {796, 314}, {831, 329},
+    {885, 289}, {899, 277}, {959, 214}, {972, 269}, {984, 230}, {1021, 282},
+    {1078, 271}, {1209, 263}, {1217, 270}, {1254, 279}, {1346, 65535}, {1402, 401},
+    {0, 401}, {60, 65535}, {182, 134}, {264, 163}, {274, 98}, {308, 87},
+    {380, 130}, {406, 153}, {445, 291}, {506, 147}, {513, 181}, {551, 290},
+    {641, 295}, {662, 334}, {689, 325}, {692, 338}, {713, 325}, {715, 3},
+    {746, 50}, {770, 339}, {796, 314}, {833, 329}, {875, 226}, {881, 289},
+    {900, 277}, {960, 214}, {973, 269}, {983, 230}, {1012, 243}, {1022, 282},
+    {1075, 271}, {1207, 263}, {1215, 270}, {1254, 279}, {1346, 65535}, {1401, 401},
+    {0, 401}, {61, 65535}, {182, 134}, {264, 163}, {274, 98}, {308, 87},
+    {380, 130}, {407, 153}, {444, 291}, {509, 147}, {513, 181}, {550, 290},
+    {640, 295}, {663, 334}, {688, 325}, {693, 338}, {712, 325}, {715, 3},
+    {746, 50}, {770, 339}, {797, 314}, {834, 256}, {835, 329}, {857, 231},
+    {860, 329}, {867, 231}, {869, 221}, {872, 226}, {882, 216}, {901, 277},
+    {962, 214}, {973, 269}, {983, 230}, {1001, 241}, {1010, 243}, {1023, 241},
+    {1024, 282}, {1072, 271}, {1206, 263}, {1213, 270}, {1254, 279}, {1346, 65535},
+    {1401, 401}, {0, 401}, {61, 65535}, {182, 134}, {264, 163}, {274, 98},
+    {308, 87}, {380, 130}, {407, 153}, {442, 291}, {511, 147}, {513, 181},
+    {550, 290}, {639, 295}, {664, 334}, {687, 325}, {694, 338}, {707, 325},
+    {715, 3}, {746, 50}, {769, 339}, {797, 314}, {834, 256}, {837, 329},
+    {845, 256}, {850, 329}, {856, 231}, {862, 329}, {866, 231}, {868, 221},
+    {871, 226}, {882, 216}, {901, 277}, {965, 214}, {973, 269}, {982, 230},
+    {986, 241}, {1009, 243}, {1025, 282}, {1069, 271}, {1205, 263}, {1211, 270},
+    {1253, 279}, {1346, 65535}, {1400, 401}, {0, 401}, {62, 65535}, {182, 134},
+    {262, 163}, {274, 98}, {276, 163}, {280, 98}, {308, 87}, {380, 130},
+    {408, 153}, {441, 291}, {513, 181}, {548, 65535}, {550, 290}, {638, 295},
+    {665, 334}, {685, 13}, {686, 325}, {695, 338}, {701, 325}, {704, 14},
+    {716, 3}, {746, 50}, {769, 339}, {797, 314}, {834, 256}, {855, 231},
+    {863, 329}, {866, 231}, {867, 221}, {871, 226}, {882, 216}, {901, 277},
+    {965, 214}, {974, 269}, {980, 241}, {1007, 243}, {1026, 241}, {1027, 282},
+    {1056, 271}, {1203, 263}, {1210, 270}, {1253, 279}, {1346, 65535}, {1399, 401},
+    {0, 401}, {63, 65535}, {182, 134}, {261, 163}, {275, 98}, {276, 163},
+    {280, 98}, {308, 87}, {380, 130}, {409, 153}, {439, 291}, {515, 181},
+    {545, 65535}, {551, 290}, {638, 295}, {667, 334}, {681, 13}, {687, 325},
+    {693, 14}, {716, 3}, {746, 50}, {769, 339}, {798, 314}, {833, 256},
+    {855, 231}, {864, 329}, {866, 221}, {870, 226}, {882, 216}, {902, 277},
+    {965, 214}, {974, 269}, {977, 241}, {1006, 243}, {1027, 241}, {1029, 282},
+    {1039, 271}, {1206, 263}, {1208, 270}, {1253, 279}, {1345, 65535}, {1398, 401},
+    {0, 401}, {64, 65535}, {182, 134}, {261, 163}, {275, 98}, {276, 163},
+    {280, 98}, {308, 87}, {379, 130}, {409, 153}, {438, 291}, {517, 181},
+    {543, 65535}, {551, 290}, {637, 295}, {668, 334}, {676, 13}, {689, 14},
+    {716, 3}, {746, 50}, {769, 339}, {798, 314}, {833, 256}, {855, 231},
+    {864, 221}, {869, 226}, {882, 216}, {902, 277}, {965, 214}, {974, 241},
+    {1006, 243}, {1027, 241}, {1030, 282}, {1034, 271}, {1208, 270}, {1253, 279},
+    {1345, 65535}, {1397, 401}, {0, 401}, {64, 65535}, {182, 134}, {261, 163},
+    {280, 98}, {308, 87}, {379, 130}, {410, 153}, {437, 291}, {518, 181},
+    {540, 65535}, {551, 290}, {636, 295}, {669, 334}, {672, 13}, {691, 14},
+    {716, 3}, {746, 50}, {768, 339}, {798, 314}, {832, 256}, {855, 231},
+    {863, 221}, {868, 226}, {882, 216}, {902, 277}, {964, 214}, {974, 241},
+    {1006, 243}, {1026, 246}, {1031, 271}, {1210, 270}, {1252, 279}, {1345, 65535},
+    {1397, 401}, {0, 401}, {65, 65535}, {182, 134}, {261, 163}, {284, 98},
+    {308, 87}, {378, 130}, {410, 153}, {435, 291}, {520, 181}, {537, 65535},
+    {552, 290}, {635, 295}, {670, 13}, {692, 14}, {716, 3}, {746, 50},
+    {768, 339}, {799, 314}, {832, 256}, {855, 231}, {862, 221}, {868, 226},
+    {882, 216}, {902, 277}, {964, 214}, {973, 241}, {1006, 243}, {1026, 246},
+    {1032, 271}, {1212, 270}, {1252, 279}, {1345, 65535}, {1396, 401}, {0, 401},
+    {66, 65535}, {182, 134}, {262, 163}, {284, 98}, {308, 87}, {378, 130},
+    {411, 153}, {434, 291}, {522, 181}, {533, 65535}, {552, 290}, {634, 295},
+    {670, 13}, {694, 14}, {716, 3}, {746, 50}, {767, 49}, {769, 339},
+    {799, 314}, {831, 256}, {854, 231}, {861, 221}, {867, 226}, {882, 216},
+    {903, 277}, {964, 214}, {973, 241}, {1006, 243}, {1025, 246}, {1033, 271},
+    {1213, 270}, {1252, 279}, {1345, 65535}, {1395, 401}, {0, 401}, {66, 65535},
+    {79, 394}, {98, 65535}, {182, 134}, {261, 98}, {263, 163}, {284, 98},
+    {308, 87}, {378, 130}, {411, 153}, {433, 291}, {523, 181}, {529, 65535},
+    {552, 290}, {633, 295}, {670, 13}, {695, 14}, {717, 3}, {746, 50},
+    {765, 49}, {772, 339}, {799, 314}, {831, 256}, {854, 231}, {859, 221},
+    {866, 226}, {882, 216}, {903, 277}, {963, 214}, {972, 241}, {1005, 243},
+    {1022, 246}, {1033, 271}, {1215, 270}, {1252, 279}, {1345, 65535}, {1395, 401},
+    {0, 401}, {67, 65535}, {73, 394}, {104, 65535}, {182, 134}, {261, 98},
+    {263, 163}, {284, 98}, {308, 87}, {378, 130}, {412, 153}, {431, 291},
+    {525, 65535}, {553, 290}, {632, 295}, {670, 13}, {696, 14}, {717, 3},
+    {747, 50}, {763, 49}, {776, 339}, {800, 314}, {831, 256}, {854, 231},
+    {858, 221}, {866, 226}, {882, 216}, {902, 277}, {963, 214}, {972, 241},
+    {1005, 243}, {1020, 246}, {1035, 271}, {1217, 270}, {1252, 279}, {1345, 65535},
+    {1394, 401}, {0, 401}, {67, 65535}, {70, 394}, {108, 65535}, {182, 134},
+    {261, 98}, {263, 163}, {284, 98}, {308, 87}, {378, 130}, {412, 153},
+    {430, 291}, {525, 65535}, {553, 290}, {632, 295}, {670, 13}, {698, 14},
+    {717, 3}, {747, 50}, {761, 49}, {779, 339}, {800, 314}, {830, 256},
+    {854, 231}, {857, 221}, {865, 226}, {882, 216}, {902, 277}, {962, 214},
+    {971, 241}, {1004, 243}, {1018, 246}, {1036, 271}, {1218, 270}, {1251, 279},
+    {1344, 65535}, {1394, 401}, {0, 401}, {67, 394}, {111, 65535}, {182, 134},
+    {261, 98}, {263, 163}, {284, 98}, {308, 87}, {378, 130}, {413, 153},
+    {429, 291}, {525, 65535}, {554, 290}, {631, 295}, {671, 13}, {699, 14},
+    {717, 3}, {747, 50}, {759, 49}, {782, 339}, {800, 314}, {829, 12},
+    {830, 256}, {854, 231}, {856, 221}, {864, 226}, {881, 216}, {902, 277},
+    {962, 214}, {971, 241}, {1000, 243}, {1017, 246}, {1036, 271}, {1220, 270},
+    {1251, 279}, {1344, 65535}, {1393, 401}, {0, 401}, {67, 394}, {113, 65535},
+    {182, 134}, {261, 98}, {262, 163}, {284, 98}, {308, 87}, {379, 130},
+    {413, 153}, {428, 291}, {525, 65535}, {554, 290}, {630, 295}, {671, 13},
+    {701, 14}, {717, 3}, {747, 50}, {758, 49}, {785, 339}, {801, 314},
+    {828, 12}, {834, 256}, {854, 231}, {855, 221}, {863, 226}, {881, 216},
+    {903, 277}, {963, 214}, {970, 241}, {1000, 243}, {1016, 246}, {1036, 271},
+    {1222, 270}, {1251, 279}, {1344, 65535}, {1393, 401}, {0, 401}, {66, 394},
+    {116, 65535}, {182, 134}, {261, 98}, {262, 163}, {284, 98}, {308, 87},
+    {379, 130}, {414, 153}, {426, 291}, {525, 65535}, {555, 290}, {629, 295},
+    {671, 13}, {702, 14}, {717, 3}, {747, 50}, {756, 49}, {788, 339},
+    {801, 314}, {826, 12}, {838, 256}, {854, 221}, {863, 226}, {881, 216},
+    {903, 277}, {964, 214}, {970, 241}, {1000, 243}, {1016, 246}, {1035, 271},
+    {1223, 270}, {1251, 279}, {1344, 65535}, {1392, 401}, {0, 401}, {66, 394},
+    {118, 65535}, {182, 134}, {261, 98}, {262, 163}, {284, 98}, {308, 87},
+    {379, 130}, {414, 153}, {425, 291}, {525, 65535}, {555, 290}, {628, 295},
+    {671, 13}, {703, 14}, {717, 3}, {747, 50}, {754, 49}, {791, 339},
+    {801, 314}, {825, 12}, {842, 256}, {852, 232}, {854, 221}, {862, 226},
+    {881, 216}, {905, 277}, {963, 214}, {970, 241}, {1000, 243}, {1017, 246},
+    {1035, 271}, {1225, 270}, {1251, 279}, {1343, 65535}, {1392, 401}, {0, 401},
+    {65, 394}, {120, 65535}, {183, 134}, {261, 163}, {284, 98}, {308, 87},
+    {379, 130}, {413, 152}, {418, 153}, {424, 291}, {525, 65535}, {556, 290},
+    {627, 295}, {671, 13}, {705, 14}, {718, 3}, {747, 50}, {752, 49},
+    {794, 339}, {802, 314}, {823, 12}, {845, 256}, {847, 232}, {857, 240},
+    {860, 221}, {861, 226}, {881, 216}, {907, 277}, {963, 214}, {969, 241},
+    {1000, 243}, {1017, 246}, {1036, 271}, {1227, 270}, {1250, 279}, {1343, 65535},
+    {1392, 401}, {0, 401}, {65, 394}, {122, 65535}, {183, 134}, {257, 189},
+    {261, 163}, {284, 98}, {308, 87}, {379, 130}, {411, 152}, {423, 291},
+    {525, 65535}, {556, 290}, {627, 295}, {671, 13}, {706, 14}, {718, 3},
+    {747, 50}, {751, 49}, {797, 339}, {802, 314}, {822, 12}, {847, 232},
+    {857, 240}, {861, 210}, {867, 226}, {881, 216}, {909, 277}, {963, 214},
+    {969, 241}, {999, 243}, {1018, 246}, {1037, 271}, {1228, 270}, {1250, 279},
+    {1343, 65535}, {1378, 416}, {1392, 401}, {0, 401}, {64, 394}, {123, 65535},
+    {183, 134}, {243, 189}, {246, 134}, {250, 189}, {262, 163}, {284, 98},
+    {308, 87}, {379, 130}, {409, 152}, {424, 291}, {525, 65535}, {557, 290},
+    {626, 295}, {671, 13}, {707, 14}, {718, 3}, {747, 50}, {749, 49},
+    {800, 339}, {802, 314}, {821, 12}, {847, 232}, {858, 240}, {862, 210},
+    {872, 226}, {881, 216}, {910, 277}, {963, 214}, {968, 241}, {998, 243},
+    {1018, 246}, {1037, 271}, {1230, 270}, {1250, 279}, {1342, 65535}, {1372, 416},
+    {1393, 401}, {0, 401}, {64, 394}, {125, 65535}, {183, 134}, {241, 189},
+    {247, 134}, {249, 189}, {263, 163}, {284, 98}, {308, 87}, {379, 130},
+    {406, 152}, {425, 291}, {525, 65535}, {557, 290}, {625, 295}, {672, 13},
+    {709, 14}, {718, 3}, {747, 49}, {802, 339}, {803, 314}, {819, 12},
+    {848, 232}, {858, 240}, {862, 210}, {878, 226}, {881, 216}, {910, 277},
+    {963, 214}, {968, 241}, {998, 243}, {1018, 246}, {1037, 271}, {1231, 270},
+    {1250, 279}, {1342, 65535}, {1368, 416}, {1393, 401}, {0, 401}, {63, 394},
+    {126, 65535}, {184, 134}, {240, 189}, {263, 163}, {284, 98}, {300, 87},
+    {379, 130}, {404, 152}, {425, 291}, {525, 65535}, {558, 290}, {624, 295},
+    {672, 13}, {710, 14}, {718, 3}, {746, 49}, {803, 314}, {818, 12},
+    {849, 232}, {859, 240}, {862, 210}, {881, 216}, {908, 250}, {910, 277},
+    {963, 214}, {967, 241}, {997, 243}, {1018, 246}, {1037, 271}, {1233, 270},
+    {1249, 279}, {1341, 65535}, {1365, 416}, {1394, 401}, {0, 401}, {63, 394},
+    {127, 65535}, {184, 134}, {238, 189}, {263, 163}, {284, 98}, {287, 89},
+    {295, 98}, {300, 87}, {380, 130}, {402, 152}, {426, 291}, {524, 65535},
+    {559, 290}, {623, 295}, {672, 13}, {711, 14}, {718, 3}, {746, 49},
+    {804, 314}, {816, 12}, {849, 232}, {859, 233}, {861, 240}, {863, 210},
+    {882, 216}, {907, 250}, {910, 277}, {963, 214}, {967, 241}, {992, 243},
+    {1018, 246}, {1036, 271}, {1234, 270}, {1249, 279}, {1341, 65535}, {1362, 416},
+    {1395, 401}, {0, 401}, {62, 394}, {129, 65535}, {184, 134}, {236, 189},
+    {263, 163}, {284, 98}, {287, 89}, {296, 98}, {300, 87}, {380, 130},
+    {400, 152}, {427, 291}, {524, 65535}, {560, 290}, {623, 295}, {672, 13},
+    {713, 14}, {719, 3}, {745, 49}, {805, 314}, {815, 12}, {850, 232},
+    {859, 233}, {863, 210}, {882, 216}, {905, 250}, {911, 277}, {963, 214},
+    {966, 241}, {990, 243}, {1018, 246}, {1036, 271}, {1236, 270}, {1249, 279},
+    {1340, 65535}, {1360, 416}, {1396, 401}, {0, 401}, {62, 394}, {130, 65535},
+    {185, 134}, {235, 189}, {264, 163}, {271, 116}, {283, 89}, {298, 98},
+    {300, 87}, {380, 130}, {398, 152}, {428, 291}, {524, 65535}, {560, 290},
+    {622, 295}, {669, 292}, {671, 20}, {674, 13}, {714, 14}, {719, 3},
+    {745, 49}, {805, 314}, {814, 12}, {851, 232}, {859, 233}, {864, 210},
+    {882, 216}, {904, 250}, {911, 277}, {962, 214}, {964, 277}, {967, 241},
+    {988, 243}, {1018, 246}, {1036, 271}, {1237, 270}, {1249, 279}, {1340, 65535},
+    {1358, 416}, {1397, 401}, {0, 401}, {61, 394}, {131, 65535}, {185, 134},
+    {233, 189}, {264, 163}, {266, 116}, {284, 89}, {299, 98}, {300, 87},
+    {380, 130}, {395, 152}, {429, 291}, {524, 65535}, {561, 290}, {621, 295},
+    {664, 292}, {670, 20}, {675, 13}, {715, 14}, {719, 3}, {744, 49},
+    {806, 314}, {812, 12}, {851, 232}, {859, 233}, {864, 210}, {882, 216},
+    {902, 250}, {912, 277}, {967, 241}, {987, 243}, {1017, 246}, {1037, 271},
+    {1239, 270}, {1249, 279}, {1339, 65535}, {1356, 416}, {1397, 401}, {0, 401},
+    {61, 394}, {132, 65535}, {185, 134}, {232, 189}, {264, 116}, {284, 89},
+    {298, 160}, {300, 87}, {380, 130}, {393, 152}, {429, 291}, {524, 65535},
+    {562, 290}, {620, 295}, {660, 292}, {670, 20}, {677, 13}, {717, 14},
+    {719, 3}, {744, 49}, {807, 314}, {811, 12}, {852, 232}, {859, 233},
+    {865, 210}, {882, 216}, {901, 250}, {914, 277}, {967, 241}, {986, 243},
+    {1016, 246}, {1040, 271}, {1240, 270}, {1248, 279}, {1339, 65535}, {1354, 416},
+    {1398, 401}, {0, 401}, {60, 394}, {133, 65535}, {186, 134}, {230, 189},
+    {263, 116}, {285, 89}, {297, 160}, {301, 87}, {380, 130}, {391, 152},
+    {430, 291}, {523, 65535}, {563, 290}, {619, 295}, {656, 292}, {669, 20},
+    {678, 13}, {718, 14}, {719, 3}, {743, 49}, {807, 314}, {810, 12},
+    {852, 232}, {859, 233}, {866, 210}, {883, 216}, {899, 250}, {916, 277},
+    {967, 243}, {974, 241}, {986, 243}, {1016, 246}, {1043, 271}, {1242, 270},
+    {1248, 279}, {1338, 65535}, {1353, 416}, {1399, 401}, {0, 401}, {60, 394},
+    {134, 65535}, {186, 134}, {229, 189}, {262, 116}, {286, 89}, {293, 88},
+    {296, 160}, {301, 87}, {380, 130}, {389, 152}, {431, 291}, {523, 65535},
+    {564, 290}, {619, 295}, {652, 292}, {668, 20}, {680, 13}, {719, 3},
+    {743, 49}, {808, 12}, {853, 232}, {860, 233}, {866, 210}, {883, 216},
+    {898, 250}, {918, 277}, {967, 243}, {981, 241}, {985, 243}, {1015, 246},
+    {1044, 244}, {1045, 271}, {1243, 270}, {1248, 279}, {1338, 65535}, {1351, 416},
+    {1400, 401}, {0, 401}, {59, 394}, {135, 65535}, {187, 134}, {227, 189},
+    {261, 116}, {286, 88}, {297, 160}, {301, 98}, {302, 87}, {379, 130},
+    {383, 115}, {389, 152}, {432, 291}, {523, 65535}, {565, 290}, {618, 295},
+    {648, 292}, {668, 20}, {681, 13}, {720, 3}, {742, 49}, {808, 12},
+    {854, 232}, {860, 233}, {867, 210}, {883, 216}, {896, 250}, {919, 277},
+    {967, 243}, {1014, 246}, {1043, 244}, {1047, 271}, {1244, 270}, {1248, 279},
+    {1337, 65535}, {1350, 416}, {1400, 401}, {0, 401}, {59, 394}, {136, 65535},
+    {187, 134}, {225, 189}, {261, 116}, {286, 88}, {297, 160}, {302, 87},
+    {378, 115}, {390, 152}, {432, 291}, {523, 65535}, {566, 290}, {617, 295},
+    {644, 292}, {667, 20}, {683, 13}, {720, 3}, {742, 49}, {808, 12},
+    {854, 232}, {860, 233}, {868, 210}, {883, 216}, {895, 250}, {921, 277},
+    {969, 243}, {1013, 246}, {1042, 244}, {1049, 271}, {1246, 270}, {1248, 279},
+    {1336, 65535}, {1348, 416}, {1401, 401}, {0, 401}, {58, 394}, {136, 65535},
+    {188, 134}, {224, 189}, {260, 116}, {286, 88}, {298, 160}, {304, 87},
+    {375, 115}, {390, 152}, {433, 291}, {522, 65535}, {567, 290}, {616, 295},
+    {640, 292}, {667, 20}, {685, 13}, {720, 3}, {741, 49}, {807, 12},
+    {855, 232}, {860, 233}, {868, 210}, {884, 216}, {893, 250}, {922, 277},
+    {970, 243}, {1012, 246}, {1041, 244}, {1051, 271}, {1103, 246}, {1104, 271},
+    {1247, 279}, {1336, 65535}, {1347, 416}, {1402, 401}, {0, 401}, {58, 394},
+    {137, 65535}, {188, 134}, {222, 189}, {259, 116}, {286, 88}, {299, 160},
+    {306, 87}, {310, 160}, {317, 87}, {370, 115}, {391, 152}, {434, 291},
+    {522, 65535}, {568, 290}, {616, 295}, {637, 292}, {666, 20}, {686, 13},
+    {721, 3}, {741, 49}, {807, 12}, {855, 232}, {860, 233}, {869, 210},
+    {884, 216}, {892, 250}, {923, 277}, {970, 243}, {1012, 246}, {1041, 244},
+    {1054, 271}, {1098, 246}, {1105, 271}, {1248, 279}, {1335, 65535}, {1346, 416},
+    {1403, 401}, {0, 401}, {57, 394}, {138, 65535}, {189, 134}, {221, 189},
+    {258, 116}, {286, 88}, {300, 160}, {317, 149}, {318, 87}, {366, 115},
+    {391, 152}, {435, 291}, {522, 65535}, {569, 290}, {615, 295}, {633, 292},
+    {666, 20}, {687, 13}, {721, 3}, {740, 49}, {807, 12}, {856, 232},
+    {860, 233}, {870, 210}, {884, 216}, {890, 250}, {923, 217}, {924, 277},
+    {969, 243}, {1011, 246}, {1040, 244}, {1057, 271}, {1096, 246}, {1106, 271},
+    {1248, 279}, {1334, 65535}, {1345, 416}, {1404, 401}, {0, 401}, {57, 394},
+    {139, 65535}, {189, 134}, {219, 189}, {258, 116}, {286, 88}, {300, 160},
+    {316, 149}, {319, 87}, {362, 144}, {366, 83}, {367, 115}, {392, 152},
+    {436, 291}, {521, 65535}, {570, 290}, {614, 295}, {630, 292}, {665, 20},
+    {689, 13}, {721, 3}, {740, 49}, {807, 12}, {857, 232}, {860, 233},
+    {870, 210}, {884, 216}, {889, 250}, {922, 217}, {925, 277}, {969, 243},
+    {1010, 246}, {1041, 244}, {1060, 271}, {1095, 246}, {1108, 271}, {1248, 279},
+    {1333, 65535}, {1344, 416}, {1404, 401}, {0, 401}, {57, 394}, {139, 65535},
+    {190, 134}, {218, 189}, {257, 116}, {286, 88}, {301, 160}, {314, 149},
+    {319, 87}, {359, 141}, {361, 144}, {366, 83}, {367, 115}, {392, 152},
+    {436, 291}, {521, 65535}, {571, 290}, {614, 295}, {627, 292}, {664, 20},
+    {690, 13}, {722, 3}, {739, 49}, {807, 12}, {857, 232}, {860, 233},
+    {871, 210}, {884, 216}, {888, 250}, {920, 217}, {926, 277}, {968, 243},
+    {1008, 246}, {1043, 244}, {1062, 271}, {1094, 246}, {1109, 271}, {1111, 278},
+    {1113, 271}, {1249, 279}, {1333, 65535}, {1343, 416}, {1405, 401}, {0, 401},
+    {56, 394}, {140, 65535}, {190, 134}, {217, 189}, {256, 116}, {286, 88},
+    {302, 160}, {313, 149}, {320, 87}, {356, 141}, {360, 144}, {366, 83},
+    {368, 115}, {393, 152}, {437, 291}, {520, 65535}, {572, 290}, {613, 295},
+    {624, 292}, {664, 20}, {692, 13}, {722, 3}, {739, 49}, {806, 12},
+    {858, 232}, {860, 233}, {872, 210}, {885, 216}, {886, 250}, {919, 217},
+    {926, 277}, {968, 243}, {1005, 246}, {1046, 244}, {1064, 271}, {1075, 246},
+    {1078, 278}, {1081, 271}, {1093, 246}, {1109, 278}, {1114, 271}, {1205, 274},
+    {1217, 271}, {1249, 279}, {1332, 65535}, {1342, 416}, {1406, 401}, {0, 401},
+    {56, 394}, {140, 65535}, {191, 134}, {215, 189}, {255, 116}, {285, 88},
+    {303, 160}, {312, 149}, {321, 87}, {354, 141}, {360, 144}, {366, 83},
+    {369, 115}, {393, 152}, {436, 108}, {439, 291}, {520, 65535}, {574, 290},
+    {612, 295}, {620, 292}, {663, 20}, {693, 13}, {723, 3}, {738, 49},
+    {806, 12}, {858, 232}, {860, 233}, {872, 210}, {884, 267}, {891, 250},
+    {917, 217}, {927, 277}, {968, 243}, {1003, 246}, {1048, 244}, {1073, 246},
+    {1076, 278}, {1086, 246}, {1087, 271}, {1089, 246}, {1109, 278}, {1114, 271},
+    {1204, 274}, {1243, 271}, {1249, 279}, {1331, 65535}, {1341, 416}, {1406, 401},
+    {0, 401}, {55, 394}, {141, 65535}, {192, 134}, {214, 189}, {255, 116},
+    {285, 88}, {303, 160}, {311, 149}, {322, 87}, {351, 141}, {359, 144},
+    {366, 83}, {369, 115}, {394, 152}, {436, 108}, {441, 291}, {519, 65535},
+    {575, 290}, {611, 295}, {617, 292}, {663, 20}, {695, 13}, {723, 3},
+    {738, 49}, {806, 12}, {859, 232}, {860, 233}, {873, 210}, {883, 267},
+    {897, 250}, {916, 217}, {928, 277}, {967, 243}, {1002, 246}, {1051, 244},
+    {1073, 246}, {1076, 278}, {1087, 246}, {1107, 278}, {1115, 271}, {1203, 274},
+    {1250, 279}, {1330, 65535}, {1340, 416}, {1407, 401}, {0, 401}, {55, 394},
+    {141, 65535}, {192, 134}, {212, 189}, {254, 116}, {285, 88}, {304, 160},
+    {309, 149}, {323, 87}, {348, 141}, {358, 144}, {366, 83}, {370, 115},
+    {394, 152}, {435, 108}, {444, 291}, {519, 65535}, {576, 290}, {611, 295},
+    {614, 292}, {662, 20}, {696, 13}, {723, 3}, {737, 49}, {806, 12},
+    {859, 232}, {860, 233}, {873, 210}, {882, 267}, {902, 250}, {914, 217},
+    {930, 277}, {967, 243}, {1002, 246}, {1053, 244}, {1073, 246}, {1075, 278},
+    {1088, 246}, {1105, 278}, {1115, 271}, {1203, 274}, {1251, 279}, {1329, 65535},
+    {1339, 416}, {1408, 401}, {0, 401}, {54, 394}, {142, 65535}, {193, 134},
+    {211, 189}, {253, 116}, {285, 88}, {305, 160}, {308, 149}, {324, 87},
+    {346, 141}, {357, 144}, {366, 83}, {370, 115}, {395, 152}, {434, 108},
+    {446, 291}, {518, 65535}, {578, 290}, {610, 295}, {611, 292}, {662, 20},
+    {697, 13}, {724, 3}, {737, 49}, {806, 12}, {860, 233}, {874, 210},
+    {882, 267}, {907, 250}, {913, 217}, {932, 277}, {944, 229}, {946, 277},
+    {967, 243}, {1001, 246}, {1057, 244}, {1073, 246}, {1075, 278}, {1088, 246},
+    {1104, 278}, {1115, 271}, {1202, 274}, {1251, 279}, {1325, 412}, {1330, 65535},
+    {1339, 416}, {1409, 401}, {0, 401}, {54, 394}, {142, 65535}, {194, 134},
+    {210, 189}, {253, 116}, {285, 88}, {305, 160}, {307, 149}, {324, 141},
+    {325, 87}, {343, 141}, {356, 144}, {366, 83}, {371, 115}, {395, 152},
+    {433, 108}, {448, 291}, {518, 65535}, {579, 290}, {609, 292}, {661, 20},
+    {699, 13}, {724, 3}, {736, 49}, {805, 12}, {861, 233}, {875, 210},
+    {881, 267}, {911, 250}, {912, 217}, {930, 264}, {934, 277}, {939, 229},
+    {949, 277}, {969, 243}, {1000, 246}, {1059, 244}, {1072, 246}, {1076, 278},
+    {1088, 246}, {1103, 278}, {1115, 271}, {1202, 274}, {1252, 279}, {1319, 412},
+    {1332, 65535}, {1338, 416}, {1409, 401}, {0, 401}, {53, 394}, {143, 65535},
+    {195, 134}, {208, 189}, {252, 116}, {285, 88}, {306, 149}, {324, 141},
+    {326, 87}, {341, 141}, {356, 144}, {366, 83}, {372, 115}, {396, 152},
+    {433, 108}, {450, 291}, {517, 65535}, {581, 290}, {608, 292}, {661, 20},
+    {700, 13}, {724, 3}, {736, 49}, {805, 12}, {861, 233}, {875, 210},
+    {880, 267}, {912, 217}, {929, 264}, {934, 229}, {950, 277}, {971, 243},
+    {999, 246}, {1063, 244}, {1072, 246}, {1101, 278}, {1110, 227}, {1115, 271},
+    {1201, 274}, {1253, 279}, {1314, 412}, {1334, 65535}, {1337, 416}, {1410, 401},
+    {0, 401}, {53, 394}, {143, 65535}, {196, 134}, {207, 189}, {251, 116},
+    {285, 88}, {305, 149}, {324, 141}, {328, 87}, {338, 141}, {355, 144},
+    {366, 83}, {372, 115}, {396, 152}, {432, 108}, {452, 291}, {517, 65535},
+    {583, 290}, {607, 292}, {660, 20}, {702, 13}, {725, 3}, {735, 49},
+    {805, 12}, {861, 233}, {876, 210}, {879, 267}, {913, 217}, {927, 264},
+    {934, 229}, {951, 277}, {970, 243}, {999, 246}, {1067, 244}, {1072, 227},
+    {1074, 246}, {1101, 227}, {1115, 271}, {1200, 274}, {1253, 279}, {1309, 412},
+    {1335, 65535}, {1337, 416}, {1411, 401}, {0, 401}, {52, 394}, {144, 65535},
+    {197, 134}, {205, 189}, {250, 116}, {285, 88}, {305, 149}, {324, 141},
+    {329, 87}, {335, 141}, {354, 144}, {366, 83}, {373, 115}, {397, 152},
+    {431, 108}, {454, 291}, {516, 65535}, {585, 290}, {606, 292}, {660, 20},
+    {703, 13}, {725, 3}, {735, 49}, {805, 12}, {862, 233}, {877, 210},
+    {878, 267}, {913, 217}, {926, 264}, {934, 229}, {952, 277}, {970, 243},
+    {1000, 246}, {1072, 227}, {1075, 246}, {1100, 227}, {1114, 271}, {1200, 274},
+    {1254, 279}, {1304, 412}, {1336, 416}, {1411, 401}, {0, 401}, {52, 394},
+    {144, 65535}, {197, 134}, {204, 189}, {250, 116}, {284, 142}, {299, 88},
+    {304, 149}, {324, 141}, {330, 87}, {333, 141}, {353, 144}, {366, 83},
+    {373, 115}, {397, 152}, {430, 108}, {456, 291}, {504, 54}, {506, 55},
+    {517, 65535}, {587, 290}, {602, 293}, {606, 292}, {659, 20}, {704, 13},
+    {726, 3}, {734, 49}, {805, 12}, {862, 233}, {877, 267}, {914, 217},
+    {924, 264}, {934, 229}, {951, 255}, {954, 277}, {969, 243}, {1000, 246},
+    {1072, 227}, {1077, 246}, {1099, 227}, {1114, 271}, {1199, 274}, {1255, 279},
+    {1299, 412}, {1337, 416}, {1412, 401}, {0, 401}, {52, 394}, {144, 65535},
+    {198, 134}, {203, 189}, {249, 116}, {282, 142}, {304, 149}, {324, 141},
+    {353, 144}, {366, 83}, {374, 115}, {398, 152}, {430, 108}, {458, 291},
+    {483, 54}, {505, 55}, {518, 65535}, {589, 290}, {594, 293}, {608, 292},
+    {658, 20}, {706, 13}, {726, 3}, {734, 49}, {804, 12}, {863, 233},
+    {877, 267}, {914, 217}, {923, 264}, {934, 229}, {951, 255}, {955, 277},
+    {968, 243}, {1001, 246}, {1073, 227}, {1078, 246}, {1099, 227}, {1113, 271},
+    {1198, 274}, {1256, 279}, {1295, 412}, {1337, 416}, {1413, 401}, {0, 401},
+    {51, 394}, {145, 65535}, {199, 134}, {201, 189}, {248, 116}, {281, 142},
+    {305, 149}, {324, 141}, {352, 144}, {366, 83}, {374, 115}, {398, 152},
+    {429, 108}, {460, 291}, {470, 54}, {504, 55}, {518, 65535}, {590, 293},
+    {610, 292}, {658, 20}, {707, 13}, {726, 3}, {733, 49}, {804, 12},
+    {863, 233}, {876, 267}, {915, 217}, {922, 264}, {934, 229}, {950, 255},
+    {957, 277}, {967, 243}, {1001, 246}, {1073, 227}, {1079, 246}, {1098, 227},
+    {1112, 271}, {1197, 274}, {1256, 279}, {1291, 412}, {1337, 416}, {1414, 401},
+    {0, 401}, {51, 394}, {145, 65535}, {200, 189}, {248, 116}, {279, 142},
+    {305, 149}, {325, 141}, {351, 144}, {366, 83}, {375, 115}, {399, 152},
+    {428, 108}, {460, 191}, {470, 54}, {502, 55}, {519, 65535}, {588, 293},
+    {612, 292}, {657, 20}, {708, 13}, {726, 44}, {733, 49}, {804, 12},
+    {864, 233}, {875, 267}, {915, 217}, {920, 264}, {934, 229}, {949, 255},
+    {971, 243}, {1002, 246}, {1073, 227}, {1086, 246}, {1098, 227}, {1111, 271},
+    {1196, 274}, {1257, 279}, {1286, 412}, {1337, 416}, {1414, 401}, {0, 401},
+    {50, 394}, {145, 65535}, {201, 189}, {247, 116}, {277, 142}, {306, 149},
+    {325, 141}, {350, 144}, {366, 83}, {376, 115}, {399, 152}, {428, 108},
+    {459, 191}, {470, 54}, {501, 55}, {520, 65535}, {587, 293}, {615, 292},
+    {657, 20}, {710, 13}, {723, 44}, {735, 49}, {804, 12}, {864, 233},
+    {875, 267}, {916, 217}, {919, 264}, {934, 229}, {949, 255}, {971, 243},
+    {1003, 246}, {1073, 227}, {1088, 246}, {1098, 227}, {1111, 271}, {1195, 274},
+    {1258, 279}, {1283, 412}, {1338, 416}, {1415, 401}, {0, 401}, {50, 394},
+    {145, 65535}, {202, 189}, {246, 116}, {276, 142}, {306, 149}, {325, 141},
+    {350, 144}, {367, 83}, {376, 115}, {400, 152}, {427, 108}, {459, 191},
+    {469, 54}, {500, 55}, {521, 65535}, {586, 293}, {617, 292}, {656, 20},
+    {711, 13}, {721, 44}, {738, 49}, {804, 12}, {865, 233}, {874, 267},
+    {917, 264}, {934, 229}, {948, 255}, {971, 243}, {1004, 246}, {1072, 227},
+    {1089, 246}, {1097, 227}, {1111, 271}, {1194, 274}, {1258, 279}, {1279, 412},
+    {1338, 416}, {1416, 401}, {0, 401}, {49, 394}, {146, 65535}, {203, 189},
+    {246, 116}, {274, 142}, {307, 149}, {325, 141}, {349, 144}, {367, 83},
+    {377, 115}, {400, 152}, {426, 108}, {458, 167}, {459, 191}, {469, 54},
+    {499, 55}, {521, 65535}, {585, 293}, {619, 292}, {656, 20}, {712, 13},
+    {718, 44}, {740, 49}, {803, 12}, {865, 233}, {873, 267}, {917, 264},
+    {934, 229}, {948, 255}, {971, 243}, {1000, 246}, {1073, 227}, {1089, 246},
+    {1097, 227}, {1110, 271}, {1192, 274}, {1259, 279}, {1275, 412}, {1338, 416},
+    {1416, 401}, {0, 401}, {49, 394}, {146, 65535}, {204, 189}, {245, 116},
+    {273, 142}, {307, 149}, {325, 141}, {348, 144}, {367, 83}, {377, 115},
+    {400, 152}, {425, 108}, {457, 167}, {459, 191}, {469, 54}, {498, 55},
+    {522, 65535}, {584, 293}, {621, 292}, {655, 20}, {713, 13}, {715, 44},
+    {742, 49}, {803, 12}, {866, 233}, {872, 267}, {917, 264}, {934, 229},
+    {947, 255}, {971, 243}, {995, 246}, {1074, 227}, {1089, 246}, {1097, 227},
+    {1110, 271}, {1191, 274}, {1260, 279}, {1271, 412}, {1338, 416}, {1417, 401},
+    {0, 401}, {49, 394}, {146, 65535}, {205, 189}, {244, 116}, {271, 142},
+    {308, 149}, {325, 141}, {347, 144}, {367, 83}, {378, 115}, {401, 152},
+    {425, 108}, {456, 167}, {459, 191}, {469, 54}, {497, 55}, {522, 65535},
+    {583, 293}, {623, 292}, {655, 20}, {714, 44}, {744, 49}, {803, 12},
+    {866, 233}, {872, 267}, {917, 264}, {934, 229}, {946, 255}, {971, 243},
+    {994, 246}, {1075, 227}, {1089, 246}, {1096, 227}, {1113, 284}, {1114, 271},
+    {1190, 235}, {1191, 274}, {1260, 279}, {1268, 412}, {1339, 416}, {1418, 401},
+    {0, 401}, {48, 394}, {146, 65535}, {206, 189}, {244, 116}, {270, 142},
+    {308, 149}, {325, 141}, {347, 144}, {367, 83}, {378, 115}, {401, 152},
+    {424, 108}, {456, 167}, {459, 191}, {469, 54}, {496, 55}, {523, 65535},
+    {582, 293}, {625, 292}, {654, 20}, {712, 44}, {746, 49}, {803, 12},
+    {867, 233}, {871, 267}, {917, 264}, {934, 229}, {946, 255}, {972, 243},
+    {993, 246}, {1075, 227}, {1089, 246}, {1095, 227}, {1112, 284}, {1115, 271},
+    {1189, 235}, {1191, 274}, {1261, 279}, {1264, 412}, {1339, 416}, {1418, 401},
+    {0, 401}, {48, 394}, {146, 65535}, {207, 189}, {243, 116}, {268, 142},
+    {309, 149}, {325, 141}, {346, 144}, {367, 83}, {379, 115}, {402, 152},
+    {423, 108}, {455, 167}, {459, 191}, {468, 54}, {495, 55}, {524, 65535},
+    {581, 293}, {627, 292}, {654, 20}, {711, 44}, {748, 49}, {803, 12},
+    {867, 4}, {872, 267}, {918, 264}, {934, 229}, {945, 255}, {972, 243},
+    {993, 246}, {1075, 227}, {1089, 246}, {1095, 227}, {1111, 287}, {1112, 284},
+    {1116, 271}, {1187, 235}, {1192, 274}, {1261, 412}, {1339, 416}, {1419, 401},
+    {0, 401}, {47, 394}, {146, 65535}, {208, 189}, {242, 116}, {267, 142},
+    {308, 73}, {309, 149}, {325, 141}, {345, 144}, {367, 83}, {379, 115},
+    {402, 152}, {423, 108}, {454, 167}, {459, 191}, {468, 54}, {493, 55},
+    {524, 65535}, {581, 293}, {628, 45}, {654, 20}, {710, 44}, {750, 49},
+    {802, 12}, {865, 4}, {873, 267}, {918, 264}, {934, 229}, {945, 255},
+    {972, 243}, {994, 246}, {1075, 227}, {1089, 246}, {1094, 227}, {1110, 287},
+    {1113, 284}, {1117, 271}, {1140, 284}, {1144, 271}, {1185, 235}, {1192, 274},
+    {1261, 412}, {1339, 416}, {1420, 401}, {0, 401}, {47, 394}, {146, 65535},
+    {209, 189}, {242, 116}, {266, 142}, {305, 73}, {310, 149}, {325, 141},
+    {344, 144}, {367, 83}, {380, 115}, {403, 152}, {422, 108}, {454, 167},
+    {459, 191}, {468, 54}, {492, 55}, {525, 65535}, {580, 293}, {629, 45},
+    {658, 20}, {709, 44}, {753, 49}, {802, 12}, {850, 27}, {864, 4},
+    {875, 267}, {918, 264}, {934, 229}, {944, 255}, {972, 243}, {994, 246},
+    {1075, 227}, {1090, 246}, {1093, 227}, {1108, 287}, {1113, 284}, {1118, 271},
+    {1137, 284}, {1147, 271}, {1182, 235}, {1193, 274}, {1261, 412}, {1339, 416},
+    {1420, 401}, {0, 401}, {46, 394}, {146, 65535}, {211, 189}, {241, 116},
+    {264, 142}, {303, 73}, {312, 149}, {323, 146}, {327, 141}, {344, 144},
+    {367, 83}, {381, 115}, {403, 152}, {421, 108}, {453, 167}, {459, 191},
+    {468, 54}, {491, 55}, {525, 65535}, {579, 293}, {629, 45}, {662, 20},
+    {708, 44}, {755, 49}, {783, 43}, {804, 12}, {838, 27}, {864, 4},
+    {876, 267}, {918, 264}, {934, 229}, {943, 255}, {972, 243}, {995, 246},
+    {1075, 227}, {1090, 246}, {1092, 227}, {1107, 287}, {1113, 284}, {1118, 271},
+    {1134, 284}, {1147, 271}, {1180, 235}, {1193, 274}, {1260, 412}, {1340, 416},
+    {1421, 401}, {0, 401}, {46, 394}, {147, 65535}, {212, 189}, {240, 116},
+    {263, 142}, {300, 73}, {313, 149}, {317, 146}, {331, 141}, {343, 144},
+    {367, 83}, {381, 115}, {404, 152}, {421, 108}, {452, 167}, {459, 191},
+    {468, 54}, {490, 55}, {525, 65535}, {578, 293}, {630, 45}, {665, 20},
+    {707, 46}, {708, 44}, {757, 49}, {770, 43}, {805, 12}, {828, 27},
+    {864, 4}, {878, 267}, {918, 264}, {934, 229}, {943, 255}, {973, 243},
+    {995, 246}, {1075, 227}, {1090, 246}, {1091, 227}, {1105, 287}, {1113, 284},
+    {1117, 271}, {1127, 284}, {1147, 271}, {1178, 235}, {1194, 274}, {1260, 412},
+    {1340, 416}, {1422, 401}, {0, 401}, {46, 394}, {147, 65535}, {213, 189},
+    {240, 116}, {261, 142}, {298, 73}, {313, 146}, {335, 141}, {342, 144},
+    {367, 83}, {382, 115}, {404, 152}, {420, 108}, {451, 167}, {459, 191},
+    {467, 54}, {489, 55}, {526, 65535}, {578, 293}, {630, 45}, {669, 20},
+    {705, 46}, {708, 44}, {759, 43}, {806, 12}, {819, 27}, {864, 4},
+    {879, 267}, {918, 264}, {934, 229}, {942, 255}, {973, 243}, {996, 246},
+    {1075, 227}, {1085, 246}, {1087, 227}, {1090, 246}, {1091, 227}, {1104, 287},
+    {1114, 284}, {1117, 271}, {1126, 284}, {1148, 271}, {1175, 235}, {1194, 274},
+    {1259, 412}, {1340, 416}, {1422, 401}, {0, 401}, {45, 394}, {147, 65535},
+    {215, 189}, {239, 116}, {260, 142}, {295, 73}, {313, 146}, {340, 141},
+    {341, 144}, {367, 83}, {382, 115}, {405, 152}, {419, 108}, {451, 167},
+    {459, 191}, {467, 54}, {488, 55}, {526, 65535}, {577, 293}, {631, 45},
+    {673, 20}, {704, 46}, {709, 44}, {759, 43}, {808, 12}, {811, 27},
+    {864, 4}, {881, 267}, {918, 264}, {934, 229}, {941, 255}, {973, 243},
+    {997, 246}, {1076, 227}, {1083, 246}, {1088, 227}, {1102, 287}, {1114, 284},
+    {1118, 271}, {1126, 284}, {1149, 271}, {1172, 251}, {1176, 235}, {1194, 274},
+    {1259, 412}, {1340, 416}, {1423, 401}, {0, 401}, {45, 394}, {147, 65535},
+    {216, 189}, {238, 116}, {258, 142}, {293, 73}, {313, 146}, {341, 144},
+    {367, 83}, {383, 115}, {400, 86}, {406, 152}, {418, 127}, {419, 108},
+    {450, 167}, {459, 191}, {467, 54}, {487, 55}, {527, 65535}, {577, 293},
+    {631, 45}, {676, 20}, {701, 5}, {703, 46}, {709, 44}, {759, 43},
+    {808, 27}, {864, 4}, {882, 267}, {919, 264}, {934, 229}, {941, 255},
+    {973, 243}, {998, 246}, {1076, 227}, {1077, 246}, {1088, 227}, {1101, 287},
+    {1114, 284}, {1120, 271}, {1125, 284}, {1149, 251}, {1151, 271}, {1169, 251},
+    {1176, 235}, {1195, 274}, {1258, 412}, {1341, 416}, {1424, 401}, {0, 401},
+    {44, 394}, {146, 65535}, {218, 189}, {238, 116}, {257, 142}, {291, 73},
+    {313, 146}, {342, 144}, {367, 83}, {383, 115}, {395, 86}, {407, 127},
+    {419, 108}, {449, 167}, {459, 191}, {467, 54}, {486, 55}, {527, 65535},
+    {576, 293}, {632, 45}, {680, 20}, {698, 5}, {703, 46}, {709, 44},
+    {758, 43}, {808, 27}, {864, 4}, {883, 267}, {919, 264}, {934, 229},
+    {940, 255}, {973, 243}, {998, 246}, {1088, 227}, {1100, 287}, {1114, 284},
+    {1122, 271}, {1125, 284}, {1150, 251}, {1152, 271}, {1168, 251}, {1176, 235},
+    {1195, 274}, {1258, 412}, {1341, 416}, {1424, 401}, {0, 401}, {44, 394},
+    {146, 65535}, {220, 189}, {237, 116}, {256, 142}, {288, 73}, {312, 146},
+    {342, 144}, {367, 83}, {384, 115}, {391, 86}, {407, 127}, {420, 108},
+    {449, 167}, {459, 191}, {467, 54}, {485, 55}, {527, 65535}, {576, 293},
+    {632, 45}, {683, 20}, {694, 5}, {703, 46}, {710, 44}, {758, 43},
+    {809, 27}, {864, 4}, {885, 267}, {919, 264}, {934, 229}, {940, 255},
+    {973, 243}, {999, 246}, {1083, 227}, {1085, 246}, {1088, 227}, {1098, 287},
+    {1114, 284}, {1150, 251}, {1152, 271}, {1167, 251}, {1176, 235}, {1196, 274},
+    {1257, 412}, {1341, 416}, {1425, 401}, {0, 401}, {44, 394}, {146, 65535},
+    {222, 189}, {236, 116}, {254, 142}, {286, 73}, {312, 146}, {342, 144},
+    {367, 83}, {384, 115}, {387, 86}, {407, 127}, {420, 164}, {423, 108},
+    {448, 167}, {459, 191}, {466, 54}, {484, 55}, {527, 74}, {528, 65535},
+    {575, 293}, {633, 45}, {687, 20}, {691, 5}, {703, 46}, {710, 44},
+    {758, 43}, {809, 27}, {864, 4}, {886, 267}, {919, 264}, {934, 229},
+    {939, 255}, {974, 243}, {1000, 246}, {1004, 243}, {1010, 246}, {1084, 227},
+    {1097, 287}, {1115, 284}, {1151, 251}, {1152, 271}, {1167, 251}, {1176, 235},
+    {1196, 274}, {1257, 412}, {1341, 416}, {1425, 401}, {0, 401}, {43, 394},
+    {146, 65535}, {224, 189}, {236, 116}, {253, 142}, {284, 73}, {312, 146},
+    {342, 144}, {367, 83}, {384, 86}, {406, 127}, {420, 164}, {426, 108},
+    {445, 176}, {448, 167}, {459, 191}, {466, 54}, {483, 55}, {524, 74},
+    {528, 65535}, {575, 293}, {633, 45}, {688, 5}, {703, 46}, {711, 44},
+    {758, 43}, {809, 27}, {864, 4}, {887, 267}, {919, 264}, {934, 229},
+    {939, 255}, {974, 243}, {1011, 246}, {1084, 227}, {1095, 287}, {1115, 284},
+    {1151, 251}, {1153, 271}, {1166, 251}, {1176, 235}, {1197, 274}, {1256, 412},
+    {1342, 416}, {1426, 401}, {0, 401}, {43, 394}, {146, 65535}, {226, 189},
+    {235, 116}, {252, 142}, {282, 73}, {312, 146}, {342, 144}, {367, 83},
+    {384, 86}, {406, 127}, {421, 164}, {429, 108}, {442, 176}, {448, 167},
+    {459, 191}, {466, 54}, {482, 55}, {522, 74}, {529, 65535}, {574, 293},
+    {634, 45}, {687, 5}, {702, 46}, {711, 44}, {758, 43}, {809, 27},
+    {864, 4}, {889, 267}, {919, 264}, {934, 229}, {938, 255}, {974, 243},
+    {1011, 246}, {1085, 227}, {1094, 287}, {1115, 284}, {1152, 251}, {1153, 271},
+    {1166, 251}, {1177, 235}, {1197, 274}, {1256, 412}, {1342, 416}, {1427, 401},
+    {0, 401}, {42, 394}, {146, 65535}, {228, 189}, {235, 116}, {250, 142},
+    {279, 73}, {311, 146}, {342, 144}, {367, 83}, {384, 86}, {406, 127},
+    {421, 164}, {432, 108}, {440, 176}, {448, 167}, {459, 191}, {466, 54},
+    {480, 55}, {520, 74}, {530, 65535}, {574, 293}, {634, 45}, {687, 5},
+    {702, 46}, {711, 44}, {758, 43}, {810, 27}, {864, 4}, {890, 267},
+    {920, 264}, {934, 229}, {937, 255}, {974, 243}, {1011, 246}, {1086, 227},
+    {1093, 287}, {1115, 284}, {1152, 251}, {1153, 271}, {1165, 251}, {1177, 235},
+    {1197, 274}, {1255, 412}, {1342, 416}, {1427, 401}, {0, 401}, {42, 394},
+    {146, 65535}, {231, 189}, {234, 116}, {249, 142}, {277, 73}, {311, 146},
+    {343, 144}, {367, 83}, {383, 86}, {405, 127}, {421, 164}, {434, 108},
+    {437, 176}, {448, 167}, {459, 191}, {466, 54}, {479, 55}, {517, 74},
+    {530, 65535}, {573, 293}, {635, 45}, {686, 5}, {702, 46}, {712, 44},
+    {758, 43}, {810, 27}, {864, 4}, {892, 267}, {920, 264}, {934, 229},
+    {937, 255}, {974, 243}, {1011, 246}, {1086, 227}, {1091, 287}, {1115, 284},
+    {1152, 251}, {1153, 271}, {1165, 251}, {1177, 235}, {1198, 254}, {1199, 274},
+    {1255, 393}, {1257, 412}, {1342, 416}, {1428, 401}, {0, 401}, {42, 394},
+    {146, 65535}, {234, 116}, {248, 142}, {275, 73}, {311, 146}, {343, 144},
+    {367, 83}, {383, 86}, {405, 127}, {421, 164}, {436, 176}, {448, 167},
+    {458, 184}, {459, 191}, {466, 54}, {478, 55}, {515, 74}, {531, 65535},
+    {573, 293}, {635, 45}, {685, 5}, {702, 46}, {712, 44}, {758, 43},
+    {810, 27}, {864, 4}, {893, 267}, {920, 264}, {934, 229}, {936, 255},
+    {974, 243}, {1011, 246}, {1087, 227}, {1090, 287}, {1116, 284}, {1153, 271},
+    {1164, 251}, {1177, 235}, {1196, 254}, {1219, 274}, {1254, 393}, {1259, 412},
+    {1342, 416}, {1429, 401}, {0, 401}, {41, 394}, {146, 65535}, {235, 116},
+    {246, 142}, {273, 73}, {310, 146}, {343, 144}, {366, 76}, {369, 83},
+    {383, 86}, {405, 127}, {421, 164}, {436, 176}, {448, 167}, {458, 184},
+    {460, 191}, {465, 54}, {477, 55}, {513, 74}, {531, 65535}, {573, 293},
+    {636, 45}, {684, 5}, {702, 46}, {712, 44}, {757, 43}, {810, 27},
+    {864, 4}, {894, 267}, {920, 264}, {934, 229}, {936, 255}, {975, 243},
+    {1011, 246}, {1087, 227}, {1089, 287}, {1116, 284}, {1153, 251}, {1154, 271},
+    {1164, 251}, {1177, 235}, {1195, 254}, {1233, 274}, {1252, 407}, {1255, 393},
+    {1261, 412}, {1343, 416}, {1429, 401}, {0, 401}, {41, 394}, {145, 65535},
+    {236, 116}, {245, 142}, {271, 73}, {310, 146}, {343, 144}, {363, 76},
+    {372, 83}, {382, 86}, {404, 127}, {421, 164}, {436, 176}, {448, 167},
+    {458, 184}, {460, 191}, {465, 54}, {475, 180}, {477, 55}, {510, 110},
+    {511, 74}, {532, 65535}, {572, 293}, {636, 45}, {684, 5}, {702, 46},
+    {713, 44}, {757, 43}, {810, 27}, {864, 4}, {896, 267}, {920, 264},
+    {934, 229}, {935, 255}, {975, 243}, {1011, 246}, {1087, 287}, {1116, 284},
+    {1154, 271}, {1163, 251}, {1177, 235}, {1194, 254}, {1244, 274}, {1251, 407},
+    {1256, 393}, {1263, 412}, {1343, 416}, {1430, 401}, {0, 401}, {40, 394},
+    {145, 65535}, {237, 116}, {244, 142}, {268, 73}, {310, 146}, {343, 144},
+    {360, 76}, {375, 83}, {382, 86}, {404, 127}, {421, 164}, {436, 176},
+    {448, 167}, {458, 184}, {460, 191}, {465, 54}, {474, 180}, {476, 55},
+    {506, 110}, {509, 74}, {532, 65535}, {572, 293}, {637, 45}, {683, 5},
+    {702, 46}, {713, 44}, {757, 43}, {811, 27}, {863, 4}, {897, 267},
+    {920, 264}, {934, 255}, {975, 243}, {1011, 246}, {1087, 287}, {1116, 284},
+    {1154, 271}, {1162, 251}, {1178, 235}, {1193, 254}, {1249, 407}, {1257, 393},
+    {1265, 412}, {1343, 416}, {1430, 401}, {0, 401}, {40, 394}, {145, 65535},
+    {239, 116}, {242, 142}, {266, 73}, {310, 146}, {344, 144}, {358, 76},
+    {377, 83}, {381, 86}, {404, 127}, {422, 164}, {436, 176}, {448, 167},
+    {458, 184}, {461, 191}, {465, 54}, {472, 180}, {475, 55}, {502, 110},
+    {507, 74}, {533, 65535}, {572, 293}, {637, 45}, {682, 5}, {702, 46},
+    {713, 44}, {757, 43}, {811, 27}, {863, 4}, {896, 208}, {906, 267},
+    {920, 264}, {934, 255}, {975, 243}, {1012, 246}, {1086, 287}, {1116, 284},
+    {1154, 271}, {1162, 251}, {1178, 235}, {1191, 254}, {1249, 407}, {1257, 393},
+    {1267, 412}, {1343, 416}, {1431, 401}, {0, 401}, {40, 394}, {145, 65535},
+    {240, 116}, {241, 142}, {264, 73}, {309, 146}, {344, 144}, {355, 76},
+    {380, 83}, {381, 86}, {403, 127}, {422, 164}, {436, 176}, {448, 167},
+    {458, 184}, {461, 191}, {465, 54}, {470, 180}, {474, 55}, {498, 110},
+    {505, 74}, {533, 65535}, {571, 293}, {638, 45}, {681, 5}, {702, 46},
+    {714, 44}, {757, 43}, {811, 27}, {863, 4}, {896, 208}, {914, 267},
+    {921, 264}, {934, 255}, {975, 243}, {1012, 246}, {1085, 287}, {1117, 284},
+    {1155, 251}, {1156, 271}, {1161, 251}, {1178, 235}, {1190, 254}, {1248, 407},
+    {1258, 393}, {1269, 412}, {1344, 416}, {1432, 401}, {0, 401}, {39, 394},
+    {144, 65535}, {241, 142}, {262, 73}, {309, 146}, {343, 111}, {349, 144},
+    {353, 76}, {381, 86}, {403, 127}, {422, 164}, {435, 176}, {448, 167},
+    {458, 184}, {461, 191}, {464, 139}, {468, 135}, {469, 180}, {473, 55},
+    {494, 110}, {503, 74}, {534, 65535}, {571, 293}, {638, 45}, {680, 5},
+    {702, 46}, {714, 44}, {757, 43}, {811, 27}, {863, 4}, {895, 208},
+    {921, 264}, {933, 255}, {975, 243}, {1012, 246}, {1084, 287}, {1117, 284},
+    {1156, 251}, {1178, 235}, {1189, 254}, {1248, 407}, {1259, 393}, {1272, 412},
+    {1344, 416}, {1432, 401}, {0, 401}, {39, 394}, {144, 65535}, {241, 142},
+    {260, 73}, {309, 146}, {343, 111}, {353, 76}, {381, 86}, {403, 127},
+    {422, 164}, {435, 176}, {448, 167}, {458, 184}, {462, 191}, {464, 139},
+    {467, 135}, {468, 180}, {472, 55}, {491, 110}, {501, 74}, {534, 65535},
+    {571, 293}, {638, 45}, {680, 5}, {702, 46}, {714, 44}, {757, 43},
+    {812, 27}, {863, 4}, {895, 208}, {923, 264}, {933, 255}, {976, 243},
+    {1013, 246}, {1083, 287}, {1117, 284}, {1156, 251}, {1178, 235}, {1188, 254},
+    {1247, 407}, {1259, 393}, {1274, 412}, {1344, 416}, {1433, 401}, {0, 401},
+    {38, 394}, {144, 65535}, {242, 142}, {258, 73}, {309, 146}, {342, 111},
+    {354, 76}, {382, 86}, {402, 127}, {422, 164}, {435, 176}, {448, 167},
+    {458, 184}, {462, 191}, {464, 139}, {467, 180}, {470, 182}, {472, 55},
+    {487, 110}, {499, 74}, {534, 65535}, {571, 293}, {639, 16}, {640, 45},
+    {679, 5}, {702, 46}, {715, 44}, {757, 43}, {812, 27}, {863, 4},
+    {895, 208}, {925, 264}, {933, 255}, {976, 243}, {1013, 246}, {1083, 287},
+    {1117, 284}, {1156, 251}, {1178, 235}, {1186, 254}, {1246, 407}, {1260, 393},
+    {1276, 412}, {1344, 416}, {1434, 401}, {0, 401}, {38, 394}, {143, 65535},
+    {242, 142}, {256, 73}, {308, 146}, {342, 111}, {355, 76}, {382, 86},
+    {402, 127}, {422, 164}, {435, 176}, {448, 167}, {457, 184}, {462, 191},
+    {464, 139}, {466, 182}, {471, 55}, {483, 110}, {497, 74}, {535, 65535},
+    {571, 293}, {639, 16}, {643, 45}, {678, 5}, {702, 46}, {715, 44},
+    {756, 43}, {812, 27}, {863, 4}, {894, 208}, {927, 264}, {933, 255},
+    {976, 243}, {1013, 246}, {1082, 287}, {1118, 284}, {1157, 251}, {1178, 235},
+    {1185, 254}, {1246, 407}, {1261, 393}, {1278, 412}, {1344, 416}, {1434, 401},
+    {0, 401}, {38, 394}, {143, 65535}, {243, 142}, {254, 73}, {308, 146},
+    {341, 111}, {357, 76}, {382, 86}, {402, 127}, {422, 164}, {435, 176},
+    {448, 167}, {457, 184}, {463, 182}, {471, 55}, {480, 110}, {495, 74},
+    {535, 65535}, {571, 293}, {639, 16}, {646, 45}, {677, 5}, {702, 46},
+    {716, 44}, {756, 43}, {812, 27}, {863, 4}, {894, 208}, {929, 264},
+    {932, 255}, {976, 243}, {1014, 246}, {1081, 287}, {1118, 284}, {1157, 251},
+    {1179, 235}, {1184, 254}, {1245, 407}, {1261, 393}, {1280, 412}, {1345, 416},
+    {1435, 401}, {0, 401}, {37, 394}, {142, 65535}, {244, 142}, {252, 73},
+    {308, 146}, {340, 111}, {358, 76}, {383, 86}, {401, 127}, {423, 164},
+    {435, 176}, {448, 167}, {457, 184}, {463, 182}, {469, 151}, {472, 55},
+    {476, 110}, {494, 74}, {534, 85}, {536, 65535}, {570, 293}, {638, 16},
+    {648, 45}, {677, 5}, {702, 46}, {716, 44}, {756, 43}, {812, 27},
+    {863, 4}, {893, 208}, {932, 255}, {976, 243}, {1014, 246}, {1080, 287},
+    {1118, 284}, {1158, 251}, {1179, 235}, {1183, 254}, {1245, 407}, {1262, 393},
+    {1282, 412}, {1345, 416}, {1435, 401}, {0, 401}, {37, 394}, {142, 65535},
+    {244, 142}, {250, 73}, {308, 146}, {340, 111}, {360, 76}, {382, 187},
+    {383, 86}, {401, 127}, {423, 164}, {435, 176}, {448, 167}, {457, 184},
+    {462, 182}, {468, 151}, {473, 110}, {492, 74}, {533, 85}, {538, 65535},
+    {570, 293}, {638, 16}, {651, 45}, {676, 5}, {702, 46}, {716, 44},
+    {756, 43}, {813, 27}, {863, 4}, {893, 208}, {933, 255}, {976, 243},
+    {1014, 246}, {1079, 287}, {1118, 219}, {1119, 284}, {1156, 234}, {1159, 251},
+    {1179, 235}, {1181, 254}, {1244, 407}, {1263, 393}, {1284, 412}, {1344, 409},
+    {1347, 416}, {1436, 401}, {0, 401}, {36, 394}, {142, 65535}, {245, 142},
+    {248, 73}, {307, 146}, {339, 111}, {361, 76}, {378, 187}, {384, 86},
+    {401, 127}, {423, 164}, {435, 176}, {448, 167}, {457, 184}, {462, 182},
+    {467, 151}, {472, 110}, {490, 74}, {532, 85}, {540, 65535}, {570, 293},
+    {638, 16}, {653, 45}, {675, 5}, {702, 46}, {717, 44}, {756, 43},
+    {813, 27}, {863, 4}, {892, 208}, {934, 255}, {977, 243}, {1015, 246},
+    {1079, 287}, {1117, 219}, {1122, 284}, {1154, 234}, {1161, 251}, {1179, 235},
+    {1180, 254}, {1243, 407}, {1263, 393}, {1286, 412}, {1343, 409}, {1349, 416},
+    {1434, 399}, {1438, 401}, {0, 401}, {36, 394}, {141, 65535}, {246, 73},
+    {307, 146}, {339, 111}, {362, 76}, {374, 187}, {385, 86}, {400, 127},
+    {423, 164}, {435, 176}, {448, 167}, {457, 184}, {461, 182}, {466, 151},
+    {471, 110}, {486, 140}, {489, 74}, {530, 85}, {541, 65535}, {570, 293},
+    {638, 16}, {656, 45}, {674, 5}, {702, 46}, {717, 44}, {756, 43},
+    {813, 27}, {863, 4}, {892, 208}, {934, 255}, {977, 243}, {1015, 246},
+    {1078, 287}, {1116, 219}, {1124, 284}, {1152, 261}, {1153, 234}, {1163, 251},
+    {1179, 254}, {1243, 407}, {1264, 393}, {1287, 412}, {1342, 384}, {1343, 409},
+    {1350, 416}, {1431, 399}, {1439, 401}, {0, 399}, {1, 401}, {34, 65535},
+    {36, 394}, {141, 65535}, {246, 73}, {307, 146}, {338, 111}, {364, 76},
+    {370, 187}, {386, 86}, {400, 127}, {423, 164}, {435, 176}, {448, 167},
+    {457, 184}, {461, 182}, {464, 151}, {471, 110}, {477, 100}, {484, 140},
+    {488, 74}, {529, 85}, {543, 65535}, {570, 293}, {638, 16}, {658, 45},
+    {674, 5}, {702, 46}, {717, 44}, {756, 43}, {813, 27}, {863, 4},
+    {891, 208}, {935, 255}, {977, 243}, {1014, 225}, {1015, 246}, {1045, 225},
+    {1047, 246}, {1077, 287}, {1115, 219}, {1126, 284}, {1149, 261}, {1152, 234},
+    {1165, 251}, {1178, 254}, {1242, 407}, {1264, 393}, {1289, 412}, {1341, 384},
+    {1343, 409}, {1352, 416}, {1427, 399}, {0, 399}, {3, 401}, {31, 65535},
+    {37, 394}, {140, 65535}, {247, 73}, {307, 146}, {337, 111}, {365, 76},
+    {367, 187}, {387, 86}, {400, 127}, {423, 164}, {435, 176}, {448, 167},
+    {457, 184}, {460, 182}, {463, 151}, {470, 100}, {482, 140}, {486, 74},
+    {528, 85}, {544, 65535}, {570, 293}, {638, 16}, {661, 45}, {673, 5},
+    {702, 46}, {718, 44}, {756, 43}, {814, 27}, {863, 4}, {891, 208},
+    {936, 255}, {977, 243}, {1013, 225}, {1016, 246}, {1044, 225}, {1049, 246},
+    {1076, 287}, {1114, 219}, {1128, 284}, {1146, 261}, {1152, 234}, {1166, 251},
+    {1177, 254}, {1242, 407}, {1265, 393}, {1291, 412}, {1339, 384}, {1342, 409},
+    {1354, 416}, {1424, 399}, {0, 399}, {5, 401}, {28, 65535}, {38, 394},
+    {140, 65535}, {247, 73}, {306, 146}, {337, 111}, {364, 103}, {366, 187},
+    {388, 86}, {400, 127}, {423, 164}, {434, 69}, {446, 131}, {450, 167},
+    {457, 184}, {460, 182}, {462, 151}, {468, 100}, {479, 140}, {485, 74},
+    {527, 85}, {545, 65535}, {570, 293}, {638, 16}, {660, 7}, {666, 45},
+    {672, 5}, {702, 46}, {718, 44}, {756, 43}, {814, 27}, {863, 4},
+    {891, 208}, {937, 255}, {977, 243}, {1011, 225}, {1016, 246}, {1043, 225},
+    {1051, 246}, {1075, 287}, {1114, 219}, {1130, 284}, {1142, 261}, {1151, 234},
+    {1168, 251}, {1176, 254}, {1241, 407}, {1266, 393}, {1293, 412}, {1338, 384},
+    {1342, 409}, {1355, 416}, {1421, 399}, {0, 399}, {7, 401}, {25, 65535},
+    {38, 394}, {139, 65535}, {248, 73}, {306, 146}, {336, 111}, {363, 103},
+    {366, 187}, {389, 86}, {399, 127}, {423, 164}, {431, 69}, {446, 131},
+    {454, 167}, {456, 184}, {459, 182}, {461, 151}, {466, 100}, {477, 140},
+    {484, 74}, {525, 85}, {547, 65535}, {570, 293}, {638, 16}, {659, 7},
+    {672, 5}, {701, 46}, {718, 44}, {755, 43}, {814, 27}, {863, 4},
+    {890, 208}, {938, 255}, {977, 243}, {1010, 225}, {1016, 246}, {1042, 225},
+    {1053, 246}, {1075, 287}, {1113, 219}, {1133, 284}, {1139, 261}, {1151, 234},
+    {1170, 251}, {1175, 254}, {1241, 407}, {1266, 393}, {1295, 412}, {1336, 384},
+    {1342, 409}, {1357, 416}, {1418, 399}, {0, 399}, {9, 401}, {19, 65535},
+    {39, 394}, {138, 65535}, {248, 73}, {306, 146}, {336, 111}, {363, 103},
+    {366, 187}, {389, 137}, {390, 86}, {399, 127}, {424, 164}, {428, 69},
+    {446, 131}, {457, 184}, {459, 151}, {464, 100}, {474, 140}, {483, 74},
+    {524, 85}, {548, 65535}, {570, 293}, {638, 16}, {657, 7}, {670, 8},
+    {672, 5}, {701, 46}, {719, 44}, {755, 43}, {814, 27}, {863, 4},
+    {889, 18}, {890, 208}, {939, 255}, {978, 243}, {1006, 376}, {1010, 225},
+    {1017, 246}, {1041, 225}, {1055, 246}, {1074, 287}, {1112, 219}, {1135, 284},
+    {1136, 261}, {1150, 234}, {1172, 251}, {1174, 254}, {1240, 407}, {1267, 393},
+    {1297, 412}, {1335, 384}, {1342, 409}, {1358, 416}, {1415, 399}, {0, 399},
+    {11, 65535}, {39, 394}, {138, 65535}, {249, 73}, {306, 146}, {335, 111},
+    {362, 103}, {367, 187}, {387, 137}, {391, 86}, {399, 127}, {424, 164},
+    {426, 69}, {445, 94}, {446, 131}, {458, 151}, {463, 100}, {472, 140},
+    {482, 74}, {523, 85}, {549, 65535}, {570, 293}, {638, 16}, {655, 7},
+    {668, 8}, {672, 5}, {701, 46}, {719, 44}, {755, 43}, {814, 27},
+    {863, 4}, {888, 18}, {891, 208}, {940, 255}, {978, 243}, {1003, 376},
+    {1010, 225}, {1017, 246}, {1041, 225}, {1057, 246}, {1073, 287}, {1111, 219},
+    {1135, 261}, {1150, 234}, {1173, 254}, {1239, 407}, {1268, 393}, {1299, 412},
+    {1333, 384}, {1342, 409}, {1360, 416}, {1412, 399}, {0, 399}, {11, 65535},
+    {40, 394}, {137, 65535}, {249, 73}, {305, 146}, {334, 111}, {361, 103},
+    {367, 187}, {384, 137}, {393, 86}, {398, 127}, {424, 69}, {445, 94},
+    {446, 131}, {459, 151}, {461, 100}, {470, 140}, {478, 183}, {481, 74},
+    {522, 85}, {550, 65535}, {570, 293}, {638, 16}, {654, 7}, {667, 8},
+    {672, 5}, {701, 46}, {719, 44}, {755, 43}, {815, 27}, {863, 4},
+    {887, 18}, {891, 208}, {941, 255}, {978, 243}, {999, 376}, {1011, 225},
+    {1017, 246}, {1041, 225}, {1059, 246}, {1072, 287}, {1111, 219}, {1135, 261},
+    {1149, 234}, {1173, 254}, {1239, 407}, {1268, 393}, {1301, 412}, {1332, 384},
+    {1342, 409}, {1362, 416}, {1401, 398}, {1410, 399}, {0, 399}, {12, 65535},
+    {41, 394}, {137, 65535}, {250, 73}, {305, 146}, {334, 111}, {360, 103},
+    {367, 187}, {382, 137}, {392, 90}, {396, 86}, {398, 127}, {423, 69},
+    {445, 94}, {446, 131}, {460, 100}, {467, 140}, {470, 183}, {480, 74},
+    {520, 85}, {551, 65535}, {570, 293}, {638, 16}, {652, 7}, {665, 8},
+    {672, 5}, {701, 46}, {720, 44}, {755, 43}, {815, 27}, {863, 4},
+    {887, 18}, {892, 208}, {941, 255}, {978, 243}, {996, 376}, {1011, 225},
+    {1018, 246}, {1041, 225}, {1061, 246}, {1072, 287}, {1110, 219}, {1134, 261},
+    {1149, 234}, {1174, 254}, {1238, 407}, {1269, 393}, {1303, 412}, {1331, 384},
+    {1342, 409}, {1363, 416}, {1384, 398}, {1410, 399}, {0, 399}, {12, 65535},
+    {41, 394}, {136, 65535}, {250, 73}, {305, 146}, {333, 111}, {360, 103},
+    {367, 187}, {380, 137}, {391, 90}, {397, 161}, {402, 127}, {422, 69},
+    {444, 94}, {446, 131}, {460, 109}, {462, 185}, {471, 183}, {480, 74},
+    {519, 85}, {552, 65535}, {570, 293}, {638, 16}, {651, 7}, {663, 8},
+    {672, 5}, {701, 46}, {720, 44}, {755, 43}, {815, 27}, {863, 4},
+    {886, 18}, {893, 208}, {942, 255}, {978, 243}, {993, 376}, {1012, 225},
+    {1018, 246}, {1041, 225}, {1063, 246}, {1071, 287}, {1109, 219}, {1133, 261},
+    {1148, 234}, {1174, 254}, {1238, 407}, {1270, 393}, {1304, 412}, {1329, 384},
+    {1342, 409}, {1365, 416}, {1371, 398}, {1409, 399}, {0, 399}, {13, 65535},
+    {42, 394}, {135, 65535}, {251, 73}, {305, 146}, {333, 111}, {359, 103},
+    {367, 187}, {377, 137}, {390, 90}, {396, 161}, {405, 127}, {421, 69},
+    {444, 94}, {446, 131}, {460, 109}, {465, 185}, {475, 183}, {479, 74},
+    {518, 85}, {552, 65535}, {571, 293}, {638, 16}, {649, 7}, {662, 8},
+    {672, 5}, {701, 46}, {720, 44}, {755, 43}, {815, 27}, {863, 4},
+    {885, 18}, {893, 208}, {943, 255}, {978, 243}, {989, 376}, {1012, 225},
+    {1018, 246}, {1041, 225}, {1065, 246}, {1070, 287}, {1109, 219}, {1133, 261},
+    {1148, 234}, {1174, 254}, {1237, 407}, {1270, 393}, {1306, 412}, {1328, 384},
+    {1342, 409}, {1366, 398}, {1409, 399}, {0, 399}, {13, 65535}, {43, 394},
+    {134, 65535}, {252, 73}, {304, 146}, {332, 111}, {358, 103}, {368, 187},
+    {375, 137}, {389, 90}, {396, 161}, {409, 127}, {420, 69}, {443, 94},
+    {446, 131}, {460, 109}, {467, 185}, {478, 74}, {517, 85}, {553, 65535},
+    {571, 293}, {638, 16}, {647, 7}, {660, 8}, {672, 5}, {701, 46},
+    {721, 44}, {755, 43}, {815, 27}, {862, 4}, {884, 18}, {894, 208},
+    {944, 255}, {978, 243}, {986, 376}, {1013, 225}, {1019, 246}, {1041, 225},
+    {1067, 246}, {1069, 287}, {1108, 219}, {1132, 261}, {1147, 234}, {1174, 254},
+    {1237, 407}, {1271, 393}, {1308, 412}, {1326, 384}, {1342, 409}, {1366, 398},
+    {1408, 399}, {0, 399}, {14, 65535}, {44, 394}, {133, 65535}, {253, 73},
+    {304, 146}, {332, 111}, {357, 103}, {368, 187}, {373, 137}, {388, 90},
+    {396, 161}, {412, 127}, {419, 69}, {443, 94}, {446, 131}, {459, 84},
+    {460, 109}, {469, 185}, {478, 74}, {516, 85}, {554, 65535}, {571, 293},
+    {638, 16}, {646, 7}, {659, 8}, {672, 5}, {701, 46}, {721, 44},
+    {755, 43}, {816, 27}, {862, 4}, {883, 18}, {894, 208}, {945, 255},
+    {979, 243}, {983, 376}, {1013, 225}, {1019, 246}, {1041, 225}, {1069, 287},
+    {1107, 219}, {1132, 261}, {1147, 234}, {1175, 254}, {1236, 407}, {1272, 393},
+    {1310, 412}, {1325, 384}, {1342, 409}, {1366, 398}, {1407, 399}, {0, 399},
+    {14, 65535}, {45, 394}, {133, 65535}, {253, 73}, {304, 146}, {331, 111},
+    {357, 103}, {368, 187}, {371, 137}, {387, 90}, {396, 161}, {415, 127},
+    {419, 69}, {443, 94}, {446, 131}, {458, 84}, {461, 109}, {472, 185},
+    {478, 74}, {514, 162}, {515, 85}, {555, 65535}, {571, 293}, {638, 16},
+    {644, 7}, {657, 8}, {673, 5}, {701, 46}, {721, 44}, {754, 43},
+    {816, 27}, {862, 4}, {882, 18}, {895, 208}, {946, 255}, {979, 243},
+    {980, 376}, {1014, 225}, {1019, 246}, {1041, 225}, {1069, 287}, {1106, 219},
+    {1131, 261}, {1146, 234}, {1175, 254}, {1235, 407}, {1272, 393}, {1312, 412},
+    {1324, 384}, {1342, 409}, {1366, 398}, {1407, 399}, {0, 399}, {15, 65535},
+    {45, 394}, {132, 65535}, {254, 73}, {304, 146}, {330, 111}, {356, 103},
+    {368, 187}, {369, 137}, {386, 90}, {396, 161}, {418, 69}, {442, 94},
+    {446, 131}, {456, 84}, {461, 109}, {474, 185}, {478, 74}, {512, 162},
+    {514, 85}, {556, 65535}, {571, 293}, {638, 16}, {643, 7}, {655, 8},
+    {672, 15}, {673, 5}, {701, 46}, {722, 44}, {754, 43}, {816, 27},
+    {862, 4}, {881, 18}, {896, 208}, {946, 255}, {978, 376}, {1014, 225},
+    {1020, 246}, {1041, 225}, {1070, 287}, {1106, 219}, {1131, 261}, {1146, 234},
+    {1175, 254}, {1235, 407}, {1273, 393}, {1313, 412}, {1322, 384}, {1342, 409},
+    {1367, 398}, {1406, 399}, {0, 399}, {15, 65535}, {46, 394}, {131, 65535},
+    {255, 73}, {304, 146}, {330, 111}, {355, 103}, {368, 137}, {385, 90},
+    {395, 161}, {418, 69}, {442, 94}, {445, 131}, {455, 84}, {461, 109},
+    {476, 185}, {478, 74}, {510, 162}, {514, 85}, {556, 65535}, {571, 293},
+    {638, 16}, {641, 7}, {654, 8}, {670, 15}, {674, 5}, {701, 46},
+    {722, 44}, {754, 43}, {816, 27}, {862, 4}, {880, 18}, {896, 208},
+    {947, 255}, {976, 376}, {1014, 225}, {1020, 246}, {1041, 225}, {1070, 287},
+    {1105, 219}, {1130, 261}, {1146, 234}, {1175, 254}, {1234, 407}, {1273, 393},
+    {1315, 412}, {1321, 384}, {1341, 409}, {1367, 398}, {1406, 399}, {0, 399},
+    {16, 65535}, {47, 394}, {130, 65535}, {256, 73}, {303, 146}, {329, 111},
+    {354, 103}, {367, 137}, {384, 90}, {395, 161}, {419, 69}, {442, 94},
+    {445, 131}, {454, 84}, {462, 109}, {478, 74}, {509, 162}, {514, 85},
+    {557, 65535}, {572, 293}, {638, 16}, {639, 7}, {652, 8}, {669, 15},
+    {674, 5}, {701, 46}, {722, 44}, {754, 43}, {816, 27}, {862, 2},
+    {879, 18}, {897, 208}, {948, 255}, {975, 376}, {1015, 225}, {1021, 246},
+    {1041, 225}, {1071, 287}, {1104, 219}, {1130, 261}, {1145, 234}, {1176, 254},
+    {1234, 407}, {1274, 393}, {1317, 412}, {1320, 384}, {1341, 409}, {1367, 398},
+    {1405, 399}, {0, 399}, {16, 65535}, {48, 394}, {129, 65535}, {257, 73},
+    {303, 146}, {329, 111}, {354, 103}, {367, 137}, {383, 90}, {395, 161},
+    {419, 69}, {441, 94}, {445, 131}, {452, 84}, {462, 109}, {479, 74},
+    {507, 162}, {513, 85}, {557, 65535}, {572, 293}, {638, 7}, {651, 8},
+    {668, 15}, {675, 5}, {701, 46}, {723, 44}, {754, 43}, {817, 27},
+    {861, 2}, {880, 18}, {897, 208}, {949, 255}, {974, 376}, {1015, 225},
+    {1021, 246}, {1040, 225}, {1072, 287}, {1103, 219}, {1129, 261}, {1145, 234},
+    {1175, 223}, {1178, 254}, {1233, 407}, {1275, 393}, {1318, 384}, {1341, 409},
+    {1367, 398}, {1405, 399}, {0, 399}, {16, 65535}, {49, 394}, {96, 396},
+    {128, 65535}, {258, 73}, {303, 146}, {328, 111}, {353, 103}, {366, 137},
+    {382, 90}, {395, 161}, {420, 69}, {441, 94}, {445, 131}, {451, 84},
+    {462, 109}, {479, 74}, {505, 162}, {513, 85}, {558, 65535}, {572, 293},
+    {637, 7}, {649, 8}, {666, 15}, {675, 5}, {701, 46}, {723, 44},
+    {754, 43}, {817, 27}, {859, 2}, {881, 18}, {898, 208}, {950, 255},
+    {972, 376}, {1016, 225}, {1022, 246}, {1040, 225}, {1072, 287}, {1103, 219},
+    {1129, 261}, {1144, 234}, {1174, 223}, {1179, 254}, {1233, 407}, {1275, 393},
+    {1317, 384}, {1341, 409}, {1368, 398}, {1404, 399}, {0, 399}, {17, 65535},
+    {51, 394}, {66, 396}, {129, 65535}, {259, 73}, {303, 146}, {328, 111},
+    {352, 103}, {366, 137}, {381, 90}, {394, 161}, {420, 69}, {441, 94},
+    {445, 131}, {450, 84}, {462, 109}, {474, 165}, {480, 74}, {503, 162},
+    {513, 85}, {559, 65535}, {572, 293}, {637, 7}, {647, 8}, {665, 15},
+    {676, 5}, {701, 46}, {723, 44}, {754, 43}, {816, 6}, {817, 27},
+    {858, 2}, {881, 18}, {899, 208}, {951, 255}, {971, 376}, {1016, 225},
+    {1022, 246}, {1040, 225}, {1073, 287}, {1102, 219}, {1128, 261}, {1144, 234},
+    {1174, 223}, {1181, 254}, {1232, 407}, {1276, 393}, {1316, 384}, {1341, 409},
+    {1368, 398}, {1404, 399}, {0, 399}, {17, 65535}, {51, 396}, {130, 65535},
+    {260, 73}, {302, 146}, {327, 111}, {352, 103}, {365, 137}, {380, 90},
+    {394, 161}, {420, 69}, {440, 94}, {445, 131}, {449, 84}, {463, 109},
+    {468, 165}, {482, 74}, {502, 162}, {512, 85}, {559, 65535}, {573, 293},
+    {637, 7}, {646, 8}, {664, 15}, {676, 5}, {701, 46}, {724, 44},
+    {754, 43}, {814, 6}, {818, 27}, {857, 2}, {882, 18}, {899, 208},
+    {951, 255}, {970, 376}, {1017, 225}, {1022, 246}, {1040, 225}, {1074, 287},
+    {1101, 219}, {1128, 261}, {1143, 234}, {1173, 223}, {1183, 254}, {1231, 407},
+    {1277, 393}, {1316, 384}, {1341, 409}, {1368, 398}, {1403, 399}, {0, 399},
+    {17, 65535}, {50, 396}, {131, 65535}, {261, 73}, {302, 146}, {326, 111},
+    {351, 103}, {364, 137}, {379, 90}, {394, 161}, {421, 69}, {440, 94},
+    {445, 131}, {447, 84}, {463, 165}, {483, 74}, {500, 162}, {512, 85},
+    {560, 65535}, {573, 293}, {637, 7}, {644, 8}, {662, 15}, {677, 5},
+    {701, 46}, {724, 44}, {752, 30}, {754, 43}, {812, 6}, {819, 27},
+    {856, 2}, {882, 18}, {900, 208}, {952, 255}, {968, 376}, {1017, 225},
+    {1023, 246}, {1040, 225}, {1074, 287}, {1101, 219}, {1127, 261}, {1143, 234},
+    {1172, 223}, {1184, 254}, {1231, 407}, {1277, 393}, {1315, 384}, {1341, 409},
+    {1368, 398}, {1403, 399}, {0, 399}, {18, 65535}, {27, 395}, {39, 65535},
+    {49, 396}, {132, 65535}, {262, 73}, {302, 146}, {326, 111}, {350, 103},
+    {364, 137}, {378, 90}, {394, 161}, {421, 69}, {440, 94}, {445, 131},
+    {446, 84}, {463, 165}, {484, 74}, {497, 113}, {499, 162}, {512, 85},
+    {560, 65535}, {573, 293}, {637, 7}, {643, 8}, {661, 15}, {678, 5},
+    {701, 46}, {724, 44}, {746, 30}, {754, 43}, {809, 6}, {819, 25},
+    {827, 27}, {855, 2}, {883, 18}, {900, 208}, {953, 255}, {967, 376},
+    {1018, 225}, {1023, 246}, {1040, 225}, {1075, 287}, {1100, 219}, {1127, 261},
+    {1142, 234}, {1171, 223}, {1186, 254}, {1230, 407}, {1278, 393}, {1314, 384},
+    {1341, 409}, {1369, 398}, {1402, 399}, {0, 399}, {18, 65535}, {21, 395},
+    {45, 65535}, {49, 396}, {133, 65535}, {263, 73}, {302, 146}, {325, 111},
+    {349, 103}, {363, 137}, {376, 90}, {394, 161}, {421, 69}, {439, 94},
+    {445, 84}, {463, 165}, {486, 74}, {492, 113}, {499, 162}, {511, 85},
+    {560, 65535}, {574, 293}, {636, 7}, {641, 8}, {660, 15}, {678, 5},
+    {701, 46}, {725, 44}, {740, 30}, {754, 19}, {755, 43}, {807, 6},
+    {820, 25}, {841, 27}, {854, 2}, {884, 18}, {901, 208}, {954, 255},
+    {965, 65535}, {966, 376}, {1018, 225}, {1024, 246}, {1040, 225}, {1075, 287},
+    {1099, 219}, {1126, 261}, {1142, 234}, {1171, 223}, {1188, 254}, {1230, 407},
+    {1278, 393}, {1313, 384}, {1341, 409}, {1368, 397}, {1369, 398}, {1402, 399},
+    {0, 399}, {18, 395}, {48, 396}, {134, 65535}, {265, 73}, {301, 146},
+    {325, 111}, {349, 103}, {363, 137}, {375, 90}, {393, 161}, {422, 69},
+    {439, 94}, {444, 84}, {463, 165}, {487, 74}, {488, 113}, {498, 162},
+    {511, 85}, {561, 65535}, {574, 293}, {636, 7}, {640, 8}, {659, 15},
+    {676, 21}, {679, 5}, {701, 46}, {725, 44}, {734, 30}, {754, 19},
+    {757, 43}, {805, 6}, {820, 25}, {853, 2}, {884, 18}, {901, 208},
+    {955, 255}, {957, 65535}, {965, 376}, {1019, 225}, {1024, 246}, {1039, 225},
+    {1076, 287}, {1098, 219}, {1126, 261}, {1141, 234}, {1170, 223}, {1189, 254},
+    {1229, 407}, {1279, 393}, {1312, 384}, {1341, 409}, {1368, 397}, {1370, 398},
+    {1401, 399}, {0, 399}, {17, 395}, {48, 396}, {134, 65535}, {266, 73},
+    {301, 146}, {324, 111}, {348, 103}, {362, 137}, {374, 90}, {393, 161},
+    {422, 69}, {439, 94}, {443, 84}, {463, 165}, {486, 113}, {498, 162},
+    {511, 85}, {561, 65535}, {575, 293}, {636, 7}, {638, 8}, {657, 15},
+    {674, 21}, {680, 5}, {700, 46}, {725, 47}, {733, 30}, {753, 19},
+    {758, 43}, {802, 6}, {820, 25}, {854, 2}, {885, 18}, {902, 208},
+    {955, 65535}, {965, 376}, {1019, 225}, {1025, 246}, {1039, 225}, {1077, 287},
+    {1098, 219}, {1125, 261}, {1141, 234}, {1169, 223}, {1191, 254}, {1229, 407},
+    {1280, 393}, {1311, 384}, {1341, 409}, {1368, 397}, {1371, 398}, {1401, 399},
+    {0, 399}, {17, 395}, {49, 396}, {135, 65535}, {268, 73}, {301, 146},
+    {324, 111}, {347, 103}, {362, 137}, {373, 90}, {393, 161}, {422, 79},
+    {423, 69}, {438, 94}, {442, 84}, {463, 165}, {485, 113}, {498, 162},
+    {510, 85}, {561, 105}, {574, 65535}, {575, 293}, {636, 7}, {637, 8},
+    {656, 15}, {672, 21}, {680, 41}, {681, 5}, {700, 46}, {723, 32},
+    {724, 47}, {733, 30}, {753, 19}, {760, 43}, {800, 6}, {820, 25},
+    {854, 2}, {885, 18}, {903, 208}, {954, 65535}, {964, 376}, {1019, 225},
+    {1025, 246}, {1038, 225}, {1077, 287}, {1097, 219}, {1125, 261}, {1140, 234},
+    {1168, 223}, {1193, 254}, {1228, 407}, {1280, 393}, {1310, 384}, {1341, 409},
+    {1367, 397}, {1372, 398}, {1400, 399}, {0, 399}, {16, 395}, {49, 396},
+    {136, 65535}, {269, 73}, {301, 146}, {323, 111}, {346, 103}, {361, 137},
+    {372, 90}, {393, 161}, {421, 79}, {425, 69}, {438, 94}, {442, 84},
+    {463, 165}, {484, 113}, {497, 162}, {510, 85}, {561, 105}, {576, 293},
+    {635, 8}, {655, 15}, {669, 21}, {679, 41}, {683, 5}, {699, 0},
+    {703, 46}, {721, 32}, {725, 47}, {733, 30}, {753, 19}, {761, 43},
+    {798, 6}, {820, 25}, {855, 2}, {886, 18}, {903, 208}, {954, 65535},
+    {964, 376}, {1020, 225}, {1026, 246}, {1038, 225}, {1078, 287}, {1096, 219},
+    {1124, 261}, {1140, 234}, {1168, 223}, {1194, 254}, {1228, 407}, {1281, 393},
+    {1309, 384}, {1341, 409}, {1367, 397}, {1373, 398}, {1400, 399}, {0, 399},
+    {15, 395}, {49, 396}, {136, 65535}, {271, 73}, {300, 146}, {322, 111},
+    {346, 103}, {361, 137}, {371, 90}, {392, 161}, {420, 79}, {427, 69},
+    {438, 94}, {441, 84}, {463, 165}, {483, 113}, {497, 162}, {510, 85},
+    {560, 105}, {578, 293}, {635, 8}, {653, 15}, {667, 21}, {678, 41},
+    {686, 5}, {697, 0}, {706, 46}, {718, 32}, {725, 47}, {732, 30},
+    {752, 19}, {763, 43}, {795, 6}, {820, 25}, {855, 2}, {887, 18},
+    {904, 208}, {954, 65535}, {963, 376}, {1020, 225}, {1026, 246}, {1037, 225},
+    {1079, 287}, {1096, 219}, {1124, 261}, {1139, 234}, {1167, 223}, {1196, 254},
+    {1227, 407}, {1282, 393}, {1308, 384}, {1341, 409}, {1367, 397}, {1374, 398},
+    {1399, 399}, {0, 399}, {15, 395}, {50, 396}, {137, 65535}, {273, 73},
+    {300, 146}, {322, 111}, {345, 103}, {360, 137}, {370, 90}, {392, 161},
+    {420, 79}, {429, 69}, {437, 94}, {440, 84}, {463, 165}, {481, 113},
+    {497, 162}, {510, 85}, {559, 105}, {579, 293}, {635, 8}, {652, 15},
+    {665, 21}, {677, 41}, {688, 5}, {695, 0}, {708, 46}, {715, 1},
+    {717, 32}, {725, 47}, {732, 30}, {752, 19}, {765, 43}, {793, 6},
+    {820, 25}, {856, 2}, {887, 18}, {904, 208}, {953, 65535}, {963, 376},
+    {1021, 225}, {1027, 246}, {1034, 225}, {1079, 287}, {1095, 219}, {1123, 261},
+    {1139, 234}, {1166, 223}, {1197, 254}, {1226, 407}, {1282, 393}, {1308, 384},
+    {1340, 409}, {1366, 397}, {1375, 398}, {1399, 399}, {0, 399}, {14, 395},
+    {50, 396}, {138, 65535}, {275, 73}, {300, 146}, {321, 111}, {344, 103},
+    {360, 137}, {369, 90}, {392, 161}, {419, 79}, {431, 69}, {437, 94},
+    {439, 84}, {463, 165}, {480, 113}, {496, 162}, {509, 85}, {559, 105},
+    {579, 155}, {581, 293}, {634, 8}, {651, 15}, {663, 21}, {676, 41},
+    {690, 5}, {693, 0}, {711, 1}, {717, 32}, {725, 47}, {732, 30},
+    {751, 19}, {766, 43}, {791, 6}, {820, 25}, {857, 2}, {888, 18},
+    {905, 208}, {953, 65535}, {963, 376}, {1021, 225}, {1028, 246}, {1032, 225},
+    {1080, 287}, {1094, 219}, {1123, 261}, {1138, 234}, {1165, 223}, {1199, 254},
+    {1226, 407}, {1283, 393}, {1307, 384}, {1340, 409}, {1366, 397}, {1376, 398},
+    {1398, 399}, {0, 399}, {14, 395}, {50, 396}, {138, 65535}, {277, 73},
+    {300, 146}, {321, 111}, {344, 103}, {359, 137}, {368, 90}, {392, 161},
+    {418, 79}, {433, 69}, {437, 94}, {438, 84}, {463, 165}, {479, 113},
+    {496, 162}, {509, 85}, {558, 105}, {579, 155}, {583, 293}, {634, 8},
+    {650, 15}, {660, 21}, {675, 41}, {692, 0}, {711, 1}, {718, 32},
+    {726, 47}, {732, 30}, {751, 19}, {768, 43}, {788, 6}, {820, 25},
+    {857, 2}, {888, 18}, {905, 208}, {952, 375}, {956, 65535}, {962, 376},
+    {1022, 225}, {1029, 246}, {1031, 225}, {1080, 287}, {1093, 219}, {1121, 248},
+    {1122, 261}, {1138, 234}, {1165, 223}, {1201, 254}, {1225, 407}, {1283, 393},
+    {1306, 384}, {1340, 409}, {1366, 397}, {1376, 398}, {1398, 399}, {0, 399},
+    {13, 395}, {51, 396}, {139, 65535}, {280, 73}, {300, 146}, {320, 111},
+    {343, 103}, {359, 137}, {367, 90}, {392, 161}, {417, 79}, {435, 69},
+    {436, 94}, {437, 84}, {463, 165}, {478, 113}, {496, 162}, {509, 85},
+    {557, 105}, {579, 155}, {585, 293}, {633, 8}, {648, 15}, {658, 21},
+    {675, 41}, {692, 0}, {711, 1}, {718, 32}, {726, 47}, {732, 30},
+    {751, 19}, {769, 43}, {786, 6}, {820, 25}, {858, 2}, {889, 18},
+    {906, 208}, {950, 375}, {959, 65535}, {962, 376}, {1022, 225}, {1081, 287},
+    {1093, 219}, {1113, 248}, {1125, 261}, {1137, 234}, {1164, 223}, {1202, 254},
+    {1225, 407}, {1284, 393}, {1305, 384}, {1340, 409}, {1365, 397}, {1377, 398},
+    {1397, 399}, {0, 399}, {12, 395}, {51, 396}, {139, 65535}, {283, 73},
+    {299, 146}, {320, 111}, {342, 103}, {358, 137}, {366, 90}, {391, 161},
+    {416, 79}, {437, 84}, {463, 165}, {477, 113}, {495, 162}, {508, 85},
+    {557, 105}, {579, 155}, {588, 293}, {633, 8}, {647, 15}, {656, 21},
+    {674, 41}, {692, 0}, {711, 1}, {719, 32}, {726, 47}, {732, 30},
+    {750, 36}, {752, 19}, {771, 43}, {784, 6}, {820, 25}, {858, 2},
+    {889, 18}, {907, 208}, {948, 375}, {962, 376}, {1023, 225}, {1082, 287},
+    {1092, 219}, {1104, 248}, {1128, 261}, {1137, 234}, {1163, 223}, {1204, 254},
+    {1224, 407}, {1285, 393}, {1304, 384}, {1340, 409}, {1365, 397}, {1378, 398},
+    {1397, 399}, {0, 399}, {12, 395}, {51, 396}, {140, 65535}, {287, 73},
+    {299, 146}, {319, 111}, {341, 103}, {357, 137}, {365, 90}, {391, 161},
+    {416, 79}, {438, 84}, {463, 165}, {475, 113}, {495, 162}, {508, 85},
+    {556, 105}, {579, 155}, {590, 293}, {633, 8}, {646, 15}, {654, 21},
+    {673, 41}, {691, 0}, {711, 1}, {719, 32}, {726, 47}, {732, 30},
+    {750, 36}, {752, 19}, {772, 43}, {782, 6}, {820, 25}, {859, 2},
+    {890, 18}, {907, 208}, {946, 375}, {962, 376}, {1023, 225}, {1082, 287},
+    {1091, 219}, {1096, 248}, {1130, 261}, {1137, 234}, {1163, 223}, {1206, 254},
+    {1224, 407}, {1285, 393}, {1303, 384}, {1340, 409}, {1364, 397}, {1379, 398},
+    {1396, 399}, {0, 399}, {9, 414}, {11, 395}, {52, 396}, {140, 65535},
+    {294, 73}, {299, 146}, {319, 111}, {341, 103}, {357, 137}, {364, 90},
+    {391, 161}, {415, 79}, {439, 84}, {463, 165}, {474, 113}, {495, 162},
+    {508, 85}, {555, 105}, {579, 155}, {592, 293}, {632, 8}, {645, 15},
+    {652, 21}, {672, 41}, {691, 0}, {711, 1}, {719, 32}, {727, 47},
+    {732, 30}, {749, 36}, {752, 19}, {774, 43}, {780, 6}, {820, 25},
+    {860, 2}, {891, 18}, {907, 40}, {945, 375}, {963, 376}, {1023, 225},
+    {1083, 287}, {1090, 248}, {1133, 261}, {1136, 234}, {1162, 223}, {1207, 254},
+    {1223, 407}, {1286, 393}, {1302, 384}, {1340, 409}, {1364, 397}, {1380, 398},
+    {1396, 399}, {0, 399}, {6, 414}, {11, 395}, {52, 396}, {141, 65535},
+    {300, 146}, {318, 111}, {340, 103}, {356, 137}, {363, 90}, {391, 161},
+    {414, 79}, {439, 84}, {463, 165}, {473, 113}, {494, 162}, {507, 85},
+    {555, 105}, {579, 155}, {594, 293}, {632, 8}, {643, 15}, {650, 21},
+    {671, 41}, {691, 0}, {711, 1}, {720, 32}, {727, 47}, {732, 30},
+    {748, 36}, {753, 19}, {775, 43}, {777, 6}, {820, 25}, {860, 2},
+    {891, 18}, {902, 40}, {944, 375}, {963, 376}, {1024, 225}, {1084, 287},
+    {1088, 248}, {1136, 234}, {1161, 223}, {1209, 254}, {1223, 407}, {1286, 393},
+    {1301, 384}, {1340, 409}, {1364, 397}, {1381, 398}, {1395, 399}, {0, 399},
+    {3, 414}, {11, 395}, {52, 396}, {141, 65535}, {303, 146}, {317, 111},
+    {339, 103}, {356, 137}, {362, 90}, {391, 161}, {413, 79}, {440, 84},
+    {464, 165}, {472, 113}, {494, 162}, {507, 85}, {553, 75}, {555, 105},
+    {579, 155}, {596, 293}, {631, 8}, {642, 15}, {647, 21}, {670, 41},
+    {691, 0}, {711, 1}, {720, 32}, {727, 47}, {732, 30}, {748, 36},
+    {753, 19}, {776, 6}, {820, 25}, {861, 2}, {892, 18}, {898, 40},
+    {944, 375}, {964, 376}, {1024, 225}, {1084, 287}, {1085, 248}, {1137, 234},
+    {1160, 223}, {1210, 254}, {1222, 407}, {1287, 393}, {1301, 384}, {1340, 409},
+    {1363, 397}, {1382, 398}, {1395, 399}, {0, 414}, {11, 395}, {53, 396},
+    {141, 65535}, {306, 146}, {317, 111}, {339, 103}, {355, 137}, {361, 90},
+    {390, 161}, {412, 79}, {441, 84}, {464, 165}, {471, 113}, {494, 162},
+    {507, 85}, {551, 75}, {554, 105}, {579, 155}, {599, 293}, {631, 8},
+    {641, 15}, {645, 21}, {669, 41}, {691, 0}, {711, 1}, {721, 32},
+    {727, 47}, {732, 30}, {747, 36}, {753, 19}, {776, 6}, {820, 25},
+    {861, 2}, {892, 18}, {893, 40}, {943, 375}, {964, 376}, {1025, 225},
+    {1084, 248}, {1139, 234}, {1159, 249}, {1160, 223}, {1212, 254}, {1222, 407},
+    {1288, 393}, {1300, 384}, {1340, 409}, {1363, 397}, {1383, 398}, {1394, 399},
+    {1439, 414}, {0, 414}, {10, 395}, {53, 396}, {142, 65535}, {309, 146},
+    {316, 111}, {330, 390}, {356, 137}, {360, 90}, {390, 161}, {411, 79},
+    {442, 84}, {463, 78}, {472, 113}, {493, 162}, {506, 85}, {550, 75},
+    {554, 105}, {579, 155}, {601, 293}, {631, 8}, {640, 15}, {643, 21},
+    {668, 41}, {691, 0}, {711, 1}, {721, 32}, {728, 47}, {732, 30},
+    {747, 36}, {754, 19}, {776, 6}, {820, 25}, {862, 2}, {892, 40},
+    {942, 375}, {965, 376}, {1025, 225}, {1084, 248}, {1140, 234}, {1156, 249},
+    {1161, 223}, {1214, 254}, {1221, 407}, {1288, 393}, {1299, 384}, {1340, 409},
+    {1363, 397}, {1384, 398}, {1394, 399}, {1436, 414}, {0, 414}, {10, 395},
+    {53, 396}, {142, 65535}, {314, 146}, {316, 111}, {317, 390}, {360, 90},
+    {390, 161}, {411, 79}, {443, 84}, {462, 78}, {474, 113}, {493, 162},
+    {506, 85}, {548, 75}, {554, 105}, {579, 155}, {603, 293}, {630, 8},
+    {638, 15}, {641, 21}, {667, 41}, {691, 0}, {711, 1}, {722, 32},
+    {728, 47}, {732, 30}, {746, 36}, {754, 19}, {776, 6}, {820, 25},
+    {863, 2}, {891, 40}, {942, 375}, {965, 376}, {1026, 225}, {1084, 248},
+    {1142, 234}, {1154, 249}, {1162, 223}, {1215, 254}, {1220, 407}, {1289, 393},
+    {1298, 384}, {1340, 409}, {1362, 397}, {1384, 398}, {1393, 399}, {1432, 414},
+    {0, 414}, {10, 395}, {54, 396}, {142, 65535}, {315, 390}, {362, 90},
+    {390, 161}, {410, 79}, {444, 84}, {461, 78}, {475, 113}, {493, 162},
+    {506, 85}, {546, 75}, {554, 105}, {579, 155}, {605, 293}, {630, 8},
+    {637, 15}, {639, 21}, {666, 41}, {690, 0}, {711, 1}, {722, 32},
+    {728, 47}, {732, 30}, {746, 36}, {754, 19}, {776, 6}, {820, 25},
+    {863, 2}, {890, 40}, {941, 375}, {966, 376}, {1026, 225}, {1084, 248},
+    {1143, 234}, {1151, 249}, {1163, 223}, {1217, 254}, {1220, 407}, {1289, 393},
+    {1297, 384}, {1340, 409}, {1362, 397}, {1385, 398}, {1393, 399}, {1429, 414},
+    {0, 414}, {10, 395}, {54, 396}, {143, 65535}, {314, 390}, {364, 90},
+    {389, 161}, {409, 79}, {444, 84}, {460, 78}, {477, 113}, {492, 162},
+    {505, 85}, {544, 75}, {553, 105}, {579, 155}, {607, 293}, {630, 8},
+    {636, 15}, {637, 21}, {666, 41}, {690, 0}, {711, 1}, {722, 32},
+    {728, 47}, {732, 30}, {745, 36}, {755, 19}, {776, 6}, {820, 25},
+    {864, 2}, {888, 40}, {940, 375}, {966, 376}, {1027, 225}, {1084, 248},
+    {1143, 272}, {1146, 234}, {1149, 249}, {1163, 223}, {1218, 254}, {1219, 407},
+    {1290, 393}, {1296, 384}, {1340, 409}, {1362, 397}, {1386, 398}, {1392, 399},
+    {1426, 414}, {0, 414}, {9, 395}, {54, 396}, {143, 65535}, {314, 390},
+    {366, 90}, {389, 161}, {408, 79}, {445, 84}, {458, 78}, {479, 113},
+    {492, 162}, {505, 85}, {543, 75}, {553, 105}, {579, 155}, {609, 293},
+    {629, 8}, {635, 21}, {665, 41}, {690, 0}, {712, 1}, {723, 32},
+    {729, 47}, {732, 30}, {745, 36}, {755, 19}, {776, 6}, {820, 25},
+    {864, 2}, {887, 40}, {940, 375}, {967, 376}, {1027, 225}, {1083, 248},
+    {1142, 272}, {1148, 249}, {1164, 223}, {1219, 407}, {1289, 239}, {1292, 393},
+    {1295, 384}, {1339, 409}, {1361, 397}, {1387, 398}, {1392, 399}, {1423, 414},
+    {0, 414}, {9, 395}, {55, 396}, {143, 65535}, {313, 390}, {368, 90},
+    {389, 161}, {407, 79}, {446, 84}, {457, 78}, {480, 113}, {492, 162},
+    {505, 85}, {541, 75}, {553, 105}, {579, 155}, {611, 293}, {629, 8},
+    {633, 21}, {664, 41}, {690, 0}, {712, 1}, {723, 32}, {729, 47},
+    {732, 30}, {744, 36}, {755, 19}, {776, 6}, {820, 25}, {865, 2},
+    {886, 40}, {939, 375}, {967, 376}, {1027, 225}, {1083, 248}, {1141, 272},
+    {1148, 249}, {1165, 223}, {1219, 407}, {1288, 239}, {1295, 384}, {1339, 409},
+    {1361, 397}, {1388, 398}, {1391, 399}, {1419, 414}, {0, 414}, {9, 395},
+    {55, 396}, {143, 65535}, {313, 390}, {370, 90}, {389, 161}, {407, 79},
+    {447, 84}, {456, 78}, {482, 113}, {491, 162}, {504, 85}, {539, 75},
+    {553, 105}, {579, 155}, {614, 293}, {628, 8}, {632, 21}, {663, 41},
+    {690, 0}, {712, 1}, {724, 32}, {729, 47}, {732, 30}, {744, 36},
+    {756, 19}, {776, 6}, {820, 25}, {866, 2}, {885, 40}, {938, 375},
+    {968, 376}, {1028, 225}, {1083, 248}, {1140, 272}, {1148, 249}, {1166, 223},
+    {1219, 407}, {1286, 239}, {1296, 384}, {1339, 409}, {1361, 397}, {1389, 398},
+    {1391, 399}, {1416, 414}, {0, 414}, {8, 395}, {55, 396}, {144, 65535},
+    {312, 390}, {372, 90}, {389, 161}, {406, 79}, {448, 84}, {455, 78},
+    {484, 113}, {491, 162}, {504, 85}, {538, 75}, {553, 105}, {579, 155},
+    {616, 293}, {628, 8}, {630, 21}, {662, 41}, {690, 0}, {712, 1},
+    {724, 32}, {729, 47}, {732, 30}, {743, 36}, {756, 19}, {777, 6},
+    {820, 25}, {866, 2}, {884, 40}, {938, 375}, {968, 376}, {1028, 225},
+    {1083, 248}, {1140, 272}, {1148, 249}, {1166, 223}, {1220, 407}, {1285, 239},
+    {1297, 384}, {1339, 409}, {1360, 397}, {1390, 399}, {1413, 414}, {0, 414},
+    {8, 395}, {56, 396}, {144, 65535}, {155, 400}, {169, 65535}, {312, 390},
+    {374, 90}, {388, 161}, {405, 79}, {449, 84}, {454, 78}, {485, 113},
+    {491, 162}, {504, 85}, {536, 75}, {552, 105}, {579, 155}, {618, 293},
+    {628, 8}, {629, 21}, {661, 41}, {690, 0}, {712, 1}, {724, 32},
+    {730, 47}, {732, 30}, {743, 36}, {756, 19}, {777, 6}, {820, 25},
+    {867, 2}, {883, 40}, {937, 375}, {969, 376}, {1029, 225}, {1083, 248},
+    {1139, 272}, {1148, 249}, {1167, 223}, {1220, 407}, {1283, 239}, {1298, 384},
+    {1339, 409}, {1360, 397}, {1390, 399}, {1410, 414}, {0, 414}, {8, 395},
+    {56, 396}, {144, 65535}, {150, 400}, {174, 65535}, {312, 390}, {376, 90},
+    {388, 161}, {404, 79}, {449, 84}, {452, 78}, {487, 113}, {490, 162},
+    {503, 85}, {534, 75}, {552, 105}, {579, 155}, {620, 293}, {627, 8},
+    {628, 21}, {660, 41}, {689, 0}, {712, 1}, {725, 32}, {730, 47},
+    {732, 30}, {742, 36}, {757, 19}, {777, 6}, {820, 25}, {867, 2},
+    {882, 40}, {936, 375}, {969, 376}, {1029, 225}, {1083, 248}, {1138, 272},
+    {1148, 249}, {1168, 223}, {1220, 407}, {1281, 239}, {1299, 384}, {1339, 409},
+    {1360, 397}, {1390, 399}, {1406, 414}, {0, 414}, {8, 395}, {56, 396},
+    {144, 65535}, {146, 400}, {178, 65535}, {311, 390}, {378, 90}, {388, 161},
+    {403, 79}, {450, 84}, {451, 78}, {488, 113}, {490, 162}, {503, 85},
+    {533, 75}, {552, 105}, {579, 155}, {622, 293}, {627, 21}, {659, 41},
+    {689, 0}, {712, 1}, {725, 32}, {730, 47}, {732, 30}, {742, 36},
+    {757, 19}, {777, 6}, {821, 25}, {867, 42}, {871, 2}, {881, 40},
+    {936, 375}, {970, 376}, {1030, 225}, {1082, 248}, {1137, 272}, {1148, 249},
+    {1169, 223}, {1220, 407}, {1280, 239}, {1300, 384}, {1339, 409}, {1359, 397},
+    {1389, 402}, {1392, 399}, {1403, 414}, {0, 414}, {7, 395}, {57, 396},
+    {144, 400}, {181, 65535}, {311, 390}, {380, 90}, {388, 161}, {403, 79},
+    {450, 78}, {490, 162}, {503, 85}, {531, 75}, {552, 105}, {579, 155},
+    {624, 293}, {626, 21}, {658, 41}, {689, 0}, {712, 1}, {726, 32},
+    {730, 47}, {732, 30}, {741, 36}, {757, 19}, {777, 6}, {821, 25},
+    {866, 42}, {877, 2}, {880, 40}, {935, 375}, {970, 376}, {1030, 225},
+    {1082, 248}, {1136, 272}, {1148, 249}, {1169, 223}, {1220, 407}, {1278, 239},
+    {1301, 384}, {1339, 409}, {1359, 397}, {1387, 402}, {1394, 399}, {1400, 414},
+    {0, 414}, {7, 395}, {57, 396}, {143, 400}, {184, 65535}, {310, 390},
+    {382, 90}, {386, 112}, {402, 79}, {450, 78}, {490, 162}, {502, 85},
+    {529, 75}, {551, 105}, {579, 155}, {626, 21}, {657, 41}, {689, 0},
+    {712, 1}, {726, 32}, {731, 47}, {732, 30}, {740, 48}, {742, 36},
+    {758, 19}, {777, 6}, {821, 25}, {864, 42}, {880, 40}, {934, 375},
+    {971, 376}, {1031, 225}, {1082, 248}, {1135, 272}, {1148, 249}, {1170, 223},
+    {1220, 407}, {1277, 239}, {1302, 384}, {1339, 409}, {1359, 397}, {1386, 402},
+    {1396, 399}, {1397, 414}, {0, 414}, {7, 395}, {57, 396}, {143, 400},
+    {186, 65535}, {310, 390}, {384, 112}, {403, 79}, {450, 78}, {491, 162},
+    {502, 85}, {528, 75}, {551, 105}, {579, 155}, {626, 21}, {657, 41},
+    {689, 0}, {712, 1}, {726, 32}, {731, 30}, {738, 48}, {744, 36},
+    {758, 19}, {777, 6}, {821, 25}, {860, 26}, {864, 42}, {880, 40},
+    {933, 375}, {971, 376}, {1031, 225}, {1082, 248}, {1134, 272}, {1148, 249},
+    {1171, 223}, {1218, 253}, {1221, 407}, {1275, 239}, {1302, 384}, {1339, 409},
+    {1358, 397}, {1384, 402}, {1396, 414}, {0, 414}, {6, 395}, {58, 396},
+    {142, 400}, {188, 65535}, {310, 390}, {383, 112}, {404, 79}, {450, 78},
+    {492, 162}, {502, 85}, {526, 75}, {551, 105}, {579, 155}, {627, 21},
+    {656, 41}, {689, 0}, {712, 1}, {727, 32}, {731, 30}, {736, 48},
+    {745, 36}, {758, 19}, {777, 6}, {821, 25}, {855, 26}, {863, 42},
+    {880, 40}, {933, 375}, {972, 376}, {1031, 225}, {1082, 248}, {1133, 272},
+    {1148, 249}, {1172, 223}, {1215, 253}, {1222, 407}, {1273, 239}, {1303, 384},
+    {1339, 409}, {1358, 397}, {1383, 402}, {1397, 414}, {0, 414}, {6, 395},
+    {58, 396}, {141, 400}, {189, 65535}, {310, 390}, {383, 112}, {406, 79},
+    {450, 78}, {492, 162}, {501, 85}, {524, 75}, {551, 105}, {579, 155},
+    {628, 21}, {655, 41}, {689, 0}, {712, 1}, {727, 32}, {731, 30},
+    {735, 48}, {747, 36}, {759, 19}, {777, 6}, {820, 28}, {823, 25},
+    {849, 26}, {863, 42}, {881, 40}, {932, 375}, {972, 376}, {1032, 225},
+    {1081, 248}, {1133, 272}, {1148, 249}, {1172, 223}, {1213, 253}, {1223, 407},
+    {1272, 239}, {1304, 384}, {1339, 409}, {1358, 397}, {1381, 402}, {1397, 414},
+    {0, 414}, {6, 395}, {58, 396}, {141, 400}, {191, 65535}, {309, 390},
+    {383, 112}, {407, 79}, {450, 78}, {493, 162}, {501, 85}, {523, 75},
+    {551, 105}, {579, 155}, {628, 21}, {654, 41}, {688, 0}, {712, 1},
+    {728, 32}, {732, 30}, {733, 48}, {749, 36}, {759, 19}, {777, 6},
+    {820, 28}, {827, 25}, {843, 26}, {863, 42}, {881, 40}, {931, 375},
+    {973, 376}, {1032, 225}, {1081, 248}, {1132, 272}, {1148, 262}, {1149, 249},
+    {1173, 223}, {1211, 253}, {1224, 407}, {1270, 239}, {1305, 384}, {1339, 409},
+    {1357, 397}, {1380, 402}, {1397, 414}, {0, 414}, {6, 395}, {59, 396},
+    {140, 400}, {193, 65535}, {309, 390}, {383, 112}, {408, 79}, {450, 78},
+    {493, 162}, {501, 85}, {521, 75}, {550, 105}, {579, 155}, {629, 21},
+    {653, 41}, {688, 0}, {712, 1}, {728, 32}, {731, 48}, {750, 36},
+    {758, 31}, {764, 19}, {777, 6}, {819, 28}, {831, 25}, {838, 26},
+    {862, 42}, {882, 40}, {931, 375}, {973, 376}, {1033, 225}, {1081, 248},
+    {1131, 272}, {1148, 262}, {1151, 249}, {1174, 223}, {1209, 253}, {1224, 407},
+    {1269, 239}, {1306, 384}, {1339, 409}, {1357, 397}, {1378, 402}, {1398, 414},
+    {0, 414}, {5, 395}, {59, 396}, {140, 400}, {194, 65535}, {309, 390},
+    {383, 112}, {409, 79}, {450, 78}, {494, 162}, {501, 85}, {519, 75},
+    {550, 105}, {579, 155}, {630, 21}, {652, 41}, {688, 0}, {712, 1},
+    {728, 32}, {730, 48}, {752, 36}, {753, 31}, {777, 6}, {819, 28},
+    {835, 26}, {862, 42}, {882, 40}, {930, 375}, {974, 376}, {1033, 225},
+    {1081, 248}, {1130, 272}, {1148, 262}, {1152, 249}, {1175, 223}, {1206, 253},
+    {1225, 407}, {1267, 239}, {1307, 384}, {1339, 409}, {1356, 397}, {1377, 402},
+    {1398, 414}, {0, 414}, {5, 395}, {59, 396}, {139, 400}, {195, 65535},
+    {309, 390}, {383, 112}, {410, 79}, {449, 78}, {494, 174}, {501, 85},
+    {518, 75}, {550, 105}, {579, 155}, {630, 21}, {651, 41}, {688, 0},
+    {712, 1}, {729, 48}, {752, 31}, {777, 6}, {818, 28}, {836, 26},
+    {862, 42}, {882, 40}, {929, 375}, {974, 376}, {1034, 225}, {1081, 248},
+    {1129, 272}, {1147, 262}, {1154, 249}, {1175, 223}, {1204, 253}, {1226, 407},
+    {1265, 239}, {1308, 384}, {1338, 409}, {1356, 397}, {1375, 402}, {1398, 414},
+    {0, 414}, {5, 395}, {60, 396}, {138, 400}, {197, 65535}, {308, 390},
+    {383, 112}, {411, 79}, {449, 78}, {493, 174}, {504, 85}, {516, 75},
+    {550, 105}, {579, 155}, {631, 21}, {650, 41}, {688, 0}, {712, 1},
+    {728, 48}, {752, 31}, {778, 6}, {818, 28}, {837, 26}, {861, 42},
+    {883, 40}, {929, 375}, {975, 376}, {1034, 225}, {1081, 248}, {1128, 272},
+    {1147, 262}, {1155, 249}, {1176, 223}, {1202, 253}, {1227, 407}, {1264, 239},
+    {1309, 384}, {1338, 409}, {1356, 397}, {1374, 402}, {1399, 414}, {0, 414},
+    {5, 395}, {60, 396}, {138, 400}, {198, 65535}, {308, 390}, {383, 112},
+    {413, 79}, {449, 78}, {492, 174}, {507, 85}, {514, 75}, {549, 105},
+    {579, 155}, {632, 21}, {649, 41}, {688, 0}, {713, 1}, {728, 48},
+    {752, 31}, {778, 6}, {817, 28}, {837, 26}, {861, 42}, {883, 40},
+    {928, 375}, {975, 376}, {1034, 225}, {1080, 248}, {1127, 272}, {1147, 262},
+    {1157, 249}, {1177, 223}, {1200, 253}, {1228, 407}, {1262, 239}, {1310, 384},
+    {1338, 409}, {1355, 397}, {1372, 402}, {1399, 414}, {0, 414}, {4, 395},
+    {60, 396}, {137, 400}, {199, 65535}, {308, 390}, {382, 112}, {414, 79},
+    {449, 78}, {491, 174}, {510, 85}, {513, 75}, {549, 105}, {579, 155},
+    {632, 21}, {649, 41}, {687, 0}, {713, 1}, {727, 48}, {752, 31},
+    {778, 10}, {779, 6}, {817, 28}, {838, 26}, {860, 42}, {884, 40},
+    {927, 375}, {976, 376}, {1035, 225}, {1080, 248}, {1126, 272}, {1147, 262},
+    {1159, 249}, {1177, 223}, {1197, 253}, {1227, 228}, {1229, 407}, {1261, 239},
+    {1311, 384}, {1338, 409}, {1355, 397}, {1371, 402}, {1399, 414}, {0, 414},
+    {4, 395}, {60, 396}, {137, 400}, {200, 65535}, {308, 390}, {382, 112},
+    {415, 79}, {449, 78}, {491, 174}, {512, 75}, {549, 105}, {579, 155},
+    {633, 21}, {648, 41}, {687, 0}, {713, 1}, {726, 48}, {752, 31},
+    {778, 10}, {782, 6}, {816, 28}, {839, 26}, {860, 42}, {884, 40},
+    {927, 375}, {976, 376}, {1035, 225}, {1080, 248}, {1125, 272}, {1146, 262},
+    {1160, 249}, {1178, 223}, {1195, 253}, {1227, 228}, {1231, 407}, {1259, 239},
+    {1311, 384}, {1335, 382}, {1343, 409}, {1355, 397}, {1369, 402}, {1400, 414},
+    {0, 414}, {4, 395}, {61, 396}, {136, 400}, {201, 65535}, {308, 390},
+    {382, 112}, {416, 79}, {447, 102}, {449, 78}, {490, 174}, {512, 75},
+    {549, 105}, {579, 155}, {634, 21}, {647, 41}, {687, 0}, {713, 1},
+    {725, 48}, {752, 31}, {777, 10}, {784, 6}, {815, 28}, {840, 26},
+    {860, 42}, {884, 40}, {926, 375}, {977, 376}, {1036, 225}, {1080, 248},
+    {1125, 272}, {1146, 262}, {1162, 249}, {1179, 223}, {1193, 253}, {1226, 228},
+    {1233, 407}, {1258, 239}, {1312, 384}, {1331, 382}, {1348, 409}, {1354, 397},
+    {1368, 402}, {1400, 414}, {0, 414}, {3, 395}, {61, 396}, {135, 400},
+    {202, 65535}, {308, 390}, {382, 112}, {417, 79}, {445, 102}, {450, 78},
+    {489, 174}, {512, 75}, {548, 105}, {579, 155}, {634, 21}, {646, 41},
+    {687, 0}, {713, 1}, {725, 48}, {752, 31}, {776, 10}, {787, 6},
+    {815, 11}, {816, 28}, {841, 26}, {859, 42}, {885, 40}, {925, 375},
+    {977, 376}, {1036, 225}, {1080, 248}, {1124, 272}, {1146, 262}, {1163, 249},
+    {1180, 223}, {1191, 253}, {1225, 228}, {1235, 407}, {1256, 239}, {1313, 384},
+    {1328, 382}, {1353, 409}, {1354, 397}, {1366, 402}, {1400, 414}, {0, 414},
+    {3, 395}, {61, 396}, {135, 400}, {203, 65535}, {308, 390}, {382, 112},
+    {418, 79}, {442, 102}, {452, 78}, {480, 138}, {489, 174}, {512, 75},
+    {548, 105}, {578, 155}, {635, 21}, {645, 41}, {687, 0}, {713, 1},
+    {724, 48}, {752, 31}, {775, 10}, {790, 6}, {814, 11}, {818, 28},
+    {842, 26}, {859, 42}, {885, 40}, {925, 375}, {978, 376}, {1037, 225},
+    {1080, 248}, {1123, 272}, {1146, 262}, {1165, 249}, {1180, 223}, {1188, 253},
+    {1225, 228}, {1237, 407}, {1254, 239}, {1314, 384}, {1324, 382}, {1355, 397},
+    {1365, 402}, {1401, 414}, {0, 414}, {3, 395}, {62, 396}, {134, 400},
+    {204, 65535}, {308, 390}, {382, 112}, {420, 79}, {439, 102}, {453, 78},
+    {471, 138}, {489, 174}, {512, 75}, {548, 105}, {578, 155}, {636, 21},
+    {644, 41}, {687, 0}, {713, 1}, {723, 48}, {752, 31}, {774, 10},
+    {792, 6}, {813, 11}, {820, 28}, {843, 26}, {859, 42}, {886, 40},
+    {924, 375}, {978, 376}, {1037, 225}, {1079, 248}, {1122, 272}, {1145, 262},
+    {1167, 249}, {1181, 223}, {1186, 253}, {1224, 228}, {1238, 407}, {1253, 239},
+    {1315, 384}, {1321, 382}, {1357, 397}, {1363, 402}, {1401, 414}, {0, 414},
+    {3, 395}, {62, 396}, {133, 400}, {204, 65535}, {308, 390}, {382, 112},
+    {421, 79}, {436, 102}, {454, 78}, {461, 138}, {489, 174}, {512, 75},
+    {548, 105}, {578, 155}, {636, 21}, {643, 41}, {687, 0}, {713, 1},
+    {722, 48}, {752, 31}, {774, 10}, {795, 6}, {813, 11}, {822, 28},
+    {844, 26}, {858, 42}, {886, 40}, {923, 375}, {979, 376}, {1037, 225},
+    {1079, 248}, {1121, 272}, {1145, 262}, {1168, 249}, {1182, 223}, {1184, 253},
+    {1224, 228}, {1240, 407}, {1251, 239}, {1316, 384}, {1317, 382}, {1358, 397},
+    {1362, 402}, {1401, 414}, {0, 414}, {2, 389}, {3, 395}, {62, 396},
+    {133, 400}, {205, 65535}, {308, 390}, {381, 112}, {422, 79}, {434, 102},
+    {454, 138}, {489, 174}, {513, 75}, {548, 105}, {578, 155}, {637, 21},
+    {642, 41}, {686, 0}, {713, 1}, {722, 48}, {752, 31}, {773, 10},
+    {797, 6}, {812, 11}, {824, 28}, {845, 26}, {858, 42}, {886, 40},
+    {923, 375}, {979, 370}, {982, 376}, {1038, 225}, {1079, 248}, {1120, 272},
+    {1145, 262}, {1170, 249}, {1182, 253}, {1223, 228}, {1242, 407}, {1250, 239},
+    {1316, 382}, {1360, 402}, {1402, 414}, {0, 389}, {4, 395}, {63, 396},
+    {132, 400}, {206, 65535}, {308, 390}, {381, 112}, {423, 79}, {431, 102},
+    {455, 138}, {489, 174}, {513, 75}, {547, 105}, {578, 155}, {638, 21},
+    {642, 41}, {686, 0}, {713, 1}, {721, 48}, {752, 31}, {772, 10},
+    {800, 6}, {811, 11}, {826, 28}, {846, 26}, {858, 42}, {887, 40},
+    {922, 375}, {979, 370}, {993, 376}, {1038, 225}, {1079, 248}, {1119, 272},
+    {1145, 262}, {1171, 249}, {1181, 253}, {1223, 228}, {1244, 407}, {1248, 239},
+    {1316, 382}, {1360, 402}, {1402, 414}, {0, 389}, {4, 395}, {63, 396},
+    {132, 400}, {207, 65535}, {308, 390}, {381, 112}, {424, 79}, {428, 102},
+    {455, 138}, {489, 174}, {513, 75}, {547, 105}, {578, 155}, {638, 21},
+    {641, 41}, {686, 0}, {713, 1}, {720, 48}, {752, 31}, {771, 10},
+    {803, 6}, {811, 11}, {828, 28}, {847, 26}, {857, 42}, {887, 40},
+    {921, 375}, {979, 370}, {1003, 376}, {1039, 225}, {1079, 248}, {1118, 272},
+    {1144, 262}, {1173, 249}, {1181, 253}, {1222, 228}, {1246, 239}, {1315, 382},
+    {1361, 402}, {1402, 414}, {1438, 389}, {0, 389}, {5, 395}, {63, 396},
+    {131, 400}, {207, 65535}, {308, 390}, {381, 112}, {426, 102}, {456, 138},
+    {490, 174}, {513, 75}, {547, 105}, {578, 155}, {639, 21}, {640, 41},
+    {686, 0}, {713, 1}, {719, 48}, {753, 31}, {770, 10}, {802, 29},
+    {805, 6}, {810, 11}, {830, 28}, {848, 26}, {857, 42}, {888, 40},
+    {921, 375}, {979, 370}, {1014, 376}, {1039, 225}, {1078, 372}, {1081, 248},
+    {1118, 272}, {1144, 262}, {1174, 249}, {1180, 253}, {1222, 228}, {1246, 239},
+    {1315, 410}, {1316, 382}, {1361, 402}, {1402, 414}, {1437, 389}, {0, 389},
+    {5, 395}, {64, 396}, {130, 400}, {208, 65535}, {308, 390}, {381, 112},
+    {425, 102}, {456, 138}, {490, 174}, {513, 75}, {547, 105}, {578, 155},
+    {639, 41}, {686, 0}, {713, 1}, {719, 48}, {753, 31}, {770, 10},
+    {800, 29}, {808, 6}, {809, 11}, {832, 28}, {849, 26}, {856, 42},
+    {888, 40}, {920, 375}, {978, 370}, {1024, 376}, {1040, 225}, {1077, 372},
+    {1084, 248}, {1117, 272}, {1144, 262}, {1176, 249}, {1179, 253}, {1221, 228},
+    {1247, 239}, {1314, 410}, {1316, 382}, {1362, 402}, {1403, 414}, {1435, 389},
+    {0, 389}, {6, 395}, {64, 396}, {130, 400}, {209, 65535}, {308, 390},
+    {381, 112}, {425, 102}, {456, 138}, {490, 174}, {513, 75}, {546, 105},
+    {578, 155}, {640, 41}, {686, 0}, {713, 1}, {718, 48}, {753, 31},
+    {769, 10}, {798, 29}, {809, 11}, {834, 28}, {850, 26}, {856, 42},
+    {888, 40}, {919, 375}, {978, 370}, {1035, 376}, {1040, 225}, {1076, 372},
+    {1087, 248}, {1116, 272}, {1144, 262}, {1178, 253}, {1220, 228}, {1247, 239},
+    {1313, 410}, {1316, 382}, {1362, 402}, {1403, 414}, {1434, 389}, {0, 389},
+    {7, 395}, {64, 396}, {129, 400}, {209, 65535}, {308, 390}, {381, 112},
+    {424, 102}, {457, 138}, {490, 174}, {514, 75}, {546, 105}, {578, 155},
+    {640, 41}, {686, 0}, {713, 1}, {717, 48}, {753, 31}, {768, 10},
+    {796, 29}, {809, 11}, {836, 28}, {851, 26}, {856, 42}, {887, 17},
+    {889, 40}, {919, 375}, {978, 370}, {1041, 225}, {1075, 372}, {1090, 248},
+    {1115, 272}, {1142, 238}, {1145, 262}, {1178, 253}, {1220, 228}, {1248, 239},
+    {1311, 410}, {1317, 382}, {1363, 402}, {1403, 414}, {1432, 389}, {0, 389},
+    {7, 395}, {65, 396}, {129, 400}, {210, 65535}, {308, 390}, {381, 112},
+    {424, 102}, {457, 138}, {490, 174}, {514, 75}, {546, 105}, {578, 155},
+    {641, 41}, {685, 0}, {713, 1}, {716, 48}, {753, 31}, {767, 10},
+    {794, 29}, {809, 11}, {839, 28}, {852, 26}, {855, 42}, {885, 17},
+    {891, 40}, {918, 375}, {978, 370}, {1043, 225}, {1073, 372}, {1093, 248},
+    {1114, 272}, {1139, 238}, {1148, 262}, {1177, 253}, {1219, 228}, {1248, 239},
+    {1310, 410}, {1317, 382}, {1364, 402}, {1404, 414}, {1430, 389}, {0, 389},
+    {8, 395}, {65, 396}, {128, 400}, {210, 65535}, {308, 390}, {380, 112},
+    {423, 102}, {457, 138}, {490, 174}, {514, 75}, {546, 105}, {578, 155},
+    {641, 41}, {685, 0}, {714, 1}, {716, 48}, {753, 31}, {766, 10},
+    {792, 29}, {809, 11}, {841, 28}, {853, 26}, {855, 42}, {883, 17},
+    {892, 40}, {917, 375}, {978, 370}, {1045, 225}, {1072, 372}, {1096, 248},
+    {1113, 272}, {1137, 238}, {1150, 262}, {1177, 253}, {1219, 228}, {1248, 239},
+    {1309, 410}, {1318, 382}, {1364, 402}, {1404, 414}, {1429, 389}, {0, 389},
+    {9, 395}, {65, 396}, {127, 400}, {211, 65535}, {308, 390}, {380, 112},
+    {423, 102}, {458, 138}, {490, 174}, {514, 75}, {546, 105}, {578, 155},
+    {642, 41}, {685, 0}, {714, 1}, {715, 48}, {753, 31}, {766, 10},
+    {790, 29}, {809, 11}, {843, 28}, {854, 26}, {855, 42}, {880, 17},
+    {894, 40}, {917, 375}, {978, 370}, {1047, 225}, {1071, 372}, {1100, 248},
+    {1112, 272}, {1134, 238}, {1153, 262}, {1176, 253}, {1218, 228}, {1249, 239},
+    {1308, 410}, {1318, 382}, {1365, 402}, {1404, 414}, {1427, 389}, {0, 389},
+    {9, 395}, {66, 396}, {127, 400}, {211, 65535}, {309, 390}, {380, 112},
+    {422, 102}, {458, 138}, {491, 174}, {514, 75}, {545, 105}, {578, 155},
+    {642, 41}, {685, 0}, {714, 48}, {753, 31}, {765, 10}, {788, 29},
+    {809, 11}, {845, 28}, {854, 42}, {878, 17}, {895, 40}, {916, 375},
+    {977, 370}, {1049, 225}, {1070, 372}, {1103, 248}, {1111, 272}, {1132, 238},
+    {1155, 262}, {1176, 253}, {1218, 228}, {1249, 239}, {1307, 410}, {1318, 382},
+    {1365, 402}, {1405, 414}, {1426, 389}, {0, 389}, {10, 395}, {66, 396},
+    {126, 400}, {212, 65535}, {309, 390}, {380, 112}, {422, 102}, {458, 166},
+    {459, 138}, {491, 174}, {514, 75}, {545, 105}, {578, 155}, {643, 41},
+    {685, 0}, {713, 48}, {753, 31}, {764, 10}, {786, 29}, {809, 11},
+    {847, 28}, {855, 42}, {876, 17}, {897, 40}, {915, 375}, {977, 370},
+    {1051, 225}, {1069, 372}, {1106, 248}, {1111, 272}, {1129, 238}, {1157, 262},
+    {1175, 253}, {1217, 228}, {1250, 239}, {1306, 410}, {1319, 382}, {1364, 392},
+    {1367, 402}, {1405, 414}, {1424, 389}, {0, 389}, {11, 395}, {66, 396},
+    {125, 400}, {212, 65535}, {309, 390}, {380, 112}, {422, 102}, {458, 166},
+    {460, 138}, {491, 174}, {514, 75}, {545, 105}, {578, 155}, {643, 41},
+    {685, 0}, {713, 48}, {753, 31}, {763, 10}, {784, 29}, {809, 11},
+    {849, 28}, {855, 42}, {874, 17}, {898, 40}, {915, 375}, {977, 370},
+    {1053, 225}, {1068, 372}, {1109, 248}, {1110, 272}, {1127, 238}, {1160, 262},
+    {1175, 253}, {1217, 228}, {1250, 239}, {1305, 410}, {1319, 382}, {1363, 392},
+    {1368, 402}, {1405, 414}, {1422, 389}, {0, 389}, {11, 395}, {67, 396},
+    {125, 400}, {213, 65535}, {309, 390}, {380, 112}, {421, 102}, {458, 166},
+    {462, 138}, {491, 174}, {515, 75}, {542, 56}, {545, 105}, {578, 155},
+    {644, 41}, {685, 0}, {713, 48}, {753, 31}, {762, 10}, {782, 29},
+    {809, 11}, {851, 28}, {855, 42}, {871, 17}, {900, 40}, {914, 375},
+    {977, 370}, {1055, 225}, {1067, 372}, {1111, 272}, {1124, 238}, {1162, 262},
+    {1174, 253}, {1216, 228}, {1250, 239}, {1304, 410}, {1320, 382}, {1362, 392},
+    {1369, 402}, {1406, 414}, {1421, 389}, {0, 389}, {12, 395}, {67, 396},
+    {124, 400}, {213, 65535}, {309, 390}, {380, 112}, {421, 102}, {457, 166},
+    {463, 138}, {491, 174}, {515, 75}, {522, 56}, {545, 105}, {578, 155},
+    {644, 41}, {684, 0}, {712, 48}, {753, 31}, {762, 10}, {780, 29},
+    {809, 11}, {853, 28}, {855, 42}, {869, 17}, {901, 40}, {913, 375},
+    {977, 370}, {1057, 225}, {1065, 372}, {1113, 272}, {1122, 238}, {1165, 262},
+    {1174, 253}, {1215, 228}, {1251, 239}, {1303, 410}, {1320, 382}, {1362, 392},
+    {1371, 402}, {1406, 414}, {1419, 389}, {0, 389}, {12, 395}, {67, 396},
+    {124, 400}, {213, 65535}, {310, 390}, {380, 112}, {420, 102}, {457, 166},
+    {464, 138}, {491, 174}, {514, 56}, {545, 105}, {578, 155}, {644, 65535},
+    {645, 41}, {684, 0}, {712, 48}, {753, 31}, {761, 10}, {778, 29},
+    {810, 11}, {855, 42}, {867, 17}, {903, 40}, {913, 375}, {977, 370},
+    {1059, 225}, {1064, 372}, {1115, 272}, {1119, 238}, {1167, 262}, {1173, 253},
+    {1215, 228}, {1251, 239}, {1302, 410}, {1320, 382}, {1361, 392}, {1372, 402},
+    {1406, 414}, {1417, 389}, {0, 389}, {13, 395}, {68, 396}, {123, 400},
+    {214, 65535}, {310, 390}, {379, 112}, {420, 102}, {457, 166}, {466, 138},
+    {491, 174}, {514, 56}, {546, 105}, {578, 155}, {644, 65535}, {647, 41},
+    {684, 0}, {711, 48}, {753, 31}, {759, 33}, {762, 10}, {776, 29},
+    {810, 11}, {855, 42}, {865, 17}, {904, 40}, {912, 375}, {976, 370},
+    {1061, 225}, {1063, 372}, {1117, 238}, {1170, 262}, {1173, 253}, {1214, 228},
+    {1250, 303}, {1252, 239}, {1301, 410}, {1321, 382}, {1360, 392}, {1373, 402},
+    {1407, 414}, {1416, 389}, {0, 389}, {14, 395}, {68, 396}, {122, 400},
+    {214, 65535}, {310, 390}, {379, 112}, {419, 102}, {456, 166}, {467, 138},
+    {492, 174}, {513, 56}, {546, 105}, {577, 170}, {580, 155}, {644, 65535},
+    {648, 41}, {681, 298}, {692, 0}, {711, 48}, {753, 31}, {756, 33},
+    {765, 10}, {774, 29}, {810, 11}, {856, 42}, {862, 17}, {905, 373},
+    {906, 40}, {911, 375}, {976, 370}, {1062, 372}, {1118, 238}, {1172, 253},
+    {1214, 228}, {1249, 303}, {1253, 239}, {1300, 410}, {1321, 382}, {1359, 392},
+    {1375, 402}, {1407, 414}, {1414, 389}, {0, 389}, {14, 395}, {68, 396},
+    {122, 400}, {214, 65535}, {311, 390}, {379, 112}, {419, 102}, {456, 166},
+    {469, 138}, {492, 174}, {512, 56}, {547, 105}, {576, 170}, {581, 155},
+    {644, 65535}, {650, 41}, {677, 298}, {704, 0}, {710, 48}, {753, 31},
+    {754, 33}, {767, 10}, {772, 29}, {810, 11}, {856, 42}, {860, 17},
+    {904, 373}, {911, 375}, {976, 370}, {1062, 372}, {1118, 238}, {1172, 253},
+    {1213, 228}, {1248, 303}, {1254, 239}, {1298, 410}, {1322, 382}, {1359, 392},
+    {1376, 402}, {1407, 414}, {1413, 389}, {0, 389}, {15, 395}, {57, 387},
+    {69, 396}, {121, 400}, {215, 65535}, {311, 390}, {379, 112}, {418, 102},
+    {455, 166}, {470, 138}, {492, 174}, {512, 56}, {547, 105}, {574, 170},
+    {583, 155}, {644, 65535}, {652, 41}, {672, 298}, {711, 48}, {752, 33},
+    {769, 10}, {770, 29}, {810, 11}, {856, 42}, {858, 17}, {903, 373},
+    {912, 375}, {976, 370}, {1062, 372}, {1119, 238}, {1172, 253}, {1213, 228},
+    {1248, 303}, {1256, 239}, {1297, 410}, {1322, 382}, {1358, 392}, {1378, 402},
+    {1408, 414}, {1411, 389}, {0, 389}, {16, 395}, {45, 387}, {70, 396},
+    {121, 400}, {215, 65535}, {311, 390}, {379, 112}, {418, 102}, {455, 166},
+    {472, 138}, {492, 174}, {511, 56}, {547, 105}, {573, 170}, {585, 155},
+    {644, 65535}, {654, 41}, {668, 298}, {712, 48}, {751, 33}, {771, 29},
+    {810, 11}, {856, 17}, {902, 373}, {912, 375}, {976, 370}, {1062, 372},
+    {1119, 238}, {1172, 253}, {1212, 228}, {1247, 303}, {1257, 239}, {1296, 410},
+    {1322, 382}, {1357, 392}, {1379, 402}, {1408, 414}, {1409, 389}, {0, 389},
+    {16, 395}, {31, 387}, {71, 396}, {120, 400}, {215, 65535}, {312, 390},
+    {379, 112}, {417, 102}, {455, 166}, {473, 138}, {492, 174}, {510, 56},
+    {548, 105}, {572, 170}, {587, 155}, {644, 65535}, {656, 41}, {663, 298},
+    {713, 48}, {749, 33}, {773, 29}, {810, 11}, {856, 17}, {901, 373},
+    {911, 378}, {913, 375}, {976, 370}, {1061, 372}, {1120, 238}, {1173, 253},
+    {1212, 228}, {1246, 303}, {1258, 239}, {1295, 410}, {1323, 382}, {1357, 392},
+    {1380, 402}, {1408, 389}, {0, 389}, {17, 387}, {72, 396}, {119, 400},
+    {215, 65535}, {312, 390}, {379, 112}, {417, 102}, {454, 166}, {475, 138},
+    {492, 174}, {509, 56}, {548, 105}, {571, 170}, {588, 155}, {644, 65535},
+    {658, 298}, {715, 48}, {748, 33}, {776, 29}, {809, 34}, {814, 11},
+    {855, 17}, {899, 373}, {910, 378}, {914, 375}, {975, 370}, {1061, 372},
+    {1121, 238}, {1173, 253}, {1211, 228}, {1245, 303}, {1259, 239}, {1294, 410},
+    {1323, 382}, {1356, 392}, {1382, 402}, {1407, 389}, {0, 389}, {17, 387},
+    {72, 396}, {118, 413}, {119, 400}, {216, 65535}, {313, 390}, {378, 112},
+    {413, 133}, {418, 102}, {454, 166}, {476, 138}, {492, 174}, {509, 56},
+    {548, 105}, {570, 170}, {590, 155}, {643, 65535}, {657, 298}, {716, 48},
+    {746, 33}, {778, 29}, {809, 34}, {818, 11}, {855, 17}, {898, 373},
+    {910, 378}, {915, 375}, {975, 370}, {1061, 372}, {1121, 238}, {1173, 253},
+    {1210, 228}, {1245, 303}, {1260, 239}, {1293, 410}, {1324, 382}, {1355, 392},
+    {1383, 402}, {1407, 389}, {0, 389}, {17, 387}, {73, 396}, {116, 413},
+    {120, 400}, {216, 65535}, {313, 390}, {378, 112}, {410, 133}, {419, 102},
+    {454, 166}, {478, 138}, {492, 174}, {508, 56}, {549, 105}, {568, 170},
+    {592, 155}, {643, 65535}, {656, 298}, {717, 48}, {745, 33}, {780, 29},
+    {808, 34}, {822, 11}, {855, 17}, {897, 373}, {909, 378}, {916, 375},
+    {975, 370}, {1061, 372}, {1122, 371}, {1123, 238}, {1173, 253}, {1210, 228},
+    {1244, 303}, {1261, 239}, {1292, 410}, {1324, 382}, {1354, 392}, {1384, 402},
+    {1406, 389}, {0, 389}, {17, 387}, {74, 396}, {113, 413}, {121, 400},
+    {216, 65535}, {314, 390}, {378, 112}, {406, 133}, {419, 102}, {452, 173},
+    {454, 166}, {479, 138}, {493, 174}, {507, 56}, {549, 105}, {567, 170},
+    {593, 155}, {643, 65535}, {655, 298}, {719, 48}, {743, 33}, {782, 29},
+    {808, 34}, {827, 11}, {854, 17}, {896, 373}, {909, 378}, {916, 375},
+    {975, 370}, {1061, 372}, {1122, 371}, {1127, 238}, {1173, 253}, {1209, 228},
+    {1243, 303}, {1262, 239}, {1291, 410}, {1324, 382}, {1354, 392}, {1386, 402},
+    {1405, 389}, {0, 389}, {17, 387}, {75, 396}, {111, 413}, {121, 400},
+    {216, 65535}, {314, 390}, {378, 112}, {402, 133}, {420, 102}, {451, 173},
+    {454, 166}, {481, 138}, {493, 174}, {506, 56}, {549, 105}, {566, 136},
+    {567, 170}, {595, 155}, {643, 65535}, {655, 298}, {720, 48}, {742, 33},
+    {784, 29}, {807, 34}, {831, 11}, {854, 17}, {894, 373}, {908, 378},
+    {917, 375}, {975, 370}, {1060, 372}, {1122, 371}, {1131, 238}, {1173, 253},
+    {1209, 228}, {1242, 303}, {1263, 239}, {1290, 410}, {1325, 382}, {1353, 392},
+    {1387, 402}, {1405, 389}, {0, 389}, {16, 387}, {76, 396}, {108, 413},
+    {122, 400}, {216, 65535}, {315, 390}, {378, 112}, {399, 133}, {421, 102},
+    {449, 173}, {454, 166}, {482, 138}, {493, 174}, {506, 56}, {550, 105},
+    {563, 136}, {569, 170}, {597, 155}, {642, 65535}, {654, 298}, {721, 48},
+    {740, 33}, {787, 29}, {806, 34}, {835, 11}, {854, 17}, {893, 373},
+    {908, 378}, {918, 375}, {975, 370}, {1060, 372}, {1122, 371}, {1135, 238},
+    {1173, 253}, {1208, 228}, {1242, 303}, {1264, 239}, {1289, 410}, {1325, 382},
+    {1352, 392}, {1389, 402}, {1404, 389}, {0, 389}, {16, 387}, {77, 396},
+    {106, 413}, {123, 400}, {216, 65535}, {315, 390}, {378, 112}, {395, 133},
+    {422, 102}, {448, 173}, {455, 166}, {484, 138}, {493, 174}, {505, 56},
+    {550, 105}, {561, 136}, {571, 170}, {599, 155}, {642, 65535}, {653, 298},
+    {723, 48}, {739, 33}, {789, 29}, {806, 34}, {840, 11}, {853, 17},
+    {892, 373}, {907, 378}, {919, 375}, {975, 370}, {1060, 372}, {1122, 371},
+    {1138, 238}, {1173, 253}, {1208, 228}, {1241, 303}, {1265, 239}, {1288, 410},
+    {1326, 382}, {1352, 392}, {1390, 402}, {1403, 389}, {0, 389}, {16, 387},
+    {77, 396}, {103, 413}, {124, 400}, {216, 65535}, {316, 390}, {378, 112},
+    {391, 133}, {422, 102}, {446, 173}, {455, 166}, {485, 138}, {493, 174},
+    {504, 56}, {551, 105}, {559, 136}, {573, 170}, {600, 155}, {642, 65535},
+    {652, 298}, {724, 48}, {738, 33}, {791, 29}, {805, 34}, {845, 11},
+    {853, 17}, {891, 373}, {906, 378}, {920, 375}, {974, 370}, {1060, 372},
+    {1123, 371}, {1142, 238}, {1173, 253}, {1207, 228}, {1240, 303}, {1266, 239},
+    {1286, 410}, {1326, 382}, {1351, 392}, {1391, 402}, {1403, 389}, {0, 389},
+    {16, 387}, {78, 396}, {100, 413}, {125, 400}, {217, 65535}, {317, 390},
+    {378, 112}, {387, 133}, {423, 102}, {444, 173}, {455, 166}, {487, 138},
+    {493, 174}, {503, 56}, {551, 72}, {557, 136}, {575, 170}, {602, 155},
+    {641, 65535}, {651, 298}, {725, 48}, {736, 33}, {793, 29}, {804, 34},
+    {849, 11}, {853, 17}, {889, 373}, {906, 378}, {920, 375}, {974, 370},
+    {1060, 372}, {1123, 371}, {1146, 238}, {1173, 253}, {1206, 228}, {1239, 303},
+    {1267, 239}, {1285, 410}, {1326, 382}, {1350, 392}, {1393, 402}, {1402, 389},
+    {0, 389}, {16, 387}, {79, 396}, {98, 413}, {126, 400}, {217, 65535},
+    {317, 390}, {377, 112}, {384, 133}, {424, 102}, {443, 173}, {456, 166},
+    {488, 138}, {493, 174}, {503, 56}, {550, 72}, {558, 136}, {577, 170},
+    {604, 155}, {641, 65535}, {651, 298}, {727, 48}, {735, 33}, {796, 29},
+    {804, 34}, {853, 17}, {888, 373}, {905, 378}, {921, 375}, {974, 370},
+    {1059, 372}, {1123, 371}, {1150, 238}, {1173, 253}, {1206, 228}, {1239, 303},
+    {1268, 239}, {1284, 410}, {1327, 382}, {1349, 392}, {1394, 402}, {1401, 389},
+    {0, 389}, {15, 417}, {17, 387}, {80, 396}, {95, 413}, {127, 400},
+    {217, 65535}, {318, 390}, {377, 112}, {380, 133}, {425, 102}, {441, 173},
+    {456, 166}, {490, 138}, {494, 174}, {502, 56}, {549, 72}, {560, 136},
+    {579, 170}, {606, 155}, {641, 65535}, {650, 298}, {728, 48}, {733, 33},
+    {798, 29}, {803, 34}, {853, 17}, {887, 373}, {905, 378}, {922, 375},
+    {974, 370}, {1059, 372}, {1123, 371}, {1155, 238}, {1174, 253}, {1205, 228},
+    {1238, 303}, {1269, 239}, {1283, 410}, {1327, 382}, {1349, 392}, {1395, 402},
+    {1400, 386}, {1401, 389}, {0, 389}, {14, 417}, {18, 387}, {81, 396},
+    {93, 413}, {127, 400}, {217, 65535}, {319, 390}, {377, 133}, {426, 102},
+    {439, 173}, {456, 166}, {491, 93}, {502, 56}, {549, 72}, {561, 136},
+    {581, 170}, {607, 155}, {640, 65535}, {649, 298}, {730, 48}, {732, 33},
+    {800, 29}, {803, 34}, {853, 17}, {886, 373}, {904, 378}, {923, 375},
+    {974, 370}, {1059, 372}, {1124, 371}, {1159, 238}, {1174, 253}, {1205, 228},
+    {1237, 303}, {1270, 239}, {1282, 410}, {1328, 382}, {1348, 392}, {1395, 386},
+    {1402, 389}, {0, 389}, {13, 417}, {19, 387}, {82, 396}, {90, 413},
+    {128, 400}, {217, 65535}, {319, 390}, {376, 133}, {426, 102}, {438, 173},
+    {457, 166}, {490, 93}, {503, 56}, {548, 72}, {562, 136}, {583, 170},
+    {609, 155}, {640, 65535}, {649, 298}, {731, 33}, {802, 34}, {854, 17},
+    {884, 373}, {904, 378}, {924, 375}, {974, 370}, {1059, 372}, {1124, 371},
+    {1163, 238}, {1174, 253}, {1204, 228}, {1236, 303}, {1271, 239}, {1281, 410},
+    {1328, 382}, {1347, 392}, {1394, 386}, {1402, 389}, {0, 389}, {12, 417},
+    {20, 387}, {82, 411}, {84, 396}, {87, 413}, {129, 400}, {217, 65535},
+    {320, 390}, {375, 133}, {427, 102}, {436, 173}, {457, 166}, {489, 93},
+    {504, 56}, {548, 72}, {563, 136}, {585, 170}, {611, 155}, {639, 65535},
+    {648, 298}, {731, 33}, {802, 34}, {854, 17}, {883, 373}, {903, 378},
+    {924, 375}, {973, 370}, {1059, 372}, {1124, 371}, {1167, 238}, {1174, 253},
+    {1204, 228}, {1236, 303}, {1272, 239}, {1280, 410}, {1328, 382}, {1346, 392},
+    {1393, 386}, {1403, 389}, {0, 389}, {10, 417}, {20, 387}, {81, 411},
+    {87, 413}, {130, 400}, {217, 65535}, {321, 390}, {374, 133}, {428, 102},
+    {434, 173}, {457, 166}, {488, 93}, {505, 56}, {547, 72}, {564, 136},
+    {587, 170}, {613, 155}, {639, 65535}, {648, 298}, {731, 33}, {802, 34},
+    {854, 9}, {856, 17}, {882, 373}, {902, 378}, {925, 375}, {973, 370},
+    {1058, 372}, {1124, 371}, {1171, 238}, {1174, 253}, {1203, 228}, {1235, 303},
+    {1273, 239}, {1279, 410}, {1329, 382}, {1346, 392}, {1392, 386}, {1404, 389},
+    {0, 389}, {9, 417}, {21, 387}, {80, 411}, {87, 413}, {131, 400},
+    {217, 65535}, {322, 390}, {373, 133}, {429, 102}, {433, 173}, {458, 166},
+    {487, 93}, {506, 56}, {546, 72}, {566, 136}, {589, 170}, {615, 155},
+    {638, 65535}, {647, 298}, {732, 33}, {801, 34}, {853, 9}, {859, 17},
+    {881, 373}, {902, 378}, {926, 375}, {973, 370}, {1058, 372}, {1124, 371},
+    {1174, 253}, {1202, 228}, {1234, 303}, {1274, 239}, {1277, 410}, {1329, 382},
+    {1345, 392}, {1391, 386}, {1405, 389}, {0, 389}, {8, 417}, {22, 387},
+    {79, 411}, {87, 413}, {132, 400}, {216, 65535}, {323, 390}, {372, 133},
+    {429, 102}, {431, 173}, {458, 166}, {486, 93}, {507, 56}, {546, 72},
+    {567, 136}, {591, 170}, {616, 155}, {638, 65535}, {647, 298}, {732, 33},
+    {801, 34}, {853, 9}, {861, 17}, {879, 373}, {901, 378}, {927, 375},
+    {973, 370}, {1058, 372}, {1125, 371}, {1174, 253}, {1202, 228}, {1233, 303},
+    {1275, 239}, {1276, 410}, {1330, 382}, {1344, 392}, {1390, 386}, {1406, 389},
+    {0, 389}, {7, 417}, {23, 387}, {76, 406}, {78, 411}, {88, 413},
+    {133, 400}, {216, 65535}, {324, 390}, {371, 133}, {430, 173}, {458, 166},
+    {486, 93}, {508, 56}, {545, 72}, {568, 136}, {593, 170}, {618, 155},
+    {637, 65535}, {646, 298}, {733, 33}, {801, 34}, {852, 9}, {863, 17},
+    {878, 373}, {901, 378}, {928, 375}, {973, 370}, {1058, 372}, {1125, 371},
+    {1175, 253}, {1201, 228}, {1232, 303}, {1276, 410}, {1330, 382}, {1343, 392},
+    {1389, 386}, {1407, 389}, {0, 389}, {6, 417}, {24, 387}, {68, 406},
+    {77, 411}, {88, 413}, {134, 400}, {216, 65535}, {325, 390}, {370, 133},
+    {430, 173}, {459, 166}, {485, 93}, {509, 56}, {545, 72}, {569, 136},
+    {595, 170}, {620, 155}, {637, 65535}, {646, 298}, {733, 33}, {801, 34},
+    {851, 9}, {865, 17}, {877, 373}, {900, 378}, {929, 375}, {973, 370},
+    {1058, 372}, {1125, 371}, {1175, 253}, {1201, 228}, {1232, 303}, {1276, 410},
+    {1330, 382}, {1343, 392}, {1388, 386}, {1408, 389}, {0, 389}, {5, 417},
+    {25, 387}, {60, 406}, {77, 411}, {89, 413}, {134, 400}, {216, 65535},
+    {326, 390}, {369, 133}, {430, 173}, {459, 166}, {484, 93}, {510, 56},
+    {544, 72}, {571, 136}, {598, 170}, {622, 155}, {636, 65535}, {645, 298},
+    {733, 33}, {801, 34}, {851, 9}, {867, 17}, {875, 373}, {900, 378},
+    {929, 375}, {972, 370}, {1057, 372}, {1125, 371}, {1176, 253}, {1200, 228},
+    {1231, 303}, {1276, 410}, {1331, 382}, {1342, 392}, {1387, 386}, {1408, 389},
+    {0, 389}, {4, 417}, {25, 380}, {26, 387}, {52, 406}, {76, 411},
+    {89, 413}, {135, 400}, {216, 65535}, {327, 390}, {369, 133}, {431, 173},
+    {459, 166}, {483, 93}, {511, 56}, {543, 72}, {572, 136}, {600, 170},
+    {624, 155}, {636, 65535}, {645, 298}, {734, 33}, {800, 34}, {850, 9},
+    {869, 17}, {874, 373}, {899, 378}, {930, 375}, {972, 370}, {1057, 372},
+    {1125, 371}, {1176, 253}, {1200, 228}, {1230, 303}, {1276, 410}, {1331, 382},
+    {1341, 392}, {1386, 386}, {1409, 389}, {0, 389}, {3, 417}, {25, 380},
+    {35, 387}, {43, 406}, {75, 411}, {89, 413}, {136, 400}, {216, 65535},
+    {329, 390}, {368, 133}, {431, 173}, {459, 166}, {482, 93}, {513, 56},
+    {543, 72}, {573, 136}, {602, 170}, {626, 155}, {635, 65535}, {645, 298},
+    {734, 33}, {800, 34}, {850, 9}, {872, 17}, {873, 373}, {898, 378},
+    {931, 375}, {969, 377}, {973, 370}, {1057, 372}, {1126, 371}, {1177, 253},
+    {1199, 228}, {1229, 303}, {1277, 410}, {1332, 382}, {1340, 392}, {1385, 386},
+    {1410, 389}, {0, 389}, {2, 417}, {25, 380}, {39, 406}, {75, 411},
+    {90, 413}, {137, 400}, {216, 65535}, {330, 390}, {367, 133}, {431, 173},
+    {460, 166}, {481, 93}, {514, 56}, {542, 72}, {574, 136}, {604, 170},
+    {627, 155}, {634, 65535}, {644, 298}, {735, 33}, {800, 34}, {849, 9},
+    {873, 373}, {898, 378}, {932, 375}, {962, 377}, {973, 370}, {1057, 372},
+    {1126, 371}, {1177, 253}, {1198, 228}, {1229, 303}, {1277, 410}, {1332, 382},
+    {1340, 392}, {1384, 386}, {1411, 389}, {0, 389}, {1, 417}, {25, 380},
+    {39, 406}, {74, 411}, {90, 413}, {138, 400}, {215, 408}, {216, 65535},
+    {331, 390}, {366, 133}, {431, 173}, {460, 166}, {480, 93}, {515, 56},
+    {541, 72}, {576, 136}, {606, 170}, {629, 155}, {633, 65535}, {644, 298},
+    {735, 33}, {800, 34}, {849, 9}, {873, 373}, {897, 378}, {933, 375},
+    {955, 377}, {974, 370}, {1057, 372}, {1126, 371}, {1177, 253}, {1198, 228},
+    {1228, 303}, {1277, 410}, {1332, 382}, {1339, 392}, {1383, 386}, {1412, 389},
+    {0, 417}, {25, 380}, {38, 406}, {74, 411}, {90, 413}, {139, 400},
+    {214, 408}, {219, 65535}, {333, 390}, {365, 133}, {432, 173}, {460, 166},
+    {479, 93}, {516, 56}, {541, 72}, {577, 136}, {608, 170}, {631, 155},
+    {633, 65535}, {644, 298}, {735, 33}, {800, 34}, {848, 9}, {874, 373},
+    {897, 378}, {934, 375}, {947, 377}, {975, 370}, {1056, 372}, {1126, 371},
+    {1178, 253}, {1197, 228}, {1227, 303}, {1277, 410}, {1333, 382}, {1338, 392},
+    {1382, 386}, {1413, 389}, {0, 417}, {25, 380}, {38, 406}, {73, 411},
+    {91, 413}, {140, 400}, {212, 408}, {222, 65535}, {335, 390}, {364, 133},
+    {432, 173}, {461, 166}, {478, 93}, {517, 56}, {540, 72}, {578, 136},
+    {610, 170}, {632, 65535}, {643, 298}, {736, 33}, {799, 34}, {847, 9},
+    {874, 373}, {896, 378}, {934, 375}, {939, 377}, {976, 370}, {1056, 372},
+    {1126, 371}, {1178, 253}, {1197, 228}, {1226, 303}, {1277, 410}, {1333, 382},
+    {1337, 392}, {1381, 386}, {1414, 389}, {1439, 417}, {0, 417}, {25, 380},
+    {37, 406}, {72, 411}, {91, 413}, {141, 400}, {210, 408}, {224, 65535},
+    {337, 390}, {363, 133}, {432, 173}, {461, 166}, {477, 93}, {518, 56},
+    {540, 72}, {579, 136}, {613, 170}, {632, 65535}, {643, 298}, {736, 33},
+    {799, 34}, {844, 35}, {847, 9}, {875, 373}, {895, 378}, {935, 377},
+    {977, 370}, {1056, 372}, {1127, 371}, {1179, 253}, {1196, 228}, {1225, 303},
+    {1278, 410}, {1334, 382}, {1337, 392}, {1380, 386}, {1415, 389}, {1438, 417},
+    {0, 417}, {24, 380}, {37, 406}, {72, 411}, {92, 413}, {142, 400},
+    {208, 391}, {209, 408}, {226, 65535}, {339, 390}, {362, 133}, {432, 132},
+    {440, 173}, {461, 166}, {476, 93}, {519, 56}, {539, 72}, {581, 136},
+    {615, 170}, {631, 65535}, {643, 298}, {737, 33}, {799, 34}, {839, 35},
+    {847, 9}, {875, 373}, {895, 378}, {934, 379}, {935, 377}, {978, 370},
+    {1056, 372}, {1127, 371}, {1179, 253}, {1195, 228}, {1225, 303}, {1278, 410},
+    {1334, 382}, {1336, 392}, {1379, 386}, {1415, 388}, {1426, 389}, {1436, 417},
+    {0, 417}, {24, 380}, {36, 406}, {71, 411}, {92, 413}, {142, 400},
+    {205, 391}, {209, 408}, {228, 65535}, {341, 390}, {361, 133}, {431, 132},
+    {461, 173}, {462, 166}, {476, 93}, {520, 56}, {538, 72}, {582, 136},
+    {617, 170}, {631, 65535}, {642, 298}, {737, 33}, {799, 34}, {835, 35},
+    {847, 9}, {876, 373}, {894, 378}, {933, 379}, {935, 377}, {979, 370},
+    {1055, 372}, {1127, 371}, {1179, 253}, {1195, 228}, {1224, 303}, {1278, 410},
+    {1334, 382}, {1335, 392}, {1378, 386}, {1415, 388}, {1436, 417}, {0, 417},
+    {24, 380}, {36, 406}, {70, 411}, {92, 413}, {143, 400}, {202, 391},
+    {208, 408}, {230, 65535}, {344, 390}, {360, 133}, {431, 132}, {464, 166},
+    {475, 93}, {522, 56}, {538, 72}, {583, 136}, {619, 170}, {630, 65535},
+    {642, 298}, {737, 33}, {798, 34}, {830, 35}, {847, 9}, {876, 373},
+    {894, 378}, {930, 369}, {933, 379}, {936, 377}, {980, 370}, {1055, 372},
+    {1127, 371}, {1180, 253}, {1194, 228}, {1223, 309}, {1225, 303}, {1278, 410},
+    {1335, 392}, {1377, 386}, {1415, 388}, {1437, 417}, {0, 417}, {24, 380},
+    {35, 406}, {70, 411}, {93, 413}, {144, 400}, {199, 391}, {208, 408},
+    {232, 65535}, {272, 385}, {293, 65535}, {347, 390}, {359, 133}, {430, 132},
+    {466, 166}, {474, 93}, {523, 56}, {537, 72}, {584, 136}, {622, 170},
+    {630, 65535}, {642, 298}, {738, 33}, {798, 34}, {825, 35}, {847, 9},
+    {877, 373}, {893, 378}, {927, 369}, {932, 379}, {936, 377}, {981, 370},
+    {1055, 372}, {1127, 371}, {1180, 253}, {1194, 228}, {1222, 309}, {1227, 303},
+    {1278, 410}, {1335, 392}, {1376, 386}, {1414, 388}, {1438, 417}, {0, 417},
+    {24, 380}, {35, 406}, {69, 411}, {93, 413}, {145, 400}, {196, 391},
+    {208, 408}, {233, 65535}, {267, 385}, {297, 65535}, {351, 390}, {358, 133},
+    {430, 132}, {468, 166}, {473, 93}, {524, 56}, {536, 72}, {586, 136},
+    {624, 170}, {629, 65535}, {642, 298}, {738, 33}, {798, 34}, {820, 35},
+    {847, 9}, {877, 373}, {893, 378}, {925, 369}, {932, 379}, {936, 377},
+    {982, 370}, {1055, 372}, {1128, 371}, {1181, 253}, {1193, 228}, {1220, 309},
+    {1229, 303}, {1278, 410}, {1330, 306}, {1335, 392}, {1375, 386}, {1414, 388},
+    {1438, 417}, {0, 417}, {24, 380}, {35, 406}, {68, 411}, {94, 413},
+    {146, 400}, {193, 391}, {207, 408}, {235, 65535}, {264, 385}, {301, 65535},
+    {357, 133}, {429, 132}, {470, 166}, {472, 93}, {525, 56}, {536, 72},
+    {587, 136}, {626, 170}, {629, 65535}, {642, 298}, {739, 33}, {798, 34},
+    {815, 35}, {847, 9}, {878, 373}, {892, 378}, {922, 369}, {932, 379},
+    {937, 377}, {983, 370}, {1055, 372}, {1128, 371}, {1181, 253}, {1193, 228},
+    {1218, 309}, {1231, 303}, {1279, 410}, {1325, 306}, {1337, 392}, {1374, 386},
+    {1414, 388}, {1439, 417}, {0, 417}, {24, 380}, {34, 406}, {67, 411},
+    {94, 413}, {147, 400}, {190, 391}, {207, 408}, {236, 65535}, {261, 385},
+    {304, 65535}, {357, 133}, {429, 132}, {471, 93}, {526, 56}, {535, 72},
+    {588, 136}, {628, 65535}, {642, 298}, {739, 33}, {796, 51}, {798, 34},
+    {809, 35}, {846, 23}, {847, 9}, {878, 373}, {891, 378}, {919, 369},
+    {932, 379}, {937, 377}, {983, 370}, {1054, 372}, {1128, 371}, {1181, 253},
+    {1192, 228}, {1217, 309}, {1234, 303}, {1279, 410}, {1319, 306}, {1338, 392},
+    {1373, 386}, {1414, 388}, {0, 388}, {1, 417}, {24, 380}, {34, 406},
+    {67, 411}, {94, 413}, {148, 400}, {186, 391}, {206, 408}, {237, 65535},
+    {258, 385}, {306, 65535}, {358, 133}, {428, 132}, {471, 93}, {527, 56},
+    {534, 72}, {589, 136}, {628, 65535}, {641, 298}, {739, 33}, {793, 51},
+    {799, 34}, {803, 35}, {845, 23}, {848, 9}, {879, 373}, {891, 378},
+    {917, 369}, {931, 379}, {937, 377}, {984, 370}, {1054, 372}, {1128, 371},
+    {1182, 253}, {1191, 228}, {1215, 309}, {1236, 303}, {1279, 410}, {1312, 306},
+    {1339, 392}, {1372, 386}, {1414, 388}, {0, 388}, {2, 417}, {23, 380},
+    {33, 406}, {66, 411}, {95, 413}, {149, 400}, {183, 391}, {206, 408},
+    {239, 65535}, {256, 385}, {308, 65535}, {358, 133}, {428, 132}, {471, 93},
+    {529, 56}, {534, 72}, {591, 136}, {628, 65535}, {641, 298}, {740, 33},
+    {789, 51}, {800, 35}, {844, 23}, {848, 9}, {880, 373}, {890, 378},
+    {914, 369}, {931, 379}, {938, 377}, {985, 370}, {1054, 372}, {1129, 371},
+    {1182, 253}, {1191, 228}, {1214, 309}, {1236, 303}, {1279, 410}, {1306, 306},
+    {1340, 392}, {1371, 386}, {1414, 388}, {0, 388}, {3, 417}, {23, 380},
+    {33, 406}, {65, 411}, {95, 413}, {150, 400}, {180, 391}, {205, 408},
+    {240, 65535}, {254, 385}, {311, 65535}, {358, 133}, {427, 132}, {471, 93},
+    {530, 177}, {534, 72}, {592, 136}, {627, 65535}, {641, 298}, {740, 33},
+    {785, 51}, {801, 35}, {843, 23}, {849, 9}, {880, 373}, {890, 378},
+    {911, 369}, {931, 379}, {938, 377}, {986, 370}, {1054, 372}, {1129, 371},
+    {1183, 253}, {1190, 228}, {1212, 309}, {1236, 303}, {1279, 410}, {1299, 306},
+    {1341, 392}, {1370, 386}, {1414, 388}, {0, 388}, {4, 417}, {23, 380},
+    {32, 406}, {63, 403}, {65, 411}, {95, 413}, {151, 400}, {177, 391},
+    {205, 408}, {241, 65535}, {252, 385}, {312, 65535}, {358, 133}, {427, 132},
+    {471, 93}, {529, 177}, {535, 72}, {593, 136}, {627, 65535}, {641, 298},
+    {741, 33}, {781, 51}, {802, 35}, {842, 23}, {849, 9}, {881, 373},
+    {889, 378}, {908, 369}, {931, 379}, {938, 377}, {987, 370}, {1053, 65535},
+    {1054, 372}, {1129, 371}, {1183, 253}, {1190, 228}, {1210, 309}, {1236, 303},
+    {1280, 410}, {1292, 306}, {1342, 392}, {1368, 386}, {1414, 388}, {0, 388},
+    {5, 417}, {23, 380}, {32, 406}, {58, 403}, {65, 411}, {96, 413},
+    {152, 400}, {174, 391}, {205, 408}, {242, 65535}, {250, 385}, {314, 65535},
+    {358, 133}, {426, 132}, {472, 93}, {528, 177}, {537, 72}, {595, 136},
+    {626, 65535}, {641, 298}, {741, 33}, {778, 51}, {802, 35}, {841, 23},
+    {850, 9}, {881, 373}, {888, 378}, {905, 369}, {930, 379}, {939, 377},
+    {988, 370}, {1052, 65535}, {1054, 372}, {1129, 371}, {1184, 253}, {1189, 228},
+    {1209, 309}, {1236, 303}, {1280, 410}, {1284, 306}, {1343, 392}, {1367, 386},
+    {1414, 388}, {0, 388}, {6, 417}, {23, 380}, {31, 406}, {52, 403},
+    {64, 411}, {96, 413}, {152, 400}, {170, 391}, {204, 408}, {243, 65535},
+    {249, 385}, {316, 65535}, {359, 133}, {426, 132}, {472, 93}, {525, 82},
+    {528, 177}, {538, 72}, {596, 136}, {626, 65535}, {641, 298}, {741, 33},
+    {774, 51}, {803, 35}, {841, 23}, {851, 9}, {882, 373}, {888, 378},
+    {902, 369}, {930, 379}, {939, 377}, {989, 370}, {1051, 65535}, {1054, 372},
+    {1129, 371}, {1184, 253}, {1188, 228}, {1207, 309}, {1236, 303}, {1280, 306},
+    {1344, 392}, {1366, 386}, {1414, 388}, {0, 388}, {7, 417}, {23, 380},
+    {31, 406}, {46, 403}, {64, 411}, {97, 413}, {153, 400}, {167, 391},
+    {204, 408}, {244, 65535}, {247, 385}, {317, 65535}, {359, 133}, {425, 132},
+    {472, 93}, {521, 82}, {527, 177}, {539, 72}, {597, 136}, {625, 65535},
+    {641, 298}, {742, 33}, {770, 51}, {804, 35}, {840, 23}, {851, 9},
+    {882, 373}, {887, 378}, {899, 369}, {930, 379}, {940, 377}, {990, 370},
+    {1051, 65535}, {1055, 372}, {1130, 371}, {1184, 253}, {1188, 228}, {1205, 309},
+    {1236, 303}, {1279, 306}, {1345, 392}, {1365, 386}, {1414, 388}, {0, 388},
+    {8, 417}, {23, 380}, {30, 406}, {39, 403}, {64, 411}, {97, 413},
+    {154, 400}, {163, 391}, {203, 408}, {245, 65535}, {246, 385}, {319, 65535},
+    {359, 133}, {424, 132}, {472, 93}, {518, 82}, {527, 177}, {541, 72},
+    {599, 136}, {625, 65535}, {641, 298}, {742, 33}, {765, 51}, {804, 35},
+    {839, 23}, {852, 9}, {883, 373}, {886, 378}, {896, 369}, {929, 379},
+    {940, 377}, {991, 370}, {1050, 65535}, {1055, 372}, {1130, 371}, {1185, 253},
+    {1187, 228}, {1203, 309}, {1236, 303}, {1279, 306}, {1346, 392}, {1364, 386},
+    {1414, 388}, {0, 388}, {9, 417}, {22, 380}, {30, 406}, {32, 403},
+    {64, 411}, {97, 413}, {155, 400}, {160, 391}, {203, 408}, {245, 385},
+    {320, 65535}, {360, 133}, {424, 132}, {472, 93}, {515, 82}, {526, 177},
+    {542, 72}, {600, 136}, {624, 65535}, {641, 298}, {743, 33}, {761, 51},
+    {805, 35}, {838, 23}, {852, 9}, {883, 373}, {886, 378}, {893, 369},
+    {929, 379}, {940, 377}, {992, 370}, {1049, 65535}, {1055, 372}, {1130, 371},
+    {1185, 253}, {1186, 228}, {1201, 309}, {1236, 303}, {1278, 306}, {1347, 392},
+    {1363, 386}, {1414, 388}, {0, 388}, {10, 417}, {20, 415}, {23, 380},
+    {28, 403}, {63, 411}, {98, 413}, {156, 391}, {203, 408}, {245, 385},
+    {321, 65535}, {360, 133}, {423, 132}, {472, 93}, {511, 82}, {526, 177},
+    {543, 72}, {601, 136}, {623, 65535}, {641, 298}, {743, 33}, {757, 51},
+    {806, 35}, {837, 23}, {853, 9}, {884, 373}, {885, 378}, {890, 369},
+    {929, 379}, {941, 377}, {993, 370}, {1048, 65535}, {1056, 372}, {1130, 371},
+    {1186, 228}, {1199, 309}, {1236, 303}, {1278, 306}, {1348, 392}, {1362, 386},
+    {1414, 388}, {0, 388}, {11, 415}, {25, 403}, {63, 411}, {98, 413},
+    {156, 391}, {202, 408}, {245, 385}, {322, 65535}, {361, 133}, {423, 132},
+    {472, 93}, {508, 82}, {525, 177}, {545, 72}, {603, 136}, {623, 65535},
+    {641, 298}, {743, 33}, {752, 51}, {806, 35}, {836, 23}, {853, 9},
+    {884, 373}, {885, 378}, {887, 369}, {929, 379}, {941, 377}, {994, 370},
+    {1047, 65535}, {1056, 372}, {1130, 371}, {1186, 228}, {1197, 309}, {1236, 303},
+    {1277, 306}, {1349, 392}, {1360, 405}, {1364, 386}, {1414, 388}, {0, 388},
+    {11, 415}, {25, 403}, {63, 411}, {99, 413}, {155, 391}, {202, 408},
+    {245, 385}, {324, 65535}, {361, 133}, {422, 132}, {472, 93}, {504, 82},
+    {525, 177}, {546, 72}, {604, 136}, {622, 65535}, {641, 298}, {744, 33},
+    {748, 51}, {807, 35}, {835, 23}, {854, 9}, {885, 369}, {928, 379},
+    {941, 377}, {995, 370}, {1045, 65535}, {1057, 372}, {1131, 371}, {1186, 228},
+    {1195, 309}, {1236, 303}, {1277, 306}, {1350, 392}, {1357, 405}, {1366, 386},
+    {1414, 388}, {0, 388}, {10, 415}, {26, 403}, {63, 411}, {99, 413},
+    {155, 391}, {201, 408}, {245, 385}, {325, 65535}, {361, 133}, {422, 132},
+    {472, 93}, {501, 82}, {525, 177}, {548, 72}, {605, 136}, {621, 65535},
+    {641, 298}, {744, 51}, {808, 35}, {834, 23}, {855, 9}, {884, 369},
+    {928, 379}, {942, 377}, {996, 370}, {1044, 65535}, {1057, 372}, {1131, 371},
+    {1186, 228}, {1193, 309}, {1236, 303}, {1276, 306}, {1351, 392}, {1355, 405},
+    {1369, 386}, {1414, 388}, {0, 388}, {10, 415}, {26, 403}, {63, 411},
+    {99, 413}, {155, 391}, {201, 408}, {245, 385}, {326, 65535}, {362, 133},
+    {421, 132}, {472, 93}, {497, 82}, {524, 177}, {549, 72}, {607, 136},
+    {620, 65535}, {642, 298}, {744, 51}, {809, 35}, {833, 23}, {855, 9},
+    {884, 369}, {928, 379}, {942, 377}, {997, 370}, {1043, 65535}, {1058, 372},
+    {1131, 371}, {1186, 228}, {1191, 309}, {1236, 303}, {1276, 306}, {1352, 392},
+    {1353, 405}, {1371, 386}, {1414, 388}, {0, 388}, {9, 415}, {27, 403},
+    {62, 411}, {100, 413}, {154, 391}, {200, 408}, {244, 385}, {327, 65535},
+    {362, 133}, {421, 132}, {472, 93}, {493, 82}, {524, 177}, {551, 72},
+    {608, 136}, {620, 65535}, {642, 298}, {743, 51}, {809, 35}, {832, 23},
+    {856, 9}, {884, 369}, {928, 379}, {943, 377}, {998, 370}, {1041, 65535},
+    {1058, 372}, {1131, 371}, {1186, 228}, {1189, 309}, {1236, 303}, {1275, 306},
+    {1352, 405}, {1374, 386}, {1414, 388}, {0, 388}, {8, 415}, {27, 403},
+    {62, 411}, {100, 413}, {154, 391}, {200, 408}, {244, 385}, {328, 65535},
+    {363, 133}, {420, 132}, {472, 93}, {489, 82}, {523, 177}, {552, 72},
+    {610, 136}, {619, 65535}, {642, 298}, {743, 51}, {810, 35}, {831, 23},
+    {856, 9}, {884, 369}, {927, 379}, {943, 377}, {999, 370}, {1040, 65535},
+    {1059, 372}, {1132, 371}, {1186, 228}, {1187, 309}, {1236, 303}, {1275, 306},
+    {1352, 405}, {1376, 386}, {1414, 388}, {0, 388}, {8, 415}, {28, 403},
+    {62, 411}, {101, 413}, {153, 391}, {199, 408}, {244, 385}, {329, 65535},
+    {364, 133}, {419, 132}, {470, 60}, {473, 93}, {485, 82}, {523, 177},
+    {554, 72}, {611, 136}, {618, 65535}, {642, 298}, {743, 51}, {811, 35},
+    {830, 23}, {857, 9}, {883, 369}, {927, 379}, {943, 377}, {1000, 370},
+    {1038, 65535}, {1059, 372}, {1132, 371}, {1184, 309}, {1236, 303}, {1275, 306},
+    {1352, 405}, {1379, 386}, {1413, 388}, {0, 388}, {7, 415}, {28, 403},
+    {62, 411}, {101, 413}, {153, 391}, {199, 408}, {244, 385}, {329, 65535},
+    {364, 133}, {419, 132}, {467, 60}, {474, 93}, {481, 82}, {522, 177},
+    {555, 72}, {612, 136}, {617, 65535}, {642, 298}, {742, 51}, {811, 22},
+    {813, 35}, {829, 23}, {857, 9}, {883, 369}, {927, 379}, {944, 377},
+    {1001, 370}, {1037, 65535}, {1060, 372}, {1132, 371}, {1182, 309}, {1236, 303},
+    {1274, 306}, {1352, 405}, {1381, 386}, {1413, 388}, {0, 388}, {7, 415},
+    {29, 403}, {61, 411}, {101, 413}, {152, 391}, {199, 408}, {244, 385},
+    {330, 65535}, {365, 133}, {418, 132}, {465, 60}, {475, 93}, {477, 82},
+    {522, 177}, {557, 72}, {614, 136}, {616, 65535}, {642, 298}, {742, 51},
+    {811, 22}, {817, 35}, {828, 23}, {858, 9}, {883, 369}, {926, 379},
+    {944, 377}, {1002, 370}, {1035, 65535}, {1060, 372}, {1132, 371}, {1180, 309},
+    {1236, 303}, {1274, 306}, {1352, 405}, {1384, 386}, {1413, 388}, {0, 388},
+    {6, 415}, {29, 403}, {61, 411}, {102, 413}, {152, 391}, {198, 408},
+    {244, 385}, {331, 65535}, {365, 133}, {418, 132}, {462, 60}, {476, 82},
+    {522, 177}, {558, 72}, {615, 65535}, {643, 298}, {742, 51}, {810, 22},
+    {821, 35}, {827, 23}, {859, 9}, {882, 369}, {926, 379}, {945, 377},
+    {1003, 370}, {1033, 65535}, {1061, 372}, {1132, 371}, {1177, 309}, {1236, 303},
+    {1273, 306}, {1352, 405}, {1386, 386}, {1413, 388}, {0, 388}, {6, 415},
+    {29, 403}, {61, 411}, {102, 413}, {152, 391}, {198, 408}, {244, 385},
+    {332, 65535}, {366, 133}, {417, 132}, {459, 60}, {476, 82}, {521, 177},
+    {560, 72}, {614, 65535}, {643, 298}, {741, 51}, {810, 22}, {826, 23},
+    {859, 9}, {882, 369}, {926, 379}, {945, 377}, {1004, 370}, {1030, 65535},
+    {1062, 372}, {1133, 371}, {1175, 309}, {1236, 303}, {1273, 306}, {1352, 405},
+    {1389, 386}, {1413, 388}, {0, 388}, {5, 415}, {30, 403}, {61, 411},
+    {103, 413}, {151, 391}, {197, 408}, {244, 385}, {333, 65535}, {367, 133},
+    {417, 132}, {456, 60}, {477, 82}, {521, 177}, {561, 72}, {614, 65535},
+    {643, 298}, {741, 51}, {810, 22}, {827, 23}, {860, 9}, {882, 369},
+    {926, 379}, {945, 377}, {1005, 370}, {1027, 65535}, {1062, 372}, {1133, 371},
+    {1173, 309}, {1236, 303}, {1272, 306}, {1351, 405}, {1391, 386}, {1413, 388},
+    {0, 388}, {5, 415}, {30, 403}, {60, 411}, {103, 413}, {151, 391},
+    {197, 408}, {244, 385}, {333, 65535}, {368, 133}, {416, 132}, {453, 60},
+    {477, 70}, {478, 82}, {520, 177}, {563, 72}, {613, 65535}, {644, 298},
+    {741, 51}, {810, 22}, {829, 23}, {860, 9}, {882, 369}, {925, 379},
+    {946, 377}, {1006, 370}, {1024, 65535}, {1063, 372}, {1133, 371}, {1170, 309},
+    {1236, 303}, {1272, 306}, {1351, 405}, {1394, 386}, {1413, 388}, {0, 388},
+    {4, 415}, {31, 403}, {60, 411}, {103, 413}, {150, 391}, {196, 408},
+    {243, 385}, {334, 65535}, {368, 133}, {415, 132}, {450, 60}, {477, 70},
+    {479, 82}, {520, 177}, {564, 72}, {612, 65535}, {644, 298}, {740, 51},
+    {809, 22}, {830, 23}, {861, 9}, {881, 369}, {925, 379}, {946, 377},
+    {1007, 370}, {1019, 65535}, {1064, 372}, {1133, 371}, {1168, 309}, {1236, 303},
+    {1272, 306}, {1350, 301}, {1352, 405}, {1397, 386}, {1413, 388}, {0, 388},
+    {4, 415}, {31, 403}, {60, 411}, {104, 413}, {150, 391}, {196, 408},
+    {243, 385}, {335, 65535}, {369, 133}, {415, 132}, {446, 60}, {477, 70},
+    {481, 82}, {519, 177}, {566, 72}, {612, 65535}, {644, 298}, {740, 51},
+    {809, 22}, {832, 23}, {862, 9}, {881, 369}, {925, 379}, {947, 377},
+    {1008, 65535}, {1065, 372}, {1134, 371}, {1165, 309}, {1236, 303}, {1272, 306},
+    {1348, 301}, {1352, 405}, {1400, 386}, {1413, 388}, {0, 388}, {3, 415},
+    {32, 403}, {60, 411}, {104, 413}, {149, 391}, {195, 408}, {243, 385},
+    {335, 65535}, {370, 133}, {414, 132}, {443, 60}, {476, 70}, {483, 82},
+    {519, 177}, {567, 72}, {611, 65535}, {645, 298}, {740, 51}, {809, 22},
+    {833, 23}, {862, 9}, {881, 369}, {925, 379}, {947, 377}, {1008, 65535},
+    {1066, 372}, {1134, 371}, {1163, 309}, {1236, 303}, {1272, 306}, {1346, 301},
+    {1352, 405}, {1402, 386}, {1413, 388}, {0, 388}, {3, 415}, {32, 403},
+    {59, 411}, {105, 413}, {149, 391}, {195, 408}, {243, 385}, {336, 65535},
+    {371, 133}, {414, 132}, {440, 60}, {476, 70}, {485, 82}, {519, 177},
+    {569, 72}, {610, 65535}, {645, 298}, {739, 51}, {808, 22}, {835, 23},
+    {859, 37}, {865, 9}, {880, 369}, {924, 379}, {947, 377}, {1007, 65535},
+    {1066, 372}, {1134, 371}, {1160, 309}, {1236, 303}, {1272, 306}, {1344, 301},
+    {1353, 405}, {1405, 386}, {1413, 388}, {0, 388}, {2, 415}, {33, 403},
+    {59, 411}, {105, 413}, {148, 391}, {195, 408}, {243, 385}, {336, 65535},
+    {372, 133}, {413, 132}, {437, 60}, {476, 70}, {487, 82}, {518, 177},
+    {570, 72}, {609, 65535}, {646, 298}, {739, 51}, {808, 22}, {836, 23},
+    {854, 37}, {871, 9}, {880, 369}, {924, 379}, {948, 377}, {1007, 65535},
+    {1067, 372}, {1134, 371}, {1158, 309}, {1236, 303}, {1272, 306}, {1342, 301},
+    {1353, 405}, {1408, 386}, {1413, 388}, {0, 388}, {2, 415}, {33, 403},
+    {59, 411}, {106, 413}, {148, 391}, {194, 408}, {243, 385}, {337, 65535},
+    {373, 133}, {413, 132}, {433, 60}, {476, 70}, {488, 82}, {518, 177},
+    {572, 72}, {608, 65535}, {646, 298}, {739, 51}, {808, 22}, {838, 23},
+    {848, 37}, {876, 9}, {880, 369}, {924, 379}, {948, 377}, {1007, 65535},
+    {1068, 372}, {1134, 371}, {1155, 309}, {1236, 303}, {1272, 306}, {1340, 301},
+    {1354, 405}, {1411, 386}, {1413, 388}, {0, 388}, {1, 415}, {34, 403},
+    {59, 411}, {106, 413}, {148, 391}, {194, 408}, {243, 385}, {337, 65535},
+    {374, 133}, {412, 132}, {430, 60}, {476, 70}, {490, 82}, {517, 177},
+    {574, 72}, {608, 65535}, {647, 298}, {738, 51}, {808, 22}, {839, 39},
+    {843, 37}, {880, 369}, {923, 379}, {948, 377}, {1007, 65535}, {1070, 372},
+    {1135, 371}, {1153, 309}, {1236, 303}, {1272, 302}, {1273, 306}, {1338, 301},
+    {1354, 405}, {1413, 388}, {0, 415}, {34, 403}, {58, 411}, {106, 413},
+    {147, 391}, {193, 408}, {243, 385}, {338, 65535}, {375, 133}, {411, 132},
+    {426, 60}, {476, 70}, {492, 82}, {517, 177}, {575, 72}, {607, 65535},
+    {647, 298}, {738, 51}, {807, 22}, {839, 39}, {843, 37}, {880, 369},
+    {923, 379}, {949, 377}, {1007, 65535}, {1071, 372}, {1135, 371}, {1150, 309},
+    {1236, 303}, {1272, 302}, {1274, 306}, {1336, 301}, {1355, 405}, {1413, 388},
+    {0, 415}, {35, 403}, {58, 411}, {107, 413}, {147, 391}, {193, 408},
+    {242, 385}, {338, 65535}, {377, 133}, {411, 132}, {422, 60}, {475, 70},
+    {494, 82}, {516, 177}, {577, 72}, {606, 65535}, {648, 298}, {738, 51},
+    {807, 22}, {838, 39}, {844, 37}, {881, 369}, {923, 379}, {949, 377},
+    {1007, 65535}, {1072, 372}, {1135, 371}, {1148, 309}, {1236, 303}, {1272, 302},
+    {1276, 306}, {1334, 301}, {1355, 405}, {1414, 388}, {0, 415}, {35, 403},
+    {58, 411}, {107, 413}, {146, 391}, {192, 408}, {242, 385}, {339, 65535},
+    {378, 133}, {410, 132}, {418, 64}, {425, 60}, {475, 70}, {496, 82},
+    {516, 177}, {578, 72}, {604, 65535}, {648, 298}, {737, 51}, {807, 22},
+    {837, 24}, {838, 39}, {844, 37}, {882, 369}, {923, 379}, {950, 377},
+    {1007, 65535}, {1073, 372}, {1135, 371}, {1145, 309}, {1236, 303}, {1272, 302},
+    {1278, 306}, {1332, 301}, {1356, 405}, {1414, 388}, {1439, 415}, {0, 415},
+    {35, 403}, {58, 411}, {108, 413}, {146, 391}, {192, 408}, {242, 385},
+    {339, 65535}, {379, 133}, {410, 132}, {414, 64}, {429, 60}, {475, 70},
+    {497, 82}, {515, 177}, {580, 72}, {603, 65535}, {649, 298}, {737, 51},
+    {807, 22}, {836, 24}, {838, 39}, {844, 37}, {882, 369}, {922, 379},
+    {950, 377}, {1007, 65535}, {1075, 372}, {1136, 371}, {1142, 309}, {1236, 303},
+    {1272, 302}, {1280, 306}, {1330, 301}, {1356, 405}, {1415, 388}, {1439, 415},
+    {0, 415}, {36, 403}, {57, 411}, {108, 413}, {145, 391}, {191, 408},
+    {242, 385}, {340, 65535}, {381, 133}, {409, 64}, {434, 60}, {475, 70},
+    {499, 82}, {515, 177}, {582, 72}, {602, 65535}, {649, 298}, {737, 51},
+    {806, 22}, {835, 24}, {838, 39}, {844, 37}, {883, 369}, {922, 379},
+    {951, 377}, {1006, 65535}, {1076, 372}, {1136, 371}, {1139, 309}, {1236, 303},
+    {1272, 302}, {1281, 306}, {1328, 301}, {1356, 405}, {1415, 388}, {1438, 415},
+    {0, 415}, {36, 403}, {57, 411}, {109, 413}, {145, 391}, {191, 408},
+    {242, 385}, {340, 65535}, {383, 133}, {408, 64}, {439, 60}, {475, 70},
+    {501, 82}, {514, 177}, {583, 72}, {601, 65535}, {650, 298}, {736, 51},
+    {806, 22}, {835, 24}, {838, 39}, {845, 37}, {883, 369}, {922, 379},
+    {951, 377}, {1006, 65535}, {1078, 372}, {1136, 371}, {1137, 309}, {1236, 303},
+    {1272, 302}, {1283, 306}, {1326, 301}, {1357, 405}, {1415, 388}, {1438, 415},
+    {0, 415}, {37, 403}, {57, 411}, {109, 413}, {144, 391}, {190, 408},
+    {242, 385}, {340, 65535}, {385, 133}, {404, 65}, {409, 61}, {411, 64},
+    {445, 60}, {475, 70}, {503, 82}, {514, 177}, {585, 72}, {599, 65535},
+    {651, 298}, {736, 51}, {806, 22}, {834, 24}, {838, 39}, {845, 37},
+    {884, 369}, {921, 379}, {951, 377}, {1006, 65535}, {1079, 372}, {1135, 309},
+    {1236, 303}, {1272, 302}, {1285, 306}, {1324, 301}, {1357, 405}, {1416, 388},
+    {1437, 415}, {0, 415}, {37, 403}, {56, 411}, {109, 413}, {144, 391},
+    {190, 408}, {242, 385}, {341, 65535}, {386, 133}, {400, 175}, {405, 65},
+    {411, 61}, {414, 64}, {450, 60}, {474, 70}, {505, 82}, {514, 177},
+    {587, 72}, {598, 65535}, {652, 298}, {736, 51}, {805, 22}, {833, 24},
+    {838, 39}, {845, 37}, {884, 369}, {921, 379}, {952, 377}, {1006, 65535},
+    {1081, 372}, {1134, 309}, {1236, 303}, {1272, 302}, {1287, 306}, {1322, 301},
+    {1358, 405}, {1416, 388}, {1437, 415}, {0, 415}, {38, 403}, {56, 411},
+    {110, 413}, {143, 391}, {189, 408}, {242, 385}, {341, 65535}, {389, 133},
+    {395, 175}, {406, 65}, {412, 61}, {417, 64}, {456, 60}, {474, 70},
+    {507, 82}, {513, 177}, {588, 72}, {596, 65535}, {652, 298}, {735, 51},
+    {805, 22}, {832, 24}, {838, 39}, {845, 37}, {885, 369}, {921, 379},
+    {952, 377}, {1005, 65535}, {1083, 372}, {1132, 65535}, {1133, 309}, {1236, 303},
+    {1272, 302}, {1288, 306}, {1320, 301}, {1358, 405}, {1414, 404}, {1417, 388},
+    {1436, 415}, {0, 415}, {38, 403}, {56, 411}, {110, 413}, {143, 391},
+    {189, 408}, {242, 385}, {341, 65535}, {391, 175}, {407, 65}, {414, 61},
+    {420, 64}, {462, 60}, {474, 70}, {509, 82}, {513, 177}, {590, 72},
+    {595, 65535}, {653, 298}, {735, 51}, {805, 22}, {831, 24}, {838, 39},
+    {846, 37}, {886, 369}, {920, 379}, {953, 377}, {1005, 65535}, {1086, 372},
+    {1129, 65535}, {1132, 309}, {1236, 303}, {1272, 302}, {1290, 306}, {1317, 301},
+    {1359, 405}, {1409, 404}, {1418, 388}, {1435, 415}, {0, 415}, {39, 403},
+    {56, 411}, {111, 413}, {142, 391}, {188, 408}, {241, 385}, {341, 65535},
+    {390, 175}, {408, 65}, {415, 61}, {423, 64}, {469, 60}, {474, 70},
+    {511, 82}, {512, 177}, {592, 72}, {593, 65535}, {654, 298}, {735, 51},
+    {805, 22}, {830, 24}, {838, 39}, {846, 37}, {886, 369}, {920, 379},
+    {953, 377}, {1005, 65535}, {1089, 372}, {1127, 65535}, {1131, 309}, {1236, 303},
+    {1272, 302}, {1292, 306}, {1315, 301}, {1359, 405}, {1405, 404}, {1420, 388},
+    {1435, 415}, {0, 415}, {39, 403}, {55, 411}, {111, 413}, {142, 391},
+    {188, 408}, {241, 385}, {342, 65535}, {389, 175}, {409, 65}, {416, 61},
+    {426, 64}, {474, 70}, {512, 177}, {592, 65535}, {655, 298}, {734, 51},
+    {804, 22}, {829, 24}, {838, 39}, {846, 37}, {887, 369}, {920, 379},
+    {953, 377}, {1004, 65535}, {1092, 372}, {1123, 65535}, {1130, 309}, {1236, 303},
+    {1272, 302}, {1294, 306}, {1313, 301}, {1359, 307}, {1360, 405}, {1400, 404},
+    {1421, 388}, {1434, 415}, {0, 415}, {40, 403}, {55, 411}, {112, 413},
+    {142, 391}, {187, 408}, {241, 385}, {342, 65535}, {388, 175}, {410, 65},
+    {418, 61}, {430, 64}, {474, 70}, {512, 177}, {592, 65535}, {656, 298},
+    {734, 51}, {804, 22}, {828, 24}, {838, 39}, {847, 37}, {887, 369},
+    {920, 379}, {954, 377}, {1004, 65535}, {1096, 372}, {1119, 65535}, {1130, 309},
+    {1236, 303}, {1272, 302}, {1296, 306}, {1311, 301}, {1358, 307}, {1362, 405},
+    {1395, 404}, {1422, 388}, {1434, 415}, {0, 415}, {40, 403}, {55, 411},
+    {112, 413}, {141, 391}, {187, 408}, {241, 385}, {342, 65535}, {387, 175},
+    {411, 65}, {419, 61}, {433, 64}, {467, 67}, {474, 70}, {512, 177},
+    {592, 65535}, {657, 298}, {734, 51}, {804, 22}, {827, 24}, {838, 39},
+    {847, 37}, {888, 369}, {919, 379}, {954, 377}, {1004, 65535}, {1104, 372},
+    {1112, 65535}, {1129, 309}, {1236, 303}, {1272, 302}, {1298, 306}, {1308, 301},
+    {1357, 307}, {1363, 405}, {1390, 404}, {1424, 388}, {1433, 415}, {0, 415},
+    {41, 403}, {55, 411}, {113, 413}, {141, 391}, {186, 408}, {241, 385},
+    {342, 65535}, {386, 175}, {412, 65}, {421, 61}, {437, 64}, {455, 67},
+    {474, 70}, {513, 177}, {592, 65535}, {658, 298}, {733, 51}, {803, 22},
+    {826, 24}, {838, 39}, {847, 37}, {888, 369}, {919, 379}, {955, 377},
+    {1003, 65535}, {1128, 309}, {1236, 303}, {1272, 302}, {1299, 306}, {1306, 301},
+    {1357, 307}, {1365, 405}, {1384, 404}, {1425, 388}, {1432, 415}, {0, 415},
+    {41, 403}, {54, 411}, {113, 413}, {140, 391}, {186, 408}, {241, 385},
+    {342, 65535}, {385, 175}, {413, 65}, {422, 61}, {440, 67}, {474, 70},
+    {513, 177}, {592, 65535}, {659, 298}, {733, 51}, {803, 22}, {825, 24},
+    {838, 39}, {847, 37}, {889, 369}, {919, 379}, {955, 377}, {1003, 65535},
+    {1128, 309}, {1236, 300}, {1284, 302}, {1301, 306}, {1304, 301}, {1356, 307},
+    {1366, 405}, {1378, 404}, {1426, 388}, {1432, 415}, {0, 415}, {42, 403},
+    {54, 411}, {113, 413}, {140, 391}, {185, 408}, {241, 385}, {343, 65535},
+    {384, 175}, {414, 65}, {423, 61}, {442, 67}, {475, 70}, {513, 177},
+    {592, 65535}, {661, 298}, {732, 51}, {803, 22}, {824, 24}, {838, 39},
+    {848, 37}, {890, 369}, {918, 379}, {956, 377}, {1002, 65535}, {1127, 309},
+    {1236, 300}, {1284, 302}, {1303, 301}, {1355, 307}, {1368, 405}, {1371, 404},
+    {1428, 388}, {1431, 415}, {0, 415}, {42, 403}, {54, 411}, {114, 413},
+    {139, 391}, {185, 408}, {241, 385}, {343, 65535}, {384, 175}, {415, 65},
+    {425, 61}, {444, 67}, {475, 70}, {513, 177}, {592, 65535}, {662, 298},
+    {732, 51}, {802, 22}, {823, 24}, {838, 39}, {848, 37}, {890, 369},
+    {918, 379}, {956, 377}, {1002, 65535}, {1127, 309}, {1236, 300}, {1284, 302},
+    {1303, 301}, {1354, 307}, {1369, 404}, {1429, 388}, {1431, 415}, {0, 415},
+    {43, 403}, {54, 411}, {114, 413}, {139, 391}, {184, 408}, {240, 385},
+    {343, 65535}, {383, 175}, {416, 65}, {426, 61}, {445, 58}, {447, 67},
+    {475, 70}, {513, 177}, {591, 65535}, {663, 298}, {731, 65535}, {732, 51},
+    {802, 22}, {822, 24}, {838, 39}, {848, 37}, {891, 369}, {918, 379},
+    {956, 377}, {1001, 65535}, {1126, 309}, {1236, 300}, {1284, 302}, {1304, 301},
+    {1353, 307}, {1369, 404}, {1430, 415}, {0, 415}, {43, 403}, {53, 411},
+    {115, 413}, {138, 391}, {184, 408}, {240, 385}, {343, 65535}, {382, 175},
+    {417, 65}, {428, 61}, {446, 58}, {451, 67}, {475, 70}, {514, 177},
+    {591, 65535}, {665, 298}, {729, 65535}, {732, 51}, {802, 22}, {821, 24},
+    {838, 39}, {848, 37}, {891, 369}, {917, 379}, {957, 377}, {1000, 65535},
+    {1125, 309}, {1236, 300}, {1284, 302}, {1304, 301}, {1352, 307}, {1370, 404},
+    {1431, 415}, {0, 415}, {44, 403}, {53, 411}, {115, 413}, {138, 391},
+    {183, 408}, {240, 385}, {343, 65535}, {381, 175}, {418, 65}, {429, 61},
+    {447, 58}, {454, 67}, {476, 70}, {514, 177}, {591, 65535}, {667, 298},
+    {728, 65535}, {733, 51}, {802, 22}, {820, 24}, {838, 39}, {849, 37},
+    {892, 369}, {917, 379}, {957, 377}, {1000, 65535}, {1125, 309}, {1236, 300},
+    {1284, 302}, {1305, 301}, {1352, 307}, {1370, 404}, {1431, 415}, {0, 415},
+    {44, 403}, {53, 411}, {116, 413}, {137, 391}, {183, 408}, {240, 385},
+    {343, 65535}, {381, 175}, {419, 65}, {431, 61}, {449, 58}, {458, 67},
+    {476, 70}, {514, 177}, {591, 65535}, {668, 298}, {726, 65535}, {733, 51},
+    {801, 22}, {818, 38}, {824, 24}, {838, 39}, {849, 37}, {893, 369},
+    {917, 379}, {958, 377}, {999, 65535}, {1125, 309}, {1236, 300}, {1284, 302},
+    {1305, 301}, {1351, 307}, {1370, 404}, {1432, 415}, {0, 415}, {45, 403},
+    {52, 411}, {116, 413}, {137, 391}, {182, 408}, {240, 385}, {343, 65535},
+    {380, 175}, {420, 65}, {432, 61}, {450, 58}, {462, 67}, {476, 70},
+    {514, 177}, {590, 65535}, {670, 298}, {724, 65535}, {734, 51}, {801, 22},
+    {814, 38}, {832, 24}, {838, 39}, {849, 37}, {893, 369}, {917, 379},
+    {958, 377}, {998, 65535}, {1124, 309}, {1236, 300}, {1284, 302}, {1306, 301},
+    {1350, 307}, {1371, 404}, {1433, 415}, {0, 415}, {45, 403}, {52, 411},
+    {117, 413}, {136, 391}, {182, 408}, {240, 385}, {343, 65535}, {380, 175},
+    {421, 65}, {434, 61}, {451, 58}, {465, 67}, {476, 70}, {514, 177},
+    {590, 65535}, {672, 298}, {722, 65535}, {734, 51}, {801, 22}, {809, 38},
+    {838, 39}, {850, 37}, {894, 369}, {916, 379}, {959, 377}, {998, 65535},
+    {1124, 309}, {1236, 300}, {1284, 302}, {1306, 301}, {1349, 307}, {1371, 404},
+    {1433, 415}, {0, 415}, {46, 403}, {52, 411}, {117, 413}, {136, 391},
+    {181, 408}, {240, 385}, {343, 65535}, {379, 175}, {422, 65}, {436, 61},
+    {452, 58}, {469, 67}, {477, 70}, {515, 177}, {590, 65535}, {675, 298},
+    {720, 65535}, {734, 51}, {800, 22}, {805, 38}, {839, 39}, {850, 37},
+    {894, 369}, {916, 379}, {959, 377}, {997, 65535}, {1123, 309}, {1236, 300},
+    {1284, 302}, {1307, 301}, {1348, 307}, {1371, 404}, {1433, 381}, {1435, 415},
+    {0, 415}, {46, 403}, {52, 411}, {118, 413}, {135, 391}, {181, 408},
+    {239, 385}, {343, 65535}, {379, 175}, {423, 65}, {437, 61}, {453, 58},
+    {472, 59}, {478, 70}, {515, 177}, {589, 65535}, {678, 298}, {717, 65535},
+    {735, 51}, {800, 38}, {841, 39}, {850, 37}, {895, 369}, {916, 379},
+    {960, 377}, {996, 65535}, {1123, 309}, {1236, 300}, {1284, 302}, {1307, 301},
+    {1347, 307}, {1372, 404}, {1431, 381}, {1437, 415}, {0, 415}, {47, 403},
+    {51, 411}, {118, 413}, {135, 391}, {180, 408}, {239, 385}, {343, 65535},
+    {378, 175}, {425, 65}, {439, 61}, {454, 58}, {470, 59}, {479, 70},
+    {515, 177}, {589, 65535}, {681, 298}, {713, 65535}, {735, 51}, {799, 38},
+    {842, 39}, {851, 37}, {896, 369}, {915, 379}, {960, 377}, {995, 65535},
+    {1122, 309}, {1236, 300}, {1284, 302}, {1308, 301}, {1346, 307}, {1372, 404},
+    {1430, 381}, {1439, 415}, {0, 381}, {1, 415}, {47, 403}, {51, 411},
+    {119, 413}, {134, 391}, {180, 408}, {239, 385}, {343, 65535}, {378, 175},
+    {426, 65}, {440, 61}, {456, 58}, {468, 59}, {480, 70}, {515, 177},
+    {588, 65535}, {685, 298}, {709, 65535}, {736, 51}, {798, 38}, {843, 39},
+    {851, 37}, {896, 369}, {915, 379}, {960, 377}, {994, 65535}, {1122, 309},
+    {1236, 300}, {1284, 302}, {1308, 301}, {1345, 307}, {1372, 404}, {1428, 381},
+    {0, 381}, {3, 415}, {48, 403}, {51, 411}, {119, 413}, {134, 391},
+    {179, 408}, {239, 385}, {343, 65535}, {377, 175}, {427, 65}, {442, 61},
+    {457, 58}, {465, 59}, {482, 70}, {514, 150}, {516, 177}, {588, 65535},
+    {693, 298}, {701, 65535}, {737, 51}, {797, 38}, {844, 39}, {851, 37},
+    {897, 369}, {915, 379}, {961, 377}, {993, 65535}, {1122, 309}, {1236, 300},
+    {1284, 302}, {1309, 301}, {1345, 307}, {1373, 404}, {1427, 381}, {0, 381},
+    {5, 415}, {49, 403}, {50, 411}, {120, 413}, {133, 391}, {179, 408},
+    {239, 385}, {343, 65535}, {377, 175}, {428, 65}, {444, 61}, {458, 58},
+    {463, 59}, {483, 70}, {507, 150}, {517, 177}, {587, 65535}, {737, 51},
+    {796, 38}, {845, 39}, {851, 37}, {898, 369}, {914, 379}, {961, 377},
+    {992, 65535}, {1122, 309}, {1236, 300}, {1284, 302}, {1309, 310}, {1310, 301},
+    {1344, 307}, {1373, 404}, {1426, 381}, {0, 381}, {7, 415}, {49, 403},
+    {50, 411}, {120, 413}, {133, 391}, {178, 408}, {239, 385}, {342, 65535},
+    {376, 175}, {429, 65}, {445, 61}, {459, 58}, {461, 59}, {484, 70},
+    {499, 150}, {519, 177}, {587, 65535}, {738, 51}, {796, 38}, {846, 39},
+    {852, 37}, {898, 369}, {914, 379}, {962, 377}, {991, 65535}, {1121, 309},
+    {1236, 300}, {1284, 302}, {1308, 310}, {1314, 301}, {1343, 307}, {1374, 404},
+    {1424, 381}, {0, 381}, {9, 415}, {50, 411}, {121, 413}, {132, 391},
+    {178, 408}, {239, 385}, {342, 65535}, {376, 175}, {430, 65}, {447, 61},
+    {459, 59}, {483, 57}, {494, 150}, {521, 177}, {586, 65535}, {739, 51},
+    {795, 38}, {848, 39}, {852, 37}, {899, 369}, {914, 379}, {962, 377},
+    {990, 65535}, {1121, 309}, {1236, 300}, {1284, 302}, {1308, 310}, {1319, 301},
+    {1342, 307}, {1374, 404}, {1423, 381}, {0, 381}, {12, 415}, {50, 411},
+    {121, 413}, {132, 391}, {177, 408}, {239, 385}, {342, 65535}, {375, 175},
+    {431, 65}, {449, 61}, {458, 59}, {483, 57}, {494, 150}, {522, 177},
+    {586, 65535}, {739, 51}, {794, 38}, {849, 39}, {852, 37}, {900, 369},
+    {913, 379}, {963, 377}, {989, 65535}, {1121, 309}, {1236, 300}, {1284, 302},
+    {1308, 310}, {1323, 301}, {1341, 307}, {1374, 404}, {1421, 381}, {0, 381},
+    {14, 415}, {50, 411}, {122, 413}, {131, 391}, {177, 408}, {238, 385},
+    {342, 65535}, {375, 175}, {433, 65}, {450, 61}, {457, 59}, {482, 57},
+    {494, 150}, {524, 177}, {585, 65535}, {740, 51}, {793, 38}, {850, 39},
+    {853, 37}, {900, 369}, {913, 379}, {963, 377}, {988, 65535}, {1121, 309},
+    {1236, 300}, {1284, 302}, {1308, 310}, {1328, 301}, {1340, 307}, {1375, 404},
+    {1420, 381}, {0, 381}, {16, 415}, {50, 411}, {122, 413}, {130, 65535},
+    {131, 391}, {176, 408}, {238, 385}, {342, 65535}, {375, 175}, {434, 65},
+    {452, 61}, {456, 59}, {481, 57}, {494, 150}, {526, 177}, {584, 65535},
+    {741, 51}, {792, 38}, {851, 39}, {853, 37}, {901, 369}, {913, 379},
+    {964, 377}, {986, 65535}, {1120, 309}, {1236, 300}, {1284, 302}, {1307, 310},
+    {1333, 301}, {1339, 307}, {1375, 404}, {1418, 381}, {0, 381}, {19, 415},
+    {50, 411}, {122, 65535}, {131, 391}, {176, 408}, {238, 385}, {341, 65535},
+    {374, 175}, {435, 65}, {454, 61}, {455, 59}, {480, 57}, {494, 150},
+    {527, 177}, {584, 65535}, {742, 51}, {791, 38}, {853, 37}, {901, 369},
+    {912, 379}, {964, 377}, {985, 65535}, {1120, 309}, {1236, 300}, {1284, 302},
+    {1307, 310}, {1338, 307}, {1375, 404}, {1417, 381}, {0, 381}, {21, 415},
+    {50, 411}, {121, 65535}, {132, 391}, {175, 408}, {238, 385}, {341, 65535},
+    {374, 175}, {436, 65}, {455, 59}, {480, 57}, {493, 150}, {529, 177},
+    {583, 65535}, {743, 51}, {790, 38}, {854, 37}, {902, 369}, {912, 379},
+    {965, 377}, {983, 65535}, {1120, 309}, {1222, 304}, {1236, 300}, {1284, 302},
+    {1307, 310}, {1339, 307}, {1376, 404}, {1415, 381}, {0, 381}, {23, 415},
+    {50, 411}, {119, 65535}, {133, 391}, {174, 408}, {238, 385}, {341, 65535},
+    {374, 175}, {437, 65}, {454, 66}, {455, 59}, {479, 57}, {493, 150},
+    {531, 177}, {582, 65535}, {743, 51}, {789, 38}, {855, 37}, {903, 369},
+    {912, 379}, {965, 377}, {982, 65535}, {1120, 309}, {1222, 304}, {1236, 300},
+    {1284, 302}, {1307, 310}, {1339, 307}, {1376, 404}, {1414, 381}, {0, 381},
+    {26, 415}, {50, 411}, {118, 65535}, {134, 391}, {174, 408}, {238, 385},
+    {340, 65535}, {374, 175}, {439, 65}, {453, 66}, {457, 59}, {478, 57},
+    {493, 150}, {532, 177}, {581, 65535}, {744, 51}, {788, 38}, {856, 37},
+    {903, 369}, {911, 379}, {966, 377}, {980, 65535}, {1120, 309}, {1222, 304},
+    {1236, 300}, {1284, 302}, {1306, 310}, {1339, 307}, {1377, 404}, {1412, 381},
+    {0, 381}, {28, 415}, {50, 411}, {117, 65535}, {135, 391}, {173, 408},
+    {238, 385}, {340, 65535}, {373, 175}, {439, 62}, {443, 65}, {452, 66},
+    {458, 59}, {477, 57}, {493, 150}, {534, 177}, {581, 65535}, {746, 51},
+    {787, 38}, {857, 37}, {904, 369}, {911, 379}, {966, 377}, {978, 65535},
+    {1120, 309}, {1222, 304}, {1236, 300}, {1284, 302}, {1306, 310}, {1340, 307},
+    {1377, 404}, {1411, 381}, {0, 381}, {31, 415}, {50, 411}, {115, 65535},
+    {136, 391}, {173, 408}, {237, 385}, {340, 65535}, {373, 175}, {440, 62},
+    {450, 66}, {459, 59}, {477, 57}, {493, 150}, {536, 177}, {580, 65535},
+    {747, 51}, {786, 38}, {858, 37}, {905, 65535}, {906, 369}, {911, 379},
+    {966, 377}, {976, 65535}, {1120, 309}, {1236, 300}, {1284, 302}, {1306, 310},
+    {1340, 307}, {1377, 404}, {1409, 381}, {0, 381}, {33, 415}, {48, 383},
+    {50, 411}, {113, 65535}, {137, 391}, {172, 408}, {237, 385}, {339, 65535},
+    {373, 175}, {440, 62}, {450, 66}, {460, 59}, {476, 57}, {492, 150},
+    {538, 177}, {579, 65535}, {748, 51}, {785, 38}, {859, 37}, {904, 65535},
+    {912, 379}, {967, 377}, {973, 65535}, {1120, 309}, {1236, 300}, {1284, 302},
+    {1306, 310}, {1341, 307}, {1378, 404}, {1407, 381}, {0, 381}, {33, 383},
+    {52, 411}, {112, 65535}, {138, 391}, {172, 408}, {237, 385}, {339, 65535},
+    {373, 175}, {441, 62}, {450, 66}, {462, 59}, {475, 57}, {492, 150},
+    {540, 177}, {578, 65535}, {749, 51}, {784, 38}, {860, 37}, {904, 65535},
+    {914, 379}, {967, 377}, {970, 65535}, {1120, 309}, {1236, 300}, {1284, 302},
+    {1305, 310}, {1341, 307}, {1378, 404}, {1406, 381}, {0, 381}, {31, 383},
+    {54, 411}, {110, 65535}, {139, 391}, {171, 408}, {237, 385}, {338, 65535},
+    {373, 175}, {441, 62}, {450, 66}, {463, 59}, {474, 57}, {492, 150},
+    {541, 177}, {577, 65535}, {750, 51}, {783, 38}, {861, 37}, {903, 65535},
+    {917, 379}, {967, 65535}, {1120, 309}, {1236, 304}, {1237, 300}, {1284, 302},
+    {1305, 310}, {1341, 307}, {1379, 404}, {1404, 381}, {0, 381}, {30, 383},
+    {56, 411}, {107, 65535}, {140, 391}, {171, 408}, {237, 385}, {338, 65535},
+    {373, 175}, {441, 62}, {449, 66}, {464, 59}, {473, 57}, {492, 150},
+    {543, 177}, {576, 65535}, {752, 51}, {782, 38}, {862, 37}, {902, 65535},
+    {919, 379}, {965, 65535}, {1120, 309}, {1236, 304}, {1239, 300}, {1284, 302},
+    {1305, 310}, {1342, 307}, {1379, 404}, {1402, 381}, {0, 381}, {29, 383},
+    {58, 411}, {105, 65535}, {142, 391}, {170, 408}, {237, 385}, {337, 65535},
+    {373, 175}, {442, 62}, {449, 66}, {465, 59}, {473, 57}, {492, 150},
+    {545, 177}, {574, 65535}, {753, 51}, {781, 38}, {863, 37}, {902, 65535},
+    {922, 379}, {962, 65535}, {1120, 309}, {1236, 304}, {1242, 300}, {1284, 302},
+    {1304, 310}, {1342, 307}, {1379, 404}, {1401, 381}, {0, 381}, {28, 383},
+    {60, 411}, {102, 65535}, {143, 391}, {169, 408}, {237, 385}, {337, 65535},
+    {373, 175}, {442, 62}, {449, 66}, {467, 59}, {472, 57}, {491, 150},
+    {547, 177}, {573, 65535}, {755, 51}, {780, 38}, {864, 37}, {901, 65535},
+    {926, 379}, {958, 65535}, {1120, 309}, {1236, 304}, {1244, 300}, {1284, 302},
+    {1302, 308}, {1305, 310}, {1343, 307}, {1380, 404}, {1399, 381}, {0, 381},
+    {27, 383}, {61, 65535}, {63, 411}, {99, 65535}, {145, 391}, {169, 408},
+    {236, 385}, {336, 65535}, {372, 175}, {443, 62}, {449, 66}, {468, 59},
+    {471, 57}, {491, 150}, {549, 177}, {572, 65535}, {757, 51}, {779, 38},
+    {865, 37}, {900, 65535}, {931, 379}, {953, 65535}, {1120, 309}, {1236, 304},
+    {1246, 300}, {1284, 302}, {1300, 308}, {1306, 310}, {1343, 307}, {1380, 404},
+    {1397, 381}, {0, 381}, {26, 383}, {63, 65535}, {67, 411}, {95, 65535},
+    {146, 391}, {168, 408}, {236, 385}, {335, 65535}, {372, 175}, {443, 62},
+    {448, 66}, {469, 59}, {470, 57}, {491, 150}, {551, 177}, {570, 65535},
+    {759, 51}, {778, 38}, {866, 37}, {899, 65535}, {1120, 309}, {1236, 304},
+    {1248, 300}, {1286, 302}, {1298, 308}, {1307, 310}, {1344, 307}, {1381, 404},
+    {1396, 381}, {0, 381}, {25, 383}, {64, 65535}, {74, 411}, {88, 65535},
+    {148, 391}, {168, 408}, {236, 385}, {335, 65535}, {372, 175}, {444, 62},
+    {448, 66}, {470, 57}, {491, 150}, {553, 177}, {569, 65535}, {761, 51},
+    {777, 38}, {867, 37}, {898, 65535}, {1120, 309}, {1236, 304}, {1251, 300},
+    {1287, 302}, {1295, 308}, {1308, 310}, {1344, 307}, {1381, 404}, {1394, 381},
+    {0, 381}, {24, 383}, {65, 65535}, {150, 391}, {167, 408}, {236, 385},
+    {334, 65535}, {372, 175}, {444, 62}, {448, 66}, {469, 57}, {491, 150},
+    {555, 177}, {567, 65535}, {763, 51}, {776, 38}, {868, 37}, {897, 65535},
+    {1120, 309}, {1236, 304}, {1252, 300}, {1289, 302}, {1293, 308}, {1309, 310},
+    {1344, 307}, {1382, 404}, {1392, 381}, {0, 381}, {23, 383}, {67, 65535},
+    {152, 391}, {166, 408}, {236, 385}, {333, 65535}, {373, 175}, {445, 62},
+    {448, 66}, {469, 57}, {490, 150}, {557, 177}, {565, 65535}, {766, 51},
+    {775, 38}, {869, 37}, {896, 65535}, {1120, 309}, {1236, 304}, {1251, 300},
+    {1290, 308}, {1310, 310}, {1345, 307}, {1382, 404}, {1390, 381}, {0, 381},
+    {22, 383}, {68, 65535}, {154, 391}, {166, 408}, {236, 385}, {332, 65535},
+    {373, 175}, {445, 62}, {447, 66}, {469, 57}, {490, 150}, {559, 177},
+    {563, 65535}, {769, 51}, {774, 38}, {870, 37}, {895, 65535}, {1121, 309},
+    {1236, 304}, {1251, 300}, {1290, 308}, {1311, 310}, {1345, 307}, {1382, 404},
+    {1388, 381}, {0, 381}, {20, 383}, {69, 65535}, {157, 391}, {165, 408},
+    {236, 385}, {331, 65535}, {373, 175}, {445, 62}, {447, 66}, {469, 57},
+    {490, 150}, {561, 65535}, {773, 38}, {871, 37}, {894, 65535}, {1121, 309},
+    {1210, 304}, {1250, 300}, {1289, 308}, {1312, 310}, {1346, 307}, {1383, 404},
+    {1387, 381}, {0, 381}, {19, 383}, {70, 65535}, {160, 391}, {165, 408},
+    {235, 385}, {331, 65535}, {373, 175}, {446, 62}, {447, 66}, {468, 57},
+    {490, 150}, {561, 65535}, {774, 38}, {872, 37}, {893, 65535}, {998, 374},
+    {1004, 65535}, {1121, 309}, {1210, 304}, {1250, 300}, {1288, 308}, {1313, 310},
+    {1346, 307}, {1383, 404}, {1385, 381}, {0, 381}, {18, 383}, {71, 65535},
+    {163, 391}, {164, 408}, {235, 385}, {330, 65535}, {373, 175}, {446, 62},
+    {447, 66}, {468, 57}, {490, 150}, {561, 65535}, {774, 38}, {873, 37},
+    {892, 65535}, {986, 374}, {1015, 65535}, {1121, 309}, {1210, 304}, {1249, 300},
+    {1288, 308}, {1314, 310}, {1347, 307}, {1383, 381}, {0, 381}, {17, 383},
+    {72, 65535}, {165, 408}, {234, 65535}, {236, 385}, {329, 65535}, {373, 175},
+    {447, 66}, {468, 57}, {489, 150}, {561, 65535}, {775, 38}, {875, 37},
+    {890, 65535}, {981, 374}, {1021, 65535}, {1122, 309}, {1210, 304}, {1249, 300},
+    {1287, 308}, {1315, 310}, {1347, 307}, {1383, 381}, {0, 381}, {16, 383},
+    {73, 65535}, {167, 408}, {232, 65535}, {237, 385}, {328, 65535}, {373, 175},
+    {447, 66}, {468, 57}, {489, 150}, {561, 65535}, {775, 38}, {876, 37},
+    {889, 65535}, {976, 374}, {1025, 65535}, {1122, 309}, {1210, 304}, {1248, 300},
+    {1286, 308}, {1316, 310}, {1348, 307}, {1382, 381}, {0, 381}, {14, 383},
+    {74, 65535}, {169, 408}, {230, 65535}, {238, 385}, {326, 65535}, {373, 175},
+    {447, 66}, {467, 57}, {489, 150}, {561, 65535}, {776, 38}, {877, 37},
+    {888, 65535}, {973, 374}, {1029, 65535}, {1123, 309}, {1210, 304}, {1248, 300},
+    {1286, 308}, {1317, 310}, {1348, 307}, {1382, 381}, {0, 381}, {13, 383},
+    {75, 65535}, {171, 408}, {228, 65535}, {239, 385}, {325, 65535}, {374, 175},
+    {447, 66}, {467, 57}, {489, 150}, {561, 65535}, {777, 38}, {878, 37},
+    {886, 65535}, {970, 374}, {1032, 65535}, {1123, 309}, {1210, 304}, {1247, 300},
+    {1285, 308}, {1318, 310}, {1348, 307}, {1381, 381}, {0, 381}, {12, 383},
+    {76, 65535}, {174, 408}, {225, 65535}, {241, 385}, {324, 65535}, {374, 175},
+    {447, 66}, {467, 57}, {488, 150}, {561, 65535}, {778, 38}, {879, 37},
+    {884, 65535}, {967, 374}, {1035, 65535}, {1123, 309}, {1210, 304}, {1247, 300},
+    {1284, 308}, {1319, 310}, {1349, 307}, {1381, 381}, {0, 381}, {11, 383},
+    {77, 65535}, {177, 408}, {223, 65535}, {242, 385}, {323, 65535}, {373, 91},
+    {377, 175}, {447, 66}, {467, 57}, {488, 150}, {561, 65535}, {778, 38},
+    {880, 37}, {882, 65535}, {964, 374}, {1038, 65535}, {1124, 309}, {1210, 304},
+    {1246, 300}, {1284, 308}, {1320, 310}, {1349, 307}, {1380, 381}, {0, 381},
+    {9, 383}, {78, 65535}, {180, 408}, {220, 65535}, {243, 385}, {321, 65535},
+    {372, 91}, {383, 175}, {447, 66}, {466, 57}, {488, 150}, {561, 65535},
+    {779, 38}, {881, 65535}, {962, 374}, {1040, 65535}, {1124, 309}, {1210, 304},
+    {1246, 300}, {1284, 308}, {1321, 310}, {1350, 307}, {1380, 381}, {0, 381},
+    {8, 383}, {78, 65535}, {184, 408}, {216, 65535}, {245, 385}, {320, 65535},
+    {371, 91}, {388, 175}, {447, 66}, {466, 57}, {488, 150}, {560, 65535},
+    {780, 38}, {880, 65535}, {959, 374}, {1042, 65535}, {1125, 309}, {1210, 304},
+    {1245, 300}, {1284, 308}, {1322, 310}, {1350, 307}, {1379, 381}, {0, 381},
+    {7, 383}, {79, 65535}, {189, 408}, {210, 65535}, {247, 385}, {318, 65535},
+    {370, 91}, {394, 175}, {447, 66}, {466, 57}, {488, 150}, {560, 65535},
+    {781, 38}, {879, 65535}, {957, 374}, {1044, 65535}, {1125, 309}, {1210, 304},
+    {1245, 300}, {1281, 308}, {1323, 310}, {1351, 307}, {1378, 381}, {0, 381},
+    {6, 383}, {80, 65535}, {248, 385}, {316, 65535}, {369, 91}, {401, 175},
+    {447, 66}, {466, 57}, {487, 150}, {560, 65535}, {782, 38}, {878, 65535},
+    {955, 374}, {1046, 65535}, {1126, 309}, {1210, 304}, {1244, 300}, {1280, 308},
+    {1324, 310}, {1351, 307}, {1378, 381}, {0, 381}, {4, 383}, {80, 65535},
+    {250, 385}, {314, 65535}, {368, 91}, {409, 175}, {447, 66}, {465, 57},
+    {487, 150}, {560, 65535}, {783, 38}, {877, 65535}, {954, 374}, {1048, 65535},
+    {1127, 309}, {1210, 304}, {1243, 300}, {1280, 308}, {1324, 305}, {1325, 310},
+    {1352, 307}, {1377, 381}, {0, 381}, {3, 383}, {81, 65535}, {253, 385},
+    {312, 65535}, {368, 91}, {417, 175}, {447, 66}, {465, 57}, {487, 150},
+    {559, 65535}, {784, 38}, {876, 65535}, {952, 374}, {1050, 65535}, {1127, 309},
+    {1210, 304}, {1243, 300}, {1279, 308}, {1321, 305}, {1329, 310}, {1352, 307},
+    {1377, 381}, {0, 381}, {2, 383}, {82, 65535}, {255, 385}, {310, 65535},
+    {367, 91}, {428, 175}, {447, 66}, {465, 57}, {487, 150}, {559, 65535},
+    {786, 38}, {874, 65535}, {950, 374}, {1052, 65535}, {1128, 309}, {1210, 304},
+    {1242, 300}, {1278, 308}, {1318, 305}, {1334, 310}, {1353, 307}, {1376, 381},
+    {0, 383}, {82, 65535}, {258, 385}, {307, 65535}, {366, 91}, {442, 175},
+    {447, 66}, {465, 57}, {486, 150}, {559, 65535}, {787, 38}, {873, 65535},
+    {948, 374}, {1053, 65535}, {1129, 309}, {1210, 304}, {1242, 300}, {1277, 308},
+    {1315, 305}, {1338, 310}, {1353, 307}, {1376, 381}, {0, 383}, {83, 65535},
+    {261, 385}, {304, 65535}, {365, 91}, {450, 66}, {464, 57}, {486, 150},
+    {558, 65535}, {788, 38}, {872, 65535}, {947, 374}, {1055, 65535}, {1129, 309},
+    {1210, 304}, {1241, 300}, {1277, 308}, {1311, 305}, {1343, 310}, {1354, 307},
+    {1375, 381}, {1439, 383}, {0, 383}, {83, 65535}, {265, 385}, {300, 65535},
+    {364, 91}, {454, 66}, {464, 57}, {486, 150}, {558, 65535}, {790, 38},
+    {870, 65535}, {945, 374}, {1056, 65535}, {1130, 309}, {1210, 304}, {1241, 300},
+    {1276, 308}, {1308, 305}, {1348, 310}, {1354, 307}, {1374, 381}, {1438, 383},
+    {0, 383}, {84, 65535}, {269, 385}, {295, 65535}, {364, 91}, {458, 66},
+    {464, 57}, {486, 150}, {557, 65535}, {791, 38}, {869, 65535}, {944, 374},
+    {1058, 65535}, {1131, 309}, {1210, 304}, {1240, 300}, {1275, 308}, {1304, 305},
+    {1354, 310}, {1355, 307}, {1374, 381}, {1436, 383}, {0, 383}, {84, 65535},
+    {279, 385}, {285, 65535}, {363, 91}, {462, 66}, {463, 57}, {485, 150},
+    {557, 65535}, {793, 38}, {867, 65535}, {943, 374}, {1059, 65535}, {1132, 309},
+    {1210, 304}, {1239, 300}, {1274, 308}, {1300, 305}, {1356, 307}, {1373, 381},
+    {1435, 383}, {0, 383}, {85, 65535}, {362, 91}, {465, 57}, {485, 150},
+    {556, 65535}, {564, 297}, {583, 65535}, {795, 38}, {865, 65535}, {941, 374},
+    {1060, 65535}, {1133, 309}, {1210, 304}, {1239, 300}, {1273, 308}, {1296, 305},
+    {1358, 307}, {1373, 381}, {1433, 383}, {0, 383}, {85, 65535}, {362, 91},
+    {466, 57}, {485, 150}, {556, 297}, {592, 65535}, {797, 38}, {863, 65535},
+    {940, 374}, {1062, 65535}, {1134, 309}, {1210, 304}, {1238, 300}, {1273, 308},
+    {1292, 305}, {1360, 307}, {1372, 381}, {1432, 383}, {0, 383}, {86, 65535},
+    {361, 91}, {467, 57}, {485, 150}, {554, 297}, {598, 65535}, {799, 38},
+    {861, 65535}, {939, 374}, {1063, 65535}, {1135, 309}, {1211, 304}, {1238, 300},
+    {1272, 308}, {1288, 305}, {1362, 307}, {1371, 381}, {1430, 383}, {0, 383},
+    {86, 65535}, {360, 91}, {469, 57}, {485, 150}, {553, 297}, {602, 65535},
+    {801, 38}, {859, 65535}, {938, 374}, {1064, 65535}, {1136, 309}, {1211, 304},
+    {1237, 300}, {1271, 308}, {1283, 305}, {1364, 307}, {1371, 381}, {1429, 383},
+    {0, 383}, {87, 65535}, {360, 91}, {470, 57}, {484, 150}, {551, 297},
+    {606, 65535}, {804, 38}, {856, 65535}, {937, 374}, {1065, 65535}, {1138, 309},
+    {1211, 304}, {1237, 300}, {1270, 308}, {1279, 305}, {1366, 307}, {1370, 381},
+    {1427, 383}, {0, 383}, {87, 65535}, {359, 91}, {472, 57}, {484, 150},
+    {549, 297}, {609, 65535}, {807, 38}, {853, 65535}, {936, 374}, {1066, 65535},
+    {1139, 309}, {1211, 304}, {1236, 300}, {1269, 308}, {1273, 305}, {1368, 307},
+    {1370, 381}, {1426, 383}, {0, 383}, {87, 65535}, {359, 91}, {473, 57},
+    {484, 150}, {548, 297}, {612, 65535}, {811, 38}, {849, 65535}, {935, 374},
+    {1067, 65535}, {1140, 309}, {1211, 304}, {1235, 300}, {1268, 305}, {1369, 381},
+    {1424, 383}, {0, 383}, {88, 65535}, {358, 91}, {475, 57}, {484, 150},
+    {546, 297}, {615, 65535}, {815, 38}, {845, 65535}, {934, 374}, {1068, 65535},
+    {1142, 309}, {1211, 304}, {1235, 300}, {1266, 305}, {1370, 381}, {1423, 383},
+    {0, 383}, {88, 65535}, {358, 91}, {477, 57}, {483, 150}, {544, 297},
+    {618, 65535}, {823, 38}, {837, 65535}, {933, 374}, {1069, 65535}, {1144, 309},
+    {1211, 304}, {1234, 300}, {1265, 305}, {1370, 381}, {1421, 383}, {0, 383},
+    {88, 65535}, {358, 91}, {478, 57}, {483, 150}, {542, 297}, {620, 65535},
+    {932, 374}, {1070, 65535}, {1145, 309}, {1211, 304}, {1233, 300}, {1263, 305},
+    {1371, 381}, {1420, 383}, {0, 383}, {88, 65535}, {357, 91}, {478, 299},
+    {498, 150}, {533, 299}, {541, 297}, {622, 65535}, {931, 374}, {1071, 65535},
+    {1147, 309}, {1211, 304}, {1233, 300}, {1261, 305}, {1371, 381}, {1418, 383},
+    {0, 383}, {89, 65535}, {357, 91}, {477, 299}, {541, 297}, {624, 65535},
+    {930, 374}, {1072, 65535}, {1149, 309}, {1211, 304}, {1232, 300}, {1259, 305},
+    {1370, 199}, {1372, 381}, {1416, 383}, {0, 383}, {89, 65535}, {356, 91},
+    {476, 299}, {541, 297}, {626, 65535}, {929, 374}, {1073, 65535}, {1151, 309},
+    {1211, 304}, {1232, 300}, {1257, 305}, {1369, 199}, {1374, 381}, {1415, 383},
+    {0, 383}, {89, 65535}, {356, 91}, {475, 299}, {540, 297}, {628, 65535},
+    {928, 374}, {1073, 65535}, {1154, 309}, {1211, 304}, {1231, 300}, {1255, 305},
+    {1367, 199}, {1376, 381}, {1413, 383}, {0, 383}, {89, 65535}, {356, 91},
+    {475, 299}, {540, 297}, {630, 65535}, {928, 374}, {1074, 65535}, {1157, 309},
+    {1210, 65535}, {1212, 304}, {1230, 300}, {1253, 305}, {1365, 199}, {1378, 381},
+    {1411, 383}, {0, 383}, {89, 65535}, {355, 91}, {474, 299}, {540, 297},
+    {632, 65535}, {927, 374}, {1075, 65535}, {1160, 309}, {1207, 65535}, {1216, 304},
+    {1230, 300}, {1251, 305}, {1364, 199}, {1380, 381}, {1409, 383}, {0, 383},
+    {89, 65535}, {355, 91}, {473, 299}, {540, 297}, {634, 65535}, {926, 374},
+    {1076, 65535}, {1164, 309}, {1203, 65535}, {1220, 304}, {1229, 300}, {1249, 305},
+    {1362, 199}, {1383, 381}, {1408, 383}, {0, 383}, {89, 65535}, {355, 91},
+    {472, 299}, {539, 297}, {635, 65535}, {925, 374}, {1076, 65535}, {1169, 309},
+    {1198, 65535}, {1228, 300}, {1246, 305}, {1360, 199}, {1385, 381}, {1406, 383},
+    {0, 383}, {89, 65535}, {355, 91}, {471, 299}, {539, 297}, {637, 65535},
+    {925, 374}, {1077, 65535}, {1177, 309}, {1190, 65535}, {1230, 300}, {1244, 305},
+    {1358, 199}, {1387, 381}, {1404, 383}, {0, 383}, {89, 65535}, {355, 91},
+    {470, 299}, {539, 297}, {638, 65535}, {924, 374}, {1078, 65535}, {1231, 300},
+    {1242, 305}, {1356, 199}, {1389, 381}, {1402, 383}, {0, 383}, {89, 65535},
+    {354, 91}, {470, 299}, {539, 297}, {640, 65535}, {924, 374}, {1078, 65535},
+    {1233, 300}, {1240, 305}, {1355, 199}, {1392, 381}, {1400, 383}, {0, 383},
+    {89, 65535}, {354, 91}, {469, 299}, {539, 297}, {641, 65535}, {923, 374},
+    {1079, 65535}, {1235, 300}, {1237, 305}, {1353, 199}, {1394, 381}, {1398, 383},
+    {0, 383}, {89, 65535}, {354, 91}, {468, 299}, {538, 297}, {642, 65535},
+    {922, 374}, {1079, 65535}, {1236, 305}, {1351, 199}, {1396, 383}, {0, 383},
+    {89, 65535}, {354, 91}, {467, 299}, {538, 297}, {644, 65535}, {922, 374},
+    {1080, 65535}, {1236, 305}, {1349, 199}, {1397, 383}, {0, 383}, {89, 65535},
+    {354, 91}, {466, 299}, {538, 297}, {645, 65535}, {921, 374}, {1080, 65535},
+    {1237, 305}, {1347, 199}, {1398, 383}, {0, 383}, {89, 65535}, {354, 91},
+    {462, 63}, {466, 299}, {537, 297}, {646, 65535}, {921, 374}, {1081, 65535},
+    {1237, 305}, {1345, 199}, {1399, 383}, {0, 383}, {88, 65535}, {354, 91},
+    {458, 63}, {466, 299}, {537, 297}, {647, 65535}, {921, 374}, {1081, 65535},
+    {1237, 305}, {1343, 199}, {1400, 383}, {0, 383}, {88, 65535}, {354, 91},
+    {454, 63}, {466, 299}, {537, 297}, {648, 65535}, {920, 374}, {1082, 65535},
+    {1238, 305}, {1341, 199}, {1401, 383}, {0, 383}, {88, 65535}, {354, 91},
+    {450, 63}, {466, 299}, {537, 297}, {649, 65535}, {920, 374}, {1082, 65535},
+    {1238, 305}, {1338, 199}, {1402, 383}, {0, 383}, {88, 65535}, {354, 91},
+    {446, 63}, {466, 299}, {536, 297}, {651, 65535}, {919, 374}, {1082, 65535},
+    {1238, 305}, {1336, 199}, {1403, 383}, {0, 383}, {87, 65535}, {354, 91},
+    {442, 63}, {466, 299}, {536, 297}, {652, 65535}, {919, 374}, {1083, 65535},
+    {1239, 305}, {1334, 199}, {1404, 383}, {0, 383}, {87, 65535}, {355, 91},
+    {437, 63}, {466, 299}, {536, 297}, {653, 65535}, {919, 374}, {1083, 65535},
+    {1239, 305}, {1332, 199}, {1405, 383}, {0, 383}, {87, 65535}, {355, 91},
+    {432, 63}, {466, 299}, {536, 297}, {653, 65535}, {918, 374}, {1083, 65535},
+    {1240, 305}, {1329, 199}, {1406, 383}, {0, 383}, {86, 65535}, {354, 168},
+    {362, 91}, {426, 63}, {466, 299}, {535, 297}, {654, 65535}, {918, 374},
+    {1084, 65535}, {1240, 305}, {1327, 199}, {1407, 383}, {0, 383}, {86, 65535},
+    {354, 168}, {375, 91}, {420, 63}, {466, 299}, {535, 297}, {655, 65535},
+    {918, 374}, {1084, 65535}, {1241, 305}, {1325, 199}, {1408, 383}, {0, 383},
+    {85, 65535}, {353, 168}, {416, 63}, {466, 299}, {535, 297}, {656, 65535},
+    {918, 374}, {1084, 65535}, {1242, 305}, {1322, 199}, {1409, 383}, {0, 383},
+    {85, 65535}, {352, 168}, {418, 63}, {466, 299}, {534, 297}, {657, 65535},
+    {918, 374}, {1084, 65535}, {1242, 305}, {1320, 199}, {1410, 383}, {0, 383},
+    {84, 65535}, {352, 168}, {420, 63}, {466, 299}, {534, 297}, {658, 65535},
+    {918, 374}, {1084, 65535}, {1243, 305}, {1317, 199}, {1411, 383}, {0, 383},
+    {84, 65535}, {351, 168}, {422, 63}, {466, 299}, {534, 297}, {658, 65535},
+    {917, 374}, {1084, 65535}, {1244, 305}, {1314, 199}, {1412, 383}, {0, 383},
+    {83, 65535}, {350, 168}, {424, 63}, {466, 299}, {534, 297}, {659, 65535},
+    {917, 374}, {1084, 65535}, {1245, 305}, {1312, 199}, {1413, 383}, {0, 383},
+    {82, 65535}, {350, 168}, {426, 63}, {466, 299}, {533, 297}, {660, 65535},
+    {917, 374}, {1084, 65535}, {1246, 305}, {1309, 199}, {1414, 383}, {0, 383},
+    {81, 65535}, {349, 168}, {428, 63}, {466, 299}, {533, 297}, {660, 65535},
+    {917, 374}, {1085, 65535}, {1247, 305}, {1306, 199}, {1416, 383}, {0, 383},
+    {81, 65535}, {349, 168}, {430, 63}, {466, 299}, {533, 297}, {661, 65535},
+    {917, 374}, {1085, 65535}, {1248, 305}, {1303, 199}, {1417, 383}, {0, 383},
+    {80, 65535}, {348, 168}, {433, 63}, {466, 299}, {532, 297}, {662, 65535},
+    {917, 374}, {1084, 65535}, {1249, 305}, {1300, 199}, {1418, 383}, {0, 383},
+    {79, 65535}, {348, 168}, {435, 63}, {466, 299}, {532, 297}, {662, 65535},
+    {917, 374}, {1084, 65535}, {1250, 305}, {1297, 199}, {1419, 383}, {0, 383},
+    {78, 65535}, {348, 168}, {437, 63}, {466, 299}, {532, 297}, {663, 65535},
+    {917, 374}, {1084, 65535}, {1251, 305}, {1293, 199}, {1420, 383}, {0, 383},
+    {77, 65535}, {347, 168}, {440, 63}, {466, 299}, {531, 297}, {663, 65535},
+    {918, 374}, {1084, 65535}, {1252, 305}, {1290, 199}, {1421, 383}, {0, 383},
+    {76, 65535}, {347, 168}, {442, 63}, {464, 68}, {466, 299}, {531, 297},
+    {664, 65535}, {918, 374}, {1084, 65535}, {1254, 305}, {1286, 199}, {1423, 383},
+    {0, 383}, {75, 65535}, {347, 168}, {445, 63}, {457, 68}, {467, 299},
+    {531, 297}, {664, 65535}, {918, 374}, {1084, 65535}, {1150, 196}, {1174, 65535},
+    {1255, 305}, {1283, 199}, {1424, 383}, {0, 383}, {74, 65535}, {346, 168},
+    {447, 63}, {448, 68}, {468, 299}, {530, 297}, {665, 65535}, {918, 374},
+    {1084, 65535}, {1138, 196}, {1186, 65535}, {1257, 305}, {1279, 199}, {1425, 383},
+    {0, 383}, {72, 65535}, {346, 168}, {446, 68}, {468, 299}, {530, 297},
+    {665, 65535}, {918, 374}, {1083, 65535}, {1131, 196}, {1193, 65535}, {1258, 305},
+    {1275, 199}, {1426, 383}, {0, 383}, {71, 65535}, {346, 168}, {444, 68},
+    {469, 299}, {530, 297}, {665, 65535}, {919, 374}, {1083, 65535}, {1125, 196},
+    {1199, 65535}, {1252, 198}, {1263, 305}, {1271, 199}, {1428, 383}, {0, 383},
+    {69, 65535}, {346, 168}, {442, 68}, {470, 299}, {529, 297}, {666, 65535},
+    {919, 374}, {1083, 65535}, {1120, 196}, {1205, 65535}, {1246, 198}, {1268, 199},
+    {1429, 383}, {0, 383}, {68, 65535}, {346, 168}, {440, 68}, {471, 299},
+    {529, 297}, {666, 65535}, {919, 374}, {1082, 65535}, {1115, 196}, {1209, 65535},
+    {1240, 198}, {1269, 199}, {1430, 383}, {0, 383}, {66, 65535}, {345, 168},
+    {439, 68}, {472, 299}, {529, 297}, {666, 65535}, {920, 374}, {1082, 65535},
+    {1111, 196}, {1213, 65535}, {1235, 198}, {1271, 199}, {1432, 383}, {0, 383},
+    {64, 65535}, {345, 168}, {437, 68}, {473, 299}, {528, 297}, {667, 65535},
+    {920, 374}, {1082, 65535}, {1107, 196}, {1217, 65535}, {1230, 198}, {1272, 199},
+    {1433, 383}, {0, 383}, {62, 65535}, {345, 168}, {435, 68}, {474, 299},
+    {528, 297}, {667, 65535}, {921, 374}, {1081, 65535}, {1103, 196}, {1221, 65535},
+    {1226, 198}, {1274, 199}, {1434, 383}, {0, 383}, {60, 65535}, {345, 168},
+    {433, 68}, {475, 299}, {528, 297}, {667, 65535}, {921, 374}, {1081, 65535},
+    {1100, 196}, {1223, 198}, {1276, 199}, {1436, 383}, {0, 383}, {58, 65535},
+    {345, 168}, {431, 68}, {476, 299}, {527, 297}, {667, 65535}, {922, 374},
+    {1080, 65535}, {1097, 196}, {1223, 198}, {1277, 199}, {1437, 383}, {0, 383},
+    {56, 65535}, {345, 168}, {429, 68}, {476, 299}, {527, 297}, {667, 65535},
+    {864, 204}, {893, 65535}, {919, 200}, {924, 374}, {1079, 65535}, {1094, 196},
+    {1223, 198}, {1279, 199}, {1439, 383}, {0, 383}, {53, 65535}, {345, 168},
+    {427, 68}, {477, 299}, {526, 297}, {667, 65535}, {852, 204}, {905, 65535},
+    {915, 200}, {928, 374}, {1079, 65535}, {1091, 196}, {1223, 198}, {1281, 199},
+    {0, 199}, {2, 383}, {50, 65535}, {345, 168}, {424, 68}, {478, 299},
+    {526, 297}, {668, 65535}, {844, 204}, {912, 200}, {933, 374}, {1078, 65535},
+    {1088, 196}, {1223, 198}, {1283, 199}, {0, 199}, {3, 383}, {47, 65535},
+    {346, 168}, {422, 68}, {479, 299}, {526, 297}, {668, 65535}, {837, 204},
+    {912, 200}, {937, 374}, {1075, 197}, {1082, 65535}, {1086, 196}, {1223, 198},
+    {1284, 199}, {0, 199}, {5, 383}, {43, 65535}, {346, 168}, {420, 68},
+    {480, 299}, {525, 297}, {668, 65535}, {831, 204}, {912, 200}, {941, 374},
+    {1071, 197}, {1084, 196}, {1223, 198}, {1286, 199}, {0, 199}, {6, 383},
+    {38, 65535}, {346, 168}, {418, 68}, {481, 299}, {525, 297}, {668, 65535},
+    {826, 204}, {913, 200}, {946, 374}, {1066, 197}, {1085, 196}, {1223, 198},
+    {1288, 199}, {0, 199}, {8, 383}, {32, 65535}, {346, 168}, {415, 68},
+    {482, 299}, {524, 297}, {667, 65535}, {822, 204}, {913, 200}, {951, 374},
+    {1062, 197}, {1085, 196}, {1223, 198}, {1290, 199}, {0, 199}, {10, 383},
+    {22, 65535}, {346, 168}, {413, 68}, {483, 299}, {524, 297}, {667, 65535},
+    {818, 204}, {913, 200}, {957, 374}, {1057, 197}, {1085, 196}, {1223, 198},
+    {1292, 199}, {0, 199}, {10, 65535}, {347, 168}, {410, 68}, {485, 299},
+    {524, 297}, {667, 65535}, {814, 204}, {913, 200}, {963, 374}, {1051, 197},
+    {1085, 196}, {1223, 198}, {1294, 199}, {0, 199}, {10, 65535}, {347, 168},
+    {408, 68}, {486, 299}, {523, 297}, {667, 65535}, {810, 204}, {913, 200},
+    {969, 374}, {1046, 197}, {1085, 196}, {1223, 198}, {1296, 199}, {0, 199},
+    {10, 65535}, {347, 168}, {405, 68}, {487, 299}, {523, 297}, {667, 65535},
+    {807, 204}, {913, 200}, {976, 374}, {1040, 197}, {1086, 196}, {1223, 198},
+    {1298, 199}, {0, 199}, {9, 65535}, {348, 168}, {403, 68}, {488, 299},
+    {522, 297}, {667, 65535}, {803, 204}, {914, 200}, {984, 374}, {1033, 197},
+    {1086, 196}, {1223, 198}, {1300, 199}, {0, 199}, {9, 65535}, {348, 168},
+    {400, 68}, {488, 202}, {490, 299}, {522, 297}, {666, 65535}, {714, 205},
+    {746, 65535}, {800, 204}, {914, 200}, {994, 374}, {1026, 197}, {1086, 196},
+    {1223, 198}, {1302, 199}, {0, 199}, {9, 65535}, {349, 168}, {397, 68},
+    {482, 202}, {501, 299}, {521, 297}, {666, 65535}, {701, 205}, {760, 65535},
+    {797, 204}, {914, 200}, {1006, 374}, {1018, 197}, {1086, 196}, {1223, 198},
+    {1305, 199}, {0, 199}, {8, 65535}, {350, 168}, {394, 68}, {476, 202},
+    {516, 299}, {521, 297}, {666, 65535}, {692, 205}, {769, 65535}, {794, 204},
+    {914, 200}, {1013, 197}, {1087, 196}, {1223, 198}, {1307, 199}, {0, 199},
+    {8, 65535}, {350, 168}, {391, 68}, {469, 202}, {522, 297}, {665, 65535},
+    {684, 205}, {776, 65535}, {792, 204}, {914, 200}, {1013, 197}, {1087, 196},
+    {1223, 198}, {1309, 199}, {0, 199}, {8, 65535}, {349, 203}, {355, 168},
+    {388, 68}, {461, 202}, {524, 297}, {665, 65535}, {678, 205}, {782, 65535},
+    {789, 204}, {915, 200}, {1013, 197}, {1087, 196}, {1223, 198}, {1312, 199},
+    {0, 199}, {7, 65535}, {347, 203}, {364, 168}, {385, 68}, {452, 202},
+    {525, 297}, {664, 65535}, {672, 205}, {787, 204}, {915, 200}, {1013, 197},
+    {1087, 196}, {1223, 198}, {1314, 199}, {0, 199}, {7, 65535}, {345, 203},
+    {376, 168}, {381, 68}, {440, 202}, {527, 297}, {664, 65535}, {667, 205},
+    {787, 204}, {915, 200}, {1012, 197}, {1088, 196}, {1223, 198}, {1317, 199},
+    {0, 199}, {6, 65535}, {343, 203}, {386, 68}, {424, 202}, {528, 297},
+    {663, 205}, {787, 204}, {915, 200}, {1012, 197}, {1088, 196}, {1222, 198},
+    {1319, 199}, {0, 199}, {5, 65535}, {342, 203}, {392, 202}, {530, 297},
+    {661, 205}, {788, 204}, {916, 200}, {1012, 197}, {1088, 196}, {1222, 198},
+    {1322, 199}, {0, 199}, {5, 65535}, {340, 203}, {394, 202}, {532, 297},
+    {659, 205}, {788, 204}, {916, 200}, {1012, 197}, {1089, 196}, {1222, 198},
+    {1325, 199}, {0, 199}, {4, 65535}, {338, 203}, {396, 202}, {533, 297},
+    {657, 205}, {788, 204}, {916, 200}, {1011, 197}, {1089, 196}, {1222, 198},
+    {1328, 199}, {0, 199}, {3, 65535}, {336, 203}, {398, 202}, {535, 297},
+    {655, 205}, {789, 204}, {916, 200}, {1011, 197}, {1089, 196}, {1222, 198},
+    {1331, 199}, {0, 199}, {2, 65535}, {335, 203}, {400, 202}, {537, 297},
+    {653, 205}, {789, 204}, {917, 200}, {1011, 197}, {1089, 196}, {1222, 198},
+    {1334, 199}, {0, 199}, {2, 65535}, {333, 203}, {403, 202}, {539, 297},
+    {651, 205}, {789, 204}, {917, 200}, {1010, 197}, {1090, 196}, {1222, 198},
+    {1337, 199}, {0, 199}, {1, 65535}, {331, 203}, {405, 202}, {541, 297},
+    {649, 205}, {790, 204}, {917, 200}, {1010, 197}, {1090, 196}, {1222, 198},
+    {1340, 199}, {0, 65535}, {330, 203}, {407, 202}, {542, 297}, {647, 205},
+    {790, 204}, {917, 200}, {1010, 197}, {1090, 196}, {1222, 198}, {1343, 199},
+    {1439, 65535}, {0, 65535}, {328, 203}, {410, 202}, {544, 297}, {645, 205},
+    {790, 204}, {918, 200}, {1010, 197}, {1091, 196}, {1222, 198}, {1347, 199},
+    {1438, 65535}, {0, 65535}, {327, 203}, {412, 202}, {546, 297}, {642, 205},
+    {791, 204}, {918, 200}, {1009, 197}, {1091, 196}, {1222, 198}, {1350, 199},
+    {1437, 65535}, {0, 65535}, {325, 203}, {415, 202}, {548, 297}, {640, 205},
+    {791, 204}, {918, 200}, {1009, 197}, {1091, 196}, {1222, 198}, {1354, 199},
+    {1436, 65535}, {0, 65535}, {324, 203}, {418, 202}, {550, 297}, {638, 205},
+    {792, 204}, {918, 200}, {1009, 197}, {1092, 196}, {1222, 198}, {1358, 199},
+    {1435, 65535}, {0, 65535}, {323, 203}, {421, 202}, {553, 297}, {635, 205},
+    {792, 204}, {919, 200}, {1008, 197}, {1092, 196}, {1222, 198}, {1362, 199},
+    {1433, 65535}, {0, 65535}, {321, 203}, {424, 202}, {555, 297}, {633, 205},
+    {792, 204}, {919, 200}, {1008, 197}, {1093, 196}, {1222, 198}, {1367, 199},
+    {1432, 65535}, {0, 65535}, {320, 203}, {426, 202}, {557, 297}, {630, 205},
+    {793, 204}, {919, 200}, {1008, 197}, {1093, 196}, {1222, 198}, {1371, 199},
+    {1430, 65535}, {0, 65535}, {319, 203}, {430, 202}, {559, 297}, {628, 205},
+    {793, 204}, {920, 200}, {1007, 197}, {1093, 196}, {1221, 198}, {1376, 199},
+    {1428, 65535}, {0, 65535}, {318, 203}, {433, 202}, {562, 297}, {625, 205},
+    {794, 204}, {920, 200}, {1007, 197}, {1094, 196}, {1221, 198}, {1381, 199},
+    {1426, 65535}, {0, 65535}, {316, 203}, {436, 202}, {564, 297}, {622, 205},
+    {794, 204}, {920, 200}, {1007, 197}, {1094, 196}, {1221, 198}, {1387, 199},
+    {1421, 201}, {1433, 65535}, {0, 201}, {3, 65535}, {315, 203}, {440, 202},
+    {567, 297}, {619, 205}, {794, 204}, {921, 200}, {1006, 197}, {1094, 196},
+    {1221, 198}, {1393, 199}, {1414, 201}, {0, 201}, {12, 65535}, {314, 203},
+    {443, 202}, {569, 297}, {616, 205}, {795, 204}, {921, 200}, {1006, 197},
+    {1095, 196}, {1221, 198}, {1399, 199}, {1406, 201}, {0, 201}, {20, 65535},
+    {313, 203}, {447, 202}, {572, 297}, {613, 205}, {795, 204}, {921, 200},
+    {1006, 197}, {1095, 196}, {1221, 198}, {1401, 201}, {0, 201}, {27, 65535},
+    {312, 203}, {451, 202}, {574, 297}, {610, 205}, {796, 204}, {922, 200},
+    {1005, 197}, {1096, 196}, {1221, 198}, {1399, 201}, {0, 201}, {33, 65535},
+    {311, 203}, {455, 202}, {577, 297}, {606, 205}, {796, 204}, {922, 200},
+    {1005, 197}, {1096, 196}, {1221, 198}, {1397, 201}, {0, 201}, {39, 65535},
+    {310, 203}, {459, 202}, {580, 297}, {603, 205}, {797, 204}, {922, 200},
+    {1004, 197}, {1097, 196}, {1221, 198}, {1395, 201}, {0, 201}, {45, 65535},
+    {309, 203}, {464, 202}, {583, 297}, {599, 205}, {797, 204}, {923, 200},
+    {1004, 197}, {1097, 196}, {1221, 198}, {1393, 201}, {0, 201}, {50, 65535},
+    {308, 203}, {468, 202}, {586, 297}, {596, 205}, {798, 204}, {923, 200},
+    {1004, 197}, {1097, 196}, {1221, 198}, {1391, 201}, {0, 201}, {55, 65535},
+    {307, 203}, {473, 202}, {589, 297}, {592, 205}, {798, 204}, {924, 200},
+    {1003, 197}, {1098, 196}, {1221, 198}, {1389, 201}, {0, 201}, {60, 65535},
+    {307, 203}, {479, 202}, {590, 205}, {799, 204}, {924, 200}, {1003, 197},
+    {1098, 196}, {1221, 198}, {1387, 201}, {0, 201}, {65, 65535}, {306, 203},
+    {484, 202}, {589, 205}, {799, 204}, {924, 200}, {1002, 197}, {1099, 196},
+    {1220, 198}, {1385, 201}, {0, 201}, {70, 65535}, {305, 203}, {491, 202},
+    {588, 205}, {800, 204}, {925, 200}, {1002, 197}, {1099, 196}, {1220, 198},
+    {1382, 201}, {0, 201}, {74, 65535}, {304, 203}, {497, 202}, {587, 205},
+    {801, 204}, {925, 200}, {1001, 197}, {1100, 196}, {1220, 198}, {1380, 201},
+    {0, 201}, {79, 65535}, {304, 203}, {505, 202}, {586, 205}, {801, 204},
+    {926, 200}, {1001, 197}, {1100, 196}, {1220, 198}, {1378, 201}, {0, 201},
+    {83, 65535}, {303, 203}, {513, 202}, {585, 205}, {802, 204}, {926, 200},
+    {1000, 197}, {1101, 196}, {1220, 198}, {1375, 201}, {0, 201}, {87, 65535},
+    {303, 203}, {523, 202}, {585, 205}, {802, 204}, {927, 200}, {1000, 197},
+    {1102, 196}, {1220, 198}, {1372, 201}, {0, 201}, {91, 65535}, {302, 203},
+    {534, 202}, {584, 205}, {803, 204}, {927, 200}, {999, 197}, {1102, 196},
+    {1220, 198}, {1370, 201}, {0, 201}, {95, 65535}, {302, 203}, {549, 202},
+    {583, 205}, {804, 204}, {928, 200}, {999, 197}, {1103, 196}, {1220, 198},
+    {1367, 201}, {0, 201}, {99, 65535}, {301, 203}, {575, 202}, {582, 205},
+    {804, 204}, {928, 200}, {998, 197}, {1103, 196}, {1220, 198}, {1364, 201},
+    {0, 201}, {103, 65535}, {301, 203}, {581, 205}, {805, 204}, {929, 200},
+    {998, 197}, {1104, 196}, {1220, 198}, {1361, 201}, {0, 201}, {107, 65535},
+    {301, 203}, {581, 205}, {806, 204}, {929, 200}, {997, 197}, {1104, 196},
+    {1219, 198}, {1358, 201}, {0, 201}, {111, 65535}, {300, 203}, {580, 205},
+    {807, 204}, {930, 200}, {997, 197}, {1105, 196}, {1219, 198}, {1355, 201},
+    {0, 201}, {114, 65535}, {300, 203}, {579, 205}, {807, 204}, {930, 200},
+    {996, 197}, {1106, 196}, {1219, 198}, {1351, 201}, {0, 201}, {118, 65535},
+    {300, 203}, {579, 205}, {808, 204}, {931, 200}, {995, 197}, {1106, 196},
+    {1219, 198}, {1348, 201}, {0, 201}, {121, 65535}, {300, 203}, {578, 205},
+    {809, 204}, {931, 200}, {995, 197}, {1107, 196}, {1219, 198}, {1344, 201},
+    {0, 201}, {125, 65535}, {300, 203}, {577, 205}, {810, 204}, {932, 200},
+    {994, 197}, {1108, 196}, {1219, 198}, {1340, 201}, {0, 201}, {128, 65535},
+    {300, 203}, {577, 205}, {811, 204}, {933, 200}, {994, 197}, {1108, 196},
+    {1219, 198}, {1336, 201}, {0, 201}, {132, 65535}, {300, 203}, {576, 205},
+    {811, 204}, {933, 200}, {993, 197}, {1106, 206}, {1119, 196}, {1219, 198},
+    {1332, 201}, {0, 201}, {135, 65535}, {300, 203}, {575, 205}, {812, 204},
+    {934, 200}, {992, 197}, {1102, 206}, {1135, 196}, {1218, 198}, {1327, 201},
+    {0, 201}, {138, 65535}, {300, 203}, {575, 205}, {813, 204}, {934, 200},
+    {992, 197}, {1099, 206}, {1162, 196}, {1192, 206}, {1222, 198}, {1323, 201},
+    {0, 201}, {142, 65535}, {301, 203}, {574, 205}, {814, 204}, {935, 200},
+    {991, 197}, {1095, 206}, {1226, 198}, {1318, 201}, {0, 201}, {145, 65535},
+    {301, 203}, {573, 205}, {815, 204}, {936, 200}, {990, 197}, {1092, 206},
+    {1230, 198}, {1313, 201}, {0, 201}, {148, 65535}, {301, 203}, {572, 205},
+    {816, 204}, {936, 200}, {989, 197}, {1088, 206}, {1235, 198}, {1307, 201},
+    {0, 201}, {151, 65535}, {302, 203}, {571, 205}, {817, 204}, {937, 200},
+    {989, 197}, {1083, 206}, {1240, 198}, {1301, 201}, {0, 201}, {154, 65535},
+    {302, 203}, {571, 205}, {818, 204}, {938, 200}, {988, 197}, {1079, 206},
+    {1245, 198}, {1294, 201}, {0, 201}, {157, 65535}, {303, 203}, {570, 205},
+    {819, 204}, {939, 200}, {987, 197}, {1074, 206}, {1250, 198}, {1287, 201},
+    {0, 201}, {161, 65535}, {304, 203}, {569, 205}, {820, 204}, {939, 200},
+    {986, 197}, {1070, 206}, {1256, 198}, {1280, 201}, {0, 201}, {164, 65535},
+    {305, 203}, {568, 205}, {821, 204}, {940, 200}, {985, 197}, {1064, 206},
+    {1262, 198}, {1271, 201}, {0, 201}, {167, 65535}, {306, 203}, {567, 205},
+    {822, 204}, {941, 200}, {985, 197}, {1059, 206}, {1266, 201}, {0, 201},
+    {170, 65535}, {307, 203}, {566, 205}, {824, 204}, {942, 200}, {984, 197},
+    {1053, 206}, {1266, 201}, {0, 201}, {172, 65535}, {308, 203}, {565, 205},
+    {825, 204}, {943, 200}, {983, 197}, {1047, 206}, {1266, 201}, {0, 201},
+    {175, 65535}, {309, 203}, {564, 205}, {826, 204}, {944, 200}, {982, 197},
+    {1040, 206}, {1266, 201}, {0, 201}, {178, 65535}, {310, 203}, {563, 205},
+    {827, 204}, {944, 200}, {981, 197}, {1032, 206}, {1266, 201}, {0, 201},
+    {181, 65535}, {312, 203}, {562, 205}, {829, 204}, {945, 200}, {980, 197},
+    {1024, 206}, {1267, 201}, {0, 201}, {184, 65535}, {314, 203}, {561, 205},
+    {830, 204}, {946, 200}, {979, 197}, {1015, 206}, {1267, 201}, {0, 201},
+    {187, 65535}, {315, 203}, {560, 205}, {831, 204}, {947, 200}, {978, 197},
+    {1005, 206}, {1267, 201}, {0, 201}, {190, 65535}, {317, 203}, {559, 205},
+    {833, 204}, {948, 200}, {977, 197}, {993, 206}, {1267, 201}, {0, 201},
+    {192, 65535}, {320, 203}, {558, 205}, {834, 204}, {949, 200}, {976, 197},
+    {978, 206}, {1267, 201}, {0, 201}, {195, 65535}, {322, 203}, {556, 205},
+    {836, 204}, {950, 200}, {969, 206}, {1268, 201}, {0, 201}, {198, 65535},
+    {324, 203}, {555, 205}, {837, 204}, {951, 200}, {962, 206}, {1268, 201},
+    {0, 201}, {200, 65535}, {327, 203}, {554, 205}, {839, 204}, {952, 200},
+    {953, 206}, {1268, 201}, {0, 201}, {203, 65535}, {330, 203}, {553, 205},
+    {841, 204}, {949, 206}, {1268, 201}, {0, 201}, {205, 65535}, {334, 203},
+    {551, 205}, {842, 204}, {946, 206}, {1268, 201}, {0, 201}, {208, 65535},
+    {337, 203}, {550, 205}, {844, 204}, {942, 206}, {1269, 201}, {0, 201},
+    {210, 65535}, {341, 203}, {548, 205}, {846, 204}, {937, 206}, {1269, 201},
+    {0, 201}, {213, 65535}, {346, 203}, {547, 205}, {848, 204}, {933, 206},
+    {1269, 201}, {0, 201}, {215, 65535}, {350, 203}, {545, 65535}, {546, 205},
+    {850, 204}, {929, 206}, {1269, 201}, {0, 201}, {218, 65535}, {356, 203},
+    {539, 65535}, {547, 205}, {852, 204}, {924, 206}, {1270, 201}, {0, 201},
+    {220, 65535}, {362, 203}, {533, 65535}, {548, 205}, {854, 204}, {919, 206},
+    {1270, 201}, {0, 201}, {222, 65535}, {369, 203}, {526, 65535}, {550, 205},
+    {856, 204}, {914, 206}, {1270, 201}, {0, 201}, {225, 65535}, {377, 203},
+    {518, 65535}, {551, 205}, {858, 204}, {908, 206}, {1271, 201}, {0, 201},
+    {227, 65535}, {386, 203}, {509, 65535}, {553, 205}, {861, 204}, {902, 206},
+    {1271, 201}, {0, 201}, {229, 65535}, {398, 203}, {497, 65535}, {555, 205},
+    {863, 204}, {896, 206}, {1271, 201}, {0, 201}, {231, 65535}, {415, 203},
+    {480, 65535}, {557, 205}, {866, 204}, {889, 206}, {1272, 201}, {0, 201},
+    {233, 65535}, {559, 205}, {868, 204}, {882, 206}, {1272, 201}, {0, 201},
+    {235, 65535}, {561, 205}, {871, 204}, {874, 206}, {1273, 201}, {0, 201},
+    {237, 65535}, {564, 205}, {870, 206}, {1273, 201}, {0, 201}, {239, 65535},
+    {567, 205}, {867, 206}, {1273, 201}, {0, 201}, {240, 65535}, {571, 205},
+    {864, 206}, {1274, 201}, {0, 201}, {242, 65535}, {574, 205}, {860, 206},
+    {1274, 201}, {0, 201}, {244, 65535}, {578, 205}, {857, 206}, {1275, 201},
+    {0, 201}, {245, 65535}, {583, 205}, {854, 206}, {1275, 201}, {0, 201},
+    {246, 65535}, {588, 205}, {850, 206}, {1276, 201}, {0, 201}, {248, 65535},
+    {594, 205}, {846, 206}, {1277, 201}, {0, 201}, {249, 65535}, {600, 205},
+    {842, 206}, {1277, 201}, {0, 201}, {250, 65535}, {607, 205}, {838, 206},
+    {1278, 201}, {0, 201}, {251, 65535}, {615, 205}, {833, 206}, {1278, 201},
+    {0, 201}, {252, 65535}, {625, 205}, {829, 206}, {1279, 201}, {0, 201},
+    {252, 65535}, {636, 205}, {824, 206}, {1280, 201}, {0, 201}, {253, 65535},
+    {649, 205}, {811, 65535}, {822, 206}, {1281, 201}, {0, 201}, {253, 65535},
+    {666, 205}, {794, 65535}, {821, 206}, {1282, 201}, {0, 201}, {253, 65535},
+    {693, 205}, {768, 65535}, {820, 206}, {1282, 201}, {0, 201}, {253, 65535},
+    {820, 206}, {1283, 201}, {0, 201}, {252, 65535}, {819, 206}, {1284, 201},
+    {0, 201}, {251, 65535}, {819, 206}, {1285, 201}, {0, 201}, {250, 65535},
+    {819, 206}, {1286, 201}, {0, 201}, {249, 65535}, {819, 206}, {1288, 201},
+    {0, 201}, {247, 65535}, {820, 206}, {1289, 201}, {0, 201}, {245, 65535},
+    {821, 206}, {1290, 201}, {0, 201}, {243, 65535}, {822, 206}, {1291, 201},
+    {0, 201}, {240, 65535}, {824, 206}, {1293, 201}, {0, 201}, {236, 65535},
+    {826, 206}, {1294, 201}, {0, 201}, {232, 65535}, {829, 206}, {1296, 201},
+    {0, 201}, {227, 65535}, {832, 206}, {1298, 201}, {0, 201}, {221, 65535},
+    {836, 206}, {1300, 201}, {0, 201}, {214, 65535}, {841, 206}, {1302, 201},
+    {0, 201}, {206, 65535}, {846, 206}, {1304, 201}, {0, 201}, {197, 65535},
+    {853, 206}, {1306, 201}, {0, 201}, {186, 65535}, {861, 206}, {1308, 201},
+    {0, 201}, {174, 65535}, {870, 206}, {1311, 201},
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "tz_lookup.h"
+
+#include <stddef.h>
+
+#include "track_codec.h"
+#include "tz_data.h"
+
+#ifndef ALPHALOC_TZ_LOOKUP
+#define ALPHALOC_TZ_LOOKUP 1
+#endif
+
+#if ALPHALOC_TZ_LOOKUP
+
+int tz_lookup_zone(double lat_deg, double lon_deg) {
+  // Written so NaN fails too.
+  if (!(lat_deg >= -90.0 && lat_deg <= 90.0 && lon_deg >= -180.0 &&
+        lon_deg <= 180.0)) {
+    return -1;
+  }
+  int row = (int)((90.0 - lat_deg) * tz_grid.cells_per_deg);
+  if (row >= tz_grid.rows) {
+    row = tz_grid.rows - 1;  // the south pole
+  }
+  int col = (int)((lon_deg + 180.0) * tz_grid.cells_per_deg);
+  if (col >= tz_grid.cols) {
+    col = 0;  // 180E is 180W
+  }
+
+  // Last run of the row starting at or before col. Every row has a run at
+  // column 0.
+  uint32_t lo = tz_row_start[row];
+  uint32_t hi = tz_row_start[row + 1];
+  while (hi - lo > 1) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    if (tz_runs[mid].col <= col) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  const uint16_t zone = tz_runs[lo].zone;
+  return zone == TZ_ZONE_NONE ? -1 : zone;
+}
+
+// UTC of the week-th (5 = last) wday of a month at minutes local time,
+// with local = UTC + offset_min. Minutes may be negative or past midnight.
+static int64_t transition_utc(int year, int month, int week, int wday,
+                              int minutes, int offset_min) {
+  static const uint8_t kDays[12] = {31, 28, 31, 30, 31, 30,
+                                    31, 31, 30, 31, 30, 31};
+  const uint32_t first = track_unix_time(year, month, 1, 0, 0, 0);
+  // 1970-01-01 was a Thursday.
+  const int first_wday = (int)((first / 86400 + 4) % 7);
+  int day = 1 + (wday - first_wday + 7) % 7 + (week - 1) * 7;
+  int month_days = kDays[month - 1];
+  if (month == 2 && year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) {
+    month_days = 29;
+  }
+  while (day > month_days) {
+    day -= 7;
+  }
+  return (int64_t)first + (int64_t)(day - 1) * 86400 +
+         (int64_t)(minutes - offset_min) * 60;
+}
+
+void tz_zone_offsets(int zone, uint32_t utc, int16_t *tz_min,
+                     int16_t *dst_min) {
+  *tz_min = 0;
+  *dst_min = 0;
+  if (zone < 0 || zone >= tz_grid.zone_count) {
+    return;
+  }
+  const tz_rule_t *r = &tz_rules[tz_zones[zone].rule];
+  *tz_min = r->std_min;
+  if (r->dst_min == 0) {
+    return;
+  }
+  int year, month, day, hour, minute, second;
+  track_unix_to_civil(utc + (uint32_t)((int32_t)r->std_min * 60), &year,
+                      &month, &day, &hour, &minute, &second);
+  const int64_t start = transition_utc(year, r->start_month, r->start_week,
+                                       r->start_wday, r->start_min,
+                                       r->std_min);
+  const int64_t end =
+      transition_utc(year, r->end_month, r->end_week, r->end_wday,
+                     r->end_min, r->std_min + r->dst_min);
+  const int64_t t = utc;
+  // Southern hemisphere rules end DST before they start it in a year.
+  const bool in_dst =
+      start < end ? (t >= start && t < end) : (t >= start || t < end);
+  if (in_dst) {
+    *dst_min = r->dst_min;
+  }
+}
+
+bool tz_lookup(double lat_deg, double lon_deg, uint32_t utc, tz_info_t *out) {
+  out->zone = tz_lookup_zone(lat_deg, lon_deg);
+  tz_zone_offsets(out->zone, utc, &out->tz_min, &out->dst_min);
+  return out->zone >= 0;
+}
+
+const char *tz_zone_name(int zone) {
+  if (zone < 0 || zone >= tz_grid.zone_count) {
+    return NULL;
+  }
+  return tz_zones[zone].name;
+}
+
+#else
+
+int tz_lookup_zone(double lat_deg, double lon_deg) {
+  (void)lat_deg;
+  (void)lon_deg;
+  return -1;
+}
+
+void tz_zone_offsets(int zone, uint32_t utc, int16_t *tz_min,
+                     int16_t *dst_min) {
+  (void)zone;
+  (void)utc;
+  *tz_min = 0;
+  *dst_min = 0;
+}
+
+bool tz_lookup(double lat_deg, double lon_deg, uint32_t utc, tz_info_t *out) {
+  (void)lat_deg;
+  (void)lon_deg;
+  (void)utc;
+  out->zone = -1;
+  out->tz_min = 0;
+  out->dst_min = 0;
+  return false;
+}
+
+const char *tz_zone_name(int zone) {
+  (void)zone;
+  return NULL;
+}
+
+#endif
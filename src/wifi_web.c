@@ -5,17 +5,54 @@
 #include <string.h>
 
 #include "ble_client.h"
+#include "boot_profile.h"
+#include "coex_policy.h"
+#include "config_schema.h"
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "esp_log.h"
 #include "esp_netif.h"
+#include "esp_rom_crc.h"
+#include "esp_system.h"
 #include "esp_wifi.h"
 #include "esp_timer.h"
+#include "fix_latency.h"
+#include "flash_sched.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "gps.h"
+#include "gps_aid.h"
+#include "gps_synth.h"
+#include "nmea_capture.h"
+#include "nvs.h"
+#include "ota_update.h"
+#include "task_plan.h"
+#include "trace_log.h"
+#include "track_log.h"
 
 #ifndef ALPHALOC_BATTERY_MONITOR
 #define ALPHALOC_BATTERY_MONITOR 0
 #endif
+#ifndef ALPHALOC_STATIC_ALLOC
+#define ALPHALOC_STATIC_ALLOC 0
+#endif
+#define SSE_MAX_CLIENTS ALPHALOC_WEB_MAX_VIEWERS
+#define SSE_KEEPALIVE_US (15 * 1000000LL)
+#define STATUS_JSON_MAX 192
+// Fix latency percentiles, only in /api/status.
+#define LAT_JSON_MAX 448
+// Firmware upload buffer: one flash sector.
+#define OTA_CHUNK 4096
+// Longest a chunk waits for the camera link before it is written anyway.
+#define OTA_LINK_WAIT_MS 1000
+#define OTA_RECV_RETRIES 3
+#define OTA_RESTART_DELAY_US (1000 * 1000)
+// Longest line an export row can produce.
+#define TRACK_ROW_MAX 160
+// A pause in the track longer than this starts a new GPX segment.
+#define TRACK_SEGMENT_GAP_S 300
+// A page counts as in use for this long after its last request.
+#define WEB_ACTIVE_US (10 * 1000000LL)
 
 #if ALPHALOC_BATTERY_MONITOR
 #include "battery.h"
@@ -23,6 +60,12 @@
 
 static const char *TAG = "wifi_web";
 
+// web/index.html.gz, embedded by the build (EMBED_FILES).
+extern const uint8_t index_html_gz_start[] asm("_binary_index_html_gz_start");
+extern const uint8_t index_html_gz_end[] asm("_binary_index_html_gz_end");
+static char s_index_etag[12];
+static char s_index_path[16];  // "/ui/<crc>"
+
 static httpd_handle_t s_server;
 static app_config_t *s_cfg;
 static esp_netif_t *s_netif = NULL;
@@ -42,17 +85,148 @@ static const char *constellation_to_str(gps_constellation_t mask) {
 }
 static bool s_started;
 static bool s_wifi_handlers_registered = false;
-static int64_t s_sta_start_us = 0;
-static bool s_ap_active = false;
+static int64_t s_start_us = 0;
+static volatile int64_t s_last_activity_us = 0;
+static httpd_req_t *s_sse[SSE_MAX_CLIENTS];
+static volatile int s_sse_count = 0;
+static volatile bool s_sse_push_queued = false;
+static SemaphoreHandle_t s_sse_mutex = NULL;
+#if ALPHALOC_STATIC_ALLOC
+static StaticSemaphore_t s_sse_mutex_buf;
+#endif
+
+static void note_activity(void) { s_last_activity_us = esp_timer_get_time(); }
+
+// Someone is using the UI right now: a recent request, an open status stream
+// or an upload. Drives the WiFi side of the coexistence policy.
+static bool web_active(void) {
+  return s_sse_count > 0 || ota_update_in_progress() ||
+         esp_timer_get_time() - s_last_activity_us < WEB_ACTIVE_US;
+}
 
 #ifndef ALPHALOC_WIFI_STA_FALLBACK_TIMEOUT_MS
 #define ALPHALOC_WIFI_STA_FALLBACK_TIMEOUT_MS 15000
 #endif
 
-static void start_softap(void) {
-  if (!s_netif_ap) {
-    s_netif_ap = esp_netif_create_default_wifi_ap();
+// Last access point the STA joined, so the next window can connect to it
+// directly instead of scanning every channel.
+#define STA_CACHE_NAMESPACE "wifi"
+#define STA_CACHE_KEY "sta"
+
+typedef struct {
+  uint32_t ssid_crc;
+  uint8_t bssid[6];
+  uint8_t channel;
+} sta_cache_t;
+
+static sta_cache_t s_sta_cache;
+static bool s_sta_cache_valid = false;
+static bool s_sta_using_cache = false;
+static bool s_sta_static_ip = false;
+static bool s_sta_active = false;
+
+static uint32_t ssid_crc(const char *ssid) {
+  return esp_rom_crc32_le(0, (const uint8_t *)ssid, strlen(ssid));
+}
+
+static void sta_cache_load(void) {
+  s_sta_cache_valid = false;
+  nvs_handle_t nvs;
+  if (nvs_open(STA_CACHE_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+    return;
+  }
+  size_t len = sizeof(s_sta_cache);
+  if (nvs_get_blob(nvs, STA_CACHE_KEY, &s_sta_cache, &len) == ESP_OK &&
+      len == sizeof(s_sta_cache) &&
+      s_sta_cache.ssid_crc == ssid_crc(s_cfg->wifi_ssid) &&
+      s_sta_cache.channel != 0) {
+    s_sta_cache_valid = true;
+  }
+  nvs_close(nvs);
+}
+
+static uint32_t sta_cache_save_job(void *ctx) {
+  (void)ctx;
+  const int64_t start_us = esp_timer_get_time();
+  nvs_handle_t nvs;
+  if (nvs_open(STA_CACHE_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+    return 0;
+  }
+  esp_err_t err = nvs_set_blob(nvs, STA_CACHE_KEY, &s_sta_cache,
+                               sizeof(s_sta_cache));
+  if (err == ESP_OK) {
+    err = nvs_commit(nvs);
+  }
+  nvs_close(nvs);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "AP cache save failed: %s", esp_err_to_name(err));
+  }
+  return (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+// Remembers the AP just joined; only written when it changed.
+static void sta_cache_update(void) {
+  wifi_ap_record_t ap;
+  if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+    return;
+  }
+  const uint32_t crc = ssid_crc(s_cfg->wifi_ssid);
+  if (s_sta_cache_valid && s_sta_cache.ssid_crc == crc &&
+      s_sta_cache.channel == ap.primary &&
+      memcmp(s_sta_cache.bssid, ap.bssid, sizeof(ap.bssid)) == 0) {
+    return;
+  }
+  s_sta_cache.ssid_crc = crc;
+  memcpy(s_sta_cache.bssid, ap.bssid, sizeof(ap.bssid));
+  s_sta_cache.channel = ap.primary;
+  s_sta_cache_valid = true;
+  flash_sched_submit(FLASH_JOB_WIFI, sta_cache_save_job, NULL, 0);
+}
+
+static void sta_apply_config(bool use_cache) {
+  wifi_config_t wifi_cfg = {0};
+  strncpy((char *)wifi_cfg.sta.ssid, s_cfg->wifi_ssid,
+          sizeof(wifi_cfg.sta.ssid) - 1);
+  strncpy((char *)wifi_cfg.sta.password, s_cfg->wifi_pass,
+          sizeof(wifi_cfg.sta.password) - 1);
+  s_sta_using_cache = use_cache && s_sta_cache_valid;
+  if (s_sta_using_cache) {
+    wifi_cfg.sta.bssid_set = true;
+    memcpy(wifi_cfg.sta.bssid, s_sta_cache.bssid, sizeof(s_sta_cache.bssid));
+    wifi_cfg.sta.channel = s_sta_cache.channel;
+  }
+  esp_wifi_set_config(WIFI_IF_STA, &wifi_cfg);
+}
+
+// A configured static address skips DHCP; anything unparsable falls back
+// to DHCP so a typo does not lock the user out.
+static void sta_apply_ip(void) {
+  s_sta_static_ip = false;
+  if (s_cfg->wifi_ip[0] == '\0') {
+    return;
+  }
+  esp_netif_ip_info_t info = {0};
+  info.ip.addr = esp_ip4addr_aton(s_cfg->wifi_ip);
+  info.gw.addr = esp_ip4addr_aton(s_cfg->wifi_gw);
+  info.netmask.addr = esp_ip4addr_aton(s_cfg->wifi_mask);
+  if (info.ip.addr == 0 || info.ip.addr == UINT32_MAX ||
+      info.netmask.addr == 0 || info.netmask.addr == UINT32_MAX) {
+    ESP_LOGW(TAG, "Invalid static IP settings, using DHCP");
+    return;
   }
+  if (info.gw.addr == UINT32_MAX) {
+    info.gw.addr = 0;
+  }
+  esp_netif_dhcpc_stop(s_netif_sta);
+  if (esp_netif_set_ip_info(s_netif_sta, &info) != ESP_OK) {
+    ESP_LOGW(TAG, "Static IP rejected, using DHCP");
+    esp_netif_dhcpc_start(s_netif_sta);
+    return;
+  }
+  s_sta_static_ip = true;
+}
+
+static void ap_apply_config(void) {
   wifi_config_t wifi_cfg = {0};
   strncpy((char *)wifi_cfg.ap.ssid, s_cfg->ap_ssid,
           sizeof(wifi_cfg.ap.ssid) - 1);
@@ -63,11 +237,38 @@ static void start_softap(void) {
                              ? WIFI_AUTH_OPEN
                              : WIFI_AUTH_WPA2_PSK;
   wifi_cfg.ap.max_connection = 4;
+  // In APSTA mode the AP follows the STA channel; starting on the cached one
+  // avoids a channel switch that would drop AP clients when the STA joins.
+  wifi_cfg.ap.channel = s_sta_cache_valid ? s_sta_cache.channel : 1;
+  esp_wifi_set_config(WIFI_IF_AP, &wifi_cfg);
+}
 
+// The STA never came up; stop its retries so scanning does not disturb the
+// AP, which has been reachable all along.
+static void stop_sta(void) {
+  s_sta_active = false;
   ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_AP));
-  ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_AP, &wifi_cfg));
-  s_ap_active = true;
-  ESP_LOGI(TAG, "Started AP fallback: ssid=%s", s_cfg->ap_ssid);
+  ESP_LOGI(TAG, "Continuing with AP only: ssid=%s", s_cfg->ap_ssid);
+}
+
+static int64_t since_start_ms(void) {
+  return (esp_timer_get_time() - s_start_us) / 1000;
+}
+
+static void ip_event_handler(void *arg, esp_event_base_t event_base,
+                             int32_t event_id, void *event_data) {
+  (void)arg;
+  if (event_base != IP_EVENT || event_id != IP_EVENT_STA_GOT_IP) {
+    return;
+  }
+  const ip_event_got_ip_t *got = (const ip_event_got_ip_t *)event_data;
+  ESP_LOGI(TAG,
+           "UI reachable on STA " IPSTR " after %lld ms (%s AP, %s)",
+           IP2STR(&got->ip_info.ip), (long long)since_start_ms(),
+           s_sta_using_cache ? "cached" : "scanned",
+           s_sta_static_ip ? "static IP" : "DHCP");
+  boot_profile_mark(BOOT_MARK_UI_REACHABLE);
+  sta_cache_update();
 }
 
 static void wifi_event_handler(void *arg, esp_event_base_t event_base,
@@ -76,48 +277,56 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base,
     return;
   }
 
+  if (event_id == WIFI_EVENT_AP_START) {
+    ESP_LOGI(TAG, "UI reachable on AP %s after %lld ms", s_cfg->ap_ssid,
+             (long long)since_start_ms());
+    boot_profile_mark(BOOT_MARK_UI_REACHABLE);
+    return;
+  }
+
   if (event_id == WIFI_EVENT_STA_CONNECTED) {
-    ESP_LOGI(TAG, "WiFi STA connected");
+    ESP_LOGI(TAG, "WiFi STA connected after %lld ms",
+             (long long)since_start_ms());
+    return;
+  }
+
+  // Joining or leaving the AP is activity at that moment; staying
+  // associated is not.
+  if (event_id == WIFI_EVENT_AP_STACONNECTED ||
+      event_id == WIFI_EVENT_AP_STADISCONNECTED) {
+    note_activity();
     return;
   }
 
   if (event_id == WIFI_EVENT_STA_DISCONNECTED) {
+    if (!s_sta_active) {
+      return;
+    }
     const wifi_event_sta_disconnected_t *disc =
         (const wifi_event_sta_disconnected_t *)event_data;
     unsigned reason = disc ? (unsigned)disc->reason : 0;
-    int64_t elapsed_ms = 0;
-    if (s_sta_start_us > 0) {
-      elapsed_ms = (esp_timer_get_time() - s_sta_start_us) / 1000;
-    }
 
     ESP_LOGW(TAG, "WiFi disconnected, reason=%u", reason);
 
-    if (elapsed_ms >= ALPHALOC_WIFI_STA_FALLBACK_TIMEOUT_MS && !s_ap_active) {
-      ESP_LOGW(TAG, "STA connect timed out, falling back to AP");
-      start_softap();
+    if (since_start_ms() >= ALPHALOC_WIFI_STA_FALLBACK_TIMEOUT_MS) {
+      ESP_LOGW(TAG, "STA connect timed out");
+      stop_sta();
       return;
     }
-
+    if (s_sta_using_cache) {
+      // The AP moved or is gone; scan for the SSID from now on.
+      ESP_LOGI(TAG, "Cached AP failed, scanning");
+      sta_apply_config(false);
+    }
     esp_wifi_connect();
   }
 }
 
-static bool parse_u16(const char *value, uint16_t *out) {
-  if (!value || value[0] == '\0') {
-    return false;
-  }
-  char *end = NULL;
-  unsigned long v = strtoul(value, &end, 10);
-  if (end == value || *end != '\0' || v > 1440) {
-    return false;
-  }
-  *out = (uint16_t)v;
-  return true;
-}
-
-static void url_decode(char *dst, const char *src, size_t dst_len) {
+// Decodes src into dst; false when the decoded value does not fit.
+static bool url_decode(char *dst, const char *src, size_t dst_len) {
   size_t di = 0;
-  for (size_t si = 0; src[si] != '\0' && di + 1 < dst_len; ++si) {
+  size_t si = 0;
+  for (; src[si] != '\0' && di + 1 < dst_len; ++si) {
     if (src[si] == '+') {
       dst[di++] = ' ';
     } else if (src[si] == '%' && src[si + 1] && src[si + 2]) {
@@ -129,12 +338,22 @@ static void url_decode(char *dst, const char *src, size_t dst_len) {
     }
   }
   dst[di] = '\0';
+  return src[si] == '\0';
 }
 
-static void form_get(const char *body, const char *key, char *out,
-                     size_t out_len) {
+typedef enum {
+  FORM_ABSENT = 0,
+  FORM_PRESENT,
+  FORM_TOO_LONG,
+} form_value_t;
+
+// Looks up key in a form-encoded body. A value that would not fit in out is
+// reported instead of being cut short.
+static form_value_t form_get(const char *body, const char *key, char *out,
+                             size_t out_len) {
   const char *p = body;
   size_t key_len = strlen(key);
+  out[0] = '\0';
   while (p && *p) {
     const char *eq = strchr(p, '=');
     const char *amp = strchr(p, '&');
@@ -144,187 +363,821 @@ static void form_get(const char *body, const char *key, char *out,
     size_t klen = (size_t)(eq - p);
     if (klen == key_len && strncmp(p, key, key_len) == 0) {
       size_t vlen = amp ? (size_t)(amp - eq - 1) : strlen(eq + 1);
-      char tmp[CONFIG_STR_MAX_64];
+      // Every byte may be percent-encoded.
+      char tmp[3 * CONFIG_STR_MAX_64];
       if (vlen >= sizeof(tmp)) {
-        vlen = sizeof(tmp) - 1;
+        return FORM_TOO_LONG;
       }
       memcpy(tmp, eq + 1, vlen);
       tmp[vlen] = '\0';
-      url_decode(out, tmp, out_len);
-      return;
+      return url_decode(out, tmp, out_len) ? FORM_PRESENT : FORM_TOO_LONG;
     }
     if (!amp) {
       break;
     }
     p = amp + 1;
   }
-  out[0] = '\0';
+  return FORM_ABSENT;
 }
 
-static esp_err_t handle_root(httpd_req_t *req) {
-  char *page = malloc(4096);
-  if (!page) {
-    return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
-                               "No memory");
-  }
-  gps_status_t gps_status = {0};
-  const char *gps_const_str = "n/a";
-  if (gps_get_status(&gps_status)) {
-    gps_const_str = constellation_to_str(gps_status.constellations);
-  }
-  bool cam_connected = ble_client_is_connected();
-  bool cam_bonded = ble_client_is_bonded();
-  const char *cam_dot_class =
-      cam_connected ? (cam_bonded ? "dot-green" : "dot-blue") : "dot-red";
-  const char *cam_conn_str = cam_connected ? "connected" : "disconnected";
-  const char *cam_bond_str = cam_bonded ? "bonded" : "not bonded";
-  const char *gps_dot_class = gps_status.has_lock ? "dot-green" : "dot-red";
-  const char *gps_lock_str = gps_status.has_lock ? "lock" : "no lock";
-#if ALPHALOC_BATTERY_MONITOR
-  battery_status_t bat = {0};
-  bool bat_ok = battery_get_status(&bat) && bat.valid;
-  const char *bat_dot_class = "dot-gray";
-  char bat_text[64] = "Battery: n/a";
-  if (bat_ok) {
-    if (bat.percent > 50.0f) {
-      bat_dot_class = "dot-green";
-    } else if (bat.percent > 30.0f) {
-      bat_dot_class = "dot-yellow";
+static size_t json_escape(char *dst, const char *src, size_t dst_len) {
+  size_t di = 0;
+  for (size_t si = 0; src[si] != '\0'; ++si) {
+    char esc[7];
+    unsigned char c = (unsigned char)src[si];
+    size_t n = 1;
+    if (c == '"' || c == '\\') {
+      esc[0] = '\\';
+      esc[1] = (char)c;
+      n = 2;
+    } else if (c < 0x20) {
+      n = (size_t)snprintf(esc, sizeof(esc), "\\u%04x", c);
     } else {
-      bat_dot_class = "dot-red";
+      esc[0] = (char)c;
+    }
+    if (di + n + 1 > dst_len) {
+      break;
     }
-    snprintf(bat_text, sizeof(bat_text), "Battery: %.0f%% (%.2fV)",
-             (double)bat.percent, (double)bat.voltage_v);
+    memcpy(dst + di, esc, n);
+    di += n;
   }
-#endif
-  snprintf(
-      page, 4096,
-      "<!doctype html><html><head><meta charset=\"utf-8\">"
-      "<meta name=\"viewport\" content=\"width=device-width,initial-scale=1\">"
-      "<title>AlphaLoc Config</title>"
-      "<style>body{font-family:Arial,sans-serif;margin:24px;max-width:560px;}"
-      ".statusbar{display:flex;flex-wrap:wrap;gap:10px 14px;align-items:center;"
-      "margin:10px 0 16px;padding:8px 10px;border:1px solid #ddd;border-radius:8px;"
-      "background:#f6f8fb;font-size:14px;}"
-      ".statuslabel{font-weight:600;margin-right:2px;}"
-      ".statusitem{display:flex;align-items:center;gap:6px;white-space:nowrap;}"
-      ".dot{width:10px;height:10px;border-radius:50%%;display:inline-block;}"
-      ".dot-green{background:#2e9a44;}.dot-red{background:#d9534f;}.dot-blue{background:#2f6fdb;}"
-      ".dot-yellow{background:#f0b429;}.dot-gray{background:#9aa3af;}"
-      "label{display:block;margin:12px 0 "
-      "4px;}input,select{width:100%%;padding:8px;margin-bottom:8px;}button{"
-      "padding:10px 14px;}</style>"
-      "</head><body><h2>AlphaLoc Config</h2>"
-      "<div class=\"statusbar\">"
-      "<span class=\"statuslabel\">Status</span>"
-      "<div class=\"statusitem\"><span class=\"dot %s\"></span>"
-      "<span>GPS: %s, %u sats, %s</span></div>"
-      "<div class=\"statusitem\"><span class=\"dot %s\"></span>"
-      "<span>Camera: %s, %s</span></div>"
+  dst[di] = '\0';
+  return di;
+}
+
+// The UI is a static, gzip-compressed asset served under a URL keyed by the
+// CRC of the embedded bytes. "/" only redirects there, so a firmware update
+// that changes the page changes its URL, and the page itself can be cached
+// for good. Live data comes from the /api endpoints below.
+static esp_err_t redirect_to_index(httpd_req_t *req) {
+  httpd_resp_set_status(req, "302 Found");
+  httpd_resp_set_hdr(req, "Location", s_index_path);
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+  return httpd_resp_send(req, NULL, 0);
+}
+
+static esp_err_t handle_root(httpd_req_t *req) {
+  note_activity();
+  return redirect_to_index(req);
+}
+
+static esp_err_t handle_index(httpd_req_t *req) {
+  note_activity();
+  // A bookmark from older firmware points at a stale CRC.
+  const size_t path_len = strlen(s_index_path);
+  if (strncmp(req->uri, s_index_path, path_len) != 0 ||
+      (req->uri[path_len] != '\0' && req->uri[path_len] != '?')) {
+    return redirect_to_index(req);
+  }
+  char tag[sizeof(s_index_etag)];
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", tag, sizeof(tag)) ==
+          ESP_OK &&
+      strcmp(tag, s_index_etag) == 0) {
+    httpd_resp_set_status(req, "304 Not Modified");
+    httpd_resp_set_hdr(req, "ETag", s_index_etag);
+    return httpd_resp_send(req, NULL, 0);
+  }
+  httpd_resp_set_type(req, "text/html");
+  httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  httpd_resp_set_hdr(req, "Cache-Control",
+                     "public, max-age=31536000, immutable");
+  httpd_resp_set_hdr(req, "ETag", s_index_etag);
+  return httpd_resp_send(req, (const char *)index_html_gz_start,
+                         index_html_gz_end - index_html_gz_start);
+}
+
+// Live values shown in the status bar. Battery figures are rounded so ADC
+// noise does not count as a change.
+typedef struct {
+  bool gps_ok;
+  gps_status_t gps;
+  bool cam_conn;
+  bool cam_bond;
+  bool bat_ok;
+  int bat_pct;
+  int bat_cv;
+} web_status_t;
+
+static web_status_t s_sse_last;
+static int64_t s_sse_last_send_us;
+
+static void read_status(web_status_t *st) {
+  memset(st, 0, sizeof(*st));
+  st->gps_ok = gps_get_status(&st->gps);
+  st->cam_conn = ble_client_is_connected();
+  st->cam_bond = ble_client_is_bonded();
 #if ALPHALOC_BATTERY_MONITOR
-      "<div class=\"statusitem\"><span class=\"dot %s\"></span>"
-      "<span>%s</span></div>"
+  battery_status_t bat = {0};
+  if (battery_get_status(&bat) && bat.valid) {
+    st->bat_ok = true;
+    st->bat_pct = (int)(bat.percent + 0.5f);
+    st->bat_cv = (int)(bat.voltage_v * 100.0f + 0.5f);
+  }
 #endif
-      "</div>"
-      "<form method=\"POST\" action=\"/save\">"
-      "<label>Camera name prefix</label><input name=\"cam_name\" value=\"%s\">"
-      "<label>Camera MAC prefix</label><input name=\"cam_mac\" value=\"%s\">"
-      "<label>TZ offset (minutes)</label><input name=\"tz\" value=\"%u\">"
-      "<label>DST offset (minutes)</label><input name=\"dst\" value=\"%u\">"
-      "<label>WiFi SSID (STA)</label><input name=\"wifi_ssid\" value=\"%s\">"
-      "<label>WiFi pass (STA)</label><input name=\"wifi_pass\" value=\"%s\">"
-      "<label>AP SSID</label><input name=\"ap_ssid\" value=\"%s\">"
-      "<label>AP pass</label><input name=\"ap_pass\" value=\"%s\">"
-      "<label>Max GPS age (seconds)</label><input name=\"max_age_s\" "
-      "value=\"%u\">"
-      "<button type=\"submit\">Save</button>"
-      "</form>"
-      "<p>Reboot the device after saving to apply network changes.</p>"
-      "</body></html>",
-      gps_dot_class, gps_lock_str, (unsigned)gps_status.satellites,
-      gps_const_str, cam_dot_class, cam_conn_str, cam_bond_str,
+}
+
+// Formats st as a JSON object. With prev set only the groups that differ
+// from it are included; returns 0 if there are none.
+static size_t status_json(const web_status_t *st, const web_status_t *prev,
+                          char *out, size_t out_len) {
+  const bool gps = !prev || prev->gps_ok != st->gps_ok ||
+                   prev->gps.has_lock != st->gps.has_lock ||
+                   prev->gps.satellites != st->gps.satellites ||
+                   prev->gps.constellations != st->gps.constellations;
+  const bool cam = !prev || prev->cam_conn != st->cam_conn ||
+                   prev->cam_bond != st->cam_bond;
+  bool bat = false;
 #if ALPHALOC_BATTERY_MONITOR
-      bat_dot_class, bat_text,
+  bat = !prev || prev->bat_ok != st->bat_ok || prev->bat_pct != st->bat_pct ||
+        prev->bat_cv != st->bat_cv;
 #endif
-      s_cfg->camera_name_prefix, s_cfg->camera_mac_prefix, s_cfg->tz_offset_min,
-      s_cfg->dst_offset_min,
-      s_cfg->wifi_ssid, s_cfg->wifi_pass, s_cfg->ap_ssid, s_cfg->ap_pass,
-      (unsigned)s_cfg->max_gps_age_s);
+  if (!gps && !cam && !bat) {
+    return 0;
+  }
+  size_t n = (size_t)snprintf(out, out_len, "{");
+  if (gps && n < out_len) {
+    n += (size_t)snprintf(
+        out + n, out_len - n, "\"gps\":{\"lock\":%s,\"sats\":%u,\"con\":\"%s\"}",
+        st->gps.has_lock ? "true" : "false", (unsigned)st->gps.satellites,
+        st->gps_ok ? constellation_to_str(st->gps.constellations) : "n/a");
+  }
+  if (cam && n < out_len) {
+    n += (size_t)snprintf(out + n, out_len - n,
+                          "%s\"cam\":{\"conn\":%s,\"bond\":%s}",
+                          gps ? "," : "", st->cam_conn ? "true" : "false",
+                          st->cam_bond ? "true" : "false");
+  }
+  if (bat && n < out_len) {
+    const char *sep = (gps || cam) ? "," : "";
+    if (st->bat_ok) {
+      n += (size_t)snprintf(out + n, out_len - n,
+                            "%s\"bat\":{\"ok\":true,\"pct\":%d,\"v\":%d.%02d}",
+                            sep, st->bat_pct, st->bat_cv / 100,
+                            st->bat_cv % 100);
+    } else {
+      n += (size_t)snprintf(out + n, out_len - n, "%s\"bat\":{\"ok\":false}",
+                            sep);
+    }
+  }
+  if (n < out_len) {
+    n += (size_t)snprintf(out + n, out_len - n, "}");
+  }
+  return n < out_len ? n : out_len - 1;
+}
 
-  httpd_resp_set_type(req, "text/html");
-  esp_err_t res = httpd_resp_send(req, page, HTTPD_RESP_USE_STRLEN);
-  free(page);
-  return res;
+// Appends ,"lat":{...} with the p50/p99/max of each fix latency hop in
+// microseconds; nothing before the first acknowledged location write.
+static size_t lat_json(char *out, size_t out_len) {
+  fix_lat_summary_t lat;
+  if (!fix_latency_get_summary(&lat)) {
+    return 0;
+  }
+  size_t n = (size_t)snprintf(
+      out, out_len, ",\"lat\":{\"n\":%lu,\"total\":%lu,\"miss\":%lu",
+      (unsigned long)lat.records, (unsigned long)lat.total,
+      (unsigned long)lat.unmatched);
+  for (int i = 0; i < FIX_LAT_HOP_COUNT && n < out_len; ++i) {
+    n += (size_t)snprintf(out + n, out_len - n, ",\"%s\":[%lu,%lu,%lu]",
+                          fix_latency_hop_name((fix_lat_hop_t)i),
+                          (unsigned long)lat.hop[i].p50_us,
+                          (unsigned long)lat.hop[i].p99_us,
+                          (unsigned long)lat.hop[i].max_us);
+  }
+  if (n < out_len) {
+    n += (size_t)snprintf(out + n, out_len - n, "}");
+  }
+  return n < out_len ? n : 0;
+}
+
+static esp_err_t handle_status(httpd_req_t *req) {
+  note_activity();
+  web_status_t st;
+  read_status(&st);
+  char json[STATUS_JSON_MAX + LAT_JSON_MAX];
+  size_t n = status_json(&st, NULL, json, STATUS_JSON_MAX);
+  // The summary moves with every epoch, so the event stream leaves it out
+  // and pollers get it here, spliced in before the closing brace.
+  n--;
+  n += lat_json(json + n, sizeof(json) - n - 1);
+  json[n++] = '}';
+  json[n] = '\0';
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return httpd_resp_sendstr(req, json);
+}
+
+// Server-sent events: every viewer holds one async request on the shared
+// httpd instance. Producers only queue a push; the httpd task reads the
+// current status and sends the groups that changed since the last push, so
+// each viewer has at most one small event in flight and nothing queues up
+// behind a slow phone. A viewer whose send fails is dropped; EventSource
+// reconnects and starts again from a full snapshot.
+static void sse_drop(int i) {
+  httpd_req_async_handler_complete(s_sse[i]);
+  s_sse[i] = NULL;
+  s_sse_count--;
 }
 
+// Sends the change from the last pushed status to st (or a keep-alive
+// comment) to every viewer. Caller holds s_sse_mutex.
+static void sse_push_locked(const web_status_t *st) {
+  char msg[STATUS_JSON_MAX + 8];
+  memcpy(msg, "data: ", 6);
+  size_t n = status_json(st, &s_sse_last, msg + 6, sizeof(msg) - 8);
+  const int64_t now = esp_timer_get_time();
+  if (n > 0) {
+    n += 6;
+    msg[n++] = '\n';
+    msg[n++] = '\n';
+  } else if (now - s_sse_last_send_us >= SSE_KEEPALIVE_US) {
+    n = (size_t)snprintf(msg, sizeof(msg), ":\n\n");
+  } else {
+    return;
+  }
+  bool delivered = false;
+  for (int i = 0; i < SSE_MAX_CLIENTS; ++i) {
+    if (!s_sse[i]) {
+      continue;
+    }
+    if (httpd_resp_send_chunk(s_sse[i], msg, n) != ESP_OK) {
+      ESP_LOGI(TAG, "Status viewer %d dropped", i);
+      sse_drop(i);
+    } else {
+      delivered = true;
+    }
+  }
+  // A status change reaching a viewer is traffic; keep-alives are not.
+  if (delivered && msg[0] != ':') {
+    note_activity();
+  }
+  s_sse_last = *st;
+  s_sse_last_send_us = now;
+}
+
+static void sse_push_work(void *arg) {
+  (void)arg;
+  s_sse_push_queued = false;
+  web_status_t st;
+  read_status(&st);
+  xSemaphoreTake(s_sse_mutex, portMAX_DELAY);
+  if (s_sse_count > 0) {
+    sse_push_locked(&st);
+  }
+  xSemaphoreGive(s_sse_mutex);
+}
+
+static esp_err_t handle_events(httpd_req_t *req) {
+  note_activity();
+  xSemaphoreTake(s_sse_mutex, portMAX_DELAY);
+  int slot = -1;
+  for (int i = 0; i < SSE_MAX_CLIENTS; ++i) {
+    if (!s_sse[i]) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot < 0) {
+    xSemaphoreGive(s_sse_mutex);
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    return httpd_resp_sendstr(req, "Too many status viewers\n");
+  }
+  // Bring the existing viewers up to date first so they share one baseline
+  // with the snapshot the new one gets.
+  web_status_t st;
+  read_status(&st);
+  if (s_sse_count > 0) {
+    sse_push_locked(&st);
+  }
+  char msg[STATUS_JSON_MAX + 16];
+  int n = snprintf(msg, sizeof(msg), "retry: 5000\ndata: ");
+  n += (int)status_json(&st, NULL, msg + n, sizeof(msg) - n - 2);
+  msg[n++] = '\n';
+  msg[n++] = '\n';
+  httpd_resp_set_type(req, "text/event-stream");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  httpd_req_t *async = NULL;
+  if (httpd_resp_send_chunk(req, msg, n) != ESP_OK ||
+      httpd_req_async_handler_begin(req, &async) != ESP_OK) {
+    xSemaphoreGive(s_sse_mutex);
+    return ESP_FAIL;
+  }
+  s_sse[slot] = async;
+  s_sse_count++;
+  s_sse_last = st;
+  s_sse_last_send_us = esp_timer_get_time();
+  xSemaphoreGive(s_sse_mutex);
+  ESP_LOGI(TAG, "Status viewer %d connected (%d open)", slot, s_sse_count);
+  return ESP_OK;
+}
+
+static void sse_close_all(void) {
+  if (!s_sse_mutex) {
+    return;
+  }
+  xSemaphoreTake(s_sse_mutex, portMAX_DELAY);
+  for (int i = 0; i < SSE_MAX_CLIENTS; ++i) {
+    if (s_sse[i]) {
+      sse_drop(i);
+    }
+  }
+  xSemaphoreGive(s_sse_mutex);
+}
+
+void wifi_web_notify_status(void) {
+  httpd_handle_t server = s_server;
+  if (!server || s_sse_count == 0 || s_sse_push_queued) {
+    return;
+  }
+  s_sse_push_queued = true;
+  if (httpd_queue_work(server, sse_push_work, NULL) != ESP_OK) {
+    s_sse_push_queued = false;
+  }
+}
+
+// Web-visible schema fields with their current values, one chunk per field.
+static esp_err_t handle_config_get(httpd_req_t *req) {
+  note_activity();
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  httpd_resp_sendstr_chunk(req, "{\"fields\":[");
+  bool first = true;
+  for (size_t i = 0; i < g_config_field_count; ++i) {
+    const config_field_t *f = &g_config_fields[i];
+    if (!(f->flags & CONFIG_F_WEB)) {
+      continue;
+    }
+    char value[CONFIG_STR_MAX_64];
+    char escaped[CONFIG_STR_MAX_64 * 2];
+    char chunk[256];
+    config_field_format(f, s_cfg, value, sizeof(value));
+    json_escape(escaped, value, sizeof(escaped));
+    snprintf(chunk, sizeof(chunk),
+             "%s{\"k\":\"%s\",\"l\":\"%s\",\"t\":\"%s\",\"min\":%lu,"
+             "\"max\":%lu,\"v\":\"%s\"}",
+             first ? "" : ",", f->key, f->label,
+             f->type == CONFIG_TYPE_STR ? "s" : "n", (unsigned long)f->min,
+             (unsigned long)f->max, escaped);
+    first = false;
+    httpd_resp_sendstr_chunk(req, chunk);
+  }
+  httpd_resp_sendstr_chunk(req, "]}");
+  return httpd_resp_sendstr_chunk(req, NULL);
+}
+
+// Request bodies and chunked responses share one buffer: the httpd task
+// runs one handler at a time.
+static char s_chunk_buf[OTA_CHUNK];
+
 static esp_err_t handle_save(httpd_req_t *req) {
-  char body[512];
-  int recv = httpd_req_recv(req, body, sizeof(body) - 1);
-  if (recv <= 0) {
+  note_activity();
+  if (req->content_len == 0) {
     return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No data");
   }
-  body[recv] = '\0';
+  if (req->content_len >= sizeof(s_chunk_buf)) {
+    httpd_resp_set_status(req, "413 Payload Too Large");
+    httpd_resp_set_type(req, "text/plain");
+    return httpd_resp_sendstr(req, "Form too large\n");
+  }
+  size_t got = 0;
+  while (got < req->content_len) {
+    const int n = httpd_req_recv(req, s_chunk_buf + got,
+                                 req->content_len - got);
+    if (n <= 0) {
+      return ESP_FAIL;
+    }
+    got += (size_t)n;
+  }
+  s_chunk_buf[got] = '\0';
 
+  // Only the fields in the POST change. An empty value clears a string
+  // that may be empty (DHCP, AP-only, any camera) and keeps anything else.
+  app_config_t next = *s_cfg;
   char value[CONFIG_STR_MAX_64];
-  form_get(body, "cam_name", value, sizeof(value));
-  if (value[0] != '\0') {
-    strncpy(s_cfg->camera_name_prefix, value,
-            sizeof(s_cfg->camera_name_prefix) - 1);
-    s_cfg->camera_name_prefix[sizeof(s_cfg->camera_name_prefix) - 1] = '\0';
+  for (size_t i = 0; i < g_config_field_count; ++i) {
+    const config_field_t *f = &g_config_fields[i];
+    if (!(f->flags & CONFIG_F_WEB)) {
+      continue;
+    }
+    const form_value_t present =
+        form_get(s_chunk_buf, f->key, value, sizeof(value));
+    if (present == FORM_ABSENT) {
+      continue;
+    }
+    if (present == FORM_PRESENT && value[0] == '\0' &&
+        (f->type != CONFIG_TYPE_STR || f->min > 0)) {
+      continue;
+    }
+    if (present == FORM_TOO_LONG || !config_field_parse(f, value, &next)) {
+      ESP_LOGW(TAG, "Rejected value for %s", f->key);
+      char msg[64];
+      snprintf(msg, sizeof(msg), "Invalid value for %s", f->label);
+      return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, msg);
+    }
   }
 
-  form_get(body, "cam_mac", value, sizeof(value));
-  if (value[0] != '\0') {
-    strncpy(s_cfg->camera_mac_prefix, value,
-            sizeof(s_cfg->camera_mac_prefix) - 1);
-    s_cfg->camera_mac_prefix[sizeof(s_cfg->camera_mac_prefix) - 1] = '\0';
+  config_update(s_cfg, &next);
+  httpd_resp_set_type(req, "text/plain");
+  return httpd_resp_sendstr(
+      req, "Saved. WiFi changes apply the next time the config window opens.\n");
+}
+
+// Firmware update: the request body is the raw app image (the .bin the
+// build produces). It streams through one static sector-sized buffer into
+// the inactive slot, so the upload never holds more than a chunk in RAM. An
+// optional X-Image-SHA256 header is checked against the received bytes;
+// the image's own checksum is always checked before the slot is selected.
+static esp_timer_handle_t s_restart_timer;
+
+static void restart_cb(void *arg) {
+  (void)arg;
+  flash_sched_flush();
+  esp_restart();
+}
+
+static esp_err_t handle_update(httpd_req_t *req) {
+  note_activity();
+  if (req->content_len == 0) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No image");
+  }
+  char sha[65] = "";
+  httpd_req_get_hdr_value_str(req, "X-Image-SHA256", sha, sizeof(sha));
+  esp_err_t err = ota_update_begin(sha);
+  if (err == ESP_ERR_INVALID_STATE) {
+    httpd_resp_set_status(req, "409 Conflict");
+    return httpd_resp_sendstr(req, "Update already in progress\n");
+  }
+  if (err == ESP_ERR_INVALID_ARG) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                               "Bad X-Image-SHA256 header");
+  }
+  if (err != ESP_OK) {
+    return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                               "Cannot start update");
   }
 
-  form_get(body, "tz", value, sizeof(value));
-  uint16_t tz = 0;
-  if (parse_u16(value, &tz)) {
-    s_cfg->tz_offset_min = tz;
+  size_t remaining = req->content_len;
+  int retries = 0;
+  while (remaining > 0) {
+    int n = httpd_req_recv(req, s_chunk_buf,
+                           remaining < sizeof(s_chunk_buf) ? remaining
+                                                           : sizeof(s_chunk_buf));
+    if (n == HTTPD_SOCK_ERR_TIMEOUT && ++retries <= OTA_RECV_RETRIES) {
+      continue;
+    }
+    if (n <= 0) {
+      ota_update_abort();
+      return ESP_FAIL;
+    }
+    retries = 0;
+    // Sector erases stall the flash cache; hold the chunk (and with it the
+    // sender, through TCP flow control) while the camera link is busy.
+    for (int waited = 0; ble_client_is_busy() && waited < OTA_LINK_WAIT_MS;
+         waited += 20) {
+      vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    if (ota_update_write(s_chunk_buf, (size_t)n) != ESP_OK) {
+      return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                                 "Not a valid firmware image");
+    }
+    remaining -= (size_t)n;
+    note_activity();
   }
 
-  form_get(body, "dst", value, sizeof(value));
-  uint16_t dst = 0;
-  if (parse_u16(value, &dst)) {
-    s_cfg->dst_offset_min = dst;
+  ota_update_stats_t st;
+  err = ota_update_finish(&st);
+  if (err != ESP_OK) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                               err == ESP_ERR_INVALID_CRC
+                                   ? "SHA-256 mismatch"
+                                   : "Image verification failed");
   }
+  char msg[160];
+  snprintf(msg, sizeof(msg),
+           "Updated: %lu bytes in %lu ms (%lu KiB/s, peak heap %lu bytes). "
+           "Rebooting.\n",
+           (unsigned long)st.bytes, (unsigned long)st.elapsed_ms,
+           (unsigned long)st.kib_per_s, (unsigned long)st.peak_heap_bytes);
+  httpd_resp_set_type(req, "text/plain");
+  httpd_resp_sendstr(req, msg);
 
-  form_get(body, "wifi_ssid", value, sizeof(value));
-  if (value[0] != '\0') {
-    strncpy(s_cfg->wifi_ssid, value, sizeof(s_cfg->wifi_ssid) - 1);
-    s_cfg->wifi_ssid[sizeof(s_cfg->wifi_ssid) - 1] = '\0';
+  // Give the response a moment to leave before restarting.
+  const esp_timer_create_args_t args = {.callback = restart_cb,
+                                        .name = "ota_restart"};
+  if (!s_restart_timer &&
+      esp_timer_create(&args, &s_restart_timer) != ESP_OK) {
+    restart_cb(NULL);
+  } else {
+    esp_timer_start_once(s_restart_timer, OTA_RESTART_DELAY_US);
   }
+  return ESP_OK;
+}
+
+// Fixed-point micro-degrees as decimal degrees, without float formatting.
+static int fmt_udeg(char *dst, size_t len, int32_t v) {
+  const uint32_t a = v < 0 ? -(uint32_t)v : (uint32_t)v;
+  return snprintf(dst, len, "%s%lu.%06lu", v < 0 ? "-" : "",
+                  (unsigned long)(a / 1000000), (unsigned long)(a % 1000000));
+}
 
-  form_get(body, "wifi_pass", value, sizeof(value));
-  if (value[0] != '\0') {
-    strncpy(s_cfg->wifi_pass, value, sizeof(s_cfg->wifi_pass) - 1);
-    s_cfg->wifi_pass[sizeof(s_cfg->wifi_pass) - 1] = '\0';
+static size_t track_row(char *dst, size_t len, const track_point_t *p,
+                        bool gpx) {
+  int y, mo, d, h, mi, sec;
+  track_unix_to_civil(p->t, &y, &mo, &d, &h, &mi, &sec);
+  char lat[16], lon[16];
+  fmt_udeg(lat, sizeof(lat), p->lat_udeg);
+  fmt_udeg(lon, sizeof(lon), p->lon_udeg);
+  const int n =
+      gpx ? snprintf(dst, len,
+                     "<trkpt lat=\"%s\" lon=\"%s\"><ele>%ld</ele>"
+                     "<time>%04d-%02d-%02dT%02d:%02d:%02dZ</time></trkpt>\n",
+                     lat, lon, (long)p->alt_m, y, mo, d, h, mi, sec)
+          : snprintf(dst, len, "%04d-%02d-%02dT%02d:%02d:%02dZ,%s,%s,%ld\n", y,
+                     mo, d, h, mi, sec, lat, lon, (long)p->alt_m);
+  return n > 0 && (size_t)n < len ? (size_t)n : 0;
+}
+
+// format=bin: the raw sectors of the range, oldest first, sent straight out
+// of the flash map. This is what the host tools read.
+static esp_err_t send_track_bin(httpd_req_t *req, track_reader_t *reader) {
+  httpd_resp_set_type(req, "application/octet-stream");
+  httpd_resp_set_hdr(req, "Content-Disposition",
+                     "attachment; filename=\"track.bin\"");
+  const uint8_t *sector;
+  while ((sector = track_reader_next_sector(reader)) != NULL) {
+    if (httpd_resp_send_chunk(req, (const char *)sector, TRACK_SECTOR_SIZE) !=
+        ESP_OK) {
+      return ESP_FAIL;
+    }
+    note_activity();
   }
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
 
-  form_get(body, "ap_ssid", value, sizeof(value));
-  if (value[0] != '\0') {
-    strncpy(s_cfg->ap_ssid, value, sizeof(s_cfg->ap_ssid) - 1);
-    s_cfg->ap_ssid[sizeof(s_cfg->ap_ssid) - 1] = '\0';
+// GET /api/track?format=gpx|csv|bin&from=<unix>&to=<unix>: decodes the
+// track log record by record and streams it in chunks of one buffer, so
+// memory use does not depend on the size of the export. The sector index
+// keeps a narrow time range from touching the rest of the partition.
+static esp_err_t handle_track(httpd_req_t *req) {
+  note_activity();
+  char query[64] = "";
+  char val[16];
+  bool gpx = true;
+  bool bin = false;
+  uint32_t t_from = 0;
+  uint32_t t_to = UINT32_MAX;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "format", val, sizeof(val)) == ESP_OK) {
+      gpx = strcmp(val, "csv") != 0 && strcmp(val, "bin") != 0;
+      bin = strcmp(val, "bin") == 0;
+    }
+    if (httpd_query_key_value(query, "from", val, sizeof(val)) == ESP_OK) {
+      t_from = (uint32_t)strtoul(val, NULL, 10);
+    }
+    if (httpd_query_key_value(query, "to", val, sizeof(val)) == ESP_OK) {
+      t_to = (uint32_t)strtoul(val, NULL, 10);
+    }
   }
+  track_reader_t reader;
+  if (!track_reader_open(&reader, t_from, t_to)) {
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    return httpd_resp_sendstr(req, "No track log\n");
+  }
+  if (bin) {
+    const esp_err_t err = send_track_bin(req, &reader);
+    track_reader_close(&reader);
+    return err;
+  }
+  httpd_resp_set_type(req, gpx ? "application/gpx+xml" : "text/csv");
+  httpd_resp_set_hdr(req, "Content-Disposition",
+                     gpx ? "attachment; filename=\"track.gpx\""
+                         : "attachment; filename=\"track.csv\"");
 
-  form_get(body, "ap_pass", value, sizeof(value));
-  if (value[0] != '\0') {
-    strncpy(s_cfg->ap_pass, value, sizeof(s_cfg->ap_pass) - 1);
-    s_cfg->ap_pass[sizeof(s_cfg->ap_pass) - 1] = '\0';
+  const int64_t start_us = esp_timer_get_time();
+  size_t len = (size_t)snprintf(
+      s_chunk_buf, sizeof(s_chunk_buf), "%s",
+      gpx ? "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<gpx version=\"1.1\" creator=\"AlphaLoc\" "
+            "xmlns=\"http://www.topografix.com/GPX/1/1\">\n<trk><trkseg>\n"
+          : "time,lat,lon,alt_m\n");
+  uint32_t points = 0;
+  uint32_t bytes = 0;
+  uint32_t last_t = 0;
+  esp_err_t err = ESP_OK;
+  track_point_t p;
+  while (err == ESP_OK && track_reader_next(&reader, &p)) {
+    if (gpx && points > 0 && p.t - last_t > TRACK_SEGMENT_GAP_S) {
+      len += (size_t)snprintf(s_chunk_buf + len, sizeof(s_chunk_buf) - len,
+                              "</trkseg><trkseg>\n");
+    }
+    len += track_row(s_chunk_buf + len, sizeof(s_chunk_buf) - len, &p, gpx);
+    last_t = p.t;
+    points++;
+    if (sizeof(s_chunk_buf) - len < TRACK_ROW_MAX) {
+      err = httpd_resp_send_chunk(req, s_chunk_buf, (ssize_t)len);
+      bytes += (uint32_t)len;
+      len = 0;
+      note_activity();
+    }
   }
+  const uint32_t blocks = reader.blocks;
+  track_reader_close(&reader);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Track export aborted after %lu points",
+             (unsigned long)points);
+    return ESP_FAIL;
+  }
+  if (gpx) {
+    len += (size_t)snprintf(s_chunk_buf + len, sizeof(s_chunk_buf) - len,
+                            "</trkseg></trk>\n</gpx>\n");
+  }
+  if (httpd_resp_send_chunk(req, s_chunk_buf, (ssize_t)len) != ESP_OK) {
+    return ESP_FAIL;
+  }
+  bytes += (uint32_t)len;
+  const uint32_t elapsed_ms =
+      (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+  ESP_LOGI(TAG,
+           "Track export: %lu points from %lu blocks, %lu bytes in %lu ms "
+           "(%lu KB/s)",
+           (unsigned long)points, (unsigned long)blocks, (unsigned long)bytes,
+           (unsigned long)elapsed_ms,
+           (unsigned long)(elapsed_ms ? bytes / elapsed_ms : 0));
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
 
-  form_get(body, "max_age_s", value, sizeof(value));
-  uint16_t max_age = 0;
-  if (parse_u16(value, &max_age)) {
-    s_cfg->max_gps_age_s = max_age;
+// GET /api/nmea/capture: the raw receiver capture (see nmea_capture.h) up
+// to the moment of the request, oldest record first, for tools/nmea_replay.
+static esp_err_t handle_nmea_capture(httpd_req_t *req) {
+  note_activity();
+  if (!nmea_capture_enabled()) {
+    return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND,
+                               "Built without ALPHALOC_NMEA_CAPTURE");
+  }
+  httpd_resp_set_type(req, "application/octet-stream");
+  httpd_resp_set_hdr(req, "Content-Disposition",
+                     "attachment; filename=\"nmea.cap\"");
+  if (httpd_resp_send_chunk(req, NMEA_CAPTURE_MAGIC, NMEA_CAPTURE_MAGIC_LEN) !=
+      ESP_OK) {
+    return ESP_FAIL;
+  }
+  uint32_t cursor, end;
+  nmea_capture_span(&cursor, &end);
+  size_t n;
+  while ((n = nmea_capture_read(&cursor, end, (uint8_t *)s_chunk_buf,
+                                sizeof(s_chunk_buf))) > 0) {
+    if (httpd_resp_send_chunk(req, s_chunk_buf, (ssize_t)n) != ESP_OK) {
+      return ESP_FAIL;
+    }
+  }
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// GET /api/trace: the trace ring (see trace_log.h) for tools/trace_decode;
+// ?src=flash returns the last copy in the "trace" partition instead.
+static esp_err_t handle_trace(httpd_req_t *req) {
+  note_activity();
+  if (!trace_log_enabled()) {
+    return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND,
+                               "Built without ALPHALOC_TRACE");
+  }
+  char query[32] = "";
+  char val[8] = "";
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    httpd_query_key_value(query, "src", val, sizeof(val));
   }
+  const bool flash = strcmp(val, "flash") == 0;
+  size_t total = 0;
+  if (flash && (!trace_log_flash_read(0, s_chunk_buf, 0, &total) ||
+                total == 0)) {
+    return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND,
+                               "No trace copy in flash");
+  }
+  httpd_resp_set_type(req, "application/octet-stream");
+  httpd_resp_set_hdr(req, "Content-Disposition",
+                     flash ? "attachment; filename=\"trace-flash.bin\""
+                           : "attachment; filename=\"trace.bin\"");
+  if (flash) {
+    for (size_t off = 0; off < total; off += sizeof(s_chunk_buf)) {
+      const size_t n = total - off < sizeof(s_chunk_buf)
+                           ? total - off
+                           : sizeof(s_chunk_buf);
+      if (!trace_log_flash_read(off, s_chunk_buf, n, &total) ||
+          httpd_resp_send_chunk(req, s_chunk_buf, (ssize_t)n) != ESP_OK) {
+        return ESP_FAIL;
+      }
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+  }
+  uint32_t cursor, end;
+  trace_log_span(&cursor, &end);
+  trace_dump_hdr_t hdr;
+  trace_log_dump_header(&hdr, cursor, end);
+  if (httpd_resp_send_chunk(req, (const char *)&hdr, sizeof(hdr)) != ESP_OK) {
+    return ESP_FAIL;
+  }
+  uint32_t words[128];
+  size_t n;
+  while ((n = trace_log_read(&cursor, end, words,
+                             sizeof(words) / sizeof(words[0]))) > 0) {
+    if (httpd_resp_send_chunk(req, (const char *)words,
+                              (ssize_t)(n * sizeof(words[0]))) != ESP_OK) {
+      return ESP_FAIL;
+    }
+  }
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
 
-  config_save(s_cfg);
+// POST /api/gps/script: replaces the synthetic receiver's script (plain
+// text, see gps_synth.h). Only in ALPHALOC_FAKE_GPS builds.
+static esp_err_t handle_gps_script(httpd_req_t *req) {
+  note_activity();
+  if (!gps_synth_source()) {
+    return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND,
+                               "Built without ALPHALOC_FAKE_GPS");
+  }
+  if (req->content_len == 0 || req->content_len >= sizeof(s_chunk_buf)) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                               "Script missing or too long");
+  }
+  size_t got = 0;
+  while (got < req->content_len) {
+    const int n = httpd_req_recv(req, s_chunk_buf + got,
+                                 req->content_len - got);
+    if (n <= 0) {
+      return ESP_FAIL;
+    }
+    got += (size_t)n;
+  }
+  s_chunk_buf[got] = '\0';
+  char err[128];
+  if (!gps_synth_load(s_chunk_buf, err, sizeof(err))) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, err);
+  }
   httpd_resp_set_type(req, "text/plain");
-  return httpd_resp_sendstr(req, "Saved. Reboot to apply WiFi changes.\n");
+  return httpd_resp_sendstr(req, "Script loaded.\n");
+}
+
+// POST /api/gps/epo: stores an MTK EPO file (e.g. MTK7d.EPO) for GPS aiding
+// and queues it for the receiver. Streamed like /update.
+static esp_err_t handle_gps_epo(httpd_req_t *req) {
+  note_activity();
+  esp_err_t err = gps_aid_epo_begin(req->content_len);
+  if (err == ESP_ERR_INVALID_STATE) {
+    httpd_resp_set_status(req, "409 Conflict");
+    return httpd_resp_sendstr(req, "EPO upload or transfer in progress\n");
+  }
+  if (err == ESP_ERR_INVALID_SIZE) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                               "Not an MTK EPO file (size)");
+  }
+  if (err == ESP_ERR_NO_MEM) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                               "EPO file larger than the epo partition");
+  }
+  if (err != ESP_OK) {
+    return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND,
+                               "No epo partition or built without aiding");
+  }
+
+  size_t remaining = req->content_len;
+  int retries = 0;
+  while (remaining > 0) {
+    int n = httpd_req_recv(req, s_chunk_buf,
+                           remaining < sizeof(s_chunk_buf) ? remaining
+                                                           : sizeof(s_chunk_buf));
+    if (n == HTTPD_SOCK_ERR_TIMEOUT && ++retries <= OTA_RECV_RETRIES) {
+      continue;
+    }
+    if (n <= 0) {
+      gps_aid_epo_abort();
+      return ESP_FAIL;
+    }
+    retries = 0;
+    for (int waited = 0; ble_client_is_busy() && waited < OTA_LINK_WAIT_MS;
+         waited += 20) {
+      vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    if (gps_aid_epo_write(s_chunk_buf, (size_t)n) != ESP_OK) {
+      return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                                 "Flash write failed");
+    }
+    remaining -= (size_t)n;
+    note_activity();
+  }
+  if (gps_aid_epo_finish() != ESP_OK) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                               "Not an MTK EPO file (segments)");
+  }
+  gps_aid_stats_t st;
+  gps_aid_get_stats(&st);
+  int y, mo, d, h, mi, sec;
+  track_unix_to_civil(st.epo_end, &y, &mo, &d, &h, &mi, &sec);
+  char msg[128];
+  snprintf(msg, sizeof(msg),
+           "EPO stored: %lu bytes, valid until %04d-%02d-%02d %02d:%02d UTC.\n",
+           (unsigned long)st.epo_bytes, y, mo, d, h, mi);
+  httpd_resp_set_type(req, "text/plain");
+  return httpd_resp_sendstr(req, msg);
 }
 
 void wifi_web_start(app_config_t *cfg) {
@@ -332,50 +1185,132 @@ void wifi_web_start(app_config_t *cfg) {
     return;
   }
   s_cfg = cfg;
+  if (!s_sse_mutex) {
+#if ALPHALOC_STATIC_ALLOC
+    s_sse_mutex = xSemaphoreCreateMutexStatic(&s_sse_mutex_buf);
+#else
+    s_sse_mutex = xSemaphoreCreateMutex();
+#endif
+  }
 
+  s_start_us = esp_timer_get_time();
   ESP_ERROR_CHECK(esp_netif_init());
   ESP_ERROR_CHECK(esp_event_loop_create_default());
   ESP_ERROR_CHECK(
       esp_event_handler_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
                                  &wifi_event_handler, NULL));
+  ESP_ERROR_CHECK(esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
+                                             &ip_event_handler, NULL));
   s_wifi_handlers_registered = true;
+  // The soft-AP is up from the start; the STA joins the configured network
+  // alongside it, so the UI never waits for a scan or DHCP to fail.
+  s_netif_ap = esp_netif_create_default_wifi_ap();
   s_netif_sta = esp_netif_create_default_wifi_sta();
   s_netif = s_netif_sta;
 
   wifi_init_config_t cfg_init = WIFI_INIT_CONFIG_DEFAULT();
   ESP_ERROR_CHECK(esp_wifi_init(&cfg_init));
 
-  wifi_config_t wifi_cfg = {0};
-  strncpy((char *)wifi_cfg.sta.ssid, s_cfg->wifi_ssid,
-          sizeof(wifi_cfg.sta.ssid) - 1);
-  strncpy((char *)wifi_cfg.sta.password, s_cfg->wifi_pass,
-          sizeof(wifi_cfg.sta.password) - 1);
-  ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
-  ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_cfg));
-
-  ESP_ERROR_CHECK(esp_wifi_start());
-  // Enable WiFi power saving in STA mode (Issue 3.2)
-  // esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
-  // ESP_LOGI(TAG, "WiFi power saving enabled");
-  s_sta_start_us = esp_timer_get_time();
-  esp_wifi_connect();
-
   httpd_config_t server_cfg = HTTPD_DEFAULT_CONFIG();
   server_cfg.uri_match_fn = httpd_uri_match_wildcard;
   server_cfg.stack_size = 8192;
+  server_cfg.core_id = task_plan_core(TASK_ROLE_HTTPD);
+  server_cfg.task_priority = task_plan_priority(TASK_ROLE_HTTPD);
+  server_cfg.max_open_sockets = WIFI_WEB_OPEN_SOCKETS;
+  server_cfg.max_uri_handlers = 14;
   httpd_start(&s_server, &server_cfg);
 
+  const size_t index_len = index_html_gz_end - index_html_gz_start;
+  const uint32_t index_crc =
+      esp_rom_crc32_le(0, index_html_gz_start, index_len);
+  snprintf(s_index_etag, sizeof(s_index_etag), "\"%08lx\"",
+           (unsigned long)index_crc);
+  snprintf(s_index_path, sizeof(s_index_path), "/ui/%08lx",
+           (unsigned long)index_crc);
+
   httpd_uri_t root = {
       .uri = "/", .method = HTTP_GET, .handler = handle_root, .user_ctx = NULL};
+  httpd_uri_t ui = {.uri = "/ui/*",
+                    .method = HTTP_GET,
+                    .handler = handle_index,
+                    .user_ctx = NULL};
+  httpd_uri_t status = {.uri = "/api/status",
+                        .method = HTTP_GET,
+                        .handler = handle_status,
+                        .user_ctx = NULL};
+  httpd_uri_t events = {.uri = "/api/events",
+                        .method = HTTP_GET,
+                        .handler = handle_events,
+                        .user_ctx = NULL};
+  httpd_uri_t config_get = {.uri = "/api/config",
+                            .method = HTTP_GET,
+                            .handler = handle_config_get,
+                            .user_ctx = NULL};
+  httpd_uri_t config_post = {.uri = "/api/config",
+                             .method = HTTP_POST,
+                             .handler = handle_save,
+                             .user_ctx = NULL};
+  // Plain form posts from older pages or scripts.
   httpd_uri_t save = {.uri = "/save",
                       .method = HTTP_POST,
                       .handler = handle_save,
                       .user_ctx = NULL};
   httpd_register_uri_handler(s_server, &root);
+  httpd_register_uri_handler(s_server, &ui);
+  httpd_register_uri_handler(s_server, &status);
+  httpd_register_uri_handler(s_server, &events);
+  httpd_register_uri_handler(s_server, &config_get);
+  httpd_register_uri_handler(s_server, &config_post);
+  httpd_uri_t update = {.uri = "/update",
+                        .method = HTTP_POST,
+                        .handler = handle_update,
+                        .user_ctx = NULL};
+  httpd_uri_t track = {.uri = "/api/track",
+                       .method = HTTP_GET,
+                       .handler = handle_track,
+                       .user_ctx = NULL};
   httpd_register_uri_handler(s_server, &save);
+  httpd_register_uri_handler(s_server, &update);
+  httpd_uri_t nmea_capture = {.uri = "/api/nmea/capture",
+                              .method = HTTP_GET,
+                              .handler = handle_nmea_capture,
+                              .user_ctx = NULL};
+  httpd_register_uri_handler(s_server, &track);
+  httpd_register_uri_handler(s_server, &nmea_capture);
+  httpd_uri_t gps_script = {.uri = "/api/gps/script",
+                            .method = HTTP_POST,
+                            .handler = handle_gps_script,
+                            .user_ctx = NULL};
+  httpd_register_uri_handler(s_server, &gps_script);
+  httpd_uri_t gps_epo = {.uri = "/api/gps/epo",
+                         .method = HTTP_POST,
+                         .handler = handle_gps_epo,
+                         .user_ctx = NULL};
+  httpd_register_uri_handler(s_server, &gps_epo);
+  httpd_uri_t trace = {.uri = "/api/trace",
+                       .method = HTTP_GET,
+                       .handler = handle_trace,
+                       .user_ctx = NULL};
+  httpd_register_uri_handler(s_server, &trace);
+
+  const bool sta = s_cfg->wifi_ssid[0] != '\0';
+  sta_cache_load();
+  ESP_ERROR_CHECK(esp_wifi_set_mode(sta ? WIFI_MODE_APSTA : WIFI_MODE_AP));
+  ap_apply_config();
+  if (sta) {
+    sta_apply_ip();
+    sta_apply_config(true);
+  }
+  ESP_ERROR_CHECK(esp_wifi_start());
+  coex_policy_start(ble_client_is_busy, web_active);
+  s_sta_active = sta;
+  if (sta) {
+    esp_wifi_connect();
+  }
 
   s_started = true;
-  ESP_LOGI(TAG, "WiFi web started");
+  ESP_LOGI(TAG, "WiFi web started (UI %u bytes gzip at %s)",
+           (unsigned)index_len, s_index_path);
 }
 
 void wifi_web_stop(void) {
@@ -383,9 +1318,13 @@ void wifi_web_stop(void) {
     return;
   }
   if (s_server) {
-    httpd_stop(s_server);
+    httpd_handle_t server = s_server;
     s_server = NULL;
+    // Async requests reference httpd sessions; release them first.
+    sse_close_all();
+    httpd_stop(server);
   }
+  coex_policy_stop();
   esp_wifi_stop();
   esp_wifi_deinit();
 
@@ -403,6 +1342,8 @@ void wifi_web_stop(void) {
   if (s_wifi_handlers_registered) {
     esp_event_handler_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID,
                                  &wifi_event_handler);
+    esp_event_handler_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP,
+                                 &ip_event_handler);
     s_wifi_handlers_registered = false;
   }
 
@@ -410,6 +1351,8 @@ void wifi_web_stop(void) {
   esp_event_loop_delete_default();
 
   s_started = false;
-  s_ap_active = false;
+  s_sta_active = false;
   ESP_LOGI(TAG, "WiFi web stopped");
 }
+
+int64_t wifi_web_last_activity_us(void) { return s_last_activity_us; }
@@ -0,0 +1,320 @@
+#include <string.h>
+#include <unity.h>
+
+#include "track_codec.h"
+
+#define TOL_UDEG 10
+#define TOL_ALT_M 2
+#define MAX_POINTS 4000
+
+static track_point_t s_in[MAX_POINTS];
+static track_point_t s_out[MAX_POINTS];
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static uint32_t s_rand = 12345;
+
+static int32_t noise(int32_t amp) {
+  s_rand = s_rand * 1103515245u + 12345u;
+  return (int32_t)((s_rand >> 16) % (uint32_t)(2 * amp + 1)) - amp;
+}
+
+// 1 Hz walk and drive with pauses, a GPS gap and receiver noise.
+static size_t make_track(void) {
+  size_t n = 0;
+  uint32_t t = track_unix_time(2025, 6, 1, 8, 0, 0);
+  int32_t lat = 48137000;
+  int32_t lon = 11575000;
+  int32_t alt = 520;
+  while (n < MAX_POINTS) {
+    const size_t i = n;
+    int32_t v_lat = 0;
+    int32_t v_lon = 0;
+    if (i % 1000 < 400) {
+      v_lat = 12;  // walking
+      v_lon = -7;
+    } else if (i % 1000 < 700) {
+      v_lat = -150;  // driving
+      v_lon = 230;
+    }
+    lat += v_lat;
+    lon += v_lon;
+    t += i == 2500 ? 600 : 1;
+    s_in[n++] = (track_point_t){
+        .t = t,
+        .lat_udeg = lat + noise(3),
+        .lon_udeg = lon + noise(3),
+        .alt_m = alt + noise(1),
+    };
+  }
+  return n;
+}
+
+// What the log stores for a point: lat/lon rounded to TRACK_QUANT_UDEG.
+static int32_t quantized_udeg(int32_t udeg) {
+  const int32_t half = TRACK_QUANT_UDEG / 2;
+  return (udeg >= 0 ? udeg + half : udeg - half) / TRACK_QUANT_UDEG *
+         TRACK_QUANT_UDEG;
+}
+
+static void assert_quantized(const track_point_t *in, const track_point_t *out,
+                             size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    TEST_ASSERT_EQUAL_UINT32(in[i].t, out[i].t);
+    TEST_ASSERT_EQUAL_INT32(quantized_udeg(in[i].lat_udeg), out[i].lat_udeg);
+    TEST_ASSERT_EQUAL_INT32(quantized_udeg(in[i].lon_udeg), out[i].lon_udeg);
+    TEST_ASSERT_EQUAL_INT32(in[i].alt_m, out[i].alt_m);
+  }
+}
+
+// Encodes points into as many blocks as needed and decodes each block as if
+// read back from flash. Returns the number of points decoded.
+static size_t round_trip(const track_point_t *in, size_t n, int32_t tol_udeg,
+                         int32_t tol_alt_m, size_t *blocks) {
+  static track_encoder_t enc;
+  size_t out_n = 0;
+  size_t i = 0;
+  *blocks = 0;
+  while (i < n) {
+    track_enc_begin(&enc, TRACK_BLOCK_PAYLOAD_MAX, tol_udeg, tol_alt_m);
+    while (i < n && track_enc_add(&enc, &in[i])) {
+      ++i;
+    }
+    TEST_ASSERT_TRUE(enc.count > 0);
+    const size_t len = track_enc_finish(&enc);
+    TEST_ASSERT_TRUE(len <= TRACK_BLOCK_PAYLOAD_MAX);
+    track_block_hdr_t hdr;
+    track_block_hdr_seal(&hdr, enc.buf, (uint16_t)len, enc.count);
+    TEST_ASSERT_TRUE(track_block_valid(&hdr, enc.buf));
+
+    track_decoder_t dec;
+    track_dec_begin(&dec, enc.buf, hdr.len, hdr.count);
+    track_point_t p;
+    size_t got = 0;
+    while (track_dec_next(&dec, &p)) {
+      TEST_ASSERT_TRUE(out_n < MAX_POINTS);
+      s_out[out_n++] = p;
+      ++got;
+    }
+    TEST_ASSERT_EQUAL_UINT32(hdr.count, got);
+    TEST_ASSERT_EQUAL_UINT32(len, dec.pos);
+    (*blocks)++;
+  }
+  return out_n;
+}
+
+static void test_crc32_matches_zlib(void) {
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926u, track_crc32(0, "123456789", 9));
+  // Chained calls equal one call over the whole buffer.
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926u,
+                          track_crc32(track_crc32(0, "1234", 4), "56789", 5));
+}
+
+static void test_round_trip_keeps_quantized_points(void) {
+  const size_t n = make_track();
+  size_t blocks;
+  TEST_ASSERT_EQUAL_UINT32(n, round_trip(s_in, n, 0, 0, &blocks));
+  assert_quantized(s_in, s_out, n);
+}
+
+static void test_quantization_rounds_half_away_from_zero(void) {
+  const track_point_t in[] = {
+      {1, 15, -15, 0},
+      {2, 14, -14, 0},
+      {3, -5, 5, 0},
+      {4, -4, 4, 0},
+  };
+  const size_t n = sizeof(in) / sizeof(in[0]);
+  size_t blocks;
+  TEST_ASSERT_EQUAL_UINT32(n, round_trip(in, n, 0, 0, &blocks));
+  TEST_ASSERT_EQUAL_INT32(20, s_out[0].lat_udeg);
+  TEST_ASSERT_EQUAL_INT32(-20, s_out[0].lon_udeg);
+  TEST_ASSERT_EQUAL_INT32(10, s_out[1].lat_udeg);
+  TEST_ASSERT_EQUAL_INT32(-10, s_out[1].lon_udeg);
+  TEST_ASSERT_EQUAL_INT32(-10, s_out[2].lat_udeg);
+  TEST_ASSERT_EQUAL_INT32(10, s_out[2].lon_udeg);
+  TEST_ASSERT_EQUAL_INT32(0, s_out[3].lat_udeg);
+  TEST_ASSERT_EQUAL_INT32(0, s_out[3].lon_udeg);
+}
+
+static void test_runs_stay_within_tolerance(void) {
+  const size_t n = make_track();
+  size_t no_run_blocks;
+  round_trip(s_in, n, 0, 0, &no_run_blocks);
+  size_t blocks;
+  TEST_ASSERT_EQUAL_UINT32(n, round_trip(s_in, n, TOL_UDEG, TOL_ALT_M, &blocks));
+  for (size_t i = 0; i < n; ++i) {
+    TEST_ASSERT_EQUAL_UINT32(s_in[i].t, s_out[i].t);
+    TEST_ASSERT_INT_WITHIN(TOL_UDEG, s_in[i].lat_udeg, s_out[i].lat_udeg);
+    TEST_ASSERT_INT_WITHIN(TOL_UDEG, s_in[i].lon_udeg, s_out[i].lon_udeg);
+    TEST_ASSERT_INT_WITHIN(TOL_ALT_M, s_in[i].alt_m, s_out[i].alt_m);
+  }
+  TEST_ASSERT_TRUE(blocks < no_run_blocks);
+}
+
+static void test_extreme_values(void) {
+  // Pole to pole, the antimeridian, below sea level, irregular and large
+  // time steps: every varint width and both zigzag signs.
+  const track_point_t in[] = {
+      {1, -90000000, -180000000, -430},
+      {2, 90000000, 180000000, 8848},
+      {5, 0, 0, 0},
+      {6, -1, 1, -1},
+      {4000000000u, 89999999, -179999999, 100000},
+      {4000000001u, -89999999, 179999999, -100000},
+      {4000000003u, 1, -1, 0},
+  };
+  const size_t n = sizeof(in) / sizeof(in[0]);
+  size_t blocks;
+  TEST_ASSERT_EQUAL_UINT32(n, round_trip(in, n, 0, 0, &blocks));
+  assert_quantized(in, s_out, n);
+}
+
+static void test_out_of_order_points_are_dropped(void) {
+  track_encoder_t enc;
+  track_enc_begin(&enc, TRACK_BLOCK_PAYLOAD_MAX, 0, 0);
+  const track_point_t a = {100, 1, 2, 3};
+  const track_point_t b = {99, 4, 5, 6};
+  TEST_ASSERT_TRUE(track_enc_add(&enc, &a));
+  TEST_ASSERT_TRUE(track_enc_add(&enc, &b));
+  TEST_ASSERT_TRUE(track_enc_add(&enc, &a));
+  TEST_ASSERT_EQUAL_UINT32(1, enc.count);
+}
+
+static void test_sector_first_block_capacity(void) {
+  // The first block of a sector shares its page with the sector header.
+  const size_t cap = TRACK_BLOCK_PAYLOAD_MAX - sizeof(track_sector_hdr_t);
+  const size_t n = make_track();
+  track_encoder_t enc;
+  track_enc_begin(&enc, cap, 0, 0);
+  size_t i = 0;
+  while (i < n && track_enc_add(&enc, &s_in[i])) {
+    ++i;
+  }
+  TEST_ASSERT_TRUE(i < n);
+  TEST_ASSERT_TRUE(track_enc_finish(&enc) <= cap);
+  TEST_ASSERT_EQUAL_UINT32(TRACK_PAGE_SIZE, track_first_block_offset() + cap +
+                                                sizeof(track_block_hdr_t));
+}
+
+static void test_block_crc_catches_corruption(void) {
+  const size_t n = make_track();
+  track_encoder_t enc;
+  track_enc_begin(&enc, TRACK_BLOCK_PAYLOAD_MAX, TOL_UDEG, TOL_ALT_M);
+  for (size_t i = 0; i < n && track_enc_add(&enc, &s_in[i]); ++i) {
+  }
+  const size_t len = track_enc_finish(&enc);
+  track_block_hdr_t hdr;
+  track_block_hdr_seal(&hdr, enc.buf, (uint16_t)len, enc.count);
+  for (size_t bit = 0; bit < len * 8; bit += 13) {
+    enc.buf[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+    TEST_ASSERT_FALSE(track_block_valid(&hdr, enc.buf));
+    enc.buf[bit / 8] ^= (uint8_t)(1u << (bit % 8));
+  }
+  TEST_ASSERT_TRUE(track_block_valid(&hdr, enc.buf));
+
+  track_block_hdr_t torn = hdr;
+  torn.count++;
+  TEST_ASSERT_FALSE(track_block_valid(&torn, enc.buf));
+  torn = hdr;
+  torn.len--;
+  TEST_ASSERT_FALSE(track_block_valid(&torn, enc.buf));
+
+  // Erased flash reads as all ones.
+  track_block_hdr_t erased;
+  memset(&erased, 0xFF, sizeof(erased));
+  TEST_ASSERT_FALSE(track_block_valid(&erased, enc.buf));
+}
+
+static void test_truncated_payload_stops_decoding(void) {
+  const size_t n = make_track();
+  track_encoder_t enc;
+  track_enc_begin(&enc, TRACK_BLOCK_PAYLOAD_MAX, 0, 0);
+  for (size_t i = 0; i < n && track_enc_add(&enc, &s_in[i]); ++i) {
+  }
+  const size_t len = track_enc_finish(&enc);
+  track_decoder_t dec;
+  track_dec_begin(&dec, enc.buf, len / 2, enc.count);
+  track_point_t p;
+  size_t got = 0;
+  while (track_dec_next(&dec, &p)) {
+    assert_quantized(&s_in[got], &p, 1);
+    ++got;
+  }
+  TEST_ASSERT_TRUE(got > 0);
+  TEST_ASSERT_TRUE(got < enc.count);
+}
+
+static void test_sector_header(void) {
+  track_sector_hdr_t sh = {.seq = 42, .t_first = 1750000000};
+  track_sector_hdr_seal(&sh);
+  TEST_ASSERT_TRUE(track_sector_hdr_valid(&sh));
+  sh.seq++;
+  TEST_ASSERT_FALSE(track_sector_hdr_valid(&sh));
+  memset(&sh, 0xFF, sizeof(sh));
+  TEST_ASSERT_FALSE(track_sector_hdr_valid(&sh));
+}
+
+static void test_sector_without_blocks_has_no_data(void) {
+  static uint8_t sector[TRACK_SECTOR_SIZE];
+  memset(sector, 0xFF, sizeof(sector));
+  track_sector_hdr_t sh = {.seq = 7, .t_first = 1750000000};
+  TEST_ASSERT_FALSE(track_sector_has_data(sector, &sh));
+
+  // Power lost after the header was written, before the first block.
+  track_sector_hdr_seal(&sh);
+  memcpy(sector, &sh, sizeof(sh));
+  track_sector_hdr_t got;
+  TEST_ASSERT_FALSE(track_sector_has_data(sector, &got));
+
+  const size_t n = make_track();
+  track_encoder_t enc;
+  track_enc_begin(&enc, TRACK_BLOCK_PAYLOAD_MAX - sizeof(track_sector_hdr_t),
+                  TOL_UDEG, TOL_ALT_M);
+  for (size_t i = 0; i < n && track_enc_add(&enc, &s_in[i]); ++i) {
+  }
+  const size_t len = track_enc_finish(&enc);
+  track_block_hdr_t bh;
+  track_block_hdr_seal(&bh, enc.buf, (uint16_t)len, enc.count);
+  uint8_t *first = sector + track_first_block_offset();
+  memcpy(first, &bh, sizeof(bh));
+  memcpy(first + sizeof(bh), enc.buf, len);
+  TEST_ASSERT_TRUE(track_sector_has_data(sector, &got));
+  TEST_ASSERT_EQUAL_UINT32(sh.seq, got.seq);
+  TEST_ASSERT_EQUAL_UINT32(sh.t_first, got.t_first);
+
+  // A torn first block counts the same as a missing one.
+  first[sizeof(bh)] ^= 0x01;
+  TEST_ASSERT_FALSE(track_sector_has_data(sector, &got));
+}
+
+static void test_unix_time(void) {
+  TEST_ASSERT_EQUAL_UINT32(0, track_unix_time(1970, 1, 1, 0, 0, 0));
+  TEST_ASSERT_EQUAL_UINT32(951782400u, track_unix_time(2000, 2, 29, 0, 0, 0));
+  TEST_ASSERT_EQUAL_UINT32(1760745600u,
+                           track_unix_time(2025, 10, 18, 0, 0, 0));
+  for (uint32_t t = 946684800u; t < 4102444800u; t += 86400u * 13 + 3601) {
+    int y, mo, d, h, mi, s;
+    track_unix_to_civil(t, &y, &mo, &d, &h, &mi, &s);
+    TEST_ASSERT_EQUAL_UINT32(t, track_unix_time(y, mo, d, h, mi, s));
+  }
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_crc32_matches_zlib);
+  RUN_TEST(test_round_trip_keeps_quantized_points);
+  RUN_TEST(test_quantization_rounds_half_away_from_zero);
+  RUN_TEST(test_runs_stay_within_tolerance);
+  RUN_TEST(test_extreme_values);
+  RUN_TEST(test_out_of_order_points_are_dropped);
+  RUN_TEST(test_sector_first_block_capacity);
+  RUN_TEST(test_block_crc_catches_corruption);
+  RUN_TEST(test_truncated_payload_stops_decoding);
+  RUN_TEST(test_sector_header);
+  RUN_TEST(test_sector_without_blocks_has_no_data);
+  RUN_TEST(test_unix_time);
+  return UNITY_END();
+}
@@ -0,0 +1,169 @@
+#include <string.h>
+#include <unity.h>
+
+#include "track_codec.h"
+#include "tz_lookup.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+typedef struct {
+  double lat;
+  double lon;
+  int16_t tz_min;
+  const char *name;
+} place_t;
+
+// Cities on or near a border, each at least a cell away from it. The
+// nearest zone.tab city alone puts every one of these in a zone with
+// another offset; tools/tz_fixes.csv corrects them.
+static const place_t k_borders[] = {
+    {42.29, -85.59, -300, "Kalamazoo"},
+    {41.68, -86.25, -300, "South Bend"},
+    {44.76, -85.62, -300, "Traverse City"},
+    {42.96, -85.67, -300, "Grand Rapids"},
+    {46.54, -87.40, -300, "Marquette"},
+    {45.82, -88.07, -360, "Iron Mountain"},
+    {41.60, -87.35, -360, "Gary"},
+    {39.77, -86.16, -300, "Indianapolis"},
+    {37.97, -87.57, -360, "Evansville"},
+    {36.16, -86.78, -360, "Nashville"},
+    {30.42, -87.22, -360, "Pensacola"},
+    {30.44, -84.28, -300, "Tallahassee"},
+    {37.69, -97.34, -360, "Wichita"},
+    {41.12, -100.77, -360, "North Platte"},
+    {44.08, -103.23, -420, "Rapid City"},
+    {45.78, -108.50, -420, "Billings"},
+    {46.42, -117.02, -480, "Lewiston"},
+    {47.66, -117.43, -480, "Spokane"},
+    {36.07, -110.00, -420, "Navajo Nation"},
+    {35.90, -110.60, -420, "Hopi Reservation"},
+    {64.84, -147.72, -540, "Fairbanks"},
+    {53.87, -166.54, -540, "Unalaska"},
+    {46.81, -71.21, -300, "Quebec City"},
+    {53.92, -122.75, -480, "Prince George"},
+    {49.51, -115.77, -420, "Cranbrook"},
+    {42.24, -8.72, 60, "Vigo"},
+    {41.15, -8.61, 0, "Porto"},
+    {65.58, 22.15, 60, "Lulea"},
+    {60.10, 19.94, 120, "Mariehamn"},
+    {59.93, 30.36, 180, "St Petersburg"},
+    {61.06, 28.19, 120, "Lappeenranta"},
+    {55.79, 49.12, 180, "Kazan"},
+    {61.25, 73.40, 300, "Surgut"},
+    {38.50, 43.38, 180, "Van"},
+    {38.08, 46.29, 210, "Tabriz"},
+    {28.61, 77.21, 330, "Delhi"},
+    {19.08, 72.88, 330, "Mumbai"},
+    {31.55, 74.34, 300, "Lahore"},
+    {27.72, 85.32, 345, "Kathmandu"},
+    {29.65, 91.17, 480, "Lhasa"},
+    {43.83, 87.62, 360, "Urumqi"},
+    {51.17, 71.45, 300, "Astana"},
+    {50.27, 127.53, 540, "Blagoveshchensk"},
+    {48.48, 135.08, 600, "Khabarovsk"},
+    {-23.70, 133.88, 570, "Alice Springs"},
+    {-17.96, 122.24, 480, "Broome"},
+    {-31.63, 128.88, 525, "Eucla"},
+};
+
+static void test_border_cities(void) {
+  const uint32_t jan = track_unix_time(2026, 1, 15, 12, 0, 0);
+  for (size_t i = 0; i < sizeof(k_borders) / sizeof(k_borders[0]); ++i) {
+    const place_t *p = &k_borders[i];
+    tz_info_t tz;
+    TEST_ASSERT_TRUE_MESSAGE(tz_lookup(p->lat, p->lon, jan, &tz), p->name);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(p->tz_min, tz.tz_min, p->name);
+  }
+}
+
+static void test_open_sea_has_no_zone(void) {
+  TEST_ASSERT_EQUAL_INT(-1, tz_lookup_zone(-50.0, -110.0));
+  TEST_ASSERT_EQUAL_INT(-1, tz_lookup_zone(91.0, 0.0));
+}
+
+// DST offset one second before and at a UTC transition.
+static void assert_transition(double lat, double lon, uint32_t utc,
+                              int16_t before, int16_t after) {
+  tz_info_t tz;
+  TEST_ASSERT_TRUE(tz_lookup(lat, lon, utc - 1, &tz));
+  TEST_ASSERT_EQUAL_INT(before, tz.dst_min);
+  TEST_ASSERT_TRUE(tz_lookup(lat, lon, utc, &tz));
+  TEST_ASSERT_EQUAL_INT(after, tz.dst_min);
+}
+
+static void test_dst_europe(void) {
+  const double lat = 52.52, lon = 13.40;  // Berlin
+  assert_transition(lat, lon, track_unix_time(2026, 3, 29, 1, 0, 0), 0, 60);
+  assert_transition(lat, lon, track_unix_time(2026, 10, 25, 1, 0, 0), 60, 0);
+  tz_info_t tz;
+  TEST_ASSERT_TRUE(tz_lookup(lat, lon, track_unix_time(2026, 1, 1, 0, 0, 0),
+                             &tz));
+  TEST_ASSERT_EQUAL_INT(60, tz.tz_min);
+}
+
+static void test_dst_us(void) {
+  const double lat = 42.29, lon = -85.59;  // Kalamazoo
+  assert_transition(lat, lon, track_unix_time(2026, 3, 8, 7, 0, 0), 0, 60);
+  assert_transition(lat, lon, track_unix_time(2026, 11, 1, 6, 0, 0), 60, 0);
+  // Chicago changes an hour later in UTC.
+  assert_transition(41.88, -87.63, track_unix_time(2026, 3, 8, 8, 0, 0), 0,
+                    60);
+}
+
+static void test_dst_southern_hemisphere(void) {
+  const double lat = -33.87, lon = 151.21;  // Sydney
+  assert_transition(lat, lon, track_unix_time(2026, 4, 4, 16, 0, 0), 60, 0);
+  assert_transition(lat, lon, track_unix_time(2026, 10, 3, 16, 0, 0), 0, 60);
+}
+
+static void test_no_dst(void) {
+  // Arizona and Queensland keep standard time all year.
+  tz_info_t tz;
+  TEST_ASSERT_TRUE(tz_lookup(33.45, -112.07,
+                             track_unix_time(2026, 7, 1, 0, 0, 0), &tz));
+  TEST_ASSERT_EQUAL_INT(-420, tz.tz_min);
+  TEST_ASSERT_EQUAL_INT(0, tz.dst_min);
+  TEST_ASSERT_TRUE(tz_lookup(-27.47, 153.03,
+                             track_unix_time(2026, 1, 1, 0, 0, 0), &tz));
+  TEST_ASSERT_EQUAL_INT(600, tz.tz_min);
+  TEST_ASSERT_EQUAL_INT(0, tz.dst_min);
+}
+
+static void test_dublin_summer_total(void) {
+  // Irish winter time is the negative DST; summer is UTC+1 either way.
+  tz_info_t tz;
+  TEST_ASSERT_TRUE(tz_lookup(53.35, -6.26,
+                             track_unix_time(2026, 7, 1, 12, 0, 0), &tz));
+  TEST_ASSERT_EQUAL_INT(60, tz.tz_min + tz.dst_min);
+  TEST_ASSERT_TRUE(tz_lookup(53.35, -6.26,
+                             track_unix_time(2026, 1, 1, 12, 0, 0), &tz));
+  TEST_ASSERT_EQUAL_INT(0, tz.tz_min + tz.dst_min);
+}
+
+static void test_zone_names(void) {
+  TEST_ASSERT_EQUAL_STRING("America/Detroit",
+                           tz_zone_name(tz_lookup_zone(42.33, -83.05)));
+  TEST_ASSERT_EQUAL_STRING("America/Detroit",
+                           tz_zone_name(tz_lookup_zone(42.29, -85.59)));
+  TEST_ASSERT_EQUAL_STRING("America/Menominee",
+                           tz_zone_name(tz_lookup_zone(45.11, -87.61)));
+  TEST_ASSERT_EQUAL_STRING("America/Indiana/Indianapolis",
+                           tz_zone_name(tz_lookup_zone(39.77, -86.16)));
+  TEST_ASSERT_EQUAL_STRING("America/Boise",
+                           tz_zone_name(tz_lookup_zone(43.62, -116.20)));
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_border_cities);
+  RUN_TEST(test_open_sea_has_no_zone);
+  RUN_TEST(test_dst_europe);
+  RUN_TEST(test_dst_us);
+  RUN_TEST(test_dst_southern_hemisphere);
+  RUN_TEST(test_no_dst);
+  RUN_TEST(test_dublin_summer_total);
+  RUN_TEST(test_zone_names);
+  return UNITY_END();
+}
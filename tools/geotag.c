@@ -0,0 +1,938 @@
+// alphaloc-geotag: writes GPS positions from an AlphaLoc track log into the
+// EXIF of JPEG and Sony ARW files, for shots taken while the camera link was
+// down.
+//
+//   cc -O2 -pthread -Iinclude -o alphaloc-geotag tools/geotag.c
+//      src/track_codec.c    (one line)
+//   alphaloc-geotag [options] track.bin photo...
+//
+// track.bin is either /api/track?format=bin or a raw dump of the "track"
+// partition. The log is memory-mapped and decoded once into a time-sorted
+// array; each photo's DateTimeOriginal (camera local time, shifted by the
+// same TZ/DST minutes the firmware sends to the camera) is looked up by
+// binary search. Files are processed in parallel.
+//
+// Only the GPS IFD is written. If the existing one (plus its values) has
+// room, it is overwritten in place; in a TIFF-based ARW the new IFD is
+// appended at the end of the file and the GPSInfo pointer is switched last.
+// A JPEG whose GPS IFD is too small would need its image data moved; that
+// only happens with --grow-jpeg (in place, not crash-safe).
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "track_codec.h"
+
+// Bytes read from the start of each photo; IFD0, the Exif and GPS IFDs of
+// both formats live well inside this.
+#define HEAD_WINDOW (128 * 1024)
+#define SHIFT_CHUNK (1024 * 1024)
+#define PAGES_PER_SECTOR (TRACK_SECTOR_SIZE / TRACK_PAGE_SIZE)
+// Largest GPS IFD this tool writes: 9 entries plus their values.
+#define GPS_IFD_MAX 256
+
+#define TAG_EXIF_IFD 0x8769
+#define TAG_GPS_IFD 0x8825
+#define TAG_DATETIME 0x0132
+#define TAG_DATETIME_ORIGINAL 0x9003
+#define TIFF_BYTE 1
+#define TIFF_ASCII 2
+#define TIFF_SHORT 3
+#define TIFF_LONG 4
+#define TIFF_RATIONAL 5
+
+typedef enum {
+  RES_INPLACE = 0,
+  RES_APPENDED,
+  RES_GROWN,
+  RES_ALREADY,
+  RES_NO_TIME,
+  RES_NO_MATCH,
+  RES_NO_ROOM,
+  RES_UNSUPPORTED,
+  RES_ERROR,
+  RES_COUNT,
+} result_t;
+
+static const char *const k_result_names[RES_COUNT] = {
+    [RES_INPLACE] = "tagged in place",
+    [RES_APPENDED] = "tagged (IFD appended)",
+    [RES_GROWN] = "tagged (JPEG grown)",
+    [RES_ALREADY] = "already tagged",
+    [RES_NO_TIME] = "no DateTimeOriginal",
+    [RES_NO_MATCH] = "no track point in range",
+    [RES_NO_ROOM] = "no room for GPS IFD",
+    [RES_UNSUPPORTED] = "not a JPEG/TIFF or no GPS IFD",
+    [RES_ERROR] = "I/O error",
+};
+
+typedef struct {
+  int threads;
+  int tz_min;
+  int dst_min;
+  uint32_t max_gap_s;
+  bool dry_run;
+  bool force;
+  bool grow_jpeg;
+  bool verbose;
+} options_t;
+
+static options_t s_opt = {.max_gap_s = 60};
+static track_point_t *s_points;
+static size_t s_point_count;
+static char **s_files;
+static size_t s_file_count;
+static atomic_size_t s_next_file;
+static atomic_uint s_results[RES_COUNT];
+
+// ---------------------------------------------------------------------------
+// Track log
+
+static int cmp_sector(const void *a, const void *b) {
+  const track_sector_hdr_t *x = *(const track_sector_hdr_t *const *)a;
+  const track_sector_hdr_t *y = *(const track_sector_hdr_t *const *)b;
+  return x->seq < y->seq ? -1 : x->seq > y->seq;
+}
+
+static int cmp_point(const void *a, const void *b) {
+  const track_point_t *x = a;
+  const track_point_t *y = b;
+  return x->t < y->t ? -1 : x->t > y->t;
+}
+
+// Decodes every intact block, in sector sequence order, into s_points.
+static bool load_track(const char *path) {
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0 || st.st_size < TRACK_SECTOR_SIZE) {
+    fprintf(stderr, "%s: cannot read track log\n", path);
+    return false;
+  }
+  const uint8_t *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    perror("mmap");
+    return false;
+  }
+  const size_t sectors = st.st_size / TRACK_SECTOR_SIZE;
+  const track_sector_hdr_t **order = malloc(sectors * sizeof(*order));
+  size_t valid = 0;
+  for (size_t i = 0; i < sectors; ++i) {
+    const track_sector_hdr_t *h =
+        (const track_sector_hdr_t *)(map + i * TRACK_SECTOR_SIZE);
+    if (track_sector_hdr_valid(h)) {
+      order[valid++] = h;
+    }
+  }
+  qsort(order, valid, sizeof(*order), cmp_sector);
+
+  size_t cap = valid * PAGES_PER_SECTOR * 64 + 1;
+  s_points = malloc(cap * sizeof(*s_points));
+  size_t blocks = 0;
+  for (size_t i = 0; i < valid; ++i) {
+    const uint8_t *sector = (const uint8_t *)order[i];
+    for (int page = 0; page < PAGES_PER_SECTOR; ++page) {
+      const size_t off = page * TRACK_PAGE_SIZE +
+                         (page == 0 ? track_first_block_offset() : 0);
+      const size_t room = TRACK_PAGE_SIZE - (off % TRACK_PAGE_SIZE);
+      track_block_hdr_t bh;
+      memcpy(&bh, sector + off, sizeof(bh));
+      if (bh.len > room - sizeof(bh) ||
+          !track_block_valid(&bh, sector + off + sizeof(bh))) {
+        break;
+      }
+      track_decoder_t dec;
+      track_dec_begin(&dec, sector + off + sizeof(bh), bh.len, bh.count);
+      track_point_t p;
+      while (track_dec_next(&dec, &p)) {
+        if (s_point_count == cap) {
+          cap *= 2;
+          s_points = realloc(s_points, cap * sizeof(*s_points));
+        }
+        s_points[s_point_count++] = p;
+      }
+      blocks++;
+    }
+  }
+  free(order);
+  munmap((void *)map, st.st_size);
+  // The log is in time order unless the receiver's clock jumped; the index
+  // must be sorted either way.
+  qsort(s_points, s_point_count, sizeof(*s_points), cmp_point);
+  fprintf(stderr, "Track: %zu points in %zu blocks from %zu sectors\n",
+          s_point_count, blocks, valid);
+  return true;
+}
+
+// Position at t: interpolated between the neighbouring points if they are
+// at most max_gap_s apart, otherwise the nearer one if it is that close.
+static bool lookup(uint32_t t, track_point_t *out) {
+  size_t lo = 0;
+  size_t hi = s_point_count;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (s_points[mid].t < t) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  const track_point_t *next = lo < s_point_count ? &s_points[lo] : NULL;
+  const track_point_t *prev = lo > 0 ? &s_points[lo - 1] : NULL;
+  if (next && next->t == t) {
+    *out = *next;
+    return true;
+  }
+  if (prev && next && next->t - prev->t <= s_opt.max_gap_s) {
+    const int64_t span = next->t - prev->t;
+    const int64_t k = t - prev->t;
+    out->t = t;
+    out->lat_udeg = (int32_t)(prev->lat_udeg +
+                              (next->lat_udeg - (int64_t)prev->lat_udeg) * k /
+                                  span);
+    out->lon_udeg = (int32_t)(prev->lon_udeg +
+                              (next->lon_udeg - (int64_t)prev->lon_udeg) * k /
+                                  span);
+    out->alt_m =
+        (int32_t)(prev->alt_m + (next->alt_m - (int64_t)prev->alt_m) * k / span);
+    return true;
+  }
+  const uint32_t d_prev = prev ? t - prev->t : UINT32_MAX;
+  const uint32_t d_next = next ? next->t - t : UINT32_MAX;
+  const track_point_t *near = d_prev <= d_next ? prev : next;
+  if (near && (d_prev <= d_next ? d_prev : d_next) <= s_opt.max_gap_s) {
+    *out = *near;
+    return true;
+  }
+  return false;
+}
+
+// ---------------------------------------------------------------------------
+// TIFF/EXIF
+
+typedef struct {
+  uint8_t *buf;  // file head
+  size_t len;    // bytes in buf
+  size_t base;   // file offset of the TIFF header
+  bool le;
+  // A GPS IFD beyond the head (one this tool appended to an ARW), read
+  // separately; ext_off is its TIFF offset.
+  uint8_t *ext;
+  size_t ext_off;
+  size_t ext_len;
+} tiff_t;
+
+// Pointer to [off, off + n) of the TIFF stream, or NULL if neither window
+// holds all of it.
+static const uint8_t *tiff_at(const tiff_t *t, size_t off, size_t n) {
+  if (off + n < off) {
+    return NULL;
+  }
+  if (t->base + off + n <= t->len) {
+    return t->buf + t->base + off;
+  }
+  if (t->ext && off >= t->ext_off && off + n <= t->ext_off + t->ext_len) {
+    return t->ext + (off - t->ext_off);
+  }
+  return NULL;
+}
+
+static bool in_window(const tiff_t *t, size_t off, size_t n) {
+  return tiff_at(t, off, n) != NULL;
+}
+
+static uint16_t rd16(const tiff_t *t, size_t off) {
+  const uint8_t *p = tiff_at(t, off, 2);
+  return t->le ? (uint16_t)(p[0] | p[1] << 8) : (uint16_t)(p[0] << 8 | p[1]);
+}
+
+static uint32_t rd32(const tiff_t *t, size_t off) {
+  const uint8_t *p = tiff_at(t, off, 4);
+  return t->le ? (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+                     (uint32_t)p[3] << 24
+               : (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 |
+                     (uint32_t)p[2] << 8 | (uint32_t)p[3];
+}
+
+static void wr16(bool le, uint8_t *p, uint16_t v) {
+  p[le ? 0 : 1] = (uint8_t)v;
+  p[le ? 1 : 0] = (uint8_t)(v >> 8);
+}
+
+static void wr32(bool le, uint8_t *p, uint32_t v) {
+  for (int i = 0; i < 4; ++i) {
+    p[le ? i : 3 - i] = (uint8_t)(v >> (8 * i));
+  }
+}
+
+static size_t type_size(uint16_t type) {
+  switch (type) {
+    case TIFF_SHORT:
+      return 2;
+    case TIFF_LONG:
+      return 4;
+    case TIFF_RATIONAL:
+      return 8;
+    default:
+      return 1;
+  }
+}
+
+// Offset of the 12-byte entry for tag in the IFD at ifd, or 0.
+static size_t find_entry(const tiff_t *t, size_t ifd, uint16_t tag) {
+  if (!in_window(t, ifd, 2)) {
+    return 0;
+  }
+  const uint16_t n = rd16(t, ifd);
+  if (!in_window(t, ifd + 2, (size_t)n * 12)) {
+    return 0;
+  }
+  for (uint16_t i = 0; i < n; ++i) {
+    const size_t e = ifd + 2 + (size_t)i * 12;
+    if (rd16(t, e) == tag) {
+      return e;
+    }
+  }
+  return 0;
+}
+
+static bool parse_datetime(const tiff_t *t, size_t entry, uint32_t *out) {
+  if (!entry || rd16(t, entry + 2) != TIFF_ASCII || rd32(t, entry + 4) < 19) {
+    return false;
+  }
+  const size_t off = rd32(t, entry + 8);
+  if (!in_window(t, off, 19)) {
+    return false;
+  }
+  int y, mo, d, h, mi, s;
+  char str[20];
+  memcpy(str, tiff_at(t, off, 19), 19);
+  str[19] = '\0';
+  if (sscanf(str, "%4d:%2d:%2d %2d:%2d:%2d", &y, &mo, &d, &h, &mi, &s) != 6 ||
+      y < 1970) {
+    return false;
+  }
+  *out = track_unix_time(y, mo, d, h, mi, s);
+  return true;
+}
+
+// A GPS IFD counts as tagged once it holds a non-zero latitude.
+static bool gps_has_position(const tiff_t *t, size_t gps) {
+  const size_t e = find_entry(t, gps, 0x0002);
+  if (!e || rd16(t, e + 2) != TIFF_RATIONAL || rd32(t, e + 4) != 3) {
+    return false;
+  }
+  const size_t off = rd32(t, e + 8);
+  if (!in_window(t, off, 24)) {
+    return false;
+  }
+  for (int i = 0; i < 3; ++i) {
+    if (rd32(t, off + i * 8) != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+typedef struct {
+  size_t start;
+  size_t end;
+} span_t;
+
+static int cmp_span(const void *a, const void *b) {
+  const span_t *x = a;
+  const span_t *y = b;
+  return x->start < y->start ? -1 : x->start > y->start;
+}
+
+// Bytes from the GPS IFD onward that belong to it alone: the entry table
+// plus the values that follow it without a gap (one pad byte allowed).
+// Anything beyond may be shared, so it is never written.
+static size_t gps_footprint(const tiff_t *t, size_t gps) {
+  const uint16_t n = rd16(t, gps);
+  const size_t table_end = gps + 2 + (size_t)n * 12 + 4;
+  if (!in_window(t, gps, table_end - gps)) {
+    return 0;
+  }
+  span_t spans[64];
+  int count = 0;
+  for (uint16_t i = 0; i < n && count < 64; ++i) {
+    const size_t e = gps + 2 + (size_t)i * 12;
+    const size_t size = type_size(rd16(t, e + 2)) * rd32(t, e + 4);
+    if (size > 4) {
+      spans[count].start = rd32(t, e + 8);
+      spans[count].end = spans[count].start + size;
+      count++;
+    }
+  }
+  qsort(spans, count, sizeof(spans[0]), cmp_span);
+  size_t end = table_end;
+  for (int i = 0; i < count; ++i) {
+    if (spans[i].start < table_end) {
+      continue;  // stored elsewhere, or overlapping the table
+    }
+    if (spans[i].start > end + 1 ||
+        !in_window(t, spans[i].start, spans[i].end - spans[i].start)) {
+      break;
+    }
+    if (spans[i].end > end) {
+      end = spans[i].end;
+    }
+  }
+  return end - gps;
+}
+
+static void put_entry(bool le, uint8_t *e, uint16_t tag, uint16_t type,
+                      uint32_t count, uint32_t value) {
+  wr16(le, e, tag);
+  wr16(le, e + 2, type);
+  wr32(le, e + 4, count);
+  wr32(le, e + 8, value);
+}
+
+static void put_rational(bool le, uint8_t *p, uint32_t num, uint32_t den) {
+  wr32(le, p, num);
+  wr32(le, p + 4, den);
+}
+
+static void put_dms(bool le, uint8_t *p, int32_t udeg) {
+  // Milli-arcseconds: exact for micro-degrees and about 3 cm.
+  const uint64_t mas = (uint64_t)(udeg < 0 ? -(int64_t)udeg : udeg) * 3600 /
+                       1000;
+  put_rational(le, p, (uint32_t)(mas / 3600000), 1);
+  put_rational(le, p + 8, (uint32_t)(mas / 60000 % 60), 1);
+  put_rational(le, p + 16, (uint32_t)(mas % 60000), 1000);
+}
+
+// Serializes a GPS IFD that will sit at TIFF offset at. Returns its size.
+static size_t build_gps_ifd(uint8_t *out, uint32_t at, bool le,
+                            const track_point_t *p) {
+  enum { ENTRIES = 9 };
+  const uint32_t data = at + 2 + ENTRIES * 12 + 4;
+  uint8_t *e = out + 2;
+  uint8_t *v = out + (data - at);
+  memset(out, 0, GPS_IFD_MAX);
+  wr16(le, out, ENTRIES);
+
+  const uint8_t version[4] = {2, 3, 0, 0};
+  put_entry(le, e, 0x0000, TIFF_BYTE, 4, 0);
+  memcpy(e + 8, version, 4);
+  e += 12;
+  put_entry(le, e, 0x0001, TIFF_ASCII, 2, 0);
+  e[8] = p->lat_udeg < 0 ? 'S' : 'N';
+  e += 12;
+  put_entry(le, e, 0x0002, TIFF_RATIONAL, 3, data);
+  put_dms(le, v, p->lat_udeg);
+  e += 12;
+  put_entry(le, e, 0x0003, TIFF_ASCII, 2, 0);
+  e[8] = p->lon_udeg < 0 ? 'W' : 'E';
+  e += 12;
+  put_entry(le, e, 0x0004, TIFF_RATIONAL, 3, data + 24);
+  put_dms(le, v + 24, p->lon_udeg);
+  e += 12;
+  put_entry(le, e, 0x0005, TIFF_BYTE, 1, 0);
+  e[8] = p->alt_m < 0 ? 1 : 0;
+  e += 12;
+  put_entry(le, e, 0x0006, TIFF_RATIONAL, 1, data + 48);
+  put_rational(le, v + 48, (uint32_t)(p->alt_m < 0 ? -p->alt_m : p->alt_m), 1);
+  e += 12;
+  int y, mo, d, h, mi, s;
+  track_unix_to_civil(p->t, &y, &mo, &d, &h, &mi, &s);
+  put_entry(le, e, 0x0007, TIFF_RATIONAL, 3, data + 56);
+  put_rational(le, v + 56, (uint32_t)h, 1);
+  put_rational(le, v + 64, (uint32_t)mi, 1);
+  put_rational(le, v + 72, (uint32_t)s, 1);
+  e += 12;
+  put_entry(le, e, 0x001D, TIFF_ASCII, 11, data + 80);
+  snprintf((char *)v + 80, 12, "%04d:%02d:%02d", y, mo, d);
+  // Next-IFD pointer stays 0.
+  return (data - at) + 91;
+}
+
+static bool write_all(int fd, const void *buf, size_t len, off_t off) {
+  const uint8_t *p = buf;
+  while (len > 0) {
+    const ssize_t n = pwrite(fd, p, len, off);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    len -= (size_t)n;
+    off += n;
+  }
+  return true;
+}
+
+// Moves everything from pos to the end of the file up by extra bytes,
+// back to front so nothing is overwritten before it has been moved.
+static bool shift_tail(int fd, off_t pos, off_t size, size_t extra,
+                       uint8_t *chunk) {
+  if (ftruncate(fd, size + (off_t)extra) != 0) {
+    return false;
+  }
+  off_t end = size;
+  while (end > pos) {
+    const size_t n = end - pos < SHIFT_CHUNK ? (size_t)(end - pos) : SHIFT_CHUNK;
+    end -= (off_t)n;
+    if (pread(fd, chunk, n, end) != (ssize_t)n ||
+        !write_all(fd, chunk, n, end + (off_t)extra)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+typedef struct {
+  uint8_t *head;
+  uint8_t *chunk;
+  uint8_t ext[2 * GPS_IFD_MAX];
+} worker_buf_t;
+
+static result_t tag_file(const char *path, worker_buf_t *wb,
+                         track_point_t *where) {
+  int fd = open(path, s_opt.dry_run ? O_RDONLY : O_RDWR);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    return RES_ERROR;
+  }
+  result_t res = RES_UNSUPPORTED;
+  const ssize_t got = pread(fd, wb->head, HEAD_WINDOW, 0);
+  tiff_t t = {.buf = wb->head, .len = got > 0 ? (size_t)got : 0};
+  size_t app1 = 0;  // JPEG: offset of the APP1 marker
+  if (t.len >= 4 && wb->head[0] == 0xFF && wb->head[1] == 0xD8) {
+    size_t pos = 2;
+    while (pos + 4 <= t.len && wb->head[pos] == 0xFF) {
+      const uint8_t marker = wb->head[pos + 1];
+      const size_t seg = (size_t)wb->head[pos + 2] << 8 | wb->head[pos + 3];
+      if (marker == 0xDA) {
+        break;
+      }
+      if (marker == 0xE1 && pos + 10 <= t.len &&
+          memcmp(wb->head + pos + 4, "Exif\0\0", 6) == 0) {
+        app1 = pos;
+        t.base = pos + 10;
+        break;
+      }
+      pos += 2 + seg;
+    }
+    if (!app1) {
+      goto out;
+    }
+  }
+  if (!in_window(&t, 0, 8)) {
+    goto out;
+  }
+  if (memcmp(t.buf + t.base, "II*\0", 4) == 0) {
+    t.le = true;
+  } else if (memcmp(t.buf + t.base, "MM\0*", 4) != 0) {
+    goto out;
+  }
+
+  const size_t ifd0 = rd32(&t, 4);
+  const size_t exif_e = find_entry(&t, ifd0, TAG_EXIF_IFD);
+  const size_t gps_e = find_entry(&t, ifd0, TAG_GPS_IFD);
+  if (!gps_e) {
+    goto out;
+  }
+  uint32_t local;
+  if (!((exif_e && parse_datetime(&t, find_entry(&t, rd32(&t, exif_e + 8),
+                                                  TAG_DATETIME_ORIGINAL),
+                                  &local)) ||
+        parse_datetime(&t, find_entry(&t, ifd0, TAG_DATETIME), &local))) {
+    res = RES_NO_TIME;
+    goto out;
+  }
+  const size_t gps = rd32(&t, gps_e + 8);
+  if (!in_window(&t, gps, GPS_IFD_MAX)) {
+    const ssize_t n = pread(fd, wb->ext, sizeof(wb->ext), (off_t)(t.base + gps));
+    if (n > 0) {
+      t.ext = wb->ext;
+      t.ext_off = gps;
+      t.ext_len = (size_t)n;
+    }
+  }
+  if (!s_opt.force && in_window(&t, gps, 2) && gps_has_position(&t, gps)) {
+    res = RES_ALREADY;
+    goto out;
+  }
+  // Same meaning as in the location payload: camera time = UTC + TZ + DST.
+  const uint32_t utc = local - (uint32_t)((s_opt.tz_min + s_opt.dst_min) * 60);
+  if (!lookup(utc, where)) {
+    res = RES_NO_MATCH;
+    goto out;
+  }
+
+  uint8_t ifd[GPS_IFD_MAX];
+  const size_t footprint = in_window(&t, gps, 2) ? gps_footprint(&t, gps) : 0;
+  size_t size = build_gps_ifd(ifd, (uint32_t)gps, t.le, where);
+  if (size <= footprint) {
+    // Overwrite the old IFD and its values; the pointer stays.
+    memset(ifd + size, 0, footprint - size);
+    res = RES_INPLACE;
+    if (!s_opt.dry_run &&
+        !write_all(fd, ifd, footprint, (off_t)(t.base + gps))) {
+      res = RES_ERROR;
+    }
+    goto out;
+  }
+  uint8_t ptr[4];
+  if (!app1) {
+    // TIFF/ARW: offsets are file offsets, so the IFD can go at the end.
+    const off_t at = (st.st_size + 1) & ~(off_t)1;
+    if (at > UINT32_MAX - GPS_IFD_MAX) {
+      res = RES_NO_ROOM;
+      goto out;
+    }
+    size = build_gps_ifd(ifd, (uint32_t)at, t.le, where);
+    wr32(t.le, ptr, (uint32_t)at);
+    res = RES_APPENDED;
+    if (!s_opt.dry_run &&
+        (!write_all(fd, ifd, size, at) ||
+         !write_all(fd, ptr, 4, (off_t)(t.base + gps_e + 8)))) {
+      res = RES_ERROR;
+    }
+    goto out;
+  }
+  // JPEG: the IFD goes at the end of the APP1 segment, which has to grow.
+  const size_t seg = (size_t)wb->head[app1 + 2] << 8 | wb->head[app1 + 3];
+  const size_t insert = app1 + 2 + seg;
+  const size_t at = insert - t.base;
+  size = build_gps_ifd(ifd, (uint32_t)at, t.le, where);
+  const size_t extra = (size + 1) & ~(size_t)1;
+  if (!s_opt.grow_jpeg || seg + extra > 0xFFFF) {
+    res = RES_NO_ROOM;
+    goto out;
+  }
+  res = RES_GROWN;
+  if (!s_opt.dry_run) {
+    uint8_t seg_len[2] = {(uint8_t)((seg + extra) >> 8),
+                          (uint8_t)(seg + extra)};
+    wr32(t.le, ptr, (uint32_t)at);
+    if (!shift_tail(fd, (off_t)insert, st.st_size, extra, wb->chunk) ||
+        !write_all(fd, ifd, extra, (off_t)insert) ||
+        !write_all(fd, seg_len, 2, (off_t)(app1 + 2)) ||
+        !write_all(fd, ptr, 4, (off_t)(t.base + gps_e + 8))) {
+      res = RES_ERROR;
+    }
+  }
+out:
+  close(fd);
+  return res;
+}
+
+static void *worker(void *arg) {
+  (void)arg;
+  worker_buf_t wb = {.head = malloc(HEAD_WINDOW)};
+  if (s_opt.grow_jpeg) {
+    wb.chunk = malloc(SHIFT_CHUNK);
+  }
+  size_t i;
+  while ((i = atomic_fetch_add(&s_next_file, 1)) < s_file_count) {
+    track_point_t where = {0};
+    const result_t res = tag_file(s_files[i], &wb, &where);
+    atomic_fetch_add(&s_results[res], 1);
+    if (s_opt.verbose || res == RES_ERROR) {
+      if (res <= RES_GROWN) {
+        printf("%s: %s %.6f %.6f %ldm\n", s_files[i], k_result_names[res],
+               where.lat_udeg / 1e6, where.lon_udeg / 1e6, (long)where.alt_m);
+      } else {
+        printf("%s: %s\n", s_files[i], k_result_names[res]);
+      }
+    }
+  }
+  free(wb.head);
+  free(wb.chunk);
+  return NULL;
+}
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Tags s_files with the given thread count; returns the wall time.
+static double run(int threads) {
+  atomic_store(&s_next_file, 0);
+  for (int i = 0; i < RES_COUNT; ++i) {
+    atomic_store(&s_results[i], 0);
+  }
+  const double start = now_s();
+  pthread_t *tids = malloc(sizeof(*tids) * threads);
+  for (int i = 0; i < threads; ++i) {
+    pthread_create(&tids[i], NULL, worker, NULL);
+  }
+  for (int i = 0; i < threads; ++i) {
+    pthread_join(tids[i], NULL);
+  }
+  free(tids);
+  return now_s() - start;
+}
+
+static void print_summary(double elapsed, int threads) {
+  fprintf(stderr, "%zu files in %.3f s with %d threads (%.0f files/s)\n",
+          s_file_count, elapsed, threads,
+          elapsed > 0 ? s_file_count / elapsed : 0.0);
+  for (int i = 0; i < RES_COUNT; ++i) {
+    const unsigned n = atomic_load(&s_results[i]);
+    if (n) {
+      fprintf(stderr, "  %-28s %u\n", k_result_names[i], n);
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: a synthetic track and synthetic photos, then timed runs.
+
+// Lays out points the way the firmware does, without wrapping.
+static bool write_track_image(const char *path, const track_point_t *pts,
+                              size_t n) {
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    return false;
+  }
+  uint8_t sector[TRACK_SECTOR_SIZE];
+  uint32_t seq = 0;
+  size_t i = 0;
+  while (i < n) {
+    memset(sector, 0xFF, sizeof(sector));
+    track_sector_hdr_t sh = {.seq = ++seq, .t_first = pts[i].t};
+    track_sector_hdr_seal(&sh);
+    memcpy(sector, &sh, sizeof(sh));
+    for (int page = 0; page < PAGES_PER_SECTOR && i < n; ++page) {
+      const size_t off = page * TRACK_PAGE_SIZE +
+                         (page == 0 ? track_first_block_offset() : 0);
+      track_encoder_t enc;
+      track_enc_begin(&enc,
+                      TRACK_PAGE_SIZE - (off % TRACK_PAGE_SIZE) -
+                          sizeof(track_block_hdr_t),
+                      10, 2);
+      while (i < n && track_enc_add(&enc, &pts[i])) {
+        i++;
+      }
+      const size_t len = track_enc_finish(&enc);
+      track_block_hdr_t bh;
+      track_block_hdr_seal(&bh, enc.buf, (uint16_t)len, enc.count);
+      memcpy(sector + off, &bh, sizeof(bh));
+      memcpy(sector + off + sizeof(bh), enc.buf, len);
+    }
+    fwrite(sector, 1, sizeof(sector), f);
+  }
+  return fclose(f) == 0;
+}
+
+// A little-endian TIFF stream: IFD0 -> Exif IFD (DateTimeOriginal) and a
+// GPS IFD. With full_gps the GPS IFD is a zeroed placeholder of the size
+// this tool writes, otherwise it holds GPSVersionID only.
+static size_t synth_tiff(uint8_t *out, uint32_t local, bool full_gps) {
+  memset(out, 0, 512);
+  memcpy(out, "II*\0", 4);
+  wr32(true, out + 4, 8);
+  // IFD0 at 8: 2 entries.
+  wr16(true, out + 8, 2);
+  put_entry(true, out + 10, TAG_EXIF_IFD, TIFF_LONG, 1, 40);
+  put_entry(true, out + 22, TAG_GPS_IFD, TIFF_LONG, 1, 80);
+  // Exif IFD at 40: DateTimeOriginal, value at 60.
+  wr16(true, out + 40, 1);
+  put_entry(true, out + 42, TAG_DATETIME_ORIGINAL, TIFF_ASCII, 20, 60);
+  int y, mo, d, h, mi, s;
+  track_unix_to_civil(local, &y, &mo, &d, &h, &mi, &s);
+  snprintf((char *)out + 60, 20, "%04d:%02d:%02d %02d:%02d:%02d", y, mo, d, h,
+           mi, s);
+  if (full_gps) {
+    const track_point_t zero = {.t = 0};
+    return 80 + build_gps_ifd(out + 80, 80, true, &zero);
+  }
+  wr16(true, out + 80, 1);
+  put_entry(true, out + 82, 0x0000, TIFF_BYTE, 4, 0);
+  out[90] = 2;
+  out[91] = 3;
+  return 80 + 18;
+}
+
+static bool write_photo(const char *path, int kind, uint32_t local,
+                        size_t filler) {
+  uint8_t head[600];
+  size_t len;
+  if (kind == 0) {
+    // ARW-like TIFF.
+    len = synth_tiff(head, local, false);
+  } else {
+    // JPEG: SOI, APP1 Exif, then SOS.
+    head[0] = 0xFF;
+    head[1] = 0xD8;
+    head[2] = 0xFF;
+    head[3] = 0xE1;
+    memcpy(head + 6, "Exif\0\0", 6);
+    const size_t tiff = synth_tiff(head + 12, local, kind == 1);
+    const size_t seg = 2 + 6 + tiff;
+    head[4] = (uint8_t)(seg >> 8);
+    head[5] = (uint8_t)seg;
+    len = 4 + seg;
+    head[len++] = 0xFF;
+    head[len++] = 0xDA;
+  }
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    return false;
+  }
+  fwrite(head, 1, len, f);
+  static uint8_t fill[64 * 1024];
+  while (filler > 0) {
+    const size_t n = filler < sizeof(fill) ? filler : sizeof(fill);
+    fwrite(fill, 1, n, f);
+    filler -= n;
+  }
+  return fclose(f) == 0;
+}
+
+static int bench(const char *dir, size_t files, int threads) {
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+    perror(dir);
+    return 1;
+  }
+  // One photo every 3 s along a 1 Hz track with GNSS-like noise, 10% of it
+  // standing still.
+  const uint32_t t0 = track_unix_time(2026, 6, 1, 8, 0, 0);
+  const size_t n = files * 3 + 120;
+  track_point_t *pts = malloc(n * sizeof(*pts));
+  int32_t lat = 48137000, lon = 11575000;
+  srand(1);
+  for (size_t i = 0; i < n; ++i) {
+    if (i % 600 >= 60) {
+      lat += 9;
+      lon += 13;
+    }
+    pts[i] = (track_point_t){.t = t0 + (uint32_t)i,
+                             .lat_udeg = lat + rand() % 7 - 3,
+                             .lon_udeg = lon + rand() % 7 - 3,
+                             .alt_m = 520 + (int32_t)(i / 600)};
+  }
+  char path[4096];
+  snprintf(path, sizeof(path), "%s/track.bin", dir);
+  if (!write_track_image(path, pts, n)) {
+    perror(path);
+    return 1;
+  }
+  free(pts);
+  if (!load_track(path)) {
+    return 1;
+  }
+
+  s_opt.tz_min = 60;
+  s_opt.dst_min = 60;
+  s_opt.grow_jpeg = true;
+  s_files = malloc(files * sizeof(*s_files));
+  s_file_count = files;
+  const double gen_start = now_s();
+  for (size_t i = 0; i < files; ++i) {
+    // ARW, JPEG with a placeholder GPS IFD, JPEG without room.
+    const int kind = (int)(i % 3);
+    snprintf(path, sizeof(path), "%s/DSC%05zu.%s", dir, i,
+             kind == 0 ? "ARW" : "JPG");
+    const uint32_t local =
+        t0 + 60 + (uint32_t)i * 3 + (uint32_t)(s_opt.tz_min + s_opt.dst_min) * 60;
+    if (!write_photo(path, kind, local, kind == 0 ? 96 * 1024 : 48 * 1024)) {
+      perror(path);
+      return 1;
+    }
+    s_files[i] = strdup(path);
+  }
+  fprintf(stderr, "Generated %zu files in %.2f s\n", files,
+          now_s() - gen_start);
+
+  double t = run(threads);
+  fprintf(stderr, "First pass (writes GPS IFDs):\n");
+  print_summary(t, threads);
+  const unsigned tagged = atomic_load(&s_results[RES_INPLACE]) +
+                          atomic_load(&s_results[RES_APPENDED]) +
+                          atomic_load(&s_results[RES_GROWN]);
+  t = run(threads);
+  fprintf(stderr, "Second pass (parse only, all already tagged):\n");
+  print_summary(t, threads);
+  return tagged == files && atomic_load(&s_results[RES_ALREADY]) == files ? 0
+                                                                          : 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: alphaloc-geotag [options] track.bin photo...\n"
+          "       alphaloc-geotag --bench DIR [-n FILES] [-j THREADS]\n"
+          "  -j N          worker threads (default: online CPUs)\n"
+          "  --tz MIN      camera TZ offset in minutes, as configured\n"
+          "  --dst MIN     camera DST offset in minutes, as configured\n"
+          "  --max-gap S   longest gap to interpolate across (default 60)\n"
+          "  --force       overwrite positions that are already there\n"
+          "  --grow-jpeg   move JPEG image data to make room (not crash-safe)\n"
+          "  --dry-run     report only, write nothing\n"
+          "  -v            one line per file\n");
+}
+
+int main(int argc, char **argv) {
+  s_opt.threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  const char *bench_dir = NULL;
+  size_t bench_files = 10000;
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; ++i) {
+    const char *a = argv[i];
+    const char *next = i + 1 < argc ? argv[i + 1] : NULL;
+    if (strcmp(a, "-j") == 0 && next) {
+      s_opt.threads = atoi(argv[++i]);
+    } else if (strcmp(a, "--tz") == 0 && next) {
+      s_opt.tz_min = (int16_t)atoi(argv[++i]);
+    } else if (strcmp(a, "--dst") == 0 && next) {
+      s_opt.dst_min = (int16_t)atoi(argv[++i]);
+    } else if (strcmp(a, "--max-gap") == 0 && next) {
+      s_opt.max_gap_s = (uint32_t)atoi(argv[++i]);
+    } else if (strcmp(a, "--bench") == 0 && next) {
+      bench_dir = argv[++i];
+    } else if (strcmp(a, "-n") == 0 && next) {
+      bench_files = (size_t)atol(argv[++i]);
+    } else if (strcmp(a, "--force") == 0) {
+      s_opt.force = true;
+    } else if (strcmp(a, "--grow-jpeg") == 0) {
+      s_opt.grow_jpeg = true;
+    } else if (strcmp(a, "--dry-run") == 0) {
+      s_opt.dry_run = true;
+    } else if (strcmp(a, "-v") == 0) {
+      s_opt.verbose = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (s_opt.threads < 1) {
+    s_opt.threads = 1;
+  }
+  if (bench_dir) {
+    return bench(bench_dir, bench_files, s_opt.threads);
+  }
+  if (argc - i < 2) {
+    usage();
+    return 2;
+  }
+  if (!load_track(argv[i])) {
+    return 1;
+  }
+  s_files = argv + i + 1;
+  s_file_count = (size_t)(argc - i - 1);
+  const double elapsed = run(s_opt.threads);
+  print_summary(elapsed, s_opt.threads);
+  return atomic_load(&s_results[RES_ERROR]) ? 1 : 0;
+}
@@ -0,0 +1,244 @@
+// alphaloc-nmea-replay: feeds a receiver capture through the firmware's NMEA
+// parser (src/nmea_parse.c) on the host.
+//
+//   cc -O2 -Iinclude -o alphaloc-nmea-replay tools/nmea_replay.c
+//      src/nmea_parse.c -lm    (one line)
+//   alphaloc-nmea-replay [options] capture...
+//
+// A capture is either /api/nmea/capture (UART reads with arrival times, see
+// nmea_capture.h) or plain NMEA text, e.g. from the TCP port or a receiver
+// log, which is fed without timing. The replay applies sentences the way
+// gps.c does and prints the state at every GGA epoch, so the output of a
+// capture can be kept next to it and diffed after parser changes. By
+// default it runs as fast as possible and reports parser throughput;
+// --realtime keeps the original spacing of the UART reads.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "nmea_capture.h"
+#include "nmea_parse.h"
+
+// Text input is fed in UART-read sized pieces.
+#define TEXT_CHUNK 256
+
+typedef struct {
+  bool realtime;
+  double speed;
+  int repeat;
+  bool quiet;
+} options_t;
+
+typedef struct {
+  // Mirrors the fix/status gps.c keeps.
+  gps_fix_t fix;
+  gps_status_t status;
+  uint32_t t_ms;  // arrival time of the read being parsed
+  FILE *out;
+  uint64_t sentences;
+  uint64_t kinds[4];
+} replay_t;
+
+static options_t s_opt = {.speed = 1.0, .repeat = 1};
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// The same state updates as gps.c's handle_sentence / update_fix /
+// update_time_date, without the mutex and timers.
+static void on_sentence(const char *line, void *ctx) {
+  replay_t *r = ctx;
+  nmea_sentence_t st;
+  nmea_parse(line, &st);
+  r->sentences++;
+  r->kinds[st.kind]++;
+  switch (st.kind) {
+    case NMEA_GGA:
+      if (st.status_ok) {
+        r->status = st.status;
+      }
+      if (r->out) {
+        fprintf(r->out,
+                "%10lu lock=%d sats=%2u fix=%d %.7f %.7f "
+                "%04u-%02u-%02u %02u:%02u:%02u%s\n",
+                (unsigned long)r->t_ms, r->status.has_lock,
+                r->status.satellites, r->fix.valid, r->fix.lat_deg,
+                r->fix.lon_deg, r->fix.year, r->fix.month, r->fix.day,
+                r->fix.hour, r->fix.minute, r->fix.second,
+                r->fix.time_valid ? "" : " (no time)");
+      }
+      break;
+    case NMEA_RMC:
+      if (st.fix_ok) {
+        r->fix.lat_deg = st.fix.lat_deg;
+        r->fix.lon_deg = st.fix.lon_deg;
+        r->fix.valid = true;
+        if (st.fix.time_valid) {
+          r->fix.hour = st.fix.hour;
+          r->fix.minute = st.fix.minute;
+          r->fix.second = st.fix.second;
+          r->fix.time_valid = true;
+        }
+        if (st.fix.year && st.fix.month && st.fix.day) {
+          r->fix.year = st.fix.year;
+          r->fix.month = st.fix.month;
+          r->fix.day = st.fix.day;
+        }
+      } else {
+        r->fix.valid = false;
+      }
+      break;
+    case NMEA_ZDA:
+      if (st.time_ok) {
+        r->fix.hour = st.fix.hour;
+        r->fix.minute = st.fix.minute;
+        r->fix.second = st.fix.second;
+        r->fix.time_valid = true;
+      }
+      if (st.date_ok) {
+        r->fix.year = st.fix.year;
+        r->fix.month = st.fix.month;
+        r->fix.day = st.fix.day;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+static uint8_t *read_file(const char *path, size_t *len) {
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *buf = malloc(size > 0 ? (size_t)size : 1);
+  if (!buf || fread(buf, 1, (size_t)size, f) != (size_t)size) {
+    fclose(f);
+    free(buf);
+    return NULL;
+  }
+  fclose(f);
+  *len = (size_t)size;
+  return buf;
+}
+
+// Feeds one pass over the file. Returns the UART bytes fed.
+static size_t replay(const uint8_t *buf, size_t len, replay_t *r) {
+  nmea_line_t line = {0};
+  size_t fed = 0;
+  if (len >= NMEA_CAPTURE_MAGIC_LEN &&
+      memcmp(buf, NMEA_CAPTURE_MAGIC, NMEA_CAPTURE_MAGIC_LEN) == 0) {
+    size_t pos = NMEA_CAPTURE_MAGIC_LEN;
+    bool first = true;
+    uint32_t t0 = 0;
+    const double start = now_s();
+    while (pos + NMEA_CAPTURE_REC_HDR <= len) {
+      const uint8_t *h = buf + pos;
+      const uint32_t t_ms = (uint32_t)h[0] | (uint32_t)h[1] << 8 |
+                            (uint32_t)h[2] << 16 | (uint32_t)h[3] << 24;
+      const size_t n = (size_t)(h[4] | h[5] << 8);
+      pos += NMEA_CAPTURE_REC_HDR;
+      if (pos + n > len) {
+        fprintf(stderr, "Truncated record at %zu\n", pos);
+        break;
+      }
+      if (first) {
+        t0 = t_ms;
+        first = false;
+      }
+      if (s_opt.realtime) {
+        const double due = start + (t_ms - t0) / 1000.0 / s_opt.speed;
+        const double wait = due - now_s();
+        if (wait > 0) {
+          usleep((useconds_t)(wait * 1e6));
+        }
+      }
+      r->t_ms = t_ms;
+      nmea_line_feed(&line, buf + pos, n, on_sentence, r);
+      fed += n;
+      pos += n;
+    }
+    return fed;
+  }
+  for (size_t pos = 0; pos < len; pos += TEXT_CHUNK) {
+    const size_t n = len - pos < TEXT_CHUNK ? len - pos : TEXT_CHUNK;
+    nmea_line_feed(&line, buf + pos, n, on_sentence, r);
+    fed += n;
+  }
+  return fed;
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: alphaloc-nmea-replay [options] capture...\n"
+          "  --realtime    keep the captured timing\n"
+          "  --speed X     realtime speed factor (default 1)\n"
+          "  --repeat N    parse each capture N times (benchmark)\n"
+          "  -q            no per-epoch output\n");
+}
+
+int main(int argc, char **argv) {
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; ++i) {
+    if (strcmp(argv[i], "--realtime") == 0) {
+      s_opt.realtime = true;
+    } else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+      s_opt.speed = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+      s_opt.repeat = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-q") == 0) {
+      s_opt.quiet = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (i == argc || s_opt.speed <= 0 || s_opt.repeat < 1) {
+    usage();
+    return 2;
+  }
+  int rc = 0;
+  for (; i < argc; ++i) {
+    size_t len;
+    uint8_t *buf = read_file(argv[i], &len);
+    if (!buf) {
+      rc = 1;
+      continue;
+    }
+    replay_t r = {.out = s_opt.quiet ? NULL : stdout};
+    size_t bytes = 0;
+    const double start = now_s();
+    for (int k = 0; k < s_opt.repeat; ++k) {
+      bytes += replay(buf, len, &r);
+      r.out = NULL;  // print the epochs of the first pass only
+    }
+    const double elapsed = now_s() - start;
+    fprintf(stderr,
+            "%s: %llu sentences (GGA %llu, RMC %llu, ZDA %llu, other %llu), "
+            "%zu bytes in %.3f s",
+            argv[i], (unsigned long long)r.sentences,
+            (unsigned long long)r.kinds[NMEA_GGA],
+            (unsigned long long)r.kinds[NMEA_RMC],
+            (unsigned long long)r.kinds[NMEA_ZDA],
+            (unsigned long long)r.kinds[NMEA_OTHER], bytes, elapsed);
+    if (!s_opt.realtime && elapsed > 0) {
+      fprintf(stderr, " (%.0f sentences/s, %.1f MB/s)",
+              r.sentences / elapsed, bytes / elapsed / 1e6);
+    }
+    fputc('\n', stderr);
+    free(buf);
+  }
+  return rc;
+}
@@ -0,0 +1,458 @@
+// alphaloc-trace-decode: turns a trace download (/api/trace, see
+// trace_log.h) back into log lines, using the firmware ELF for the format
+// strings and tags the device only stored the addresses of.
+//
+//   cc -O2 -Iinclude -o alphaloc-trace-decode tools/trace_decode.c
+//   alphaloc-trace-decode [-c] firmware.elf trace.bin
+//
+// firmware.elf is the ELF of the running build (.pio/build/<env>/
+// firmware.elf). The decoder checks it against the build hash in the
+// download and warns on a mismatch, since the addresses would then point
+// at other strings. Records are printed oldest first, "I (12345.678) gps:
+// ..." with milliseconds since boot; a reset inside the ring shows as a
+// separator line.
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace_log.h"
+
+typedef struct {
+  uint64_t addr;
+  uint64_t size;
+  const uint8_t *data;
+} section_t;
+
+typedef struct {
+  section_t *secs;
+  size_t n;
+  const char *version;  // esp_app_desc version, NULL if not found
+} elf_t;
+
+static bool s_show_core;
+
+static uint8_t *read_file(const char *path, size_t *len) {
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  const long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *buf = malloc(size > 0 ? (size_t)size : 1);
+  if (!buf || fread(buf, 1, (size_t)size, f) != (size_t)size) {
+    fclose(f);
+    free(buf);
+    return NULL;
+  }
+  fclose(f);
+  *len = (size_t)size;
+  return buf;
+}
+
+static uint32_t rd32(const uint8_t *p) {
+  return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+         (uint32_t)p[3] << 24;
+}
+
+static uint64_t rd64(const uint8_t *p) {
+  return rd32(p) | (uint64_t)rd32(p + 4) << 32;
+}
+
+static uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+// --- ELF ----------------------------------------------------------------
+
+// Keeps the allocated sections with file contents (code, rodata, data).
+static bool elf_load(const uint8_t *buf, size_t len, elf_t *elf) {
+  if (len < 64 || memcmp(buf, "\x7f" "ELF", 4) != 0 || buf[5] != 1) {
+    fprintf(stderr, "Not a little-endian ELF file\n");
+    return false;
+  }
+  const bool is64 = buf[4] == 2;
+  const uint64_t shoff = is64 ? rd64(buf + 0x28) : rd32(buf + 0x20);
+  const uint16_t shentsize = rd16(buf + (is64 ? 0x3A : 0x2E));
+  const uint16_t shnum = rd16(buf + (is64 ? 0x3C : 0x30));
+  const uint16_t shstrndx = rd16(buf + (is64 ? 0x3E : 0x32));
+  if (shoff == 0 || shoff + (uint64_t)shnum * shentsize > len ||
+      shstrndx >= shnum) {
+    fprintf(stderr, "ELF without section headers\n");
+    return false;
+  }
+  const uint8_t *strh = buf + shoff + (uint64_t)shstrndx * shentsize;
+  const uint64_t stroff = is64 ? rd64(strh + 0x18) : rd32(strh + 0x10);
+  elf->secs = calloc(shnum, sizeof(section_t));
+  elf->n = 0;
+  elf->version = NULL;
+  for (uint16_t i = 0; i < shnum; ++i) {
+    const uint8_t *sh = buf + shoff + (uint64_t)i * shentsize;
+    const uint32_t name = rd32(sh);
+    const uint32_t type = rd32(sh + 4);
+    const uint64_t flags = is64 ? rd64(sh + 8) : rd32(sh + 8);
+    const uint64_t addr = is64 ? rd64(sh + 0x10) : rd32(sh + 0x0C);
+    const uint64_t off = is64 ? rd64(sh + 0x18) : rd32(sh + 0x10);
+    const uint64_t size = is64 ? rd64(sh + 0x20) : rd32(sh + 0x14);
+    // SHT_PROGBITS with SHF_ALLOC.
+    if (type != 1 || !(flags & 2) || addr == 0 || off + size > len) {
+      continue;
+    }
+    elf->secs[elf->n++] =
+        (section_t){.addr = addr, .size = size, .data = buf + off};
+    if (stroff + name < len &&
+        strcmp((const char *)buf + stroff + name, ".flash.appdesc") == 0 &&
+        size >= 48) {
+      // esp_app_desc_t: magic, secure_version, reserv1[2], version[32].
+      elf->version = (const char *)buf + off + 16;
+    }
+  }
+  return true;
+}
+
+// The NUL-terminated string at addr, or NULL.
+static const char *elf_str(const elf_t *elf, uint32_t addr) {
+  for (size_t i = 0; i < elf->n; ++i) {
+    const section_t *s = &elf->secs[i];
+    if (addr >= s->addr && addr < s->addr + s->size) {
+      const size_t off = addr - s->addr;
+      return memchr(s->data + off, '\0', s->size - off)
+                 ? (const char *)s->data + off
+                 : NULL;
+    }
+  }
+  return NULL;
+}
+
+// --- SHA-256, for the build check ---------------------------------------
+
+static const uint32_t k_sha_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+#define ROR(x, n) ((x) >> (n) | (x) << (32 - (n)))
+
+static void sha256_block(uint32_t h[8], const uint8_t *p) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; ++i) {
+    w[i] = (uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16 |
+           (uint32_t)p[4 * i + 2] << 8 | p[4 * i + 3];
+  }
+  for (int i = 16; i < 64; ++i) {
+    const uint32_t s0 = ROR(w[i - 15], 7) ^ ROR(w[i - 15], 18) ^ w[i - 15] >> 3;
+    const uint32_t s1 = ROR(w[i - 2], 17) ^ ROR(w[i - 2], 19) ^ w[i - 2] >> 10;
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5],
+           g = h[6], k = h[7];
+  for (int i = 0; i < 64; ++i) {
+    const uint32_t t1 = k + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) +
+                        ((e & f) ^ (~e & g)) + k_sha_k[i] + w[i];
+    const uint32_t t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) +
+                        ((a & b) ^ (a & c) ^ (b & c));
+    k = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  h[0] += a;
+  h[1] += b;
+  h[2] += c;
+  h[3] += d;
+  h[4] += e;
+  h[5] += f;
+  h[6] += g;
+  h[7] += k;
+}
+
+// Lower-case hex of the SHA-256 of buf, as esp_app_get_elf_sha256 reports
+// it for the ELF the image was made from.
+static void sha256_hex(const uint8_t *buf, size_t len, char out[65]) {
+  uint32_t h[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                   0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  size_t i = 0;
+  for (; i + 64 <= len; i += 64) {
+    sha256_block(h, buf + i);
+  }
+  uint8_t tail[128] = {0};
+  const size_t rest = len - i;
+  memcpy(tail, buf + i, rest);
+  tail[rest] = 0x80;
+  const size_t tail_len = rest < 56 ? 64 : 128;
+  const uint64_t bits = (uint64_t)len * 8;
+  for (int b = 0; b < 8; ++b) {
+    tail[tail_len - 1 - b] = (uint8_t)(bits >> (8 * b));
+  }
+  for (size_t off = 0; off < tail_len; off += 64) {
+    sha256_block(h, tail + off);
+  }
+  for (int b = 0; b < 32; ++b) {
+    snprintf(out + 2 * b, 3, "%02x",
+             (unsigned)(h[b / 4] >> (24 - 8 * (b % 4))) & 0xFF);
+  }
+}
+
+// --- Records ------------------------------------------------------------
+
+typedef struct {
+  const uint32_t *args;
+  size_t n;
+  size_t used;
+  bool short_args;
+} args_t;
+
+static uint32_t next_word(args_t *a) {
+  if (a->used < a->n) {
+    return a->args[a->used++];
+  }
+  a->short_args = true;
+  return 0;
+}
+
+// printf with the arguments as the device stored them: 64-bit integers
+// (ll, j) and floating point take two words, everything else one (int,
+// long, size_t and pointers are 32 bits on the ESP32).
+static void render(FILE *out, const elf_t *elf, const char *fmt, args_t *a) {
+  for (const char *p = fmt; *p; ++p) {
+    if (*p != '%') {
+      fputc(*p, out);
+      continue;
+    }
+    if (p[1] == '%') {
+      fputc('%', out);
+      ++p;
+      continue;
+    }
+    // Rebuild the conversion with the ESP32 sizes mapped to host types.
+    char spec[48] = "%";
+    size_t sl = 1;
+    const char *q = p + 1;
+    while (*q && strchr("-+ #0", *q) && sl < 8) {
+      spec[sl++] = *q++;
+    }
+    for (int part = 0; part < 2; ++part) {
+      if (part == 1) {
+        if (*q != '.') {
+          break;
+        }
+        spec[sl++] = *q++;
+      }
+      if (*q == '*') {
+        sl += (size_t)snprintf(spec + sl, sizeof(spec) - sl, "%d",
+                               (int)(int32_t)next_word(a));
+        ++q;
+      } else {
+        while (*q >= '0' && *q <= '9' && sl < 30) {
+          spec[sl++] = *q++;
+        }
+      }
+    }
+    int longs = 0;
+    while (*q && strchr("hlLjztq", *q)) {
+      if (*q == 'l') {
+        longs++;
+      } else if (*q == 'j' || *q == 'q' || *q == 'L') {
+        longs = 2;
+      } else if (*q == 'h') {
+        spec[sl++] = 'h';
+      }
+      ++q;
+    }
+    const char conv = *q;
+    if (!conv) {
+      break;
+    }
+    p = q;
+    if (strchr("diouxXc", conv)) {
+      if (longs >= 2 && conv != 'c') {
+        const uint64_t v = next_word(a);
+        const uint64_t w = v | (uint64_t)next_word(a) << 32;
+        spec[sl++] = 'l';
+        spec[sl++] = 'l';
+        spec[sl++] = conv;
+        spec[sl] = '\0';
+        if (conv == 'd' || conv == 'i') {
+          fprintf(out, spec, (long long)(int64_t)w);
+        } else {
+          fprintf(out, spec, (unsigned long long)w);
+        }
+      } else {
+        const uint32_t v = next_word(a);
+        spec[sl++] = conv;
+        spec[sl] = '\0';
+        if (conv == 'd' || conv == 'i' || conv == 'c') {
+          fprintf(out, spec, (int)(int32_t)v);
+        } else {
+          fprintf(out, spec, (unsigned)v);
+        }
+      }
+    } else if (strchr("fFeEgGaA", conv)) {
+      const uint64_t lo = next_word(a);
+      const uint64_t bits = lo | (uint64_t)next_word(a) << 32;
+      double d;
+      memcpy(&d, &bits, sizeof(d));
+      spec[sl++] = conv;
+      spec[sl] = '\0';
+      fprintf(out, spec, d);
+    } else if (conv == 's') {
+      const uint32_t addr = next_word(a);
+      const char *s = addr ? elf_str(elf, addr) : "(null)";
+      if (s) {
+        spec[sl++] = 's';
+        spec[sl] = '\0';
+        fprintf(out, spec, s);
+      } else {
+        fprintf(out, "<str@0x%08" PRIx32 ">", addr);
+      }
+    } else if (conv == 'p') {
+      fprintf(out, "0x%08" PRIx32, next_word(a));
+    } else if (conv == 'n') {
+      next_word(a);
+    } else {
+      fputc('%', out);
+      fputc(conv, out);
+    }
+  }
+}
+
+typedef struct {
+  uint64_t records;
+  uint64_t skipped_words;
+  uint64_t unknown;
+} decode_stats_t;
+
+static void decode(const elf_t *elf, const trace_dump_hdr_t *hdr,
+                   const uint32_t *w, FILE *out, decode_stats_t *st) {
+  const uint32_t n = hdr->end - hdr->begin;
+  uint64_t last_t = 0;
+  uint32_t i = 0;
+  while (i < n) {
+    const uint32_t pos = hdr->begin + i;
+    const uint32_t h = w[i];
+    const uint32_t words = h & 0xFF;
+    if (h >> 24 != TRACE_REC_MAGIC ||
+        ((h >> 16) & 0xFF) != ((pos / hdr->ring_words) & 0xFF) ||
+        words < TRACE_REC_HDR_WORDS ||
+        words > TRACE_REC_HDR_WORDS + TRACE_MAX_ARG_WORDS || words > n - i) {
+      // Zeroed, stale or the tail of a record cut by the ring start.
+      st->skipped_words++;
+      ++i;
+      continue;
+    }
+    const uint64_t t = w[i + 1] | (uint64_t)w[i + 2] << 32;
+    const char *fmt = elf_str(elf, w[i + 3]);
+    const char *tag = elf_str(elf, w[i + 4]);
+    if (!fmt) {
+      st->unknown++;
+      st->skipped_words++;
+      ++i;
+      continue;
+    }
+    if (st->records > 0 && t < last_t) {
+      fprintf(out, "--- reset ---\n");
+    }
+    last_t = t;
+    static const char k_levels[] = "?EWIDV";
+    const unsigned level = (h >> 8) & 7;
+    fprintf(out, "%c (%" PRIu64 ".%03u) ", level < 6 ? k_levels[level] : '?',
+            t / 1000, (unsigned)(t % 1000));
+    if (s_show_core) {
+      fprintf(out, "[%u] ", (unsigned)((h >> 11) & 1));
+    }
+    fprintf(out, "%s: ", tag ? tag : "?");
+    args_t a = {.args = w + i + TRACE_REC_HDR_WORDS,
+                .n = words - TRACE_REC_HDR_WORDS};
+    render(out, elf, fmt, &a);
+    if (a.short_args) {
+      fprintf(out, " <args missing>");
+    }
+    fputc('\n', out);
+    st->records++;
+    i += words;
+  }
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: alphaloc-trace-decode [-c] firmware.elf trace.bin\n"
+          "  -c    show the core that wrote each record\n");
+}
+
+int main(int argc, char **argv) {
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; ++i) {
+    if (strcmp(argv[i], "-c") == 0) {
+      s_show_core = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (argc - i != 2) {
+    usage();
+    return 2;
+  }
+  size_t elf_len, dump_len;
+  uint8_t *elf_buf = read_file(argv[i], &elf_len);
+  uint8_t *dump = read_file(argv[i + 1], &dump_len);
+  elf_t elf;
+  if (!elf_buf || !dump || !elf_load(elf_buf, elf_len, &elf)) {
+    return 1;
+  }
+  trace_dump_hdr_t hdr;
+  if (dump_len < sizeof(hdr)) {
+    fprintf(stderr, "%s: too short\n", argv[i + 1]);
+    return 1;
+  }
+  memcpy(&hdr, dump, sizeof(hdr));
+  if (memcmp(hdr.magic, TRACE_DUMP_MAGIC, sizeof(hdr.magic)) != 0 ||
+      hdr.ring_words == 0 ||
+      (uint64_t)(hdr.end - hdr.begin) * 4 > dump_len - sizeof(hdr)) {
+    fprintf(stderr, "%s: not a trace download\n", argv[i + 1]);
+    return 1;
+  }
+  hdr.version[sizeof(hdr.version) - 1] = '\0';
+  hdr.build[sizeof(hdr.build) - 1] = '\0';
+  char sha[65];
+  sha256_hex(elf_buf, elf_len, sha);
+  if (hdr.build[0] && strncmp(sha, hdr.build, strlen(hdr.build)) != 0) {
+    fprintf(stderr,
+            "warning: trace is from build %s (%s), the ELF is %.16s (%s); "
+            "strings will be wrong\n",
+            hdr.build, hdr.version, sha, elf.version ? elf.version : "?");
+  }
+  uint32_t *words = malloc((size_t)(hdr.end - hdr.begin) * 4 + 4);
+  for (uint32_t k = 0; k < hdr.end - hdr.begin; ++k) {
+    words[k] = rd32(dump + sizeof(hdr) + (size_t)k * 4);
+  }
+  decode_stats_t st = {0};
+  decode(&elf, &hdr, words, stdout, &st);
+  fprintf(stderr,
+          "%llu records, %llu words skipped, %llu unknown formats; uptime "
+          "%lu s, %s\n",
+          (unsigned long long)st.records,
+          (unsigned long long)st.skipped_words,
+          (unsigned long long)st.unknown, (unsigned long)hdr.uptime_s,
+          hdr.version);
+  free(words);
+  free(dump);
+  free(elf_buf);
+  free(elf.secs);
+  return 0;
+}
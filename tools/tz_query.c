@@ -0,0 +1,80 @@
+// alphaloc-tz-query: looks positions up in the embedded time zone grid
+// (src/tz_lookup.c with src/tz_data.c) on the host.
+//
+//   cc -O2 -Iinclude -o alphaloc-tz-query tools/tz_query.c src/tz_lookup.c
+//      src/tz_data.c src/track_codec.c    (one line)
+//   alphaloc-tz-query LAT LON [YYYY-MM-DD[THH:MM[:SS]]]
+//   alphaloc-tz-query --bench N
+//
+// Prints the zone and the offsets the camera would be sent at that UTC time
+// (default now), to check borders and DST changes after regenerating the
+// data. --bench times N lookups at random positions.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "track_codec.h"
+#include "tz_data.h"
+#include "tz_lookup.h"
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int bench(long n) {
+  double *pos = malloc(sizeof(double) * 2 * (size_t)n);
+  if (!pos) {
+    return 1;
+  }
+  srand(1);
+  for (long i = 0; i < n; ++i) {
+    pos[2 * i] = rand() / (double)RAND_MAX * 180.0 - 90.0;
+    pos[2 * i + 1] = rand() / (double)RAND_MAX * 360.0 - 180.0;
+  }
+  const uint32_t utc = (uint32_t)time(NULL);
+  long found = 0;
+  const double start = now_s();
+  for (long i = 0; i < n; ++i) {
+    tz_info_t info;
+    found += tz_lookup(pos[2 * i], pos[2 * i + 1], utc, &info);
+  }
+  const double elapsed = now_s() - start;
+  printf("%ld lookups (%ld in a zone) in %.3f s: %.0f ns each\n", n, found,
+         elapsed, elapsed / n * 1e9);
+  free(pos);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 3 && strcmp(argv[1], "--bench") == 0) {
+    return bench(atol(argv[2]));
+  }
+  if (argc < 3 || argc > 4) {
+    fprintf(stderr,
+            "usage: alphaloc-tz-query LAT LON [YYYY-MM-DD[THH:MM[:SS]]]\n"
+            "       alphaloc-tz-query --bench N\n");
+    return 2;
+  }
+  uint32_t utc = (uint32_t)time(NULL);
+  if (argc == 4) {
+    int y, mo, d, h = 0, mi = 0, s = 0;
+    if (sscanf(argv[3], "%d-%d-%dT%d:%d:%d", &y, &mo, &d, &h, &mi, &s) < 3) {
+      fprintf(stderr, "Bad time %s\n", argv[3]);
+      return 2;
+    }
+    utc = track_unix_time(y, mo, d, h, mi, s);
+  }
+  tz_info_t info;
+  if (!tz_lookup(atof(argv[1]), atof(argv[2]), utc, &info)) {
+    printf("no zone\n");
+    return 1;
+  }
+  printf("%s tz=%+d dst=%+d\n", tz_zone_name(info.zone), info.tz_min,
+         info.dst_min);
+  return 0;
+}
@@ -0,0 +1,731 @@
+// alphaloc-tzgen: builds the time zone grid in src/tz_data.c (see tz_data.h).
+//
+//   cc -O2 -Iinclude -o alphaloc-tzgen tools/tzgen.c -lm
+//   alphaloc-tzgen [options] -o src/tz_data.c
+//
+// Zone areas come from one of two sources:
+//
+//  - --polygons FILE: boundary polygons as CSV with a WKT geometry and the
+//    zone name per line, e.g. timezone-boundary-builder's shapefile through
+//      ogr2ogr -f CSV -lco GEOMETRY=AS_WKT -simplify 0.005 tz.csv
+//              combined-shapefile-with-oceans.shp
+//    Each cell gets the zone whose polygon contains its centre.
+//  - Otherwise the zone.tab of the zoneinfo directory: each cell gets the
+//    zone of the nearest listed city within --radius km. This only follows
+//    borders roughly (halfway between cities) and is what ships by default
+//    because it needs nothing but the system tz database.
+//
+// --fixes FILE paints more polygons in the same format over either result,
+// in file order, so a later line wins where two overlap. tools/tz_fixes.csv
+// holds hand-drawn borders for the places where the nearest city is in
+// another zone with another offset (Michigan, India, ...).
+//
+// The rules are the POSIX TZ strings at the end of the zoneinfo files,
+// i.e. the current rules of each zone. A zone whose DST rule is not in the
+// "Mm.w.d/time" form (none in tzdata 2025b) is left out with a warning.
+
+#include <ctype.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tz_data.h"
+
+#define MAX_ZONES 1024
+#define MAX_RULES 256
+#define EARTH_RADIUS_KM 6371.0
+#define PI 3.14159265358979323846
+
+typedef struct {
+  char name[64];
+  double lat, lon;  // city, zone.tab mode only
+  int rule;         // -1 if the rule could not be read
+} zone_t;
+
+typedef struct {
+  double x;  // longitude of an edge crossing
+  int poly;  // line in the file; later lines paint over earlier ones
+  int zone;
+} crossing_t;
+
+typedef struct {
+  crossing_t *v;
+  size_t n, cap;
+} row_t;
+
+static const char *s_zoneinfo = "/usr/share/zoneinfo";
+static int s_cpd = 4;
+static double s_radius_km = 1500.0;
+static zone_t s_zones[MAX_ZONES];
+static int s_zone_count;
+static tz_rule_t s_rules[MAX_RULES];
+static int s_rule_count;
+
+// --- Rules --------------------------------------------------------------
+
+static const char *skip_tz_name(const char *p) {
+  if (*p == '<') {
+    const char *q = strchr(p, '>');
+    return q ? q + 1 : NULL;
+  }
+  const char *start = p;
+  while (isalpha((unsigned char)*p)) {
+    p++;
+  }
+  return p - start >= 3 ? p : NULL;
+}
+
+// [+-]hh[:mm[:ss]] in minutes.
+static const char *parse_hms(const char *p, int *minutes) {
+  int sign = 1;
+  if (*p == '+' || *p == '-') {
+    sign = *p == '-' ? -1 : 1;
+    p++;
+  }
+  if (!isdigit((unsigned char)*p)) {
+    return NULL;
+  }
+  char *end;
+  int total = (int)strtol(p, &end, 10) * 60;
+  p = end;
+  if (*p == ':') {
+    total += (int)strtol(p + 1, &end, 10);
+    p = end;
+    if (*p == ':') {
+      strtol(p + 1, &end, 10);  // seconds, no zone uses them any more
+      p = end;
+    }
+  }
+  *minutes = sign * total;
+  return p;
+}
+
+// ",Mm.w.d[/time]"
+static const char *parse_change(const char *p, uint8_t *month, uint8_t *week,
+                                uint8_t *wday, int16_t *minutes) {
+  int m, w, d, n = 0;
+  if (*p != ',' || p[1] != 'M' ||
+      sscanf(p + 2, "%d.%d.%d%n", &m, &w, &d, &n) != 3 || m < 1 || m > 12 ||
+      w < 1 || w > 5 || d < 0 || d > 6) {
+    return NULL;
+  }
+  p += 2 + n;
+  int t = 120;
+  if (*p == '/') {
+    p = parse_hms(p + 1, &t);
+    if (!p) {
+      return NULL;
+    }
+  }
+  *month = (uint8_t)m;
+  *week = (uint8_t)w;
+  *wday = (uint8_t)d;
+  *minutes = (int16_t)t;
+  return p;
+}
+
+static bool parse_posix_tz(const char *s, tz_rule_t *r) {
+  memset(r, 0, sizeof(*r));
+  int off;
+  const char *p = skip_tz_name(s);
+  if (!p || !(p = parse_hms(p, &off))) {
+    return false;
+  }
+  r->std_min = (int16_t)-off;  // POSIX offsets count west
+  if (*p == '\0') {
+    return true;
+  }
+  if (!(p = skip_tz_name(p))) {
+    return false;
+  }
+  int dst_total = r->std_min + 60;
+  if (*p != ',' && *p != '\0') {
+    if (!(p = parse_hms(p, &off))) {
+      return false;
+    }
+    dst_total = -off;
+  }
+  if (!(p = parse_change(p, &r->start_month, &r->start_week, &r->start_wday,
+                         &r->start_min)) ||
+      !(p = parse_change(p, &r->end_month, &r->end_week, &r->end_wday,
+                         &r->end_min)) ||
+      *p != '\0') {
+    return false;
+  }
+  r->dst_min = (int16_t)(dst_total - r->std_min);
+  if (r->dst_min < 0) {
+    // Europe/Dublin: winter is the "DST". Store it the usual way round, so
+    // the summer offset is standard + dst_min.
+    tz_rule_t n = *r;
+    n.std_min = (int16_t)dst_total;
+    n.dst_min = (int16_t)-r->dst_min;
+    n.start_month = r->end_month;
+    n.start_week = r->end_week;
+    n.start_wday = r->end_wday;
+    n.start_min = r->end_min;
+    n.end_month = r->start_month;
+    n.end_week = r->start_week;
+    n.end_wday = r->start_wday;
+    n.end_min = r->start_min;
+    *r = n;
+  }
+  return true;
+}
+
+// The POSIX TZ string is the last line of a version 2+ TZif file.
+static bool read_zone_rule(const char *name, tz_rule_t *r, char *tz,
+                           size_t tz_len) {
+  char path[512];
+  if (snprintf(path, sizeof(path), "%s/%s", s_zoneinfo, name) >=
+      (int)sizeof(path)) {
+    return false;
+  }
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  const long tail = size < 256 ? size : 256;
+  char buf[257];
+  fseek(f, size - tail, SEEK_SET);
+  const size_t n = fread(buf, 1, (size_t)tail, f);
+  fclose(f);
+  buf[n] = '\0';
+  if (n < 2 || buf[n - 1] != '\n') {
+    return false;
+  }
+  buf[n - 1] = '\0';
+  size_t line = n - 1;
+  while (line > 0 && buf[line - 1] != '\n') {
+    line--;
+  }
+  if (line == 0) {
+    return false;
+  }
+  snprintf(tz, tz_len, "%s", buf + line);
+  return parse_posix_tz(tz, r);
+}
+
+static int add_rule(const tz_rule_t *r) {
+  for (int i = 0; i < s_rule_count; ++i) {
+    if (memcmp(&s_rules[i], r, sizeof(*r)) == 0) {
+      return i;
+    }
+  }
+  if (s_rule_count == MAX_RULES) {
+    fprintf(stderr, "Too many rules\n");
+    exit(1);
+  }
+  s_rules[s_rule_count] = *r;
+  return s_rule_count++;
+}
+
+// Reads the rules of zones [from, s_zone_count).
+static void read_rules(int from) {
+  for (int i = from; i < s_zone_count; ++i) {
+    tz_rule_t r;
+    char tz[128] = "";
+    if (read_zone_rule(s_zones[i].name, &r, tz, sizeof(tz))) {
+      s_zones[i].rule = add_rule(&r);
+    } else {
+      fprintf(stderr, "%s: no usable rule (\"%s\"), left out\n",
+              s_zones[i].name, tz);
+    }
+  }
+}
+
+// --- Zones --------------------------------------------------------------
+
+static int find_zone(const char *name) {
+  for (int i = 0; i < s_zone_count; ++i) {
+    if (strcmp(s_zones[i].name, name) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static int add_zone(const char *name) {
+  const int i = find_zone(name);
+  if (i >= 0) {
+    return i;
+  }
+  if (s_zone_count == MAX_ZONES || strlen(name) >= sizeof(s_zones[0].name)) {
+    fprintf(stderr, "Zone %s: too many zones or name too long\n", name);
+    exit(1);
+  }
+  zone_t *z = &s_zones[s_zone_count];
+  snprintf(z->name, sizeof(z->name), "%s", name);
+  z->rule = -1;
+  return s_zone_count++;
+}
+
+// ISO 6709 +DDMM[SS] / +DDDMM[SS].
+static double parse_iso6709(const char *p, int deg_digits, const char **end) {
+  const double sign = *p == '-' ? -1.0 : 1.0;
+  p++;
+  int digits = 0;
+  int v[3] = {0, 0, 0};  // degrees, minutes, seconds
+  for (; isdigit((unsigned char)p[digits]); ++digits) {
+    const int part = digits < deg_digits ? 0 : 1 + (digits - deg_digits) / 2;
+    if (part < 3) {
+      v[part] = v[part] * 10 + (p[digits] - '0');
+    }
+  }
+  *end = p + digits;
+  return sign * (v[0] + v[1] / 60.0 + v[2] / 3600.0);
+}
+
+static bool load_cities(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') {
+      continue;
+    }
+    char *coord = strchr(line, '\t');
+    char *name = coord ? strchr(coord + 1, '\t') : NULL;
+    if (!name) {
+      continue;
+    }
+    coord++;
+    name++;
+    name[strcspn(name, "\t\n")] = '\0';
+    const char *p;
+    const double lat = parse_iso6709(coord, 2, &p);
+    const double lon = parse_iso6709(p, 3, &p);
+    const int i = add_zone(name);
+    s_zones[i].lat = lat;
+    s_zones[i].lon = lon;
+  }
+  fclose(f);
+  return true;
+}
+
+// --- Grid ---------------------------------------------------------------
+
+static uint16_t *s_grid;
+static int s_rows, s_cols;
+
+static double cell_lat(int row) { return 90.0 - (row + 0.5) / s_cpd; }
+static double cell_lon(int col) { return -180.0 + (col + 0.5) / s_cpd; }
+
+static void fill_nearest_city(void) {
+  double lat_r[MAX_ZONES], lon_r[MAX_ZONES];
+  for (int i = 0; i < s_zone_count; ++i) {
+    lat_r[i] = s_zones[i].lat * PI / 180.0;
+    lon_r[i] = s_zones[i].lon * PI / 180.0;
+  }
+  const double max_r = s_radius_km / EARTH_RADIUS_KM;
+  for (int row = 0; row < s_rows; ++row) {
+    const double lat = cell_lat(row) * PI / 180.0;
+    for (int col = 0; col < s_cols; ++col) {
+      const double lon = cell_lon(col) * PI / 180.0;
+      double best = max_r * max_r;
+      int best_zone = -1;
+      for (int i = 0; i < s_zone_count; ++i) {
+        if (s_zones[i].rule < 0) {
+          continue;
+        }
+        const double dlat = lat - lat_r[i];
+        if (dlat * dlat >= best) {
+          continue;
+        }
+        double dlon = fabs(lon - lon_r[i]);
+        if (dlon > PI) {
+          dlon = 2 * PI - dlon;
+        }
+        // Equirectangular at the mean latitude: plenty for "nearest".
+        const double x = dlon * cos((lat + lat_r[i]) / 2);
+        const double d = dlat * dlat + x * x;
+        if (d < best) {
+          best = d;
+          best_zone = i;
+        }
+      }
+      s_grid[(size_t)row * s_cols + col] =
+          best_zone < 0 ? TZ_ZONE_NONE : (uint16_t)best_zone;
+    }
+  }
+}
+
+static void add_crossing(row_t *rows, int row, double x, int poly,
+                         int zone) {
+  row_t *r = &rows[row];
+  if (r->n == r->cap) {
+    r->cap = r->cap ? r->cap * 2 : 64;
+    r->v = realloc(r->v, r->cap * sizeof(*r->v));
+    if (!r->v) {
+      fprintf(stderr, "Out of memory\n");
+      exit(1);
+    }
+  }
+  r->v[r->n].x = x;
+  r->v[r->n].poly = poly;
+  r->v[r->n].zone = zone;
+  r->n++;
+}
+
+// Crossings of an edge with the rows' centre lines, half-open in latitude
+// so a vertex on a centre line counts once.
+static void add_edge(row_t *rows, double x1, double y1, double x2, double y2,
+                     int poly, int zone) {
+  if (y1 == y2) {
+    return;
+  }
+  const double lo = y1 < y2 ? y1 : y2;
+  const double hi = y1 < y2 ? y2 : y1;
+  int first = (int)ceil((90.0 - hi) * s_cpd - 0.5);
+  if (first < 0) {
+    first = 0;
+  }
+  for (int row = first; row < s_rows; ++row) {
+    const double y = cell_lat(row);
+    if (y < lo) {
+      break;
+    }
+    if (y >= hi) {
+      continue;
+    }
+    add_crossing(rows, row, x1 + (y - y1) * (x2 - x1) / (y2 - y1), poly,
+                 zone);
+  }
+}
+
+static void add_ring(row_t *rows, const double *pts, size_t n, int poly,
+                     int zone) {
+  for (size_t i = 0; i + 1 < n; ++i) {
+    add_edge(rows, pts[2 * i], pts[2 * i + 1], pts[2 * i + 2], pts[2 * i + 3],
+             poly, zone);
+  }
+  if (n > 2) {  // close it if the WKT did not
+    add_edge(rows, pts[2 * n - 2], pts[2 * n - 1], pts[0], pts[1], poly,
+             zone);
+  }
+}
+
+// Rings are the innermost parenthesised lists, so POLYGON and MULTIPOLYGON
+// read the same. Holes come out right with even-odd filling.
+static void add_wkt(row_t *rows, const char *p, int poly, int zone) {
+  static double *pts;
+  static size_t cap;
+  size_t n = 0;
+  bool in_ring = false;
+  while (*p) {
+    if (*p == '(') {
+      in_ring = true;
+      n = 0;
+      p++;
+    } else if (*p == ')') {
+      if (in_ring && n > 0) {
+        add_ring(rows, pts, n, poly, zone);
+      }
+      in_ring = false;
+      n = 0;
+      p++;
+    } else if (in_ring && (isdigit((unsigned char)*p) || *p == '-' ||
+                           *p == '+' || *p == '.')) {
+      char *end;
+      const double x = strtod(p, &end);
+      const double y = strtod(end, &end);
+      if (n == cap) {
+        cap = cap ? cap * 2 : 4096;
+        pts = realloc(pts, cap * 2 * sizeof(*pts));
+        if (!pts) {
+          fprintf(stderr, "Out of memory\n");
+          exit(1);
+        }
+      }
+      pts[2 * n] = x;
+      pts[2 * n + 1] = y;
+      n++;
+      p = end;
+    } else {
+      p++;
+    }
+  }
+}
+
+static int cmp_crossing(const void *a, const void *b) {
+  const crossing_t *x = a, *y = b;
+  if (x->poly != y->poly) {
+    return x->poly < y->poly ? -1 : 1;
+  }
+  return x->x < y->x ? -1 : x->x > y->x;
+}
+
+static bool fill_polygons(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  row_t *rows = calloc((size_t)s_rows, sizeof(*rows));
+  char *line = NULL;
+  size_t line_cap = 0;
+  ssize_t len;
+  int polygons = 0;
+  while ((len = getline(&line, &line_cap, f)) > 0) {
+    // "WKT",name: the name is after the last comma.
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+      line[--len] = '\0';
+    }
+    char *comma = strrchr(line, ',');
+    if (!comma || !strstr(line, "POLYGON")) {
+      continue;  // header
+    }
+    *comma = '\0';
+    char *name = comma + 1;
+    if (*name == '"') {
+      name++;
+      name[strcspn(name, "\"")] = '\0';
+    }
+    add_wkt(rows, line, polygons, add_zone(name));
+    polygons++;
+  }
+  free(line);
+  fclose(f);
+  fprintf(stderr, "%s: %d polygons\n", path, polygons);
+
+  for (int row = 0; row < s_rows; ++row) {
+    row_t *r = &rows[row];
+    qsort(r->v, r->n, sizeof(*r->v), cmp_crossing);
+    for (size_t i = 0; i + 1 < r->n; i += 2) {
+      if (r->v[i].poly != r->v[i + 1].poly) {
+        i--;  // odd count for a line, a broken ring: skip its last crossing
+        continue;
+      }
+      // Cells whose centre lies in [x_a, x_b).
+      int c0 = (int)ceil((r->v[i].x + 180.0) * s_cpd - 0.5);
+      int c1 = (int)ceil((r->v[i + 1].x + 180.0) * s_cpd - 0.5);
+      if (c0 < 0) {
+        c0 = 0;
+      }
+      if (c1 > s_cols) {
+        c1 = s_cols;
+      }
+      for (int c = c0; c < c1; ++c) {
+        s_grid[(size_t)row * s_cols + c] = (uint16_t)r->v[i].zone;
+      }
+    }
+    free(r->v);
+  }
+  free(rows);
+  return true;
+}
+
+// --- Output -------------------------------------------------------------
+
+static int cmp_zone_name(const void *a, const void *b) {
+  return strcmp(((const zone_t *)a)->name, ((const zone_t *)b)->name);
+}
+
+static void read_version(char *out, size_t len) {
+  char path[512];
+  snprintf(path, sizeof(path), "%s/tzdata.zi", s_zoneinfo);
+  snprintf(out, len, "unknown");
+  FILE *f = fopen(path, "r");
+  if (f) {
+    char line[128];
+    if (fgets(line, sizeof(line), f)) {
+      sscanf(line, "# version %31s", out);
+    }
+    fclose(f);
+  }
+}
+
+static bool write_output(const char *path, const char *source) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  fprintf(f,
+          "// Generated by tools/tzgen.c, do not edit. Source: %s.\n\n"
+          "#include \"tz_data.h\"\n\n"
+          "#ifndef ALPHALOC_TZ_LOOKUP\n"
+          "#define ALPHALOC_TZ_LOOKUP 1\n"
+          "#endif\n\n"
+          "#if ALPHALOC_TZ_LOOKUP\n\n",
+          source);
+  fprintf(f,
+          "const tz_grid_t tz_grid = {%d, %d, %d, %d,\n"
+          "                           \"%s\"};\n\n",
+          s_cpd, s_rows, s_cols, s_zone_count, source);
+
+  fprintf(f, "const tz_rule_t tz_rules[] = {\n");
+  for (int i = 0; i < s_rule_count; ++i) {
+    const tz_rule_t *r = &s_rules[i];
+    fprintf(f, "    {%d, %d, %u, %u, %u, %u, %u, %u, %d, %d},\n", r->std_min,
+            r->dst_min, r->start_month, r->start_week, r->start_wday,
+            r->end_month, r->end_week, r->end_wday, r->start_min, r->end_min);
+  }
+  fprintf(f, "};\n\nconst tz_zone_t tz_zones[] = {\n");
+  for (int i = 0; i < s_zone_count; ++i) {
+    fprintf(f, "    {\"%s\", %d},\n", s_zones[i].name, s_zones[i].rule);
+  }
+
+  fprintf(f, "};\n\nconst uint32_t tz_row_start[] = {");
+  uint32_t runs = 0;
+  for (int row = 0; row <= s_rows; ++row) {
+    fprintf(f, "%s%lu,", row % 8 ? " " : "\n    ", (unsigned long)runs);
+    if (row == s_rows) {
+      break;
+    }
+    const uint16_t *g = &s_grid[(size_t)row * s_cols];
+    for (int c = 0; c < s_cols; ++c) {
+      runs += c == 0 || g[c] != g[c - 1];
+    }
+  }
+  fprintf(f, "\n};\n\nconst tz_run_t tz_runs[] = {");
+  int k = 0;
+  for (int row = 0; row < s_rows; ++row) {
+    const uint16_t *g = &s_grid[(size_t)row * s_cols];
+    for (int c = 0; c < s_cols; ++c) {
+      if (c == 0 || g[c] != g[c - 1]) {
+        fprintf(f, "%s{%d, %u},", k++ % 6 ? " " : "\n    ", c, g[c]);
+      }
+    }
+  }
+  fprintf(f, "\n};\n\n#endif\n");
+  fclose(f);
+
+  size_t names = 0;
+  for (int i = 0; i < s_zone_count; ++i) {
+    names += strlen(s_zones[i].name) + 1;
+  }
+  fprintf(stderr,
+          "%d zones, %d rules, %lu runs: about %zu bytes of flash\n",
+          s_zone_count, s_rule_count, (unsigned long)runs,
+          runs * sizeof(tz_run_t) + (size_t)(s_rows + 1) * 4 +
+              (size_t)s_zone_count * sizeof(tz_zone_t) + names +
+              (size_t)s_rule_count * sizeof(tz_rule_t));
+  return true;
+}
+
+static const char *base_name(const char *path) {
+  const char *slash = strrchr(path, '/');
+  return slash ? slash + 1 : path;
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: alphaloc-tzgen [options] -o tz_data.c\n"
+          "  --zoneinfo DIR   tz database (default /usr/share/zoneinfo)\n"
+          "  --polygons FILE  zone polygons, CSV of WKT,name\n"
+          "  --fixes FILE     polygons painted over the result, same format\n"
+          "  --radius KM      zone.tab mode: city reach (default 1500)\n"
+          "  --res N          cells per degree (default 4)\n");
+}
+
+int main(int argc, char **argv) {
+  const char *polygons = NULL;
+  const char *fixes = NULL;
+  const char *out = NULL;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--zoneinfo") == 0 && i + 1 < argc) {
+      s_zoneinfo = argv[++i];
+    } else if (strcmp(argv[i], "--polygons") == 0 && i + 1 < argc) {
+      polygons = argv[++i];
+    } else if (strcmp(argv[i], "--fixes") == 0 && i + 1 < argc) {
+      fixes = argv[++i];
+    } else if (strcmp(argv[i], "--radius") == 0 && i + 1 < argc) {
+      s_radius_km = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--res") == 0 && i + 1 < argc) {
+      s_cpd = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      out = argv[++i];
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  // Columns must fit the uint16_t run start.
+  if (!out || s_cpd < 1 || s_cpd > 100) {
+    usage();
+    return 2;
+  }
+  s_rows = 180 * s_cpd;
+  s_cols = 360 * s_cpd;
+
+  char version[32];
+  read_version(version, sizeof(version));
+  char areas[160];
+  if (polygons) {
+    snprintf(areas, sizeof(areas), "%s", base_name(polygons));
+  } else {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/zone.tab", s_zoneinfo);
+    if (!load_cities(path)) {
+      return 1;
+    }
+    snprintf(areas, sizeof(areas), "zone.tab nearest city within %.0f km",
+             s_radius_km);
+  }
+  char source[256];
+  snprintf(source, sizeof(source), "%s%s%s, tzdata %s, %d cells/deg", areas,
+           fixes ? " + " : "", fixes ? base_name(fixes) : "", version, s_cpd);
+
+  s_grid = malloc((size_t)s_rows * s_cols * sizeof(*s_grid));
+  if (!s_grid) {
+    fprintf(stderr, "Out of memory\n");
+    return 1;
+  }
+  for (size_t i = 0; i < (size_t)s_rows * s_cols; ++i) {
+    s_grid[i] = TZ_ZONE_NONE;
+  }
+  if (polygons && !fill_polygons(polygons)) {
+    return 1;
+  }
+
+  // Rules, then the zones in name order with the cells remapped (polygon
+  // zones are numbered in file order).
+  read_rules(0);
+  if (!polygons) {
+    fill_nearest_city();
+  }
+  if (fixes) {
+    const int before = s_zone_count;
+    if (!fill_polygons(fixes)) {
+      return 1;
+    }
+    read_rules(before);
+  }
+  zone_t *sorted = malloc(sizeof(zone_t) * (size_t)s_zone_count);
+  memcpy(sorted, s_zones, sizeof(zone_t) * (size_t)s_zone_count);
+  qsort(sorted, (size_t)s_zone_count, sizeof(zone_t), cmp_zone_name);
+  uint16_t remap[MAX_ZONES];
+  int kept = 0;
+  for (int i = 0; i < s_zone_count; ++i) {
+    if (sorted[i].rule >= 0) {
+      sorted[kept++] = sorted[i];
+    }
+  }
+  for (int i = 0; i < s_zone_count; ++i) {
+    remap[i] = TZ_ZONE_NONE;
+    for (int j = 0; j < kept; ++j) {
+      if (strcmp(s_zones[i].name, sorted[j].name) == 0) {
+        remap[i] = (uint16_t)j;
+        break;
+      }
+    }
+  }
+  for (size_t i = 0; i < (size_t)s_rows * s_cols; ++i) {
+    if (s_grid[i] != TZ_ZONE_NONE) {
+      s_grid[i] = remap[s_grid[i]];
+    }
+  }
+  memcpy(s_zones, sorted, sizeof(zone_t) * (size_t)kept);
+  s_zone_count = kept;
+  free(sorted);
+
+  return write_output(out, source) ? 0 : 1;
+}